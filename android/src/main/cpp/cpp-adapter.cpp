@@ -0,0 +1,16 @@
+#include <jni.h>
+#include <jsi/jsi.h>
+
+#include "TemporalJSI.h"
+
+/**
+ * JNI function for `com.temporal.TemporalJSI.nativeInstall()`.
+ * Called on the JavaScript thread with the runtime owned by React Native.
+ */
+extern "C" JNIEXPORT void JNICALL
+Java_com_temporal_TemporalJSI_nativeInstall(JNIEnv *, jclass, jlong runtimePtr) {
+  auto *runtime = reinterpret_cast<facebook::jsi::Runtime *>(runtimePtr);
+  if (runtime != nullptr) {
+    temporal::install(*runtime);
+  }
+}
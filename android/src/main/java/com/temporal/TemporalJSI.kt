@@ -0,0 +1,19 @@
+package com.temporal
+
+/**
+ * Loader for the shared C++ JSI bindings (cpp/TemporalJSI.cpp).
+ */
+object TemporalJSI {
+    init {
+        System.loadLibrary("temporal_rn")
+        System.loadLibrary("temporal-jsi")
+    }
+
+    /**
+     * Installs `global.__TemporalJSI` into the given jsi::Runtime.
+     * Must be called on that runtime's JavaScript thread. Worklet and worker
+     * runtimes can be passed too; a runtime that has the bindings is left as is.
+     */
+    @JvmStatic
+    external fun nativeInstall(runtimePtr: Long)
+}
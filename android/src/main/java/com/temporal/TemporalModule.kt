@@ -1,9 +1,14 @@
 package com.temporal
 
+import com.facebook.react.bridge.Promise
 import com.facebook.react.bridge.ReactApplicationContext
+import com.facebook.react.bridge.ReadableArray
 import com.facebook.react.bridge.WritableArray
 import com.facebook.react.bridge.WritableNativeArray
 import com.facebook.react.module.annotations.ReactModule
+import java.util.concurrent.ExecutorService
+import java.util.concurrent.Executors
+import java.util.concurrent.RejectedExecutionException
 
 /**
  * Custom exception for Temporal RangeError (matches TC39 Temporal spec)
@@ -19,14 +24,40 @@ class TemporalTypeError(message: String) : Exception(message)
 class TemporalModule(reactContext: ReactApplicationContext) :
   NativeTemporalSpec(reactContext) {
 
+  // Worker pool for the async API, sized for background work so it never
+  // competes with the UI thread for every core. Created on first use so
+  // apps that never call the async API don't pay for it at startup.
+  private val workersDelegate = lazy<ExecutorService> {
+    Executors.newFixedThreadPool(
+      Runtime.getRuntime().availableProcessors().coerceIn(1, 4)
+    )
+  }
+  private val workers: ExecutorService by workersDelegate
+
   override fun getName(): String {
     return NAME
   }
 
+  override fun invalidate() {
+    super.invalidate()
+    if (workersDelegate.isInitialized()) {
+      workers.shutdown()
+    }
+  }
+
   override fun multiply(a: Double, b: Double): Double {
     return a * b
   }
 
+  override fun install(): Boolean {
+    val runtimePtr = reactApplicationContext.javaScriptContextHolder?.get() ?: 0L
+    if (runtimePtr == 0L) {
+      return false
+    }
+    TemporalJSI.nativeInstall(runtimePtr)
+    return true
+  }
+
   override fun instantNow(): String {
     return TemporalNative.instantNow()
   }
@@ -419,6 +450,141 @@ class TemporalModule(reactContext: ReactApplicationContext) :
     return TemporalNative.timeZoneGetPreviousTransition(tzId, instantStr)
   }
 
+  override fun validate(kind: Double, s: String): Double {
+    return TemporalNative.validate(kind.toInt(), s).toDouble()
+  }
+
+  override fun lastErrorMessage(): String? {
+    return TemporalNative.lastErrorMessage()
+  }
+
+  override fun getStats(): String {
+    return TemporalNative.getStats()
+  }
+
+  override fun resetStats() {
+    TemporalNative.resetStats()
+  }
+
+  override fun zonedDateTimeToBytes(s: String): WritableArray {
+    val result = WritableNativeArray()
+    for (byte in TemporalNative.zonedDateTimeToBytes(s)) {
+      result.pushInt(byte.toInt() and 0xFF)
+    }
+    return result
+  }
+
+  override fun zonedDateTimeFromBytes(bytes: ReadableArray): String {
+    val record = ByteArray(bytes.size()) { i ->
+      val value = bytes.getDouble(i)
+      if (value < 0 || value > 255 || value != Math.floor(value)) {
+        throw TemporalRangeError("[RangeError] Byte $i must be an integer in [0, 255]")
+      }
+      value.toInt().toByte()
+    }
+    return TemporalNative.zonedDateTimeFromBytes(record)
+  }
+
+  override fun instantToStringWithOptions(s: String, fractionalSecondDigits: Double, smallestUnit: String?, roundingMode: String?): String {
+    return TemporalNative.instantToStringWithOptions(s, fractionalSecondDigits.toInt(), smallestUnit, roundingMode)
+  }
+
+  override fun plainTimeToStringWithOptions(s: String, fractionalSecondDigits: Double, smallestUnit: String?, roundingMode: String?): String {
+    return TemporalNative.plainTimeToStringWithOptions(s, fractionalSecondDigits.toInt(), smallestUnit, roundingMode)
+  }
+
+  override fun plainDateTimeToStringWithOptions(s: String, fractionalSecondDigits: Double, smallestUnit: String?, roundingMode: String?, calendarName: String?): String {
+    return TemporalNative.plainDateTimeToStringWithOptions(s, fractionalSecondDigits.toInt(), smallestUnit, roundingMode, calendarName)
+  }
+
+  override fun zonedDateTimeToStringWithOptions(s: String, fractionalSecondDigits: Double, smallestUnit: String?, roundingMode: String?, calendarName: String?, timeZoneName: String?, offset: String?): String {
+    return TemporalNative.zonedDateTimeToStringWithOptions(s, fractionalSecondDigits.toInt(), smallestUnit, roundingMode, calendarName, timeZoneName, offset)
+  }
+
+  override fun toStringOptionsNew(fractionalSecondDigits: Double, smallestUnit: String?, roundingMode: String?, calendarName: String?, timeZoneName: String?, offset: String?): Double {
+    return TemporalNative.toStringOptionsNew(fractionalSecondDigits.toInt(), smallestUnit, roundingMode, calendarName, timeZoneName, offset).toDouble()
+  }
+
+  override fun instantToStringWithPackedOptions(s: String, options: Double): String {
+    return TemporalNative.instantToStringWithPackedOptions(s, options.toLong())
+  }
+
+  override fun plainTimeToStringWithPackedOptions(s: String, options: Double): String {
+    return TemporalNative.plainTimeToStringWithPackedOptions(s, options.toLong())
+  }
+
+  override fun plainDateTimeToStringWithPackedOptions(s: String, options: Double): String {
+    return TemporalNative.plainDateTimeToStringWithPackedOptions(s, options.toLong())
+  }
+
+  override fun zonedDateTimeToStringWithPackedOptions(s: String, options: Double): String {
+    return TemporalNative.zonedDateTimeToStringWithPackedOptions(s, options.toLong())
+  }
+
+  override fun roundingOptionsNew(largestUnit: String?, smallestUnit: String?, roundingIncrement: Double, roundingMode: String?): Double {
+    return TemporalNative.roundingOptionsNew(largestUnit, smallestUnit, roundingIncrement.toLong(), roundingMode).toDouble()
+  }
+
+  override fun instantUntilEpochNanosecondsWithOptions(
+    oneSeconds: Double, oneNanoseconds: Double,
+    twoSeconds: Double, twoNanoseconds: Double,
+    options: Double
+  ): String {
+    return TemporalNative.instantUntilEpochNanosecondsWithOptions(
+      oneSeconds.toLong(), oneNanoseconds.toInt(), twoSeconds.toLong(), twoNanoseconds.toInt(), options.toLong()
+    )
+  }
+
+  override fun instantSinceEpochNanosecondsWithOptions(
+    oneSeconds: Double, oneNanoseconds: Double,
+    twoSeconds: Double, twoNanoseconds: Double,
+    options: Double
+  ): String {
+    return TemporalNative.instantSinceEpochNanosecondsWithOptions(
+      oneSeconds.toLong(), oneNanoseconds.toInt(), twoSeconds.toLong(), twoNanoseconds.toInt(), options.toLong()
+    )
+  }
+
+  override fun instantRoundEpochNanosecondsWithOptions(seconds: Double, nanoseconds: Double, options: Double): WritableArray {
+    return toWritableArray(TemporalNative.instantRoundEpochNanosecondsWithOptions(seconds.toLong(), nanoseconds.toInt(), options.toLong()))
+  }
+
+  override fun plainTimeUntilWithOptions(one: String, two: String, options: Double): String {
+    return TemporalNative.plainTimeUntilWithOptions(one, two, options.toLong())
+  }
+
+  override fun plainTimeSinceWithOptions(one: String, two: String, options: Double): String {
+    return TemporalNative.plainTimeSinceWithOptions(one, two, options.toLong())
+  }
+
+  override fun plainTimeRoundWithOptions(time: String, options: Double): String {
+    return TemporalNative.plainTimeRoundWithOptions(time, options.toLong())
+  }
+
+  override fun zonedDateTimeRoundWithOptions(s: String, options: Double): String {
+    return TemporalNative.zonedDateTimeRoundWithOptions(s, options.toLong())
+  }
+
+  override fun zonedDateTimeHandleRoundWithOptions(handle: Double, options: Double): Double {
+    return fromHandle(TemporalNative.zonedDateTimeHandleRoundWithOptions(toHandle(handle), options.toLong()))
+  }
+
+  override fun timeZoneCacheStats(): WritableArray {
+    return toWritableArray(TemporalNative.timeZoneCacheStats())
+  }
+
+  override fun timeZoneCacheClear() {
+    TemporalNative.timeZoneCacheClear()
+  }
+
+  override fun setBatchThreads(threads: Double) {
+    TemporalNative.setBatchThreads(threads.toInt())
+  }
+
+  override fun getBatchThreads(): Double {
+    return TemporalNative.getBatchThreads().toDouble()
+  }
+
   // ZonedDateTime methods
 
   override fun zonedDateTimeFromString(s: String): String {
@@ -626,6 +792,352 @@ class TemporalModule(reactContext: ReactApplicationContext) :
     )
   }
 
+  // Handle API
+  //
+  // Handles cross the bridge as doubles holding the pointer's raw bits. Android
+  // tags heap pointers in the top byte, so a numeric conversion would lose
+  // precision; a bit cast round-trips exactly.
+
+  private fun toHandle(handle: Double): Long = java.lang.Double.doubleToRawLongBits(handle)
+
+  private fun fromHandle(handle: Long): Double = java.lang.Double.longBitsToDouble(handle)
+
+  private fun toWritableArray(components: LongArray): WritableArray {
+    val result = WritableNativeArray()
+    for (value in components) {
+      result.pushDouble(value.toDouble())
+    }
+    return result
+  }
+
+  private fun toWritableArray(values: IntArray): WritableArray {
+    val result = WritableNativeArray()
+    for (value in values) {
+      result.pushInt(value)
+    }
+    return result
+  }
+
+  private fun toStringArray(values: ReadableArray): Array<String> {
+    return Array(values.size()) { i ->
+      values.getString(i) ?: throw TemporalTypeError("[TypeError] Array element $i must be a string")
+    }
+  }
+
+  override fun handleRelease(handle: Double) {
+    TemporalNative.handleRelease(toHandle(handle))
+  }
+
+  override fun handleToString(handle: Double): String {
+    return TemporalNative.handleToString(toHandle(handle))
+  }
+
+  override fun handleCompare(a: Double, b: Double): Double {
+    return TemporalNative.handleCompare(toHandle(a), toHandle(b)).toDouble()
+  }
+
+  override fun instantHandleFromString(s: String): Double {
+    return fromHandle(TemporalNative.instantHandleFromString(s))
+  }
+
+  override fun plainDateTimeHandleFromString(s: String): Double {
+    return fromHandle(TemporalNative.plainDateTimeHandleFromString(s))
+  }
+
+  override fun zonedDateTimeHandleFromString(s: String): Double {
+    return fromHandle(TemporalNative.zonedDateTimeHandleFromString(s))
+  }
+
+  override fun durationHandleFromString(s: String): Double {
+    return fromHandle(TemporalNative.durationHandleFromString(s))
+  }
+
+  override fun instantHandleAdd(handle: Double, duration: Double): Double {
+    return fromHandle(TemporalNative.instantHandleAdd(toHandle(handle), toHandle(duration)))
+  }
+
+  override fun instantHandleSubtract(handle: Double, duration: Double): Double {
+    return fromHandle(TemporalNative.instantHandleSubtract(toHandle(handle), toHandle(duration)))
+  }
+
+  override fun instantHandleRound(handle: Double, smallestUnit: String, roundingIncrement: Double, roundingMode: String?): Double {
+    return fromHandle(TemporalNative.instantHandleRound(toHandle(handle), smallestUnit, roundingIncrement.toLong(), roundingMode))
+  }
+
+  override fun plainDateTimeHandleAdd(handle: Double, duration: Double): Double {
+    return fromHandle(TemporalNative.plainDateTimeHandleAdd(toHandle(handle), toHandle(duration)))
+  }
+
+  override fun plainDateTimeHandleSubtract(handle: Double, duration: Double): Double {
+    return fromHandle(TemporalNative.plainDateTimeHandleSubtract(toHandle(handle), toHandle(duration)))
+  }
+
+  override fun plainDateTimeHandleWith(
+    handle: Double,
+    year: Double, month: Double, day: Double,
+    hour: Double, minute: Double, second: Double,
+    millisecond: Double, microsecond: Double, nanosecond: Double,
+    calendarId: String?
+  ): Double {
+    return fromHandle(TemporalNative.plainDateTimeHandleWith(
+      toHandle(handle),
+      year.toInt(), month.toInt(), day.toInt(),
+      hour.toInt(), minute.toInt(), second.toInt(),
+      millisecond.toInt(), microsecond.toInt(), nanosecond.toInt(),
+      calendarId
+    ))
+  }
+
+  override fun plainDateTimeHandleGetAllComponents(handle: Double): WritableArray {
+    return toWritableArray(TemporalNative.plainDateTimeHandleGetAllComponents(toHandle(handle)))
+  }
+
+  override fun zonedDateTimeHandleAdd(handle: Double, duration: Double): Double {
+    return fromHandle(TemporalNative.zonedDateTimeHandleAdd(toHandle(handle), toHandle(duration)))
+  }
+
+  override fun zonedDateTimeHandleSubtract(handle: Double, duration: Double): Double {
+    return fromHandle(TemporalNative.zonedDateTimeHandleSubtract(toHandle(handle), toHandle(duration)))
+  }
+
+  override fun zonedDateTimeHandleRound(handle: Double, smallestUnit: String, roundingIncrement: Double, roundingMode: String?): Double {
+    return fromHandle(TemporalNative.zonedDateTimeHandleRound(toHandle(handle), smallestUnit, roundingIncrement.toLong(), roundingMode))
+  }
+
+  override fun zonedDateTimeHandleWith(
+    handle: Double,
+    year: Double, month: Double, day: Double,
+    hour: Double, minute: Double, second: Double,
+    millisecond: Double, microsecond: Double, nanosecond: Double,
+    calendarId: String?, timeZoneId: String?
+  ): Double {
+    return fromHandle(TemporalNative.zonedDateTimeHandleWith(
+      toHandle(handle),
+      year.toInt(), month.toInt(), day.toInt(),
+      hour.toInt(), minute.toInt(), second.toInt(),
+      millisecond.toInt(), microsecond.toInt(), nanosecond.toInt(),
+      calendarId, timeZoneId
+    ))
+  }
+
+  override fun zonedDateTimeHandleGetAllComponents(handle: Double): WritableArray {
+    return toWritableArray(TemporalNative.zonedDateTimeHandleGetAllComponents(toHandle(handle)))
+  }
+
+  override fun zonedDateTimeRangeNew(start: String, step: String, end: String?): Double {
+    return fromHandle(TemporalNative.zonedDateTimeRangeNew(start, step, end))
+  }
+
+  override fun zonedDateTimeRangeNextBatch(range: Double, n: Double): WritableArray {
+    return toWritableArray(TemporalNative.zonedDateTimeRangeNextBatch(toHandle(range), n.toInt()))
+  }
+
+  override fun instantColumnFromEpochNanoseconds(epochPairs: ReadableArray): Double {
+    val pairs = LongArray(epochPairs.size()) { epochPairs.getDouble(it).toLong() }
+    return fromHandle(TemporalNative.instantColumnFromEpochNanoseconds(pairs))
+  }
+
+  override fun instantColumnFromStrings(strings: ReadableArray): Double {
+    return fromHandle(TemporalNative.instantColumnFromStrings(toStringArray(strings)))
+  }
+
+  override fun plainDateColumnFromStrings(strings: ReadableArray): Double {
+    return fromHandle(TemporalNative.plainDateColumnFromStrings(toStringArray(strings)))
+  }
+
+  override fun columnLength(column: Double): Double {
+    return TemporalNative.columnLength(toHandle(column)).toDouble()
+  }
+
+  override fun columnSlice(column: Double, start: Double, end: Double): Double {
+    return fromHandle(TemporalNative.columnSlice(toHandle(column), start.toInt(), end.toInt()))
+  }
+
+  override fun instantColumnLowerBound(column: Double, seconds: Double, nanoseconds: Double): Double {
+    return TemporalNative.instantColumnLowerBound(toHandle(column), seconds.toLong(), nanoseconds.toInt()).toDouble()
+  }
+
+  override fun instantColumnRangeCount(
+    column: Double,
+    startSeconds: Double,
+    startNanoseconds: Double,
+    endSeconds: Double,
+    endNanoseconds: Double
+  ): Double {
+    return TemporalNative.instantColumnRangeCount(
+      toHandle(column),
+      startSeconds.toLong(), startNanoseconds.toInt(),
+      endSeconds.toLong(), endNanoseconds.toInt()
+    ).toDouble()
+  }
+
+  override fun instantColumnRead(column: Double, start: Double, count: Double): WritableArray {
+    return toWritableArray(TemporalNative.instantColumnRead(toHandle(column), start.toInt(), count.toInt()))
+  }
+
+  override fun instantColumnBucketBy(column: Double, unit: String, timeZoneId: String): WritableArray {
+    return toWritableArray(TemporalNative.instantColumnBucketBy(toHandle(column), unit, timeZoneId))
+  }
+
+  override fun plainDateColumnLowerBound(column: Double, date: String): Double {
+    return TemporalNative.plainDateColumnLowerBound(toHandle(column), date).toDouble()
+  }
+
+  override fun plainDateColumnRangeCount(column: Double, start: String, end: String): Double {
+    return TemporalNative.plainDateColumnRangeCount(toHandle(column), start, end).toDouble()
+  }
+
+  override fun plainDateColumnRead(column: Double, start: Double, count: Double): WritableArray {
+    return toWritableArray(TemporalNative.plainDateColumnRead(toHandle(column), start.toInt(), count.toInt()))
+  }
+
+  override fun plainDateColumnBucketBy(column: Double, unit: String): WritableArray {
+    return toWritableArray(TemporalNative.plainDateColumnBucketBy(toHandle(column), unit))
+  }
+
+  override fun zonedClockNew(timeZoneId: String): Double {
+    return fromHandle(TemporalNative.zonedClockNew(timeZoneId))
+  }
+
+  override fun zonedClockRead(clock: Double): WritableArray {
+    return toWritableArray(TemporalNative.zonedClockRead(toHandle(clock)))
+  }
+
+  override fun instantParseMany(strings: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.instantParseMany(toStringArray(strings)))
+  }
+
+  override fun instantSort(strings: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.instantSort(toStringArray(strings)))
+  }
+
+  override fun instantCompareMany(a: ReadableArray, b: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.instantCompareMany(toStringArray(a), toStringArray(b)))
+  }
+
+  override fun plainDateSort(strings: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.plainDateSort(toStringArray(strings)))
+  }
+
+  override fun plainDateCompareMany(a: ReadableArray, b: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.plainDateCompareMany(toStringArray(a), toStringArray(b)))
+  }
+
+  override fun zonedDateTimeParseMany(strings: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.zonedDateTimeParseMany(toStringArray(strings)))
+  }
+
+  override fun zonedDateTimeSort(strings: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.zonedDateTimeSort(toStringArray(strings)))
+  }
+
+  override fun zonedDateTimeCompareMany(a: ReadableArray, b: ReadableArray): WritableArray {
+    return toWritableArray(TemporalNative.zonedDateTimeCompareMany(toStringArray(a), toStringArray(b)))
+  }
+
+  override fun timeZoneGetPlainDateTimesForMany(tzId: String, epochPairs: ReadableArray): WritableArray {
+    val pairs = LongArray(epochPairs.size()) { epochPairs.getDouble(it).toLong() }
+    return toWritableArray(TemporalNative.timeZoneGetPlainDateTimesForMany(tzId, pairs))
+  }
+
+  override fun timeZoneGetTransitions(
+    tzId: String,
+    startSeconds: Double,
+    startNanoseconds: Double,
+    endSeconds: Double,
+    endNanoseconds: Double,
+    cap: Double
+  ): WritableArray {
+    return toWritableArray(
+      TemporalNative.timeZoneGetTransitions(
+        tzId,
+        startSeconds.toLong(), startNanoseconds.toInt(),
+        endSeconds.toLong(), endNanoseconds.toInt(),
+        cap.toInt()
+      )
+    )
+  }
+
+  override fun instantParseEpochNanoseconds(s: String): WritableArray {
+    return toWritableArray(TemporalNative.instantParseEpochNanoseconds(s))
+  }
+
+  override fun instantNowEpochNanoseconds(): WritableArray {
+    return toWritableArray(TemporalNative.instantNowEpochNanoseconds())
+  }
+
+  override fun instantFormatEpochNanoseconds(seconds: Double, nanoseconds: Double): String {
+    return TemporalNative.instantFormatEpochNanoseconds(seconds.toLong(), nanoseconds.toInt())
+  }
+
+  override fun instantRoundEpochNanoseconds(
+    seconds: Double,
+    nanoseconds: Double,
+    smallestUnit: String,
+    roundingIncrement: Double,
+    roundingMode: String?
+  ): WritableArray {
+    return toWritableArray(TemporalNative.instantRoundEpochNanoseconds(
+      seconds.toLong(), nanoseconds.toInt(), smallestUnit, roundingIncrement.toLong(), roundingMode
+    ))
+  }
+
+  override fun instantUntilEpochNanoseconds(
+    oneSeconds: Double, oneNanoseconds: Double,
+    twoSeconds: Double, twoNanoseconds: Double,
+    largestUnit: String?, smallestUnit: String?, roundingIncrement: Double, roundingMode: String?
+  ): String {
+    return TemporalNative.instantUntilEpochNanoseconds(
+      oneSeconds.toLong(), oneNanoseconds.toInt(), twoSeconds.toLong(), twoNanoseconds.toInt(),
+      largestUnit, smallestUnit, roundingIncrement.toLong(), roundingMode
+    )
+  }
+
+  override fun instantSinceEpochNanoseconds(
+    oneSeconds: Double, oneNanoseconds: Double,
+    twoSeconds: Double, twoNanoseconds: Double,
+    largestUnit: String?, smallestUnit: String?, roundingIncrement: Double, roundingMode: String?
+  ): String {
+    return TemporalNative.instantSinceEpochNanoseconds(
+      oneSeconds.toLong(), oneNanoseconds.toInt(), twoSeconds.toLong(), twoNanoseconds.toInt(),
+      largestUnit, smallestUnit, roundingIncrement.toLong(), roundingMode
+    )
+  }
+
+  // Async API
+  //
+  // Heavy batches run on a worker pool and settle a Promise; rejection codes
+  // are the Temporal error names so JS can rethrow the right type.
+
+  override fun expandRecurrence(
+    start: String,
+    duration: String,
+    count: Double,
+    timeZoneId: String,
+    promise: Promise
+  ) {
+    // Anything else thrown on a worker would kill its thread and leave the
+    // promise pending, so every failure settles it.
+    try {
+      workers.execute {
+        try {
+          val pairs = TemporalNative.zonedDateTimeExpandRecurrence(
+            start, duration, count.toInt(), timeZoneId
+          )
+          promise.resolve(toWritableArray(pairs))
+        } catch (e: TemporalTypeError) {
+          promise.reject("TypeError", e.message, e)
+        } catch (e: TemporalRangeError) {
+          promise.reject("RangeError", e.message, e)
+        } catch (e: Throwable) {
+          promise.reject("Error", e.message, e)
+        }
+      }
+    } catch (e: RejectedExecutionException) {
+      promise.reject("Error", "Temporal worker pool is shut down", e)
+    }
+  }
+
   companion object {
     const val NAME = "Temporal"
   }
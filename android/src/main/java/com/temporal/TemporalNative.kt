@@ -276,6 +276,115 @@ object TemporalNative {
     @Throws(TemporalRangeError::class, TemporalTypeError::class)
     external fun timeZoneGetPreviousTransition(tzId: String, instantStr: String): String?
 
+    /** Returns the TimeZone cache counters as [hits, misses, size]. */
+    external fun timeZoneCacheStats(): LongArray
+
+    /** Empties the TimeZone cache and resets its counters. */
+    external fun timeZoneCacheClear()
+
+    /**
+     * Sets how many threads large batches may use: 0 for the device's
+     * performance cores, 1 to stay on the calling thread.
+     */
+    @Throws(TemporalRangeError::class)
+    external fun setBatchThreads(threads: Int)
+
+    /** Returns the number of threads large batches run on. */
+    external fun getBatchThreads(): Int
+
+    /**
+     * Returns 0 if a string of the given TemporalValueKind parses, otherwise
+     * its TemporalErrorType. Never throws; the message is built on demand by
+     * [lastErrorMessage].
+     */
+    external fun validate(kind: Int, s: String?): Int
+
+    /** Message of the last failed validation on this thread, or null. */
+    external fun lastErrorMessage(): String?
+
+    /**
+     * Returns the call counters as JSON; all zero unless the library was
+     * built with the `stats` feature.
+     */
+    external fun getStats(): String
+
+    /** Zeroes the call counters. */
+    external fun resetStats()
+
+    /** Encodes a ZonedDateTime string as a 24-byte binary record. */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeToBytes(s: String): ByteArray
+
+    /** Decodes a 24-byte binary record into a ZonedDateTime string. */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeFromBytes(bytes: ByteArray): String
+
+    /**
+     * toString(options) for the types with a time. `fractionalSecondDigits`
+     * is 0-9, or negative for "auto"; null options take the defaults.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantToStringWithOptions(s: String, fractionalSecondDigits: Int, smallestUnit: String?, roundingMode: String?): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainTimeToStringWithOptions(s: String, fractionalSecondDigits: Int, smallestUnit: String?, roundingMode: String?): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateTimeToStringWithOptions(s: String, fractionalSecondDigits: Int, smallestUnit: String?, roundingMode: String?, calendarName: String?): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeToStringWithOptions(s: String, fractionalSecondDigits: Int, smallestUnit: String?, roundingMode: String?, calendarName: String?, timeZoneName: String?, offset: String?): String
+
+    /**
+     * Packs toString options into one value for the `WithPackedOptions`
+     * variants, which then parse no option strings.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun toStringOptionsNew(fractionalSecondDigits: Int, smallestUnit: String?, roundingMode: String?, calendarName: String?, timeZoneName: String?, offset: String?): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantToStringWithPackedOptions(s: String, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainTimeToStringWithPackedOptions(s: String, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateTimeToStringWithPackedOptions(s: String, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeToStringWithPackedOptions(s: String, options: Long): String
+
+    /**
+     * Packs until/since/round options into one value for the `WithOptions`
+     * variants, which then parse no strings.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun roundingOptionsNew(largestUnit: String?, smallestUnit: String?, roundingIncrement: Long, roundingMode: String?): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantUntilEpochNanosecondsWithOptions(oneSeconds: Long, oneNanoseconds: Int, twoSeconds: Long, twoNanoseconds: Int, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantSinceEpochNanosecondsWithOptions(oneSeconds: Long, oneNanoseconds: Int, twoSeconds: Long, twoNanoseconds: Int, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantRoundEpochNanosecondsWithOptions(seconds: Long, nanoseconds: Int, options: Long): LongArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainTimeUntilWithOptions(one: String, two: String, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainTimeSinceWithOptions(one: String, two: String, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainTimeRoundWithOptions(time: String, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeRoundWithOptions(s: String, options: Long): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeHandleRoundWithOptions(handle: Long, options: Long): Long
+
     /**
      * ZonedDateTime API
      */
@@ -452,4 +561,275 @@ object TemporalNative {
         microseconds: Long,
         nanoseconds: Long
     ): String
+
+    // Handle API
+    //
+    // Handles are opaque native pointers to parsed Temporal values. Every handle
+    // returned here must be released exactly once with handleRelease. Released
+    // or made-up handles throw TemporalTypeError instead of being dereferenced.
+
+    /** Releases a handle. Passing 0 is a no-op. */
+    @Throws(TemporalTypeError::class)
+    external fun handleRelease(handle: Long)
+
+    /** Formats the value held by a handle as an ISO 8601 string. */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun handleToString(handle: Long): String
+
+    /**
+     * Compares two handles of the same kind. Returns -1, 0, or 1.
+     * Throws TemporalTypeError for mismatched kinds, TemporalRangeError for durations.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun handleCompare(a: Long, b: Long): Int
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantHandleFromString(s: String): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateTimeHandleFromString(s: String): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeHandleFromString(s: String): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun durationHandleFromString(s: String): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantHandleAdd(handle: Long, duration: Long): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantHandleSubtract(handle: Long, duration: Long): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantHandleRound(handle: Long, smallestUnit: String, roundingIncrement: Long, roundingMode: String?): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateTimeHandleAdd(handle: Long, duration: Long): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateTimeHandleSubtract(handle: Long, duration: Long): Long
+
+    /**
+     * Returns a new PlainDateTime handle with updated fields.
+     * Pass Int.MIN_VALUE for fields that should not be changed.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateTimeHandleWith(
+        handle: Long,
+        year: Int, month: Int, day: Int,
+        hour: Int, minute: Int, second: Int,
+        millisecond: Int, microsecond: Int, nanosecond: Int,
+        calendarId: String?
+    ): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateTimeHandleGetAllComponents(handle: Long): LongArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeHandleAdd(handle: Long, duration: Long): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeHandleSubtract(handle: Long, duration: Long): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeHandleRound(handle: Long, smallestUnit: String, roundingIncrement: Long, roundingMode: String?): Long
+
+    /**
+     * Returns a new ZonedDateTime handle with updated fields.
+     * Pass Int.MIN_VALUE for fields that should not be changed.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeHandleWith(
+        handle: Long,
+        year: Int, month: Int, day: Int,
+        hour: Int, minute: Int, second: Int,
+        millisecond: Int, microsecond: Int, nanosecond: Int,
+        calendarId: String?, timeZoneId: String?
+    ): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeHandleGetAllComponents(handle: Long): LongArray
+
+    // Batch API
+    //
+    // Each call crosses JNI once for the whole array instead of once per item.
+
+    /**
+     * Parses instants into flat [seconds, nanoseconds] pairs of epoch nanoseconds.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantParseMany(strings: Array<String>): LongArray
+
+    /**
+     * Returns the stable ascending sort permutation of the given instants.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantSort(strings: Array<String>): IntArray
+
+    /**
+     * Compares a[i] with b[i] for each index (-1, 0, or 1).
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantCompareMany(a: Array<String>, b: Array<String>): IntArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateSort(strings: Array<String>): IntArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateCompareMany(a: Array<String>, b: Array<String>): IntArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeParseMany(strings: Array<String>): LongArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeSort(strings: Array<String>): IntArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeCompareMany(a: Array<String>, b: Array<String>): IntArray
+
+    /**
+     * Converts flat [seconds, nanoseconds] epoch pairs to wall-clock fields in
+     * one time zone. The result is column-major: year, month, day, hour,
+     * minute, second, millisecond, microsecond, nanosecond.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun timeZoneGetPlainDateTimesForMany(tzId: String, epochPairs: LongArray): IntArray
+
+    /**
+     * Returns at most `cap` transitions t with start <= t < end as flat
+     * [seconds, nanoseconds] pairs, ascending.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun timeZoneGetTransitions(
+        tzId: String,
+        startSeconds: Long, startNanoseconds: Int,
+        endSeconds: Long, endNanoseconds: Int,
+        cap: Int
+    ): LongArray
+
+    /**
+     * Expands `start + duration * i` for i in [0, count) in a time zone into
+     * flat [seconds, nanoseconds] pairs. Long-running; call off the JS thread.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeExpandRecurrence(
+        start: String, duration: String, count: Int, tzId: String
+    ): LongArray
+
+    /**
+     * Creates a range handle over `start + step * i`, bounded by the exclusive
+     * `end` when given. Release with handleRelease.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeRangeNew(start: String, step: String, end: String?): Long
+
+    /**
+     * Advances a range by up to `n` occurrences, returned as flat
+     * [seconds, nanoseconds] pairs. An empty array means it is exhausted.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedDateTimeRangeNextBatch(range: Long, n: Int): LongArray
+
+    // Columns
+    //
+    // Sorted instants or plain dates held natively for range queries. Plain
+    // dates cross as days since 1970-01-01. Release with handleRelease.
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantColumnFromEpochNanoseconds(epochPairs: LongArray): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantColumnFromStrings(strings: Array<String>): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateColumnFromStrings(strings: Array<String>): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun columnLength(column: Long): Int
+
+    /** A view of `[start, end)` sharing the column's memory, bounds clamped. */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun columnSlice(column: Long, start: Int, end: Int): Long
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantColumnLowerBound(column: Long, seconds: Long, nanoseconds: Int): Int
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantColumnRangeCount(
+        column: Long, startSeconds: Long, startNanoseconds: Int, endSeconds: Long, endNanoseconds: Int
+    ): Int
+
+    /** Up to `count` instants from `start`, as flat [seconds, nanoseconds] pairs. */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantColumnRead(column: Long, start: Int, count: Int): LongArray
+
+    /**
+     * Non-empty day, week, month or year buckets in `tzId`, as flat
+     * [start seconds, start nanoseconds, count] triples.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantColumnBucketBy(column: Long, unit: String, tzId: String): LongArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateColumnLowerBound(column: Long, date: String): Int
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateColumnRangeCount(column: Long, start: String, end: String): Int
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateColumnRead(column: Long, start: Int, count: Int): IntArray
+
+    /** Non-empty buckets as flat [start day, count] pairs. */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun plainDateColumnBucketBy(column: Long, unit: String): IntArray
+
+    /**
+     * Creates a clock bound to `tzId` whose reads skip zone lookups and
+     * formatting. Release with handleRelease.
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedClockNew(tzId: String): Long
+
+    /**
+     * The current time in the clock's zone: [epoch seconds, nanoseconds,
+     * offset nanoseconds, year, month, day, hour, minute, second, millisecond,
+     * microsecond, nanosecond, day of week, day of year].
+     */
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun zonedClockRead(clock: Long): LongArray
+
+    // Epoch nanosecond instants
+    //
+    // Instants cross as [seconds, nanoseconds] with the nanosecond part in
+    // [0, 1e9) instead of ISO strings.
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantParseEpochNanoseconds(s: String): LongArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantNowEpochNanoseconds(): LongArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantFormatEpochNanoseconds(seconds: Long, nanoseconds: Int): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantRoundEpochNanoseconds(
+        seconds: Long, nanoseconds: Int,
+        smallestUnit: String, roundingIncrement: Long, roundingMode: String?
+    ): LongArray
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantUntilEpochNanoseconds(
+        oneSeconds: Long, oneNanoseconds: Int,
+        twoSeconds: Long, twoNanoseconds: Int,
+        largestUnit: String?, smallestUnit: String?, roundingIncrement: Long, roundingMode: String?
+    ): String
+
+    @Throws(TemporalRangeError::class, TemporalTypeError::class)
+    external fun instantSinceEpochNanoseconds(
+        oneSeconds: Long, oneNanoseconds: Int,
+        twoSeconds: Long, twoNanoseconds: Int,
+        largestUnit: String?, smallestUnit: String?, roundingIncrement: Long, roundingMode: String?
+    ): String
 }
@@ -0,0 +1,2139 @@
+#include "TemporalJSI.h"
+#include "temporal_rn.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace facebook;
+
+namespace temporal {
+
+namespace {
+
+// ============================================================================
+// Errors
+// ============================================================================
+
+// Errors carry the same "[RangeError] " / "[TypeError] " markers as the
+// platform modules so wrapNativeCall() maps them to the right JS error type.
+[[noreturn]] void throwTemporalError(jsi::Runtime &rt, int32_t errorType,
+                                     const std::string &message) {
+  const char *prefix =
+      errorType == TEMPORAL_ERROR_TYPE ? "[TypeError] " : "[RangeError] ";
+  throw jsi::JSError(rt, prefix + message);
+}
+
+[[noreturn]] void throwTypeError(jsi::Runtime &rt, const std::string &message) {
+  throwTemporalError(rt, TEMPORAL_ERROR_TYPE, message);
+}
+
+[[noreturn]] void throwRangeError(jsi::Runtime &rt,
+                                  const std::string &message) {
+  throwTemporalError(rt, TEMPORAL_ERROR_RANGE, message);
+}
+
+// Frees the result and throws if it carries an error
+void checkResult(jsi::Runtime &rt, TemporalResult &result) {
+  if (result.error_type == TEMPORAL_ERROR_NONE) {
+    return;
+  }
+  std::string message =
+      result.error_message ? result.error_message : "Unknown error";
+  int32_t errorType = result.error_type;
+  temporal_free_result(&result);
+  throwTemporalError(rt, errorType, message);
+}
+
+// ============================================================================
+// Argument conversion
+// ============================================================================
+
+std::string stringArg(jsi::Runtime &rt, const jsi::Value &value,
+                      const char *name) {
+  if (!value.isString()) {
+    throwTypeError(rt, std::string(name) + " cannot be null");
+  }
+  return value.getString(rt).utf8(rt);
+}
+
+std::optional<std::string> optionalStringArg(jsi::Runtime &rt,
+                                             const jsi::Value &value,
+                                             const char *name) {
+  if (value.isNull() || value.isUndefined()) {
+    return std::nullopt;
+  }
+  return stringArg(rt, value, name);
+}
+
+const char *cstr(const std::optional<std::string> &s) {
+  return s ? s->c_str() : nullptr;
+}
+
+double numberArg(jsi::Runtime &rt, const jsi::Value &value, const char *name) {
+  if (!value.isNumber()) {
+    throwTypeError(rt, std::string(name) + " must be a number");
+  }
+  return value.getNumber();
+}
+
+// Saturating conversions, so Number.MIN_SAFE_INTEGER becomes the native
+// "unchanged" sentinel (i32::MIN) like the platform modules' casts do, and
+// NaN becomes 0 as Kotlin's toInt() makes it.
+int32_t int32Arg(jsi::Runtime &rt, const jsi::Value &value, const char *name) {
+  double d = numberArg(rt, value, name);
+  if (std::isnan(d)) {
+    return 0;
+  }
+  if (d <= static_cast<double>(std::numeric_limits<int32_t>::min())) {
+    return std::numeric_limits<int32_t>::min();
+  }
+  if (d >= static_cast<double>(std::numeric_limits<int32_t>::max())) {
+    return std::numeric_limits<int32_t>::max();
+  }
+  return static_cast<int32_t>(d);
+}
+
+int64_t int64Arg(jsi::Runtime &rt, const jsi::Value &value, const char *name) {
+  double d = numberArg(rt, value, name);
+  if (std::isnan(d)) {
+    return 0;
+  }
+  if (d <= -9223372036854775808.0) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  if (d >= 9223372036854775807.0) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  return static_cast<int64_t>(d);
+}
+
+// Epoch instants cross as two numbers: whole seconds and the nanosecond
+// remainder in [0, 1e9). Validation of the remainder happens in Rust.
+TemporalEpochNanoseconds epochArg(jsi::Runtime &rt, const jsi::Value &seconds,
+                                  const jsi::Value &nanoseconds) {
+  TemporalEpochNanoseconds epoch;
+  epoch.seconds = int64Arg(rt, seconds, "Epoch seconds");
+  epoch.nanoseconds = int32Arg(rt, nanoseconds, "Epoch nanoseconds");
+  return epoch;
+}
+
+// Flat [seconds, nanoseconds, ...] pairs, the inverse of epochPairsToJS.
+std::vector<TemporalEpochNanoseconds> epochPairsArg(jsi::Runtime &rt,
+                                                    const jsi::Value &value) {
+  if (!value.isObject() || !value.getObject(rt).isArray(rt)) {
+    throwTypeError(rt, "Epoch nanoseconds must be an array");
+  }
+  jsi::Array pairs = value.getObject(rt).getArray(rt);
+  size_t length = pairs.size(rt);
+  if (length % 2 != 0) {
+    throwRangeError(rt,
+                    "Epoch nanoseconds must be [seconds, nanoseconds] pairs");
+  }
+  std::vector<TemporalEpochNanoseconds> epochs(length / 2);
+  for (size_t i = 0; i < epochs.size(); i++) {
+    epochs[i].seconds =
+        int64Arg(rt, pairs.getValueAtIndex(rt, i * 2), "Seconds");
+    epochs[i].nanoseconds =
+        int32Arg(rt, pairs.getValueAtIndex(rt, i * 2 + 1), "Nanoseconds");
+  }
+  return epochs;
+}
+
+// Values from temporal_rounding_options_new; Rust rejects any other bits.
+TemporalRoundingOptions roundingOptionsArg(jsi::Runtime &rt,
+                                           const jsi::Value &value) {
+  double d = numberArg(rt, value, "Rounding options");
+  if (d < 0 || d >= 9007199254740992.0 || d != std::floor(d)) {
+    throwRangeError(rt, "Invalid rounding options");
+  }
+  return static_cast<TemporalRoundingOptions>(d);
+}
+
+// Values from temporal_to_string_options_new; Rust rejects any other bits.
+TemporalToStringOptions toStringOptionsArg(jsi::Runtime &rt,
+                                           const jsi::Value &value) {
+  double d = numberArg(rt, value, "toString options");
+  if (d < 0 || d >= 9007199254740992.0 || d != std::floor(d)) {
+    throwRangeError(rt, "Invalid toString options");
+  }
+  return static_cast<TemporalToStringOptions>(d);
+}
+
+// IDs from temporal_intern_time_zone / temporal_intern_calendar. Anything
+// that isn't one maps to UINT32_MAX, which Rust reports as unknown.
+uint32_t internedArg(jsi::Runtime &rt, const jsi::Value &value,
+                     const char *name) {
+  double d = numberArg(rt, value, name);
+  if (d < 0 || d >= 4294967295.0 || d != std::floor(d)) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  return static_cast<uint32_t>(d);
+}
+
+// ============================================================================
+// Handles
+// ============================================================================
+
+// Handles must round-trip through the TurboModule too, so the encoding
+// mirrors the platform modules: Android bit-casts (tagged heap pointers
+// exceed 2^53), iOS converts numerically.
+double encodeHandle(TemporalHandle *handle) {
+#if defined(__ANDROID__)
+  uint64_t bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+#else
+  return static_cast<double>(reinterpret_cast<uintptr_t>(handle));
+#endif
+}
+
+// Rust checks the pointer against its live handles; only the numeric
+// conversion, which is undefined outside the integer range, is checked here.
+TemporalHandle *handleArg(jsi::Runtime &rt, const jsi::Value &value) {
+  double d = numberArg(rt, value, "Handle");
+#if defined(__ANDROID__)
+  uint64_t bits;
+  std::memcpy(&bits, &d, sizeof(bits));
+  return reinterpret_cast<TemporalHandle *>(static_cast<uintptr_t>(bits));
+#else
+  if (d < 0 || d >= 18446744073709551616.0 || d != std::floor(d)) {
+    throwTypeError(rt, "Invalid handle");
+  }
+  return reinterpret_cast<TemporalHandle *>(static_cast<uintptr_t>(d));
+#endif
+}
+
+// ============================================================================
+// Result conversion
+// ============================================================================
+
+jsi::Value toJSString(jsi::Runtime &rt, TemporalResult result) {
+  checkResult(rt, result);
+  const char *value = result.value ? result.value : "";
+  jsi::String str = jsi::String::createFromUtf8(
+      rt, reinterpret_cast<const uint8_t *>(value), std::strlen(value));
+  temporal_free_result(&result);
+  return str;
+}
+
+// Big enough for any instant and most date-time strings; longer values
+// (annotations, extended years) fall back to a heap buffer.
+constexpr size_t kStackFormatBufferSize = 64;
+
+// Calls a *_into function with a stack buffer so the only copy of the
+// formatted string is the one into the JS engine. `format` is invoked again
+// with a larger buffer when the first attempt was truncated.
+template <typename Format>
+jsi::Value toJSStringInto(jsi::Runtime &rt, Format &&format) {
+  char stackBuffer[kStackFormatBufferSize];
+  size_t length = 0;
+  int32_t errorType = format(stackBuffer, sizeof(stackBuffer), &length);
+  if (errorType != TEMPORAL_ERROR_NONE) {
+    const char *message = temporal_last_error_message();
+    throwTemporalError(rt, errorType, message ? message : "Unknown error");
+  }
+  if (length < sizeof(stackBuffer)) {
+    return jsi::String::createFromUtf8(
+        rt, reinterpret_cast<const uint8_t *>(stackBuffer), length);
+  }
+  std::vector<char> heapBuffer(length + 1);
+  format(heapBuffer.data(), heapBuffer.size(), &length);
+  return jsi::String::createFromUtf8(
+      rt, reinterpret_cast<const uint8_t *>(heapBuffer.data()), length);
+}
+
+// For results whose string value is numeric (epoch milliseconds, offsets)
+jsi::Value toJSNumber(jsi::Runtime &rt, TemporalResult result) {
+  checkResult(rt, result);
+  double value = result.value ? std::strtod(result.value, nullptr) : 0;
+  temporal_free_result(&result);
+  return jsi::Value(value);
+}
+
+// For results where an empty string means "none"
+jsi::Value toJSStringOrNull(jsi::Runtime &rt, TemporalResult result) {
+  checkResult(rt, result);
+  if (result.value == nullptr || result.value[0] == '\0') {
+    temporal_free_result(&result);
+    return jsi::Value::null();
+  }
+  jsi::String str = jsi::String::createFromUtf8(
+      rt, reinterpret_cast<const uint8_t *>(result.value),
+      std::strlen(result.value));
+  temporal_free_result(&result);
+  return str;
+}
+
+jsi::Value toJSNumber(jsi::Runtime &rt, CompareResult result) {
+  if (result.error_type != TEMPORAL_ERROR_NONE) {
+    std::string message =
+        result.error_message ? result.error_message : "Unknown error";
+    int32_t errorType = result.error_type;
+    temporal_free_compare_result(&result);
+    throwTemporalError(rt, errorType, message);
+  }
+  return jsi::Value(static_cast<double>(result.value));
+}
+
+jsi::Value toJSHandle(jsi::Runtime &rt, HandleResult result) {
+  if (result.error_type != TEMPORAL_ERROR_NONE) {
+    std::string message =
+        result.error_message ? result.error_message : "Unknown error";
+    int32_t errorType = result.error_type;
+    temporal_free_handle_result(&result);
+    throwTemporalError(rt, errorType, message);
+  }
+  return jsi::Value(encodeHandle(result.handle));
+}
+
+jsi::Value toJSArray(jsi::Runtime &rt, std::initializer_list<double> values) {
+  jsi::Array array(rt, values.size());
+  size_t i = 0;
+  for (double value : values) {
+    array.setValueAtIndex(rt, i++, jsi::Value(value));
+  }
+  return array;
+}
+
+// For status-returning calls; the message is thread-local in Rust
+void checkStatus(jsi::Runtime &rt, int32_t errorType) {
+  if (errorType != TEMPORAL_ERROR_NONE) {
+    const char *message = temporal_last_error_message();
+    throwTemporalError(rt, errorType, message ? message : "Unknown error");
+  }
+}
+
+jsi::Value toJSEpoch(jsi::Runtime &rt, int32_t errorType,
+                     TemporalEpochNanoseconds epoch) {
+  checkStatus(rt, errorType);
+  return toJSArray(rt, {static_cast<double>(epoch.seconds),
+                        static_cast<double>(epoch.nanoseconds)});
+}
+
+// Float64 slots of a zoned clock reading, in ZonedClockReading order with the
+// epoch split into seconds and nanoseconds: epoch seconds, nanoseconds,
+// offset nanoseconds, year, month, day, hour, minute, second, millisecond,
+// microsecond, nanosecond, day of week, day of year.
+constexpr size_t kZonedClockSlots = 14;
+
+void readZonedClock(jsi::Runtime &rt, const jsi::Value &clock, double *out) {
+  ZonedClockReading r;
+  checkStatus(rt, temporal_zoned_clock_read(handleArg(rt, clock), &r));
+  const double values[kZonedClockSlots] = {
+      static_cast<double>(r.epoch_ns.seconds),
+      static_cast<double>(r.epoch_ns.nanoseconds),
+      static_cast<double>(r.offset_nanoseconds),
+      static_cast<double>(r.year),
+      static_cast<double>(r.month),
+      static_cast<double>(r.day),
+      static_cast<double>(r.hour),
+      static_cast<double>(r.minute),
+      static_cast<double>(r.second),
+      static_cast<double>(r.millisecond),
+      static_cast<double>(r.microsecond),
+      static_cast<double>(r.nanosecond),
+      static_cast<double>(r.day_of_week),
+      static_cast<double>(r.day_of_year)};
+  std::memcpy(out, values, sizeof(values));
+}
+
+// Sizes the output of column reads and bucketing.
+int32_t columnLength(jsi::Runtime &rt, TemporalHandle *column) {
+  int32_t length = 0;
+  checkStatus(rt, temporal_column_length(column, &length));
+  return length;
+}
+
+jsi::Value plainDateTimeComponentsToJS(jsi::Runtime &rt,
+                                       const PlainDateTimeComponents &c) {
+  return toJSArray(
+      rt, {(double)c.year, (double)c.month, (double)c.day,
+           (double)c.day_of_week, (double)c.day_of_year,
+           (double)c.week_of_year, (double)c.year_of_week,
+           (double)c.days_in_week, (double)c.days_in_month,
+           (double)c.days_in_year, (double)c.months_in_year,
+           (double)c.in_leap_year, (double)c.hour, (double)c.minute,
+           (double)c.second, (double)c.millisecond, (double)c.microsecond,
+           (double)c.nanosecond});
+}
+
+jsi::Value zonedDateTimeComponentsToJS(jsi::Runtime &rt,
+                                       const ZonedDateTimeComponents &c) {
+  return toJSArray(
+      rt, {(double)c.year, (double)c.month, (double)c.day,
+           (double)c.day_of_week, (double)c.day_of_year,
+           (double)c.week_of_year, (double)c.year_of_week,
+           (double)c.days_in_week, (double)c.days_in_month,
+           (double)c.days_in_year, (double)c.months_in_year,
+           (double)c.in_leap_year, (double)c.hour, (double)c.minute,
+           (double)c.second, (double)c.millisecond, (double)c.microsecond,
+           (double)c.nanosecond, (double)c.offset_nanoseconds});
+}
+
+// ============================================================================
+// Component buffers
+// ============================================================================
+
+// Int32 slots written by the *GetAllComponentsInto and *FromStringWithComponents
+// methods, in the same order as the number[] variants. The zoned offset is
+// split into whole seconds and a nanosecond remainder since it doesn't fit an
+// int32 in nanoseconds.
+constexpr size_t kPlainTimeComponentSlots = 6;
+constexpr size_t kPlainDateComponentSlots = 12;
+constexpr size_t kPlainDateTimeComponentSlots = 18;
+constexpr size_t kZonedDateTimeComponentSlots = 20;
+
+int32_t *componentBufferArg(jsi::Runtime &rt, const jsi::Value &value,
+                            size_t slots) {
+  if (!value.isObject() || !value.getObject(rt).isArrayBuffer(rt)) {
+    throwTypeError(rt, "Components buffer must be an ArrayBuffer");
+  }
+  jsi::ArrayBuffer buffer = value.getObject(rt).getArrayBuffer(rt);
+  if (buffer.size(rt) < slots * sizeof(int32_t)) {
+    throwRangeError(rt, "Components buffer is too small");
+  }
+  return reinterpret_cast<int32_t *>(buffer.data(rt));
+}
+
+void writeComponents(int32_t *out, const PlainTimeComponents &c) {
+  const int32_t values[kPlainTimeComponentSlots] = {
+      c.hour,        c.minute,      c.second,
+      c.millisecond, c.microsecond, c.nanosecond};
+  std::memcpy(out, values, sizeof(values));
+}
+
+void writeComponents(int32_t *out, const PlainDateComponents &c) {
+  const int32_t values[kPlainDateComponentSlots] = {
+      c.year,          c.month,        c.day,          c.day_of_week,
+      c.day_of_year,   c.week_of_year, c.year_of_week, c.days_in_week,
+      c.days_in_month, c.days_in_year, c.months_in_year, c.in_leap_year};
+  std::memcpy(out, values, sizeof(values));
+}
+
+void writeComponents(int32_t *out, const PlainDateTimeComponents &c) {
+  const int32_t values[kPlainDateTimeComponentSlots] = {
+      c.year,          c.month,          c.day,          c.day_of_week,
+      c.day_of_year,   c.week_of_year,   c.year_of_week, c.days_in_week,
+      c.days_in_month, c.days_in_year,   c.months_in_year, c.in_leap_year,
+      c.hour,          c.minute,         c.second,       c.millisecond,
+      c.microsecond,   c.nanosecond};
+  std::memcpy(out, values, sizeof(values));
+}
+
+void writeComponents(int32_t *out, const ZonedDateTimeComponents &c) {
+  const int32_t values[kZonedDateTimeComponentSlots] = {
+      c.year,
+      c.month,
+      c.day,
+      c.day_of_week,
+      c.day_of_year,
+      c.week_of_year,
+      c.year_of_week,
+      c.days_in_week,
+      c.days_in_month,
+      c.days_in_year,
+      c.months_in_year,
+      c.in_leap_year,
+      c.hour,
+      c.minute,
+      c.second,
+      c.millisecond,
+      c.microsecond,
+      c.nanosecond,
+      static_cast<int32_t>(c.offset_nanoseconds / 1000000000),
+      static_cast<int32_t>(c.offset_nanoseconds % 1000000000)};
+  std::memcpy(out, values, sizeof(values));
+}
+
+// Parses `s` and writes its components into the buffer, returning the
+// normalized string. The buffer is validated before the native call so a
+// type error can't leak the result.
+template <typename Components>
+jsi::Value fromStringWithComponents(
+    jsi::Runtime &rt, const jsi::Value *args, const char *name, size_t slots,
+    TemporalResult (*parse)(const char *, Components *)) {
+  auto s = stringArg(rt, args[0], name);
+  int32_t *out = componentBufferArg(rt, args[1], slots);
+  Components c;
+  jsi::Value result = toJSString(rt, parse(s.c_str(), &c));
+  writeComponents(out, c);
+  return result;
+}
+
+// ============================================================================
+// Batch conversion
+// ============================================================================
+
+// Owns the UTF-8 copies of a JS string array and exposes the pointer array
+// the batch C API expects.
+struct StringBatch {
+  std::vector<std::string> storage;
+  std::vector<const char *> pointers;
+
+  int32_t size() const { return static_cast<int32_t>(pointers.size()); }
+};
+
+StringBatch stringArrayArg(jsi::Runtime &rt, const jsi::Value &value,
+                           const char *name) {
+  if (!value.isObject() || !value.getObject(rt).isArray(rt)) {
+    throwTypeError(rt, std::string(name) + " must be an array");
+  }
+  jsi::Array array = value.getObject(rt).getArray(rt);
+  size_t length = array.size(rt);
+  StringBatch batch;
+  batch.storage.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    jsi::Value item = array.getValueAtIndex(rt, i);
+    if (!item.isString()) {
+      throwTypeError(rt, "Array elements must be strings");
+    }
+    batch.storage.push_back(item.getString(rt).utf8(rt));
+  }
+  batch.pointers.reserve(length);
+  for (const auto &item : batch.storage) {
+    batch.pointers.push_back(item.c_str());
+  }
+  return batch;
+}
+
+void checkBatchResult(jsi::Runtime &rt, BatchResult &result) {
+  if (result.error_type == TEMPORAL_ERROR_NONE) {
+    return;
+  }
+  std::string message =
+      result.error_message ? result.error_message : "Unknown error";
+  int32_t errorType = result.error_type;
+  temporal_free_batch_result(&result);
+  throwTemporalError(rt, errorType, message);
+}
+
+template <typename T>
+jsi::Value toJSArray(jsi::Runtime &rt, const std::vector<T> &values) {
+  jsi::Array array(rt, values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    array.setValueAtIndex(rt, i, jsi::Value(static_cast<double>(values[i])));
+  }
+  return array;
+}
+
+// Flattens epochs into [seconds, nanoseconds, ...].
+jsi::Value epochPairsToJS(jsi::Runtime &rt,
+                          const std::vector<TemporalEpochNanoseconds> &epochs) {
+  jsi::Array array(rt, epochs.size() * 2);
+  for (size_t i = 0; i < epochs.size(); i++) {
+    array.setValueAtIndex(rt, i * 2,
+                          jsi::Value(static_cast<double>(epochs[i].seconds)));
+    array.setValueAtIndex(
+        rt, i * 2 + 1, jsi::Value(static_cast<double>(epochs[i].nanoseconds)));
+  }
+  return array;
+}
+
+jsi::Value parseManyToJS(jsi::Runtime &rt, const jsi::Value &strings,
+                         BatchResult (*parse)(const char *const *, int32_t,
+                                              TemporalEpochNanoseconds *)) {
+  auto batch = stringArrayArg(rt, strings, "strings");
+  std::vector<TemporalEpochNanoseconds> out(batch.pointers.size());
+  BatchResult result = parse(batch.pointers.data(), batch.size(), out.data());
+  checkBatchResult(rt, result);
+  return epochPairsToJS(rt, out);
+}
+
+jsi::Value sortToJS(jsi::Runtime &rt, const jsi::Value &strings,
+                    BatchResult (*sort)(const char *const *, int32_t,
+                                        int32_t *)) {
+  auto batch = stringArrayArg(rt, strings, "strings");
+  std::vector<int32_t> out(batch.pointers.size());
+  BatchResult result = sort(batch.pointers.data(), batch.size(), out.data());
+  checkBatchResult(rt, result);
+  return toJSArray(rt, out);
+}
+
+jsi::Value compareManyToJS(jsi::Runtime &rt, const jsi::Value &a,
+                           const jsi::Value &b,
+                           BatchResult (*compare)(const char *const *,
+                                                  const char *const *, int32_t,
+                                                  int8_t *)) {
+  auto first = stringArrayArg(rt, a, "First array");
+  auto second = stringArrayArg(rt, b, "Second array");
+  if (first.size() != second.size()) {
+    throwRangeError(rt, "Arrays must have the same length");
+  }
+  std::vector<int8_t> out(first.pointers.size());
+  BatchResult result = compare(first.pointers.data(), second.pointers.data(),
+                               first.size(), out.data());
+  checkBatchResult(rt, result);
+  return toJSArray(rt, out);
+}
+
+// ============================================================================
+// Binary records
+// ============================================================================
+
+// Returns the first of `count` records at `byteOffset`, after checking they
+// lie inside the ArrayBuffer.
+uint8_t *binaryBufferArg(jsi::Runtime &rt, const jsi::Value &buffer,
+                         const jsi::Value &byteOffset, size_t count) {
+  if (!buffer.isObject() || !buffer.getObject(rt).isArrayBuffer(rt)) {
+    throwTypeError(rt, "Binary records must be an ArrayBuffer");
+  }
+  jsi::ArrayBuffer records = buffer.getObject(rt).getArrayBuffer(rt);
+  double offset = numberArg(rt, byteOffset, "Byte offset");
+  size_t size = records.size(rt);
+  if (offset < 0 || offset != std::floor(offset) || offset > size ||
+      count > (size - static_cast<size_t>(offset)) / TEMPORAL_BINARY_SIZE) {
+    throwRangeError(rt, "Binary records extend past the end of the buffer");
+  }
+  return records.data(rt) + static_cast<size_t>(offset);
+}
+
+// Reads one record from the number[] the TurboModule methods use.
+std::array<uint8_t, TEMPORAL_BINARY_SIZE>
+binaryArrayArg(jsi::Runtime &rt, const jsi::Value &value) {
+  if (!value.isObject() || !value.getObject(rt).isArray(rt)) {
+    throwTypeError(rt, "Binary record must be an array");
+  }
+  jsi::Array array = value.getObject(rt).getArray(rt);
+  if (array.size(rt) != TEMPORAL_BINARY_SIZE) {
+    throwRangeError(rt, "Binary record must be " +
+                            std::to_string(TEMPORAL_BINARY_SIZE) + " bytes");
+  }
+  std::array<uint8_t, TEMPORAL_BINARY_SIZE> record;
+  for (size_t i = 0; i < record.size(); i++) {
+    jsi::Value item = array.getValueAtIndex(rt, i);
+    double byte = item.isNumber() ? item.asNumber() : -1;
+    if (byte < 0 || byte > 255 || byte != std::floor(byte)) {
+      throwRangeError(rt, "Byte " + std::to_string(i) +
+                              " must be an integer in [0, 255]");
+    }
+    record[i] = static_cast<uint8_t>(byte);
+  }
+  return record;
+}
+
+jsi::Value bytesToJS(jsi::Runtime &rt, int32_t errorType,
+                     const uint8_t *record) {
+  if (errorType != TEMPORAL_ERROR_NONE) {
+    const char *message = temporal_last_error_message();
+    throwTemporalError(rt, errorType, message ? message : "Unknown error");
+  }
+  jsi::Array array(rt, TEMPORAL_BINARY_SIZE);
+  for (size_t i = 0; i < TEMPORAL_BINARY_SIZE; i++) {
+    array.setValueAtIndex(rt, i, jsi::Value(static_cast<int>(record[i])));
+  }
+  return array;
+}
+
+// Decodes `count` consecutive records into strings, naming the failing item
+// in the error like the batch C API does.
+jsi::Value fromBytesManyToJS(jsi::Runtime &rt, const jsi::Value *args,
+                             TemporalResult (*decode)(const uint8_t *)) {
+  int32_t count = int32Arg(rt, args[2], "Count");
+  if (count < 0) {
+    throwRangeError(rt, "count cannot be negative");
+  }
+  const uint8_t *records = binaryBufferArg(rt, args[0], args[1], count);
+  jsi::Array array(rt, count);
+  for (int32_t i = 0; i < count; i++) {
+    TemporalResult result = decode(records + i * TEMPORAL_BINARY_SIZE);
+    if (result.error_type != TEMPORAL_ERROR_NONE) {
+      std::string message =
+          "Item " + std::to_string(i) + ": " +
+          (result.error_message ? result.error_message : "Unknown error");
+      int32_t errorType = result.error_type;
+      temporal_free_result(&result);
+      throwTemporalError(rt, errorType, message);
+    }
+    array.setValueAtIndex(rt, i, toJSString(rt, result));
+  }
+  return array;
+}
+
+// ============================================================================
+// Streaming parse
+// ============================================================================
+
+// Creates a typed array of `length` elements with the engine's constructor
+// and returns it with a pointer to its storage.
+template <typename T>
+std::pair<jsi::Object, T *> newTypedArray(jsi::Runtime &rt, const char *name,
+                                          size_t length) {
+  jsi::Object array = rt.global()
+                          .getPropertyAsFunction(rt, name)
+                          .callAsConstructor(rt, static_cast<double>(length))
+                          .getObject(rt);
+  jsi::ArrayBuffer buffer =
+      array.getProperty(rt, "buffer").getObject(rt).getArrayBuffer(rt);
+  return {std::move(array), reinterpret_cast<T *>(buffer.data(rt))};
+}
+
+// Parses every instant string in `byteLength` bytes of an ArrayBuffer into
+// { seconds: Float64Array, nanoseconds: Int32Array, errors: Int8Array }.
+// The items are counted first so the output is allocated once.
+jsi::Value parseStreamToJS(jsi::Runtime &rt, const jsi::Value *args) {
+  if (!args[0].isObject() || !args[0].getObject(rt).isArrayBuffer(rt)) {
+    throwTypeError(rt, "Stream must be an ArrayBuffer");
+  }
+  jsi::ArrayBuffer stream = args[0].getObject(rt).getArrayBuffer(rt);
+  double offset = numberArg(rt, args[1], "Byte offset");
+  double length = numberArg(rt, args[2], "Byte length");
+  size_t size = stream.size(rt);
+  if (offset < 0 || length < 0 || offset != std::floor(offset) ||
+      length != std::floor(length) || offset + length > size) {
+    throwRangeError(rt, "Stream range extends past the end of the buffer");
+  }
+  int32_t format = int32Arg(rt, args[3], "Format");
+  const uint8_t *bytes = stream.data(rt) + static_cast<size_t>(offset);
+  size_t len = static_cast<size_t>(length);
+
+  BatchResult counted = temporal_instant_parse_stream(
+      bytes, len, format, 1, nullptr, nullptr, 0, nullptr);
+  checkBatchResult(rt, counted);
+  std::vector<TemporalEpochNanoseconds> epochs(counted.count);
+  std::vector<int8_t> errors(counted.count);
+  BatchResult result = temporal_instant_parse_stream(
+      bytes, len, format, 1, epochs.data(), errors.data(), counted.count,
+      nullptr);
+  checkBatchResult(rt, result);
+
+  auto [seconds, secondsData] =
+      newTypedArray<double>(rt, "Float64Array", epochs.size());
+  auto [nanoseconds, nanosecondsData] =
+      newTypedArray<int32_t>(rt, "Int32Array", epochs.size());
+  auto [errorTypes, errorTypesData] =
+      newTypedArray<int8_t>(rt, "Int8Array", errors.size());
+  for (size_t i = 0; i < epochs.size(); i++) {
+    secondsData[i] = static_cast<double>(epochs[i].seconds);
+    nanosecondsData[i] = epochs[i].nanoseconds;
+  }
+  std::memcpy(errorTypesData, errors.data(), errors.size());
+
+  jsi::Object parsed(rt);
+  parsed.setProperty(rt, "seconds", std::move(seconds));
+  parsed.setProperty(rt, "nanoseconds", std::move(nanoseconds));
+  parsed.setProperty(rt, "errors", std::move(errorTypes));
+  return parsed;
+}
+
+// ============================================================================
+// Method table
+// ============================================================================
+
+using Method = jsi::Value (*)(jsi::Runtime &rt, const jsi::Value *args);
+
+struct MethodEntry {
+  const char *name;
+  size_t argCount;
+  Method method;
+};
+
+#define TEMPORAL_METHOD(jsName, argc)                                          \
+  {jsName, argc, [](jsi::Runtime & rt, const jsi::Value *args) -> jsi::Value
+
+#define TEMPORAL_STRING_1(jsName, cFunction)                                   \
+  TEMPORAL_METHOD(jsName, 1) {                                                 \
+    auto s = stringArg(rt, args[0], "String");                                 \
+    return toJSString(rt, cFunction(s.c_str()));                               \
+  }                                                                            \
+  }
+
+#define TEMPORAL_STRING_1_INTO(jsName, cFunction)                              \
+  TEMPORAL_METHOD(jsName, 1) {                                                 \
+    auto s = stringArg(rt, args[0], "String");                                 \
+    return toJSStringInto(rt, [&](char *buf, size_t cap, size_t *len) {        \
+      return cFunction(s.c_str(), buf, cap, len);                              \
+    });                                                                        \
+  }                                                                            \
+  }
+
+#define TEMPORAL_STRING_2_INTO(jsName, cFunction)                              \
+  TEMPORAL_METHOD(jsName, 2) {                                                 \
+    auto a = stringArg(rt, args[0], "Arguments");                              \
+    auto b = stringArg(rt, args[1], "Arguments");                              \
+    return toJSStringInto(rt, [&](char *buf, size_t cap, size_t *len) {        \
+      return cFunction(a.c_str(), b.c_str(), buf, cap, len);                   \
+    });                                                                        \
+  }                                                                            \
+  }
+
+#define TEMPORAL_STRING_2(jsName, cFunction)                                   \
+  TEMPORAL_METHOD(jsName, 2) {                                                 \
+    auto a = stringArg(rt, args[0], "Arguments");                              \
+    auto b = stringArg(rt, args[1], "Arguments");                              \
+    return toJSString(rt, cFunction(a.c_str(), b.c_str()));                    \
+  }                                                                            \
+  }
+
+#define TEMPORAL_NUMBER_1(jsName, cFunction)                                   \
+  TEMPORAL_METHOD(jsName, 1) {                                                 \
+    auto s = stringArg(rt, args[0], "String");                                 \
+    return toJSNumber(rt, cFunction(s.c_str()));                               \
+  }                                                                            \
+  }
+
+#define TEMPORAL_COMPARE(jsName, cFunction)                                    \
+  TEMPORAL_METHOD(jsName, 2) {                                                 \
+    auto a = stringArg(rt, args[0], "Arguments");                              \
+    auto b = stringArg(rt, args[1], "Arguments");                              \
+    return toJSNumber(rt, cFunction(a.c_str(), b.c_str()));                    \
+  }                                                                            \
+  }
+
+#define TEMPORAL_DIFFERENCE(jsName, cFunction)                                 \
+  TEMPORAL_METHOD(jsName, 6) {                                                 \
+    auto one = stringArg(rt, args[0], "Arguments");                            \
+    auto two = stringArg(rt, args[1], "Arguments");                            \
+    auto largest = optionalStringArg(rt, args[2], "largestUnit");              \
+    auto smallest = optionalStringArg(rt, args[3], "smallestUnit");            \
+    auto mode = optionalStringArg(rt, args[5], "roundingMode");                \
+    return toJSString(                                                         \
+        rt, cFunction(one.c_str(), two.c_str(), cstr(largest),                 \
+                      cstr(smallest), int64Arg(rt, args[4], "increment"),      \
+                      cstr(mode)));                                            \
+  }                                                                            \
+  }
+
+#define TEMPORAL_EPOCH_DIFFERENCE(jsName, cFunction)                           \
+  TEMPORAL_METHOD(jsName, 8) {                                                 \
+    auto largest = optionalStringArg(rt, args[4], "largestUnit");              \
+    auto smallest = optionalStringArg(rt, args[5], "smallestUnit");            \
+    auto mode = optionalStringArg(rt, args[7], "roundingMode");                \
+    return toJSString(                                                         \
+        rt, cFunction(epochArg(rt, args[0], args[1]),                          \
+                      epochArg(rt, args[2], args[3]), cstr(largest),           \
+                      cstr(smallest), int64Arg(rt, args[6], "increment"),      \
+                      cstr(mode)));                                            \
+  }                                                                            \
+  }
+
+#define TEMPORAL_ROUND(jsName, cFunction)                                      \
+  TEMPORAL_METHOD(jsName, 4) {                                                 \
+    auto s = stringArg(rt, args[0], "Arguments");                              \
+    auto unit = stringArg(rt, args[1], "smallestUnit");                        \
+    auto mode = optionalStringArg(rt, args[3], "roundingMode");                \
+    return toJSString(rt, cFunction(s.c_str(), unit.c_str(),                   \
+                                    int64Arg(rt, args[2], "increment"),        \
+                                    cstr(mode)));                              \
+  }                                                                            \
+  }
+
+#define TEMPORAL_HANDLE_FROM_STRING(jsName, cFunction)                         \
+  TEMPORAL_METHOD(jsName, 1) {                                                 \
+    auto s = stringArg(rt, args[0], "String");                                 \
+    return toJSHandle(rt, cFunction(s.c_str()));                               \
+  }                                                                            \
+  }
+
+#define TEMPORAL_HANDLE_DURATION(jsName, cFunction)                            \
+  TEMPORAL_METHOD(jsName, 2) {                                                 \
+    return toJSHandle(                                                         \
+        rt, cFunction(handleArg(rt, args[0]), handleArg(rt, args[1])));        \
+  }                                                                            \
+  }
+
+#define TEMPORAL_HANDLE_ROUND(jsName, cFunction)                               \
+  TEMPORAL_METHOD(jsName, 4) {                                                 \
+    auto unit = stringArg(rt, args[1], "smallestUnit");                        \
+    auto mode = optionalStringArg(rt, args[3], "roundingMode");                \
+    return toJSHandle(rt, cFunction(handleArg(rt, args[0]), unit.c_str(),      \
+                                    int64Arg(rt, args[2], "increment"),        \
+                                    cstr(mode)));                              \
+  }                                                                            \
+  }
+
+const MethodEntry kMethods[] = {
+    // Instant
+    TEMPORAL_METHOD("instantNow", 0) {
+      char *now = temporal_instant_now();
+      if (now == nullptr) {
+        throwRangeError(rt, "Failed to get current instant");
+      }
+      jsi::String str = jsi::String::createFromUtf8(rt, now);
+      temporal_free_string(now);
+      return str;
+    }
+    },
+    TEMPORAL_STRING_1_INTO("instantFromString",
+                           temporal_instant_from_string_into),
+    TEMPORAL_METHOD("instantFromEpochMilliseconds", 1) {
+      int64_t ms = int64Arg(rt, args[0], "Milliseconds");
+      return toJSStringInto(rt, [ms](char *buf, size_t cap, size_t *len) {
+        return temporal_instant_from_epoch_milliseconds_into(ms, buf, cap, len);
+      });
+    }
+    },
+    TEMPORAL_STRING_1("instantFromEpochNanoseconds",
+                      temporal_instant_from_epoch_nanoseconds),
+    TEMPORAL_NUMBER_1("instantEpochMilliseconds",
+                      temporal_instant_epoch_milliseconds),
+    TEMPORAL_STRING_1("instantEpochNanoseconds",
+                      temporal_instant_epoch_nanoseconds),
+    TEMPORAL_STRING_2_INTO("instantAdd", temporal_instant_add_into),
+    TEMPORAL_STRING_2_INTO("instantSubtract", temporal_instant_subtract_into),
+    TEMPORAL_COMPARE("instantCompare", temporal_instant_compare),
+    TEMPORAL_DIFFERENCE("instantUntil", temporal_instant_until),
+    TEMPORAL_DIFFERENCE("instantSince", temporal_instant_since),
+    TEMPORAL_ROUND("instantRound", temporal_instant_round),
+    TEMPORAL_METHOD("instantToZonedDateTime", 3) {
+      auto instant = stringArg(rt, args[0], "Instant");
+      auto calendar = optionalStringArg(rt, args[1], "calendarId");
+      auto timeZone = stringArg(rt, args[2], "timeZoneId");
+      return toJSString(rt, temporal_instant_to_zoned_date_time(
+                                instant.c_str(), cstr(calendar),
+                                timeZone.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("instantParseEpochNanoseconds", 1) {
+      auto s = stringArg(rt, args[0], "String");
+      TemporalEpochNanoseconds epoch = {0, 0};
+      int32_t errorType =
+          temporal_instant_parse_epoch_nanoseconds(s.c_str(), &epoch);
+      return toJSEpoch(rt, errorType, epoch);
+    }
+    },
+    TEMPORAL_METHOD("instantNowEpochNanoseconds", 0) {
+      TemporalEpochNanoseconds epoch = {0, 0};
+      int32_t errorType = temporal_instant_now_epoch_nanoseconds(&epoch);
+      return toJSEpoch(rt, errorType, epoch);
+    }
+    },
+    TEMPORAL_METHOD("instantFormatEpochNanoseconds", 2) {
+      TemporalEpochNanoseconds epoch = epochArg(rt, args[0], args[1]);
+      return toJSStringInto(rt, [epoch](char *buf, size_t cap, size_t *len) {
+        return temporal_instant_format_epoch_nanoseconds_into(epoch, buf, cap,
+                                                              len);
+      });
+    }
+    },
+    TEMPORAL_METHOD("instantRoundEpochNanoseconds", 5) {
+      TemporalEpochNanoseconds epoch = epochArg(rt, args[0], args[1]);
+      auto unit = stringArg(rt, args[2], "smallestUnit");
+      auto mode = optionalStringArg(rt, args[4], "roundingMode");
+      TemporalEpochNanoseconds rounded = {0, 0};
+      int32_t errorType = temporal_instant_round_epoch_nanoseconds(
+          epoch, unit.c_str(), int64Arg(rt, args[3], "increment"), cstr(mode),
+          &rounded);
+      return toJSEpoch(rt, errorType, rounded);
+    }
+    },
+    TEMPORAL_EPOCH_DIFFERENCE("instantUntilEpochNanoseconds",
+                              temporal_instant_until_epoch_nanoseconds),
+    TEMPORAL_EPOCH_DIFFERENCE("instantSinceEpochNanoseconds",
+                              temporal_instant_since_epoch_nanoseconds),
+
+    // PlainTime
+    TEMPORAL_STRING_1("plainTimeFromString", temporal_plain_time_from_string),
+    TEMPORAL_METHOD("plainTimeFromComponents", 6) {
+      return toJSString(rt, temporal_plain_time_from_components(
+                                (uint8_t)int32Arg(rt, args[0], "hour"),
+                                (uint8_t)int32Arg(rt, args[1], "minute"),
+                                (uint8_t)int32Arg(rt, args[2], "second"),
+                                (uint16_t)int32Arg(rt, args[3], "millisecond"),
+                                (uint16_t)int32Arg(rt, args[4], "microsecond"),
+                                (uint16_t)int32Arg(rt, args[5], "nanosecond")));
+    }
+    },
+    TEMPORAL_METHOD("plainTimeGetAllComponents", 1) {
+      auto s = stringArg(rt, args[0], "PlainTime string");
+      PlainTimeComponents c;
+      temporal_plain_time_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid plain time");
+      }
+      return toJSArray(rt, {(double)c.hour, (double)c.minute,
+                            (double)c.second, (double)c.millisecond,
+                            (double)c.microsecond, (double)c.nanosecond});
+    }
+    },
+    TEMPORAL_METHOD("plainTimeFromStringWithComponents", 2) {
+      return fromStringWithComponents(
+          rt, args, "PlainTime string", kPlainTimeComponentSlots,
+          temporal_plain_time_from_string_with_components);
+    }
+    },
+    TEMPORAL_STRING_2("plainTimeAdd", temporal_plain_time_add),
+    TEMPORAL_STRING_2("plainTimeSubtract", temporal_plain_time_subtract),
+    TEMPORAL_COMPARE("plainTimeCompare", temporal_plain_time_compare),
+    TEMPORAL_DIFFERENCE("plainTimeUntil", temporal_plain_time_until),
+    TEMPORAL_DIFFERENCE("plainTimeSince", temporal_plain_time_since),
+    TEMPORAL_ROUND("plainTimeRound", temporal_plain_time_round),
+
+    // PlainDate
+    TEMPORAL_STRING_1("plainDateFromString", temporal_plain_date_from_string),
+    TEMPORAL_METHOD("plainDateFromComponents", 4) {
+      auto calendar = optionalStringArg(rt, args[3], "calendarId");
+      return toJSString(rt, temporal_plain_date_from_components(
+                                int32Arg(rt, args[0], "year"),
+                                (uint8_t)int32Arg(rt, args[1], "month"),
+                                (uint8_t)int32Arg(rt, args[2], "day"),
+                                cstr(calendar)));
+    }
+    },
+    TEMPORAL_METHOD("plainDateGetAllComponents", 1) {
+      auto s = stringArg(rt, args[0], "PlainDate string");
+      PlainDateComponents c;
+      temporal_plain_date_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid plain date");
+      }
+      return toJSArray(
+          rt, {(double)c.year, (double)c.month, (double)c.day,
+               (double)c.day_of_week, (double)c.day_of_year,
+               (double)c.week_of_year, (double)c.year_of_week,
+               (double)c.days_in_week, (double)c.days_in_month,
+               (double)c.days_in_year, (double)c.months_in_year,
+               (double)c.in_leap_year});
+    }
+    },
+    TEMPORAL_METHOD("plainDateFromStringWithComponents", 2) {
+      return fromStringWithComponents(
+          rt, args, "PlainDate string", kPlainDateComponentSlots,
+          temporal_plain_date_from_string_with_components);
+    }
+    },
+    TEMPORAL_STRING_1("plainDateGetMonthCode",
+                      temporal_plain_date_get_month_code),
+    TEMPORAL_STRING_1("plainDateGetCalendar", temporal_plain_date_get_calendar),
+    TEMPORAL_STRING_2("plainDateAdd", temporal_plain_date_add),
+    TEMPORAL_STRING_2("plainDateSubtract", temporal_plain_date_subtract),
+    TEMPORAL_COMPARE("plainDateCompare", temporal_plain_date_compare),
+    TEMPORAL_METHOD("plainDateWith", 5) {
+      auto date = stringArg(rt, args[0], "PlainDate string");
+      auto calendar = optionalStringArg(rt, args[4], "calendarId");
+      return toJSString(rt, temporal_plain_date_with(
+                                date.c_str(), int32Arg(rt, args[1], "year"),
+                                int32Arg(rt, args[2], "month"),
+                                int32Arg(rt, args[3], "day"), cstr(calendar)));
+    }
+    },
+    TEMPORAL_STRING_2("plainDateUntil", temporal_plain_date_until),
+    TEMPORAL_STRING_2("plainDateSince", temporal_plain_date_since),
+
+    // PlainDateTime
+    TEMPORAL_STRING_1_INTO("plainDateTimeFromString",
+                           temporal_plain_date_time_from_string_into),
+    TEMPORAL_METHOD("plainDateTimeFromComponents", 10) {
+      auto calendar = optionalStringArg(rt, args[9], "calendarId");
+      return toJSString(
+          rt, temporal_plain_date_time_from_components(
+                  int32Arg(rt, args[0], "year"),
+                  (uint8_t)int32Arg(rt, args[1], "month"),
+                  (uint8_t)int32Arg(rt, args[2], "day"),
+                  (uint8_t)int32Arg(rt, args[3], "hour"),
+                  (uint8_t)int32Arg(rt, args[4], "minute"),
+                  (uint8_t)int32Arg(rt, args[5], "second"),
+                  (uint16_t)int32Arg(rt, args[6], "millisecond"),
+                  (uint16_t)int32Arg(rt, args[7], "microsecond"),
+                  (uint16_t)int32Arg(rt, args[8], "nanosecond"),
+                  cstr(calendar)));
+    }
+    },
+    TEMPORAL_METHOD("plainDateTimeGetAllComponents", 1) {
+      auto s = stringArg(rt, args[0], "PlainDateTime string");
+      PlainDateTimeComponents c;
+      temporal_plain_date_time_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid plain date time");
+      }
+      return plainDateTimeComponentsToJS(rt, c);
+    }
+    },
+    TEMPORAL_METHOD("plainDateTimeGetAllComponentsInto", 2) {
+      auto s = stringArg(rt, args[0], "PlainDateTime string");
+      int32_t *out =
+          componentBufferArg(rt, args[1], kPlainDateTimeComponentSlots);
+      PlainDateTimeComponents c;
+      temporal_plain_date_time_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid plain date time");
+      }
+      writeComponents(out, c);
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_METHOD("plainDateTimeFromStringWithComponents", 2) {
+      return fromStringWithComponents(
+          rt, args, "PlainDateTime string", kPlainDateTimeComponentSlots,
+          temporal_plain_date_time_from_string_with_components);
+    }
+    },
+    TEMPORAL_STRING_1("plainDateTimeGetMonthCode",
+                      temporal_plain_date_time_get_month_code),
+    TEMPORAL_STRING_1("plainDateTimeGetCalendar",
+                      temporal_plain_date_time_get_calendar),
+    TEMPORAL_STRING_2("plainDateTimeAdd", temporal_plain_date_time_add),
+    TEMPORAL_STRING_2("plainDateTimeSubtract",
+                      temporal_plain_date_time_subtract),
+    TEMPORAL_COMPARE("plainDateTimeCompare", temporal_plain_date_time_compare),
+    TEMPORAL_METHOD("plainDateTimeWith", 11) {
+      auto dt = stringArg(rt, args[0], "PlainDateTime string");
+      auto calendar = optionalStringArg(rt, args[10], "calendarId");
+      return toJSString(
+          rt, temporal_plain_date_time_with(
+                  dt.c_str(), int32Arg(rt, args[1], "year"),
+                  int32Arg(rt, args[2], "month"), int32Arg(rt, args[3], "day"),
+                  int32Arg(rt, args[4], "hour"),
+                  int32Arg(rt, args[5], "minute"),
+                  int32Arg(rt, args[6], "second"),
+                  int32Arg(rt, args[7], "millisecond"),
+                  int32Arg(rt, args[8], "microsecond"),
+                  int32Arg(rt, args[9], "nanosecond"), cstr(calendar)));
+    }
+    },
+    TEMPORAL_STRING_2("plainDateTimeUntil", temporal_plain_date_time_until),
+    TEMPORAL_STRING_2("plainDateTimeSince", temporal_plain_date_time_since),
+
+    // PlainYearMonth
+    TEMPORAL_STRING_1("plainYearMonthFromString",
+                      temporal_plain_year_month_from_string),
+    TEMPORAL_METHOD("plainYearMonthFromComponents", 4) {
+      auto calendar = optionalStringArg(rt, args[2], "calendarId");
+      return toJSString(rt, temporal_plain_year_month_from_components(
+                                int32Arg(rt, args[0], "year"),
+                                (uint8_t)int32Arg(rt, args[1], "month"),
+                                cstr(calendar),
+                                (uint8_t)int32Arg(rt, args[3], "referenceDay")));
+    }
+    },
+    TEMPORAL_METHOD("plainYearMonthGetAllComponents", 1) {
+      auto s = stringArg(rt, args[0], "String");
+      PlainYearMonthComponents c;
+      temporal_plain_year_month_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid plain year month");
+      }
+      return toJSArray(rt, {(double)c.year, (double)c.month, (double)c.day,
+                            (double)c.days_in_month, (double)c.days_in_year,
+                            (double)c.months_in_year, (double)c.in_leap_year,
+                            (double)c.era_year});
+    }
+    },
+    TEMPORAL_STRING_1("plainYearMonthGetMonthCode",
+                      temporal_plain_year_month_get_month_code),
+    TEMPORAL_STRING_1("plainYearMonthGetCalendar",
+                      temporal_plain_year_month_get_calendar),
+    TEMPORAL_STRING_2("plainYearMonthAdd", temporal_plain_year_month_add),
+    TEMPORAL_STRING_2("plainYearMonthSubtract",
+                      temporal_plain_year_month_subtract),
+    TEMPORAL_COMPARE("plainYearMonthCompare",
+                     temporal_plain_year_month_compare),
+    TEMPORAL_METHOD("plainYearMonthWith", 4) {
+      auto ym = stringArg(rt, args[0], "String");
+      auto calendar = optionalStringArg(rt, args[3], "calendarId");
+      return toJSString(rt, temporal_plain_year_month_with(
+                                ym.c_str(), int32Arg(rt, args[1], "year"),
+                                int32Arg(rt, args[2], "month"),
+                                cstr(calendar)));
+    }
+    },
+    TEMPORAL_STRING_2("plainYearMonthUntil", temporal_plain_year_month_until),
+    TEMPORAL_STRING_2("plainYearMonthSince", temporal_plain_year_month_since),
+    TEMPORAL_METHOD("plainYearMonthToPlainDate", 2) {
+      auto ym = stringArg(rt, args[0], "String");
+      return toJSString(rt, temporal_plain_year_month_to_plain_date(
+                                ym.c_str(), int32Arg(rt, args[1], "day")));
+    }
+    },
+
+    // PlainMonthDay
+    TEMPORAL_STRING_1("plainMonthDayFromString",
+                      temporal_plain_month_day_from_string),
+    TEMPORAL_METHOD("plainMonthDayFromComponents", 4) {
+      auto calendar = optionalStringArg(rt, args[2], "calendarId");
+      return toJSString(rt, temporal_plain_month_day_from_components(
+                                (uint8_t)int32Arg(rt, args[0], "month"),
+                                (uint8_t)int32Arg(rt, args[1], "day"),
+                                cstr(calendar),
+                                int32Arg(rt, args[3], "referenceYear")));
+    }
+    },
+    TEMPORAL_METHOD("plainMonthDayGetAllComponents", 1) {
+      auto s = stringArg(rt, args[0], "String");
+      PlainMonthDayComponents c;
+      temporal_plain_month_day_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid plain month day");
+      }
+      return toJSArray(rt, {(double)c.month, (double)c.day});
+    }
+    },
+    TEMPORAL_STRING_1("plainMonthDayGetMonthCode",
+                      temporal_plain_month_day_get_month_code),
+    TEMPORAL_STRING_1("plainMonthDayGetCalendar",
+                      temporal_plain_month_day_get_calendar),
+    TEMPORAL_METHOD("plainMonthDayToPlainDate", 2) {
+      auto md = stringArg(rt, args[0], "String");
+      return toJSString(rt, temporal_plain_month_day_to_plain_date(
+                                md.c_str(), int32Arg(rt, args[1], "year")));
+    }
+    },
+
+    // Calendar
+    TEMPORAL_STRING_1("calendarFrom", temporal_calendar_from),
+    TEMPORAL_STRING_1("calendarId", temporal_calendar_id),
+
+    // TimeZone
+    TEMPORAL_STRING_1("timeZoneFromString", temporal_time_zone_from_string),
+    TEMPORAL_STRING_1("timeZoneGetId", temporal_time_zone_get_id),
+    TEMPORAL_METHOD("timeZoneGetOffsetNanosecondsFor", 2) {
+      auto tz = stringArg(rt, args[0], "Arguments");
+      auto instant = stringArg(rt, args[1], "Arguments");
+      return toJSNumber(rt, temporal_time_zone_get_offset_nanoseconds_for(
+                                tz.c_str(), instant.c_str()));
+    }
+    },
+    TEMPORAL_STRING_2("timeZoneGetOffsetStringFor",
+                      temporal_time_zone_get_offset_string_for),
+    TEMPORAL_METHOD("timeZoneGetPlainDateTimeFor", 3) {
+      auto tz = stringArg(rt, args[0], "Arguments");
+      auto instant = stringArg(rt, args[1], "Arguments");
+      auto calendar = optionalStringArg(rt, args[2], "calendarId");
+      return toJSString(rt, temporal_time_zone_get_plain_date_time_for(
+                                tz.c_str(), instant.c_str(), cstr(calendar)));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetInstantFor", 3) {
+      auto tz = stringArg(rt, args[0], "Arguments");
+      auto dt = stringArg(rt, args[1], "Arguments");
+      auto disambiguation = optionalStringArg(rt, args[2], "disambiguation");
+      return toJSString(rt, temporal_time_zone_get_instant_for(
+                                tz.c_str(), dt.c_str(), cstr(disambiguation)));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetNextTransition", 2) {
+      auto tz = stringArg(rt, args[0], "Arguments");
+      auto instant = stringArg(rt, args[1], "Arguments");
+      return toJSStringOrNull(rt, temporal_time_zone_get_next_transition(
+                                      tz.c_str(), instant.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetPreviousTransition", 2) {
+      auto tz = stringArg(rt, args[0], "Arguments");
+      auto instant = stringArg(rt, args[1], "Arguments");
+      return toJSStringOrNull(rt, temporal_time_zone_get_previous_transition(
+                                      tz.c_str(), instant.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneCacheStats", 0) {
+      TimeZoneCacheStats stats = temporal_time_zone_cache_stats();
+      return toJSArray(rt, {(double)stats.hits, (double)stats.misses,
+                            (double)stats.size});
+    }
+    },
+    TEMPORAL_METHOD("timeZoneCacheClear", 0) {
+      temporal_time_zone_cache_clear();
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_METHOD("setBatchThreads", 1) {
+      checkStatus(rt, temporal_set_batch_threads(
+                          int32Arg(rt, args[0], "Batch threads")));
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_METHOD("getBatchThreads", 0) {
+      return jsi::Value(temporal_get_batch_threads());
+    }
+    },
+    TEMPORAL_METHOD("validate", 2) {
+      int32_t kind = int32Arg(rt, args[0], "Kind");
+      auto s = stringArg(rt, args[1], "String");
+      return jsi::Value(temporal_validate(kind, s.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("lastErrorMessage", 0) {
+      const char *message = temporal_last_error_message();
+      if (message == nullptr) {
+        return jsi::Value::null();
+      }
+      return jsi::String::createFromUtf8(rt, message);
+    }
+    },
+    TEMPORAL_METHOD("getStats", 0) {
+      return toJSString(rt, temporal_stats_to_json());
+    }
+    },
+    TEMPORAL_METHOD("resetStats", 0) {
+      temporal_stats_reset();
+      return jsi::Value::undefined();
+    }
+    },
+
+    // Binary records
+    TEMPORAL_METHOD("zonedDateTimeToBytes", 1) {
+      auto s = stringArg(rt, args[0], "Zoned date time");
+      uint8_t record[TEMPORAL_BINARY_SIZE];
+      int32_t errorType = temporal_zoned_date_time_to_bytes(s.c_str(), record);
+      return bytesToJS(rt, errorType, record);
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeFromBytes", 1) {
+      auto record = binaryArrayArg(rt, args[0]);
+      return toJSString(rt, temporal_zoned_date_time_from_bytes(record.data()));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeToBytesMany", 3) {
+      auto batch = stringArrayArg(rt, args[0], "strings");
+      uint8_t *out =
+          binaryBufferArg(rt, args[1], args[2], batch.pointers.size());
+      BatchResult result = temporal_zoned_date_time_to_bytes_many(
+          batch.pointers.data(), batch.size(), out);
+      checkBatchResult(rt, result);
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeFromBytesMany", 3) {
+      return fromBytesManyToJS(rt, args, temporal_zoned_date_time_from_bytes);
+    }
+    },
+    TEMPORAL_METHOD("instantToStringWithOptions", 4) {
+      auto s = stringArg(rt, args[0], "Instant");
+      int32_t digits = int32Arg(rt, args[1], "fractionalSecondDigits");
+      auto unit = optionalStringArg(rt, args[2], "smallestUnit");
+      auto mode = optionalStringArg(rt, args[3], "roundingMode");
+      return toJSString(rt, temporal_instant_to_string_with_options(
+                                s.c_str(), digits, cstr(unit), cstr(mode)));
+    }
+    },
+    TEMPORAL_METHOD("plainTimeToStringWithOptions", 4) {
+      auto s = stringArg(rt, args[0], "Plain time");
+      int32_t digits = int32Arg(rt, args[1], "fractionalSecondDigits");
+      auto unit = optionalStringArg(rt, args[2], "smallestUnit");
+      auto mode = optionalStringArg(rt, args[3], "roundingMode");
+      return toJSString(rt, temporal_plain_time_to_string_with_options(
+                                s.c_str(), digits, cstr(unit), cstr(mode)));
+    }
+    },
+    TEMPORAL_METHOD("plainDateTimeToStringWithOptions", 5) {
+      auto s = stringArg(rt, args[0], "Plain date time");
+      int32_t digits = int32Arg(rt, args[1], "fractionalSecondDigits");
+      auto unit = optionalStringArg(rt, args[2], "smallestUnit");
+      auto mode = optionalStringArg(rt, args[3], "roundingMode");
+      auto calendar = optionalStringArg(rt, args[4], "calendarName");
+      return toJSString(rt, temporal_plain_date_time_to_string_with_options(
+                                s.c_str(), digits, cstr(unit), cstr(mode),
+                                cstr(calendar)));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeToStringWithOptions", 7) {
+      auto s = stringArg(rt, args[0], "Zoned date time");
+      int32_t digits = int32Arg(rt, args[1], "fractionalSecondDigits");
+      auto unit = optionalStringArg(rt, args[2], "smallestUnit");
+      auto mode = optionalStringArg(rt, args[3], "roundingMode");
+      auto calendar = optionalStringArg(rt, args[4], "calendarName");
+      auto timeZone = optionalStringArg(rt, args[5], "timeZoneName");
+      auto offset = optionalStringArg(rt, args[6], "offset");
+      return toJSString(rt, temporal_zoned_date_time_to_string_with_options(
+                                s.c_str(), digits, cstr(unit), cstr(mode),
+                                cstr(calendar), cstr(timeZone), cstr(offset)));
+    }
+    },
+    TEMPORAL_METHOD("toStringOptionsNew", 6) {
+      int32_t digits = int32Arg(rt, args[0], "fractionalSecondDigits");
+      auto unit = optionalStringArg(rt, args[1], "smallestUnit");
+      auto mode = optionalStringArg(rt, args[2], "roundingMode");
+      auto calendar = optionalStringArg(rt, args[3], "calendarName");
+      auto timeZone = optionalStringArg(rt, args[4], "timeZoneName");
+      auto offset = optionalStringArg(rt, args[5], "offset");
+      TemporalToStringOptions options = 0;
+      checkStatus(rt, temporal_to_string_options_new(
+                          digits, cstr(unit), cstr(mode), cstr(calendar),
+                          cstr(timeZone), cstr(offset), &options));
+      return jsi::Value(static_cast<double>(options));
+    }
+    },
+    TEMPORAL_METHOD("instantToStringWithPackedOptions", 2) {
+      auto s = stringArg(rt, args[0], "Instant");
+      return toJSString(
+          rt, temporal_instant_to_string_with_packed_options(s.c_str(),
+                  toStringOptionsArg(rt, args[1])));
+    }
+    },
+    TEMPORAL_METHOD("plainTimeToStringWithPackedOptions", 2) {
+      auto s = stringArg(rt, args[0], "Plain time");
+      return toJSString(
+          rt, temporal_plain_time_to_string_with_packed_options(s.c_str(),
+                  toStringOptionsArg(rt, args[1])));
+    }
+    },
+    TEMPORAL_METHOD("plainDateTimeToStringWithPackedOptions", 2) {
+      auto s = stringArg(rt, args[0], "Plain date time");
+      return toJSString(
+          rt, temporal_plain_date_time_to_string_with_packed_options(s.c_str(),
+                  toStringOptionsArg(rt, args[1])));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeToStringWithPackedOptions", 2) {
+      auto s = stringArg(rt, args[0], "Zoned date time");
+      return toJSString(
+          rt, temporal_zoned_date_time_to_string_with_packed_options(s.c_str(),
+                  toStringOptionsArg(rt, args[1])));
+    }
+    },
+
+    // ZonedDateTime
+    TEMPORAL_STRING_1_INTO("zonedDateTimeFromString",
+                           temporal_zoned_date_time_from_string_into),
+    TEMPORAL_METHOD("zonedDateTimeFromComponents", 12) {
+      auto calendar = optionalStringArg(rt, args[9], "calendarId");
+      auto timeZone = stringArg(rt, args[10], "timeZoneId");
+      return toJSString(
+          rt, temporal_zoned_date_time_from_components(
+                  int32Arg(rt, args[0], "year"),
+                  (uint8_t)int32Arg(rt, args[1], "month"),
+                  (uint8_t)int32Arg(rt, args[2], "day"),
+                  (uint8_t)int32Arg(rt, args[3], "hour"),
+                  (uint8_t)int32Arg(rt, args[4], "minute"),
+                  (uint8_t)int32Arg(rt, args[5], "second"),
+                  (uint16_t)int32Arg(rt, args[6], "millisecond"),
+                  (uint16_t)int32Arg(rt, args[7], "microsecond"),
+                  (uint16_t)int32Arg(rt, args[8], "nanosecond"),
+                  cstr(calendar), timeZone.c_str(),
+                  int64Arg(rt, args[11], "offsetNanoseconds")));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeGetAllComponents", 1) {
+      auto s = stringArg(rt, args[0], "String");
+      ZonedDateTimeComponents c;
+      temporal_zoned_date_time_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid zoned date time");
+      }
+      return zonedDateTimeComponentsToJS(rt, c);
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeGetAllComponentsInto", 2) {
+      auto s = stringArg(rt, args[0], "String");
+      int32_t *out =
+          componentBufferArg(rt, args[1], kZonedDateTimeComponentSlots);
+      ZonedDateTimeComponents c;
+      temporal_zoned_date_time_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid zoned date time");
+      }
+      writeComponents(out, c);
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeFromStringWithComponents", 2) {
+      return fromStringWithComponents(
+          rt, args, "String", kZonedDateTimeComponentSlots,
+          temporal_zoned_date_time_from_string_with_components);
+    }
+    },
+    TEMPORAL_NUMBER_1("zonedDateTimeEpochMilliseconds",
+                      temporal_zoned_date_time_epoch_milliseconds),
+    TEMPORAL_STRING_1("zonedDateTimeEpochNanoseconds",
+                      temporal_zoned_date_time_epoch_nanoseconds),
+    TEMPORAL_STRING_1("zonedDateTimeGetCalendar",
+                      temporal_zoned_date_time_get_calendar),
+    TEMPORAL_STRING_1("zonedDateTimeGetTimeZone",
+                      temporal_zoned_date_time_get_time_zone),
+    TEMPORAL_STRING_1("zonedDateTimeGetOffset",
+                      temporal_zoned_date_time_get_offset),
+    TEMPORAL_STRING_2("zonedDateTimeAdd", temporal_zoned_date_time_add),
+    TEMPORAL_STRING_2("zonedDateTimeSubtract",
+                      temporal_zoned_date_time_subtract),
+    TEMPORAL_COMPARE("zonedDateTimeCompare", temporal_zoned_date_time_compare),
+    TEMPORAL_METHOD("zonedDateTimeWith", 13) {
+      auto zdt = stringArg(rt, args[0], "String");
+      auto calendar = optionalStringArg(rt, args[11], "calendarId");
+      auto timeZone = optionalStringArg(rt, args[12], "timeZoneId");
+      return toJSString(
+          rt, temporal_zoned_date_time_with(
+                  zdt.c_str(), int32Arg(rt, args[1], "year"),
+                  int32Arg(rt, args[2], "month"), int32Arg(rt, args[3], "day"),
+                  int32Arg(rt, args[4], "hour"),
+                  int32Arg(rt, args[5], "minute"),
+                  int32Arg(rt, args[6], "second"),
+                  int32Arg(rt, args[7], "millisecond"),
+                  int32Arg(rt, args[8], "microsecond"),
+                  int32Arg(rt, args[9], "nanosecond"),
+                  int64Arg(rt, args[10], "offsetNs"), cstr(calendar),
+                  cstr(timeZone)));
+    }
+    },
+    TEMPORAL_STRING_2("zonedDateTimeUntil", temporal_zoned_date_time_until),
+    TEMPORAL_STRING_2("zonedDateTimeSince", temporal_zoned_date_time_since),
+    TEMPORAL_ROUND("zonedDateTimeRound", temporal_zoned_date_time_round),
+    TEMPORAL_STRING_1("zonedDateTimeToInstant",
+                      temporal_zoned_date_time_to_instant),
+    TEMPORAL_STRING_1("zonedDateTimeToPlainDate",
+                      temporal_zoned_date_time_to_plain_date),
+    TEMPORAL_STRING_1("zonedDateTimeToPlainTime",
+                      temporal_zoned_date_time_to_plain_time),
+    TEMPORAL_STRING_1("zonedDateTimeToPlainDateTime",
+                      temporal_zoned_date_time_to_plain_date_time),
+
+    // Duration
+    TEMPORAL_STRING_1("durationFromString", temporal_duration_from_string),
+    TEMPORAL_METHOD("durationFromComponents", 10) {
+      return toJSString(
+          rt, temporal_duration_from_components(
+                  int64Arg(rt, args[0], "years"),
+                  int64Arg(rt, args[1], "months"),
+                  int64Arg(rt, args[2], "weeks"), int64Arg(rt, args[3], "days"),
+                  int64Arg(rt, args[4], "hours"),
+                  int64Arg(rt, args[5], "minutes"),
+                  int64Arg(rt, args[6], "seconds"),
+                  int64Arg(rt, args[7], "milliseconds"),
+                  int64Arg(rt, args[8], "microseconds"),
+                  int64Arg(rt, args[9], "nanoseconds")));
+    }
+    },
+    TEMPORAL_METHOD("durationGetAllComponents", 1) {
+      auto s = stringArg(rt, args[0], "Duration string");
+      DurationComponents c;
+      temporal_duration_get_components(s.c_str(), &c);
+      if (c.is_valid == 0) {
+        throwRangeError(rt, "Invalid duration: " + s);
+      }
+      return toJSArray(
+          rt, {(double)c.years, (double)c.months, (double)c.weeks,
+               (double)c.days, (double)c.hours, (double)c.minutes,
+               (double)c.seconds, (double)c.milliseconds,
+               (double)c.microseconds, (double)c.nanoseconds, (double)c.sign,
+               c.sign == 0 ? 1.0 : 0.0});
+    }
+    },
+    TEMPORAL_STRING_2("durationAdd", temporal_duration_add),
+    TEMPORAL_STRING_2("durationSubtract", temporal_duration_subtract),
+    TEMPORAL_STRING_1("durationNegated", temporal_duration_negated),
+    TEMPORAL_STRING_1("durationAbs", temporal_duration_abs),
+    TEMPORAL_COMPARE("durationCompare", temporal_duration_compare),
+    TEMPORAL_METHOD("durationWith", 11) {
+      auto original = stringArg(rt, args[0], "Duration string");
+      return toJSString(
+          rt, temporal_duration_with(
+                  original.c_str(), int64Arg(rt, args[1], "years"),
+                  int64Arg(rt, args[2], "months"),
+                  int64Arg(rt, args[3], "weeks"), int64Arg(rt, args[4], "days"),
+                  int64Arg(rt, args[5], "hours"),
+                  int64Arg(rt, args[6], "minutes"),
+                  int64Arg(rt, args[7], "seconds"),
+                  int64Arg(rt, args[8], "milliseconds"),
+                  int64Arg(rt, args[9], "microseconds"),
+                  int64Arg(rt, args[10], "nanoseconds")));
+    }
+    },
+
+    // Handles
+    TEMPORAL_METHOD("handleRelease", 1) {
+      checkStatus(rt, temporal_handle_release(handleArg(rt, args[0])));
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_METHOD("handleToString", 1) {
+      TemporalHandle *handle = handleArg(rt, args[0]);
+      return toJSStringInto(rt, [handle](char *buf, size_t cap, size_t *len) {
+        return temporal_handle_to_string_into(handle, buf, cap, len);
+      });
+    }
+    },
+    TEMPORAL_METHOD("handleCompare", 2) {
+      return toJSNumber(rt, temporal_handle_compare(handleArg(rt, args[0]),
+                                                    handleArg(rt, args[1])));
+    }
+    },
+    TEMPORAL_HANDLE_FROM_STRING("instantHandleFromString",
+                                temporal_instant_handle_from_string),
+    TEMPORAL_HANDLE_FROM_STRING("plainDateTimeHandleFromString",
+                                temporal_plain_date_time_handle_from_string),
+    TEMPORAL_HANDLE_FROM_STRING("zonedDateTimeHandleFromString",
+                                temporal_zoned_date_time_handle_from_string),
+    TEMPORAL_HANDLE_FROM_STRING("durationHandleFromString",
+                                temporal_duration_handle_from_string),
+    TEMPORAL_HANDLE_DURATION("instantHandleAdd", temporal_instant_handle_add),
+    TEMPORAL_HANDLE_DURATION("instantHandleSubtract",
+                             temporal_instant_handle_subtract),
+    TEMPORAL_HANDLE_ROUND("instantHandleRound", temporal_instant_handle_round),
+    TEMPORAL_HANDLE_DURATION("plainDateTimeHandleAdd",
+                             temporal_plain_date_time_handle_add),
+    TEMPORAL_HANDLE_DURATION("plainDateTimeHandleSubtract",
+                             temporal_plain_date_time_handle_subtract),
+    TEMPORAL_METHOD("plainDateTimeHandleWith", 11) {
+      auto calendar = optionalStringArg(rt, args[10], "calendarId");
+      return toJSHandle(
+          rt, temporal_plain_date_time_handle_with(
+                  handleArg(rt, args[0]), int32Arg(rt, args[1], "year"),
+                  int32Arg(rt, args[2], "month"), int32Arg(rt, args[3], "day"),
+                  int32Arg(rt, args[4], "hour"),
+                  int32Arg(rt, args[5], "minute"),
+                  int32Arg(rt, args[6], "second"),
+                  int32Arg(rt, args[7], "millisecond"),
+                  int32Arg(rt, args[8], "microsecond"),
+                  int32Arg(rt, args[9], "nanosecond"), cstr(calendar)));
+    }
+    },
+    TEMPORAL_METHOD("plainDateTimeHandleGetAllComponents", 1) {
+      PlainDateTimeComponents c;
+      temporal_plain_date_time_handle_get_components(handleArg(rt, args[0]),
+                                                     &c);
+      if (c.is_valid == 0) {
+        throwTypeError(rt, "Handle is not a PlainDateTime");
+      }
+      return plainDateTimeComponentsToJS(rt, c);
+    }
+    },
+    TEMPORAL_METHOD("plainDateTimeHandleGetAllComponentsInto", 2) {
+      int32_t *out =
+          componentBufferArg(rt, args[1], kPlainDateTimeComponentSlots);
+      PlainDateTimeComponents c;
+      temporal_plain_date_time_handle_get_components(handleArg(rt, args[0]),
+                                                     &c);
+      if (c.is_valid == 0) {
+        throwTypeError(rt, "Handle is not a PlainDateTime");
+      }
+      writeComponents(out, c);
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_HANDLE_DURATION("zonedDateTimeHandleAdd",
+                             temporal_zoned_date_time_handle_add),
+    TEMPORAL_HANDLE_DURATION("zonedDateTimeHandleSubtract",
+                             temporal_zoned_date_time_handle_subtract),
+    TEMPORAL_HANDLE_ROUND("zonedDateTimeHandleRound",
+                          temporal_zoned_date_time_handle_round),
+    TEMPORAL_METHOD("zonedDateTimeHandleWith", 12) {
+      auto calendar = optionalStringArg(rt, args[10], "calendarId");
+      auto timeZone = optionalStringArg(rt, args[11], "timeZoneId");
+      return toJSHandle(
+          rt, temporal_zoned_date_time_handle_with(
+                  handleArg(rt, args[0]), int32Arg(rt, args[1], "year"),
+                  int32Arg(rt, args[2], "month"), int32Arg(rt, args[3], "day"),
+                  int32Arg(rt, args[4], "hour"),
+                  int32Arg(rt, args[5], "minute"),
+                  int32Arg(rt, args[6], "second"),
+                  int32Arg(rt, args[7], "millisecond"),
+                  int32Arg(rt, args[8], "microsecond"),
+                  int32Arg(rt, args[9], "nanosecond"), cstr(calendar),
+                  cstr(timeZone)));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeHandleGetAllComponents", 1) {
+      ZonedDateTimeComponents c;
+      temporal_zoned_date_time_handle_get_components(handleArg(rt, args[0]),
+                                                     &c);
+      if (c.is_valid == 0) {
+        throwTypeError(rt, "Handle is not a ZonedDateTime");
+      }
+      return zonedDateTimeComponentsToJS(rt, c);
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeHandleGetAllComponentsInto", 2) {
+      int32_t *out =
+          componentBufferArg(rt, args[1], kZonedDateTimeComponentSlots);
+      ZonedDateTimeComponents c;
+      temporal_zoned_date_time_handle_get_components(handleArg(rt, args[0]),
+                                                     &c);
+      if (c.is_valid == 0) {
+        throwTypeError(rt, "Handle is not a ZonedDateTime");
+      }
+      writeComponents(out, c);
+      return jsi::Value::undefined();
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeRangeNew", 3) {
+      auto start = stringArg(rt, args[0], "Start");
+      auto step = stringArg(rt, args[1], "Step");
+      auto end = optionalStringArg(rt, args[2], "End");
+      return toJSHandle(rt, temporal_zoned_date_time_range_new(
+                                start.c_str(), step.c_str(), cstr(end)));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeRangeNextBatch", 2) {
+      int32_t n = int32Arg(rt, args[1], "Count");
+      std::vector<TemporalEpochNanoseconds> out(
+          std::clamp<int32_t>(n, 0, TEMPORAL_MAX_RECURRENCE_COUNT));
+      BatchResult result = temporal_zoned_date_time_range_next_batch(
+          handleArg(rt, args[0]), out.data(), n);
+      checkBatchResult(rt, result);
+      out.resize(result.count);
+      return epochPairsToJS(rt, out);
+    }
+    },
+
+    // Columns
+    TEMPORAL_METHOD("instantColumnFromEpochNanoseconds", 1) {
+      auto epochs = epochPairsArg(rt, args[0]);
+      return toJSHandle(rt, temporal_instant_column_from_epoch_nanoseconds(
+                                epochs.data(),
+                                static_cast<int32_t>(epochs.size())));
+    }
+    },
+    TEMPORAL_METHOD("instantColumnFromStrings", 1) {
+      auto batch = stringArrayArg(rt, args[0], "strings");
+      return toJSHandle(rt, temporal_instant_column_from_strings(
+                                batch.pointers.data(), batch.size()));
+    }
+    },
+    TEMPORAL_METHOD("plainDateColumnFromStrings", 1) {
+      auto batch = stringArrayArg(rt, args[0], "strings");
+      return toJSHandle(rt, temporal_plain_date_column_from_strings(
+                                batch.pointers.data(), batch.size()));
+    }
+    },
+    TEMPORAL_METHOD("columnLength", 1) {
+      return jsi::Value(columnLength(rt, handleArg(rt, args[0])));
+    }
+    },
+    TEMPORAL_METHOD("columnSlice", 3) {
+      return toJSHandle(rt, temporal_column_slice(
+                                handleArg(rt, args[0]),
+                                int32Arg(rt, args[1], "Start"),
+                                int32Arg(rt, args[2], "End")));
+    }
+    },
+    TEMPORAL_METHOD("instantColumnLowerBound", 3) {
+      int32_t index = 0;
+      checkStatus(rt, temporal_instant_column_lower_bound(
+                          handleArg(rt, args[0]),
+                          epochArg(rt, args[1], args[2]), &index));
+      return jsi::Value(index);
+    }
+    },
+    TEMPORAL_METHOD("instantColumnRangeCount", 5) {
+      int32_t count = 0;
+      checkStatus(rt, temporal_instant_column_range_count(
+                          handleArg(rt, args[0]),
+                          epochArg(rt, args[1], args[2]),
+                          epochArg(rt, args[3], args[4]), &count));
+      return jsi::Value(count);
+    }
+    },
+    TEMPORAL_METHOD("instantColumnRead", 3) {
+      TemporalHandle *column = handleArg(rt, args[0]);
+      int32_t start = std::max<int32_t>(int32Arg(rt, args[1], "Start"), 0);
+      int32_t n = std::clamp<int32_t>(
+          int32Arg(rt, args[2], "Count"), 0,
+          std::max<int32_t>(columnLength(rt, column) - start, 0));
+      std::vector<TemporalEpochNanoseconds> out(n);
+      BatchResult result =
+          temporal_instant_column_read(column, start, n, out.data());
+      checkBatchResult(rt, result);
+      out.resize(result.count);
+      return epochPairsToJS(rt, out);
+    }
+    },
+    TEMPORAL_METHOD("instantColumnBucketBy", 3) {
+      TemporalHandle *column = handleArg(rt, args[0]);
+      auto unit = stringArg(rt, args[1], "Unit");
+      auto tz = stringArg(rt, args[2], "Timezone");
+      int32_t cap = columnLength(rt, column);
+      std::vector<TemporalEpochNanoseconds> starts(cap);
+      std::vector<int32_t> counts(cap);
+      BatchResult result = temporal_instant_column_bucket_by(
+          column, unit.c_str(), tz.c_str(), starts.data(), counts.data(), cap);
+      checkBatchResult(rt, result);
+      jsi::Array array(rt, result.count * 3);
+      for (int32_t i = 0; i < result.count; i++) {
+        array.setValueAtIndex(
+            rt, i * 3, jsi::Value(static_cast<double>(starts[i].seconds)));
+        array.setValueAtIndex(rt, i * 3 + 1,
+                              jsi::Value(starts[i].nanoseconds));
+        array.setValueAtIndex(rt, i * 3 + 2, jsi::Value(counts[i]));
+      }
+      return array;
+    }
+    },
+    TEMPORAL_METHOD("plainDateColumnLowerBound", 2) {
+      auto date = stringArg(rt, args[1], "Date");
+      int32_t index = 0;
+      checkStatus(rt, temporal_plain_date_column_lower_bound(
+                          handleArg(rt, args[0]), date.c_str(), &index));
+      return jsi::Value(index);
+    }
+    },
+    TEMPORAL_METHOD("plainDateColumnRangeCount", 3) {
+      auto start = stringArg(rt, args[1], "Start");
+      auto end = stringArg(rt, args[2], "End");
+      int32_t count = 0;
+      checkStatus(rt, temporal_plain_date_column_range_count(
+                          handleArg(rt, args[0]), start.c_str(), end.c_str(),
+                          &count));
+      return jsi::Value(count);
+    }
+    },
+    TEMPORAL_METHOD("plainDateColumnRead", 3) {
+      TemporalHandle *column = handleArg(rt, args[0]);
+      int32_t start = std::max<int32_t>(int32Arg(rt, args[1], "Start"), 0);
+      int32_t n = std::clamp<int32_t>(
+          int32Arg(rt, args[2], "Count"), 0,
+          std::max<int32_t>(columnLength(rt, column) - start, 0));
+      std::vector<int32_t> out(n);
+      BatchResult result =
+          temporal_plain_date_column_read(column, start, n, out.data());
+      checkBatchResult(rt, result);
+      out.resize(result.count);
+      return toJSArray(rt, out);
+    }
+    },
+    TEMPORAL_METHOD("plainDateColumnBucketBy", 2) {
+      TemporalHandle *column = handleArg(rt, args[0]);
+      auto unit = stringArg(rt, args[1], "Unit");
+      int32_t cap = columnLength(rt, column);
+      std::vector<int32_t> starts(cap);
+      std::vector<int32_t> counts(cap);
+      BatchResult result = temporal_plain_date_column_bucket_by(
+          column, unit.c_str(), starts.data(), counts.data(), cap);
+      checkBatchResult(rt, result);
+      jsi::Array array(rt, result.count * 2);
+      for (int32_t i = 0; i < result.count; i++) {
+        array.setValueAtIndex(rt, i * 2, jsi::Value(starts[i]));
+        array.setValueAtIndex(rt, i * 2 + 1, jsi::Value(counts[i]));
+      }
+      return array;
+    }
+    },
+
+    // Zoned clocks
+    TEMPORAL_METHOD("zonedClockNew", 1) {
+      auto tz = stringArg(rt, args[0], "Timezone");
+      return toJSHandle(rt, temporal_zoned_clock_new(tz.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("zonedClockRead", 1) {
+      double out[kZonedClockSlots];
+      readZonedClock(rt, args[0], out);
+      jsi::Array array(rt, kZonedClockSlots);
+      for (size_t i = 0; i < kZonedClockSlots; i++) {
+        array.setValueAtIndex(rt, i, jsi::Value(out[i]));
+      }
+      return array;
+    }
+    },
+    TEMPORAL_METHOD("zonedClockReadInto", 2) {
+      if (!args[1].isObject() || !args[1].getObject(rt).isArrayBuffer(rt)) {
+        throwTypeError(rt, "Clock buffer must be an ArrayBuffer");
+      }
+      jsi::ArrayBuffer buffer = args[1].getObject(rt).getArrayBuffer(rt);
+      if (buffer.size(rt) < kZonedClockSlots * sizeof(double)) {
+        throwRangeError(rt, "Clock buffer is too small");
+      }
+      readZonedClock(rt, args[0], reinterpret_cast<double *>(buffer.data(rt)));
+      return jsi::Value::undefined();
+    }
+    },
+
+    // Batch
+    TEMPORAL_METHOD("instantParseMany", 1) {
+      return parseManyToJS(rt, args[0], temporal_instant_parse_many);
+    }
+    },
+    TEMPORAL_METHOD("instantParseStream", 4) {
+      return parseStreamToJS(rt, args);
+    }
+    },
+    TEMPORAL_METHOD("instantSort", 1) {
+      return sortToJS(rt, args[0], temporal_instant_sort);
+    }
+    },
+    TEMPORAL_METHOD("instantCompareMany", 2) {
+      return compareManyToJS(rt, args[0], args[1],
+                             temporal_instant_compare_many);
+    }
+    },
+    TEMPORAL_METHOD("plainDateSort", 1) {
+      return sortToJS(rt, args[0], temporal_plain_date_sort);
+    }
+    },
+    TEMPORAL_METHOD("plainDateCompareMany", 2) {
+      return compareManyToJS(rt, args[0], args[1],
+                             temporal_plain_date_compare_many);
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeParseMany", 1) {
+      return parseManyToJS(rt, args[0], temporal_zoned_date_time_parse_many);
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeSort", 1) {
+      return sortToJS(rt, args[0], temporal_zoned_date_time_sort);
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeCompareMany", 2) {
+      return compareManyToJS(rt, args[0], args[1],
+                             temporal_zoned_date_time_compare_many);
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetPlainDateTimesForMany", 2) {
+      auto tz = stringArg(rt, args[0], "Timezone");
+      auto epochs = epochPairsArg(rt, args[1]);
+      std::vector<int32_t> out(epochs.size() *
+                               TEMPORAL_PLAIN_DATE_TIME_COLUMN_COUNT);
+      BatchResult result = temporal_time_zone_get_plain_date_times_for_many(
+          tz.c_str(), epochs.data(), static_cast<int32_t>(epochs.size()),
+          out.data());
+      checkBatchResult(rt, result);
+      return toJSArray(rt, out);
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetTransitions", 6) {
+      auto tz = stringArg(rt, args[0], "Timezone");
+      int32_t cap = int32Arg(rt, args[5], "Cap");
+      std::vector<TemporalEpochNanoseconds> out(
+          std::clamp<int32_t>(cap, 0, TEMPORAL_MAX_TRANSITION_COUNT));
+      BatchResult result = temporal_time_zone_get_transitions(
+          tz.c_str(), epochArg(rt, args[1], args[2]),
+          epochArg(rt, args[3], args[4]), out.data(), cap);
+      checkBatchResult(rt, result);
+      out.resize(result.count);
+      return epochPairsToJS(rt, out);
+    }
+    },
+
+    // Interned identifiers
+    TEMPORAL_METHOD("timeZoneIntern", 1) {
+      auto tz = stringArg(rt, args[0], "Timezone");
+      uint32_t id = 0;
+      checkStatus(rt, temporal_intern_time_zone(tz.c_str(), &id));
+      return jsi::Value(static_cast<double>(id));
+    }
+    },
+    TEMPORAL_METHOD("calendarIntern", 1) {
+      auto calendar = stringArg(rt, args[0], "Calendar");
+      uint32_t id = 0;
+      checkStatus(rt, temporal_intern_calendar(calendar.c_str(), &id));
+      return jsi::Value(static_cast<double>(id));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetOffsetNanosecondsForInterned", 2) {
+      auto instant = stringArg(rt, args[1], "Instant");
+      return toJSNumber(rt,
+                        temporal_time_zone_get_offset_nanoseconds_for_interned(
+                            internedArg(rt, args[0], "Timezone"),
+                            instant.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetOffsetStringForInterned", 2) {
+      auto instant = stringArg(rt, args[1], "Instant");
+      return toJSString(rt, temporal_time_zone_get_offset_string_for_interned(
+                                internedArg(rt, args[0], "Timezone"),
+                                instant.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetPlainDateTimeForInterned", 3) {
+      auto instant = stringArg(rt, args[1], "Instant");
+      return toJSString(rt,
+                        temporal_time_zone_get_plain_date_time_for_interned(
+                            internedArg(rt, args[0], "Timezone"),
+                            instant.c_str(),
+                            internedArg(rt, args[2], "Calendar")));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetInstantForInterned", 3) {
+      auto dt = stringArg(rt, args[1], "Plain date time");
+      auto disambiguation = optionalStringArg(rt, args[2], "disambiguation");
+      return toJSString(rt, temporal_time_zone_get_instant_for_interned(
+                                internedArg(rt, args[0], "Timezone"),
+                                dt.c_str(), cstr(disambiguation)));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetNextTransitionInterned", 2) {
+      auto instant = stringArg(rt, args[1], "Instant");
+      return toJSStringOrNull(
+          rt, temporal_time_zone_get_next_transition_interned(
+                  internedArg(rt, args[0], "Timezone"), instant.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetPreviousTransitionInterned", 2) {
+      auto instant = stringArg(rt, args[1], "Instant");
+      return toJSStringOrNull(
+          rt, temporal_time_zone_get_previous_transition_interned(
+                  internedArg(rt, args[0], "Timezone"), instant.c_str()));
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetTransitionsInterned", 6) {
+      int32_t cap = int32Arg(rt, args[5], "Cap");
+      std::vector<TemporalEpochNanoseconds> out(
+          std::clamp<int32_t>(cap, 0, TEMPORAL_MAX_TRANSITION_COUNT));
+      BatchResult result = temporal_time_zone_get_transitions_interned(
+          internedArg(rt, args[0], "Timezone"), epochArg(rt, args[1], args[2]),
+          epochArg(rt, args[3], args[4]), out.data(), cap);
+      checkBatchResult(rt, result);
+      out.resize(result.count);
+      return epochPairsToJS(rt, out);
+    }
+    },
+    TEMPORAL_METHOD("timeZoneGetPlainDateTimesForManyInterned", 2) {
+      auto epochs = epochPairsArg(rt, args[1]);
+      std::vector<int32_t> out(epochs.size() *
+                               TEMPORAL_PLAIN_DATE_TIME_COLUMN_COUNT);
+      BatchResult result =
+          temporal_time_zone_get_plain_date_times_for_many_interned(
+              internedArg(rt, args[0], "Timezone"), epochs.data(),
+              static_cast<int32_t>(epochs.size()), out.data());
+      checkBatchResult(rt, result);
+      return toJSArray(rt, out);
+    }
+    },
+    TEMPORAL_METHOD("instantToZonedDateTimeInterned", 4) {
+      return toJSString(rt, temporal_instant_to_zoned_date_time_interned(
+                                epochArg(rt, args[0], args[1]),
+                                internedArg(rt, args[2], "Calendar"),
+                                internedArg(rt, args[3], "Timezone")));
+    }
+    },
+
+    // Rounding options
+    TEMPORAL_METHOD("roundingOptionsNew", 4) {
+      auto largest = optionalStringArg(rt, args[0], "largestUnit");
+      auto smallest = optionalStringArg(rt, args[1], "smallestUnit");
+      auto mode = optionalStringArg(rt, args[3], "roundingMode");
+      TemporalRoundingOptions options = 0;
+      checkStatus(rt, temporal_rounding_options_new(
+                          cstr(largest), cstr(smallest),
+                          int64Arg(rt, args[2], "increment"), cstr(mode),
+                          &options));
+      return jsi::Value(static_cast<double>(options));
+    }
+    },
+    TEMPORAL_METHOD("instantUntilEpochNanosecondsWithOptions", 5) {
+      return toJSString(
+          rt, temporal_instant_until_epoch_nanoseconds_with_options(
+                  epochArg(rt, args[0], args[1]),
+                  epochArg(rt, args[2], args[3]),
+                  roundingOptionsArg(rt, args[4])));
+    }
+    },
+    TEMPORAL_METHOD("instantSinceEpochNanosecondsWithOptions", 5) {
+      return toJSString(
+          rt, temporal_instant_since_epoch_nanoseconds_with_options(
+                  epochArg(rt, args[0], args[1]),
+                  epochArg(rt, args[2], args[3]),
+                  roundingOptionsArg(rt, args[4])));
+    }
+    },
+    TEMPORAL_METHOD("instantRoundEpochNanosecondsWithOptions", 3) {
+      TemporalEpochNanoseconds rounded = {0, 0};
+      int32_t errorType = temporal_instant_round_epoch_nanoseconds_with_options(
+          epochArg(rt, args[0], args[1]), roundingOptionsArg(rt, args[2]),
+          &rounded);
+      return toJSEpoch(rt, errorType, rounded);
+    }
+    },
+    TEMPORAL_METHOD("plainTimeUntilWithOptions", 3) {
+      auto one = stringArg(rt, args[0], "Arguments");
+      auto two = stringArg(rt, args[1], "Arguments");
+      return toJSString(rt, temporal_plain_time_until_with_options(
+                                one.c_str(), two.c_str(),
+                                roundingOptionsArg(rt, args[2])));
+    }
+    },
+    TEMPORAL_METHOD("plainTimeSinceWithOptions", 3) {
+      auto one = stringArg(rt, args[0], "Arguments");
+      auto two = stringArg(rt, args[1], "Arguments");
+      return toJSString(rt, temporal_plain_time_since_with_options(
+                                one.c_str(), two.c_str(),
+                                roundingOptionsArg(rt, args[2])));
+    }
+    },
+    TEMPORAL_METHOD("plainTimeRoundWithOptions", 2) {
+      auto s = stringArg(rt, args[0], "Arguments");
+      return toJSString(rt, temporal_plain_time_round_with_options(
+                                s.c_str(), roundingOptionsArg(rt, args[1])));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeRoundWithOptions", 2) {
+      auto s = stringArg(rt, args[0], "Arguments");
+      return toJSString(rt, temporal_zoned_date_time_round_with_options(
+                                s.c_str(), roundingOptionsArg(rt, args[1])));
+    }
+    },
+    TEMPORAL_METHOD("zonedDateTimeHandleRoundWithOptions", 2) {
+      return toJSHandle(rt, temporal_zoned_date_time_handle_round_with_options(
+                                handleArg(rt, args[0]),
+                                roundingOptionsArg(rt, args[1])));
+    }
+    },
+};
+
+#undef TEMPORAL_HANDLE_ROUND
+#undef TEMPORAL_HANDLE_DURATION
+#undef TEMPORAL_HANDLE_FROM_STRING
+#undef TEMPORAL_ROUND
+#undef TEMPORAL_DIFFERENCE
+#undef TEMPORAL_COMPARE
+#undef TEMPORAL_NUMBER_1
+#undef TEMPORAL_STRING_2
+#undef TEMPORAL_STRING_1
+#undef TEMPORAL_METHOD
+
+const std::unordered_map<std::string, const MethodEntry *> &methodsByName() {
+  static const auto *methods = [] {
+    auto *map = new std::unordered_map<std::string, const MethodEntry *>();
+    for (const auto &entry : kMethods) {
+      map->emplace(entry.name, &entry);
+    }
+    return map;
+  }();
+  return *methods;
+}
+
+} // namespace
+
+// ============================================================================
+// Host object
+// ============================================================================
+
+jsi::Value TemporalHostObject::get(jsi::Runtime &runtime,
+                                   const jsi::PropNameID &name) {
+  const auto &methods = methodsByName();
+  auto it = methods.find(name.utf8(runtime));
+  if (it == methods.end()) {
+    return jsi::Value::undefined();
+  }
+
+  const MethodEntry *entry = it->second;
+  return jsi::Function::createFromHostFunction(
+      runtime, name, static_cast<unsigned int>(entry->argCount),
+      [entry](jsi::Runtime &rt, const jsi::Value &, const jsi::Value *args,
+              size_t count) -> jsi::Value {
+        if (count < entry->argCount) {
+          throwTypeError(rt, std::string(entry->name) + " expects " +
+                                 std::to_string(entry->argCount) +
+                                 " arguments");
+        }
+        return entry->method(rt, args);
+      });
+}
+
+std::vector<jsi::PropNameID>
+TemporalHostObject::getPropertyNames(jsi::Runtime &runtime) {
+  std::vector<jsi::PropNameID> names;
+  names.reserve(std::size(kMethods));
+  for (const auto &entry : kMethods) {
+    names.push_back(jsi::PropNameID::forAscii(runtime, entry.name));
+  }
+  return names;
+}
+
+bool isInstalled(jsi::Runtime &runtime) {
+  jsi::Value existing = runtime.global().getProperty(runtime, "__TemporalJSI");
+  return existing.isObject() &&
+         existing.getObject(runtime).isHostObject<TemporalHostObject>(runtime);
+}
+
+void install(jsi::Runtime &runtime) {
+  if (isInstalled(runtime)) {
+    return;
+  }
+  // One host object per runtime: the object holds no state, and every
+  // jsi::Value it creates belongs to the runtime that asked for it.
+  auto hostObject = std::make_shared<TemporalHostObject>();
+  runtime.global().setProperty(
+      runtime, "__TemporalJSI",
+      jsi::Object::createFromHostObject(runtime, std::move(hostObject)));
+}
+
+} // namespace temporal
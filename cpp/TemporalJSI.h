@@ -0,0 +1,45 @@
+/* temporal-rn JSI bindings */
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <string>
+#include <vector>
+
+namespace temporal {
+
+/**
+ * JSI host object exposing the temporal_* C API directly to JavaScript.
+ *
+ * Property names and signatures mirror the TurboModule spec in
+ * src/NativeTemporal.ts, so JS can use it as a drop-in replacement for the
+ * Objective-C / Kotlin bridge. Methods that need platform services (such as
+ * the device time zone) are left to the TurboModule.
+ */
+class TemporalHostObject : public facebook::jsi::HostObject {
+public:
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime,
+                           const facebook::jsi::PropNameID &name) override;
+
+  std::vector<facebook::jsi::PropNameID>
+  getPropertyNames(facebook::jsi::Runtime &runtime) override;
+};
+
+/**
+ * Whether `runtime` already has the bindings as `global.__TemporalJSI`.
+ * Must be called on the runtime's JavaScript thread.
+ */
+bool isInstalled(facebook::jsi::Runtime &runtime);
+
+/**
+ * Installs the host object as `global.__TemporalJSI`.
+ *
+ * Can be called for any number of runtimes (the main one and worklet or
+ * worker runtimes), each on its own JavaScript thread; installing twice into
+ * the same runtime does nothing. The bindings keep no per-runtime state and
+ * the temporal_* functions are safe to call from several threads at once,
+ * so the runtimes can run date math concurrently.
+ */
+void install(facebook::jsi::Runtime &runtime);
+
+} // namespace temporal
@@ -1,7 +1,14 @@
+import { markStartup, measureStartup } from './src/startup';
+import 'react-native-temporal/polyfill/lazy';
 import { AppRegistry } from 'react-native';
-import App from './src/App';
 import { name as appName } from './app.json';
 
-import 'react-native-temporal/polyfill';
+markStartup('polyfillInstalled');
 
-AppRegistry.registerComponent(appName, () => App);
+// First touch of the lazy namespace: loads the class modules it needs,
+// resolves the native module and installs the JSI bindings.
+measureStartup('firstTemporalAccess', () => globalThis.Temporal.Now.instant());
+
+// Required lazily so the measurements above aren't skewed by App.tsx pulling
+// in the whole library at import time.
+AppRegistry.registerComponent(appName, () => require('./src/App').default);
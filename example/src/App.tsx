@@ -16,6 +16,7 @@ import {
   PlainYearMonth,
   PlainMonthDay,
 } from 'react-native-temporal';
+import { markStartup, logStartupReport } from './startup';
 
 const multiplyResult = multiply(3, 7);
 
@@ -199,6 +200,8 @@ export default function App() {
   };
 
   useEffect(() => {
+    markStartup('firstRender');
+    logStartupReport();
     updateInstant();
     // Initial parse on mount
     try {
@@ -0,0 +1,89 @@
+import { describe, it, expect } from 'react-native-harness';
+import { TurboModuleRegistry, type TurboModule } from 'react-native';
+import { Instant } from 'react-native-temporal';
+import { benchPhase, generateInstantStrings } from '../bench';
+
+const COUNT = 10_000;
+const TIME_ZONE = 'America/New_York';
+
+interface StringBridge extends TurboModule {
+  instantFromString(s: string): string;
+}
+
+describe('bridge benchmark', () => {
+  const strings = generateInstantStrings(COUNT);
+
+  it('parses, sorts, converts and formats 10k instants', () => {
+    const suite = 'instants';
+
+    const { result: instants } = benchPhase(
+      suite,
+      'parse',
+      COUNT,
+      () => strings.map((s) => Instant.from(s)),
+      () => Instant.from(strings[0]!)
+    );
+
+    const { result: sorted } = benchPhase(suite, 'sort', COUNT, () =>
+      Instant.sort(instants)
+    );
+
+    const { result: zoned } = benchPhase(
+      suite,
+      'toZonedDateTimeISO',
+      COUNT,
+      () => sorted.map((i) => i.toZonedDateTimeISO(TIME_ZONE)),
+      () => sorted[0]!.toZonedDateTimeISO(TIME_ZONE)
+    );
+
+    const { result: formatted } = benchPhase(
+      suite,
+      'format',
+      COUNT,
+      () => zoned.map((z) => z.toString()),
+      () => zoned[0]!.toString()
+    );
+
+    expect(formatted).toHaveLength(COUNT);
+    const ascending = sorted.every(
+      (instant, i) => i === 0 || Instant.compare(sorted[i - 1]!, instant) <= 0
+    );
+    expect(ascending).toBe(true);
+    expect(formatted[0]!.endsWith(`[${TIME_ZONE}]`)).toBe(true);
+  });
+
+  it('parses 10k instants with one batched call', () => {
+    const { result } = benchPhase('instants', 'parseMany', COUNT, () =>
+      Instant.epochNanosecondsMany(strings)
+    );
+    expect(result).toHaveLength(COUNT);
+    expect(result[0]).toBe(Instant.from(strings[0]!).epochNanoseconds);
+  });
+
+  it('times the string bridge against the JSI bindings', () => {
+    // Round-trips a string through each layer without any JS-side work, so
+    // the difference is the marshalling cost alone.
+    const turbo = TurboModuleRegistry.getEnforcing<StringBridge>('Temporal');
+    const { result: viaTurbo } = benchPhase(
+      'bridge',
+      'instantFromString.turbomodule',
+      COUNT,
+      () => strings.map((s) => turbo.instantFromString(s)),
+      () => turbo.instantFromString(strings[0]!)
+    );
+    expect(viaTurbo).toHaveLength(COUNT);
+
+    const jsi = globalThis.__TemporalJSI?.instantFromString;
+    if (jsi === undefined) {
+      return;
+    }
+    const { result: viaJSI } = benchPhase(
+      'bridge',
+      'instantFromString.jsi',
+      COUNT,
+      () => strings.map((s) => jsi(s)),
+      () => jsi(strings[0]!)
+    );
+    expect(viaJSI).toEqual(viaTurbo);
+  });
+});
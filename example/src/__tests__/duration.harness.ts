@@ -96,6 +96,13 @@ describe('Duration', () => {
       expect(diff.toString()).toBe('PT1H');
     });
 
+    it('should balance time-only durations built from fields', () => {
+      const sum = Duration.from({ hours: 1, minutes: 45 }).add({ minutes: 30 });
+      expect(sum.toString()).toBe('PT2H15M');
+      const diff = Duration.from({ days: 1 }).subtract({ milliseconds: 1500 });
+      expect(diff.toString()).toBe('PT23H59M58.5S');
+    });
+
     it('should negate duration', () => {
       const d = Duration.from('P1Y');
       expect(d.negated().toString()).toBe('-P1Y');
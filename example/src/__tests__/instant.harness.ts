@@ -1,5 +1,13 @@
 import { describe, it, expect } from 'react-native-harness';
-import { Instant, Duration } from 'react-native-temporal';
+import {
+  CompiledRoundingOptions,
+  Instant,
+  InstantColumn,
+  Duration,
+  ZonedDateTime,
+  getBatchThreads,
+  setBatchThreads,
+} from 'react-native-temporal';
 
 describe('Instant', () => {
   describe('Instant.from', () => {
@@ -189,4 +197,240 @@ describe('Instant', () => {
       expect(() => instant.valueOf()).toThrow();
     });
   });
+
+  describe('Instant batch methods', () => {
+    it('should sort instants stably', () => {
+      const a = Instant.from('2020-01-02T00:00:00Z');
+      const b = Instant.from('1969-12-31T23:59:59.5Z');
+      const c = Instant.from('2020-01-02T00:00:00Z');
+      const sorted = Instant.sort([a, b, c]);
+      expect(sorted[0]).toBe(b);
+      expect(sorted[1]).toBe(a);
+      expect(sorted[2]).toBe(c);
+    });
+
+    it('should compare pairwise', () => {
+      expect(
+        Instant.compareMany(
+          ['2020-01-01T00:00:00Z', '2020-01-01T00:00:00Z'],
+          ['2021-01-01T00:00:00Z', '2020-01-01T01:00:00+01:00']
+        )
+      ).toEqual([-1, 0]);
+    });
+
+    it('should return epoch nanoseconds, including before the epoch', () => {
+      expect(
+        Instant.epochNanosecondsMany([
+          '1970-01-01T00:00:01Z',
+          '1969-12-31T23:59:59.5Z',
+        ])
+      ).toEqual([1_000_000_000n, -500_000_000n]);
+    });
+
+    it('should report the failing item', () => {
+      expect(() =>
+        Instant.epochNanosecondsMany(['2020-01-01T00:00:00Z', 'invalid'])
+      ).toThrow('Item 1');
+    });
+
+    it('should give the same results with any number of batch threads', () => {
+      const strings = Array.from(
+        { length: 10_000 },
+        (_, i) => new Date(i * 1000).toISOString()
+      );
+      const expected = strings.map((_, i) => BigInt(i) * 1_000_000_000n);
+      try {
+        for (const threads of [1, 4]) {
+          setBatchThreads(threads);
+          expect(getBatchThreads()).toBe(threads);
+          expect(Instant.epochNanosecondsMany(strings)).toEqual(expected);
+          const broken = [...strings];
+          broken[9_000] = 'invalid';
+          broken[7_000] = 'invalid';
+          expect(() => Instant.epochNanosecondsMany(broken)).toThrow(
+            'Item 7000'
+          );
+        }
+        expect(() => setBatchThreads(-1)).toThrow(RangeError);
+      } finally {
+        setBatchThreads(0);
+      }
+      expect(getBatchThreads()).toBeGreaterThanOrEqual(1);
+    });
+  });
+
+  describe('Instant epoch nanoseconds', () => {
+    it('should keep sub-millisecond precision before the epoch', () => {
+      const instant = Instant.fromEpochNanoseconds(-1n);
+      expect(instant.epochMilliseconds).toBe(-1);
+      expect(instant.toString()).toBe('1969-12-31T23:59:59.999999999Z');
+    });
+
+    it('should add and subtract time units', () => {
+      const instant = Instant.from('2020-01-01T00:00:00Z');
+      expect(instant.add({ hours: 1, nanoseconds: 5 }).epochNanoseconds).toBe(
+        1_577_840_400_000_000_005n
+      );
+      expect(instant.subtract('PT0.5S').toString()).toBe(
+        '2019-12-31T23:59:59.5Z'
+      );
+    });
+
+    it('should reject calendar units and out-of-range results', () => {
+      const instant = Instant.from('2020-01-01T00:00:00Z');
+      expect(() => instant.add({ days: 1 })).toThrow();
+      expect(() =>
+        Instant.fromEpochNanoseconds(8_640_000_000_000_000_000_001n)
+      ).toThrow();
+    });
+  });
+
+  describe('Binary encoding', () => {
+    it('should round-trip through 24-byte records', () => {
+      const instant = Instant.from('1969-07-20T20:17:40.123456789Z');
+      const bytes = instant.toBytes();
+      expect(bytes.byteLength).toBe(24);
+      expect(Instant.fromBytes(bytes).equals(instant)).toBe(true);
+    });
+
+    it('should round-trip batches and reject zoned records', () => {
+      const items = [
+        Instant.fromEpochNanoseconds(-8_640_000_000_000_000_000_000n),
+        Instant.fromEpochNanoseconds(-1n),
+        Instant.fromEpochNanoseconds(8_640_000_000_000_000_000_000n),
+      ];
+      const decoded = Instant.fromBytesMany(Instant.toBytesMany(items));
+      expect(decoded.map((i) => i.epochNanoseconds)).toEqual(
+        items.map((i) => i.epochNanoseconds)
+      );
+      const zoned = ZonedDateTime.from('2024-01-01T00:00:00+00:00[UTC]');
+      expect(() => Instant.fromBytes(zoned.toBytes())).toThrow(TypeError);
+    });
+  });
+
+  describe('Instant.parseStream', () => {
+    const encode = (text: string): ArrayBuffer =>
+      Uint8Array.from(text, (c) => c.charCodeAt(0)).buffer;
+
+    it('should parse a JSON array body into epoch columns', () => {
+      const body = encode(
+        '["1970-01-01T00:00:01.5Z", null, "not an instant", "1969-12-31T23:59:59Z"]'
+      );
+      const stream = Instant.parseStream(body);
+      expect(stream.length).toBe(4);
+      expect(Array.from(stream.seconds)).toEqual([1, 0, 0, -1]);
+      expect(Array.from(stream.nanoseconds)).toEqual([500_000_000, 0, 0, 0]);
+      expect(Array.from(stream.errors)).toEqual([0, 2, 1, 0]);
+    });
+
+    it('should parse newline-delimited bodies', () => {
+      const body = encode('2020-01-01T00:00:00Z\r\n\n2020-01-01T00:00:01Z');
+      const stream = Instant.parseStream(new Uint8Array(body), 'lines');
+      expect(Array.from(stream.seconds)).toEqual([1577836800, 1577836801]);
+      expect(Array.from(stream.errors)).toEqual([0, 0]);
+    });
+  });
+
+  describe('Instant.prototype.toString options', () => {
+    it('should round to the requested precision', () => {
+      const instant = Instant.from('2024-07-01T12:34:56.789123456Z');
+      expect(instant.toString({ fractionalSecondDigits: 3 })).toBe(
+        '2024-07-01T12:34:56.789Z'
+      );
+      expect(
+        instant.toString({ smallestUnit: 'minute', roundingMode: 'ceil' })
+      ).toBe('2024-07-01T12:35Z');
+    });
+
+    it('should apply the options in a time zone', () => {
+      const instant = Instant.from('2024-07-01T12:34:56.789Z');
+      expect(
+        instant.toString({ timeZone: '+01:00', fractionalSecondDigits: 0 })
+      ).toBe('2024-07-01T13:34:56+01:00[+01:00]');
+    });
+  });
+
+  describe('CompiledRoundingOptions', () => {
+    it('should match plain options in until, since and round', () => {
+      const one = Instant.from('2024-01-01T00:00:00Z');
+      const two = Instant.from('2024-01-02T01:01:01.5Z');
+      const options = CompiledRoundingOptions.from({
+        largestUnit: 'hour',
+        smallestUnit: 'minute',
+        roundingMode: 'floor',
+      });
+      expect(one.until(two, options).toString()).toBe('PT25H1M');
+      expect(two.since(one, options).toString()).toBe('PT25H1M');
+      expect(
+        one.until(two, { largestUnit: 'hour', smallestUnit: 'minute' })
+      ).toEqual(one.until(two, options));
+      const rounded = two.round(
+        CompiledRoundingOptions.from({ smallestUnit: 'second' })
+      );
+      expect(rounded.toString()).toBe('2024-01-02T01:01:02Z');
+    });
+
+    it('should return one instance for equal options', () => {
+      expect(CompiledRoundingOptions.from({ smallestUnit: 'hour' })).toBe(
+        CompiledRoundingOptions.from({ smallestUnit: 'hour' })
+      );
+    });
+
+    it('should throw a RangeError for invalid options', () => {
+      expect(() =>
+        CompiledRoundingOptions.from({ smallestUnit: 'fortnight' })
+      ).toThrow(RangeError);
+      expect(() =>
+        CompiledRoundingOptions.from({ roundingIncrement: 2e9 })
+      ).toThrow(RangeError);
+    });
+  });
+
+  describe('InstantColumn', () => {
+    const column = InstantColumn.from([
+      '2024-03-31T12:00:00Z',
+      '2024-03-30T22:30:00Z',
+      Instant.from('2024-03-30T23:30:00Z'),
+      '2024-04-02T08:00:00Z',
+      '2024-03-30T10:00:00Z',
+    ]);
+
+    it('should sort and search its instants', () => {
+      expect(column.length).toBe(5);
+      expect(column.at(0)!.toString()).toBe('2024-03-30T10:00:00Z');
+      expect(column.at(-1)!.toString()).toBe('2024-04-02T08:00:00Z');
+      expect(column.lowerBound('2024-03-30T23:00:00Z')).toBe(2);
+      expect(
+        column.rangeCount('2024-03-30T00:00:00Z', '2024-03-31T00:00:00Z')
+      ).toBe(3);
+    });
+
+    it('should slice without copying', () => {
+      const slice = column.slice(1, -1);
+      expect(slice.toArray().map((i) => i.toString())).toEqual([
+        '2024-03-30T22:30:00Z',
+        '2024-03-30T23:30:00Z',
+        '2024-03-31T12:00:00Z',
+      ]);
+      slice.release();
+      expect(column.length).toBe(5);
+    });
+
+    it('should bucket by local day across a DST change', () => {
+      const buckets = column.bucketBy('day', 'Europe/Paris');
+      expect(
+        buckets.map(({ start, count }) => [start.toString(), count])
+      ).toEqual([
+        ['2024-03-29T23:00:00Z', 2],
+        ['2024-03-30T23:00:00Z', 2],
+        ['2024-04-01T22:00:00Z', 1],
+      ]);
+    });
+
+    it('should throw a RangeError for an unknown unit', () => {
+      expect(() => column.bucketBy('fortnight' as 'day', 'UTC')).toThrow(
+        RangeError
+      );
+    });
+  });
 });
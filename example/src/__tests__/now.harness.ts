@@ -1,5 +1,5 @@
 import { describe, it, expect } from 'react-native-harness';
-import { Now, Instant } from 'react-native-temporal';
+import { Now, Instant, ZonedClock } from 'react-native-temporal';
 
 describe('Now', () => {
   describe('Now.instant', () => {
@@ -41,4 +41,32 @@ describe('Now', () => {
       expect(t).toMatch(/^\d{2}:\d{2}:\d{2}/);
     });
   });
+
+  describe('Now.clock', () => {
+    it('should track the current time in its zone', () => {
+      const clock = Now.clock('Asia/Kolkata');
+      expect(clock).toBeInstanceOf(ZonedClock);
+      expect(clock.offsetNanoseconds).toBe(19_800_000_000_000);
+      const before = clock.epochMilliseconds;
+      clock.read();
+      expect(clock.epochMilliseconds).toBeGreaterThanOrEqual(before);
+      expect(
+        Math.abs(clock.epochMilliseconds - Now.instant().epochMilliseconds)
+      ).toBeLessThan(5000);
+      const local = clock.toInstant().toZonedDateTimeISO('Asia/Kolkata');
+      expect([clock.year, clock.month, clock.day, clock.hour]).toEqual([
+        local.year,
+        local.month,
+        local.day,
+        local.hour,
+      ]);
+      expect(clock.dayOfWeek).toBe(local.dayOfWeek);
+      clock.release();
+      expect(() => clock.read()).toThrow(TypeError);
+    });
+
+    it('should throw a RangeError for an unknown zone', () => {
+      expect(() => ZonedClock.from('Mars/Olympus_Mons')).toThrow(RangeError);
+    });
+  });
 });
@@ -1,7 +1,32 @@
 import { describe, it, expect } from 'react-native-harness';
-import { PlainDate } from 'react-native-temporal';
+import {
+  PlainDate,
+  PlainDateColumn,
+  PlainDateTime,
+  PlainTime,
+  lastValidationError,
+  setForceNativeArithmetic,
+} from 'react-native-temporal';
 
 describe('PlainDate', () => {
+  describe('PlainDate.tryFrom', () => {
+    it('should parse valid strings', () => {
+      expect(PlainDate.isValid('2024-02-29')).toBe(true);
+      expect(PlainDate.tryFrom('2024-02-29')?.toString()).toBe('2024-02-29');
+    });
+
+    it('should return null without throwing for invalid strings', () => {
+      expect(PlainDate.isValid('2023-02-29')).toBe(false);
+      expect(PlainDate.tryFrom('2023-02-29')).toBeNull();
+      expect(PlainDate.tryFrom('2024-0')).toBeNull();
+    });
+
+    it('should explain the last rejection on demand', () => {
+      expect(PlainDate.tryFrom('2023-02-29')).toBeNull();
+      expect(lastValidationError()).toContain('2023-02-29');
+    });
+  });
+
   describe('PlainDate.from', () => {
     it('should create from ISO string', () => {
       const date = PlainDate.from('2024-01-17');
@@ -32,6 +57,13 @@ describe('PlainDate', () => {
       expect(date.inLeapYear).toBe(true);
       expect(date.monthCode).toBe('M01');
     });
+
+    it('should fetch fields of derived dates on first access', () => {
+      const date = PlainDate.from('2024-01-31').add({ days: 30 });
+      expect(date.toString()).toBe('2024-03-01');
+      expect(date.month).toBe(3);
+      expect(date.dayOfYear).toBe(61);
+    });
   });
 
   describe('Comparison', () => {
@@ -90,10 +122,99 @@ describe('PlainDate', () => {
     });
   });
 
+  describe('JS arithmetic conformance', () => {
+    // Runs each operation on the JS fast path and with native forced, and
+    // expects identical strings.
+    const both = (run: () => string) => {
+      const js = run();
+      setForceNativeArithmetic(true);
+      try {
+        return [js, run()];
+      } finally {
+        setForceNativeArithmetic(false);
+      }
+    };
+
+    it('should match native for date arithmetic', () => {
+      const cases: [string, object][] = [
+        ['2024-01-31', { months: 1 }],
+        ['2024-02-29', { years: 1 }],
+        ['2024-03-31', { months: -1, days: -1 }],
+        ['-000001-12-31', { weeks: 1 }],
+        ['9999-12-31', { days: 1 }],
+      ];
+      for (const [date, duration] of cases) {
+        const [js, native] = both(() =>
+          PlainDate.from(date).add(duration).toString()
+        );
+        expect(js).toBe(native);
+      }
+      const [js, native] = both(() =>
+        PlainDate.from('2020-02-29').until('2024-03-01').toString()
+      );
+      expect(js).toBe(native);
+    });
+
+    it('should match native for time and date-time arithmetic', () => {
+      const [timeJs, timeNative] = both(() =>
+        PlainTime.from('23:59:59.5').add({ milliseconds: 750 }).toString()
+      );
+      expect(timeJs).toBe(timeNative);
+
+      const [dtJs, dtNative] = both(() =>
+        PlainDateTime.from('2024-01-31T23:00:00')
+          .add({ months: 1, hours: 2, nanoseconds: 1 })
+          .toString()
+      );
+      expect(dtJs).toBe(dtNative);
+
+      const [untilJs, untilNative] = both(() =>
+        PlainDateTime.from('2024-01-01T12:00:00')
+          .until('2024-01-03T06:00:00.000000001')
+          .toString()
+      );
+      expect(untilJs).toBe(untilNative);
+    });
+
+    it('should fill week fields for JS results', () => {
+      const js = PlainDate.from('2020-12-31').add({ days: 3 });
+      expect(js.toString()).toBe('2021-01-03');
+      expect(js.weekOfYear).toBe(53);
+      expect(js.yearOfWeek).toBe(2020);
+      expect(js.dayOfWeek).toBe(7);
+    });
+  });
+
   describe('PlainDate.prototype.valueOf', () => {
     it('should throw TypeError on valueOf', () => {
       const date = PlainDate.from('2024-01-17');
       expect(() => date.valueOf()).toThrow();
     });
   });
+
+  describe('PlainDateColumn', () => {
+    it('should count and bucket dates', () => {
+      const column = PlainDateColumn.from([
+        '2024-02-29',
+        PlainDate.from('2024-01-31'),
+        '2024-03-04',
+        { year: 2024, month: 3, day: 3 },
+        '2024-02-01',
+      ]);
+      expect(column.at(0)!.toString()).toBe('2024-01-31');
+      expect(column.lowerBound('2024-03-01')).toBe(3);
+      expect(column.rangeCount('2024-02-01', '2024-03-01')).toBe(2);
+      const weeks = column
+        .bucketBy('week')
+        .map(({ start, count }) => [start.toString(), count]);
+      expect(weeks).toEqual([
+        ['2024-01-29', 2],
+        ['2024-02-26', 2],
+        ['2024-03-04', 1],
+      ]);
+      expect(column.bucketBy('year')).toHaveLength(1);
+      column.release();
+      expect(() => column.lowerBound('2024-03-01')).toThrow(TypeError);
+    });
+  });
 });
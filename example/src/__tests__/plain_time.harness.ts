@@ -1,5 +1,10 @@
 import { describe, it, expect } from 'react-native-harness';
-import { PlainTime } from 'react-native-temporal';
+import {
+  CompiledToStringOptions,
+  PlainTime,
+  clearFormatCache,
+  getFormatCacheStats,
+} from 'react-native-temporal';
 
 describe('PlainTime', () => {
   describe('PlainTime.from', () => {
@@ -123,4 +128,37 @@ describe('PlainTime', () => {
       expect(() => time.valueOf()).toThrow();
     });
   });
+
+  describe('PlainTime.prototype.toString', () => {
+    it('should format with precision and rounding options', () => {
+      const time = PlainTime.from('08:30:15.123456789');
+      expect(time.toString({ fractionalSecondDigits: 3 })).toBe(
+        '08:30:15.123'
+      );
+      expect(time.toString({ smallestUnit: 'minute' })).toBe('08:30');
+      expect(
+        time.toString({ smallestUnit: 'second', roundingMode: 'ceil' })
+      ).toBe('08:30:16');
+      expect(time.toString({})).toBe('08:30:15.123456789');
+    });
+
+    it('should reuse compiled options and cache the output', () => {
+      clearFormatCache();
+      const options = CompiledToStringOptions.from({ smallestUnit: 'minute' });
+      const time = PlainTime.from('23:59:59');
+      expect(time.toString(options)).toBe('23:59');
+      expect(time.toString(options)).toBe('23:59');
+      expect(getFormatCacheStats()).toEqual({ hits: 1, misses: 1, size: 1 });
+    });
+
+    it('should throw a RangeError for invalid options', () => {
+      const time = PlainTime.from('12:00');
+      expect(() => time.toString({ fractionalSecondDigits: 10 })).toThrow(
+        RangeError
+      );
+      expect(() => time.toString({ smallestUnit: 'hour' })).toThrow(
+        RangeError
+      );
+    });
+  });
 });
@@ -0,0 +1,44 @@
+import { describe, it, expect } from 'react-native-harness';
+import { PlainMonthDay } from 'react-native-temporal';
+import { getStartupReport } from '../startup';
+
+describe('lazy polyfill', () => {
+  it('should install every class as an enumerable property', () => {
+    expect(Object.keys(globalThis.Temporal).sort()).toEqual([
+      'Calendar',
+      'Duration',
+      'Instant',
+      'Now',
+      'PlainDate',
+      'PlainDateTime',
+      'PlainMonthDay',
+      'PlainTime',
+      'PlainYearMonth',
+      'TimeZone',
+      'ZonedDateTime',
+    ]);
+  });
+
+  it('should replace the getter with the class on first access', () => {
+    const before = Object.getOwnPropertyDescriptor(
+      globalThis.Temporal,
+      'PlainMonthDay'
+    );
+    expect(typeof before?.get).toBe('function');
+
+    expect(globalThis.Temporal.PlainMonthDay).toBe(PlainMonthDay);
+
+    const after = Object.getOwnPropertyDescriptor(
+      globalThis.Temporal,
+      'PlainMonthDay'
+    );
+    expect(after?.get).toBeUndefined();
+    expect(after?.value).toBe(PlainMonthDay);
+  });
+
+  it('should record cold-start marks', () => {
+    const { marks, durations } = getStartupReport();
+    expect(marks.polyfillInstalled).toBeGreaterThanOrEqual(0);
+    expect(durations.firstTemporalAccess).toBeGreaterThanOrEqual(0);
+  });
+});
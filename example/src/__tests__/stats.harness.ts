@@ -0,0 +1,27 @@
+import { describe, it, expect } from 'react-native-harness';
+import { Duration, getStats, resetStats } from 'react-native-temporal';
+
+describe('native stats', () => {
+  it('should report totals and per-function counters', () => {
+    resetStats();
+    Duration.from('PT1H').toString();
+    const stats = getStats();
+    expect(typeof stats.enabled).toBe('boolean');
+    expect(typeof stats.totals.calls).toBe('number');
+    if (!stats.enabled) {
+      expect(stats.totals.calls).toBe(0);
+      expect(Object.keys(stats.functions)).toHaveLength(0);
+      return;
+    }
+    expect(stats.totals.calls).toBeGreaterThan(0);
+    expect(stats.totals.parseCount).toBeGreaterThan(0);
+    expect(Object.keys(stats.functions).length).toBeGreaterThan(0);
+  });
+
+  it('should count failed calls', () => {
+    resetStats();
+    expect(() => Duration.from('not a duration')).toThrow(RangeError);
+    const stats = getStats();
+    expect(stats.totals.errorCount).toBe(stats.enabled ? 1 : 0);
+  });
+});
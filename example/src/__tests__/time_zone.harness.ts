@@ -1,5 +1,13 @@
 import { describe, it, expect } from 'react-native-harness';
-import { TimeZone, Instant, PlainDateTime } from 'react-native-temporal';
+import {
+  TimeZone,
+  Instant,
+  PlainDateTime,
+  clearTimeZoneCache,
+  ZonedDateTimeRange,
+  expandRecurrence,
+  getTimeZoneCacheStats,
+} from 'react-native-temporal';
 
 describe('TimeZone', () => {
   describe('Creation', () => {
@@ -87,5 +95,155 @@ describe('TimeZone', () => {
       const prev = tz.getPreviousTransition(instant);
       expect(prev?.toString()).toBe('2020-03-29T01:00:00Z');
     });
+
+    it('should list transitions in a range', () => {
+      const tz = TimeZone.from('Europe/London');
+      const transitions = tz.getTransitions(
+        Instant.from('2020-03-29T01:00:00Z'),
+        Instant.from('2021-03-28T01:00:00Z')
+      );
+      expect(transitions.map((t) => t.toString())).toEqual([
+        '2020-03-29T01:00:00Z',
+        '2020-10-25T01:00:00Z',
+      ]);
+    });
+
+    it('should list no transitions for UTC', () => {
+      const tz = TimeZone.from('UTC');
+      expect(
+        tz.getTransitions(
+          Instant.from('2000-01-01T00:00:00Z'),
+          Instant.from('2030-01-01T00:00:00Z')
+        )
+      ).toEqual([]);
+    });
+  });
+
+  describe('getPlainDateTimesFor', () => {
+    it('should convert many instants into columns', () => {
+      const tz = TimeZone.from('Europe/Warsaw');
+      const instants = [
+        Instant.from('2020-01-01T00:00:00Z'),
+        Instant.from('2020-07-01T12:34:56.789Z'),
+      ];
+      const columns = tz.getPlainDateTimesFor(instants);
+      expect(columns.length).toBe(2);
+      expect(Array.from(columns.year)).toEqual([2020, 2020]);
+      expect(Array.from(columns.month)).toEqual([1, 7]);
+      expect(Array.from(columns.hour)).toEqual([1, 14]);
+      expect(columns.millisecond[1]).toBe(789);
+      expect(columns.hour[1]).toBe(tz.getPlainDateTimeFor(instants[1]!).hour);
+    });
+  });
+
+  describe('Cache', () => {
+    it('should serve repeated lookups from the cache', () => {
+      clearTimeZoneCache();
+      const tz = TimeZone.from('Asia/Tokyo');
+      const instant = Instant.from('2020-01-01T00:00:00Z');
+      tz.getOffsetNanosecondsFor(instant);
+      tz.getOffsetNanosecondsFor(instant);
+      const stats = getTimeZoneCacheStats();
+      expect(stats.misses).toBe(1);
+      expect(stats.hits).toBeGreaterThanOrEqual(2);
+      expect(stats.size).toBeGreaterThanOrEqual(1);
+    });
+  });
+
+  describe('expandRecurrence', () => {
+    it('should expand monthly occurrences without month-end drift', async () => {
+      const occurrences = await expandRecurrence(
+        '2024-01-31T09:00:00',
+        { months: 1 },
+        3,
+        'UTC'
+      );
+      expect(occurrences.map((i) => i.toString())).toEqual([
+        '2024-01-31T09:00:00Z',
+        '2024-02-29T09:00:00Z',
+        '2024-03-31T09:00:00Z',
+      ]);
+    });
+
+    it('should keep wall-clock time across DST changes', async () => {
+      const [before, after] = await expandRecurrence(
+        '2024-03-30T09:00:00',
+        { days: 1 },
+        2,
+        'Europe/Berlin'
+      );
+      expect(before!.toString()).toBe('2024-03-30T08:00:00Z');
+      expect(after!.toString()).toBe('2024-03-31T07:00:00Z');
+    });
+
+    it('should reject with a RangeError for invalid zones', async () => {
+      await expect(
+        expandRecurrence('2024-01-01T00:00:00', 'P1D', 1, 'Not/AZone')
+      ).rejects.toThrow();
+    });
+  });
+
+  describe('ZonedDateTimeRange', () => {
+    it('should stop before the end across DST changes', () => {
+      const range = ZonedDateTimeRange.from(
+        '2024-03-30T09:00:00+01:00[Europe/Berlin]',
+        { days: 1 },
+        '2024-04-01T09:00:00+02:00[Europe/Berlin]'
+      );
+      expect([...range].map((i) => i.toString())).toEqual([
+        '2024-03-30T08:00:00Z',
+        '2024-03-31T07:00:00Z',
+      ]);
+      expect(range.nextBatch(10)).toEqual([]);
+    });
+
+    it('should pull unbounded ranges in batches', () => {
+      const range = ZonedDateTimeRange.from(
+        '2024-01-01T00:00:00+00:00[UTC]',
+        'PT1H'
+      );
+      expect(range.nextBatch(1000)).toHaveLength(1000);
+      expect(range.nextBatch(1)[0]!.toString()).toBe('2024-02-11T16:00:00Z');
+    });
+
+    it('should throw a RangeError for a zero step', () => {
+      expect(() =>
+        ZonedDateTimeRange.from('2024-01-01T00:00:00+00:00[UTC]', 'PT0S')
+      ).toThrow(RangeError);
+    });
+  });
+
+  describe('Interned identifiers', () => {
+    it('should match the string results on repeated calls', () => {
+      const tz = TimeZone.from('America/New_York');
+      const instant = Instant.from('2024-07-01T12:00:00Z');
+      for (let i = 0; i < 3; i++) {
+        expect(tz.getOffsetStringFor(instant)).toBe('-04:00');
+        expect(tz.getPlainDateTimeFor(instant).toString()).toBe(
+          '2024-07-01T08:00:00'
+        );
+      }
+      expect(instant.toZonedDateTimeISO(tz).toString()).toBe(
+        '2024-07-01T08:00:00-04:00[America/New_York]'
+      );
+      const japanese = instant.toZonedDateTime({
+        timeZone: tz,
+        calendar: 'japanese',
+      });
+      expect(japanese.toString()).toBe(
+        '2024-07-01T08:00:00-04:00[America/New_York][u-ca=japanese]'
+      );
+    });
+
+    it('should share IDs across instances of the same zone', () => {
+      const a = TimeZone.from('Europe/Paris');
+      const b = TimeZone.from('Europe/Paris');
+      const instant = Instant.from('2024-01-15T00:00:00Z');
+      expect(a.getOffsetNanosecondsFor(instant)).toBe(3_600_000_000_000);
+      expect(b.getOffsetNanosecondsFor(instant)).toBe(3_600_000_000_000);
+      expect(a.getNextTransition(instant)?.toString()).toBe(
+        '2024-03-31T01:00:00Z'
+      );
+    });
   });
 });
@@ -144,4 +144,96 @@ describe('ZonedDateTime', () => {
       expect(dt.toString()).toBe('2020-01-01T15:30:00');
     });
   });
+
+  describe('Components', () => {
+    it('should read fields and offsets from the component buffer', () => {
+      const zdt = ZonedDateTime.from(
+        '2020-01-01T15:30:45.123456789+05:45[Asia/Kathmandu]'
+      );
+      expect(zdt.hour).toBe(15);
+      expect(zdt.nanosecond).toBe(789);
+      expect(zdt.offsetNanoseconds).toBe(20_700_000_000_000);
+
+      const west = ZonedDateTime.from(
+        '2020-01-01T00:00:00-03:30[America/St_Johns]'
+      );
+      expect(west.offsetNanoseconds).toBe(-12_600_000_000_000);
+    });
+
+    it('should resolve the time zone and calendar lazily', () => {
+      const zdt = ZonedDateTime.from(
+        '2024-03-30T12:00:00+01:00[Europe/Warsaw]'
+      ).add({ days: 1 });
+      expect(zdt.hour).toBe(12);
+      expect(zdt.timeZoneId).toBe('Europe/Warsaw');
+      expect(zdt.calendarId).toBe('iso8601');
+    });
+
+    it('should read components of handle-backed values', () => {
+      const zdt = ZonedDateTime.from('2020-01-01T23:00:00+01:00[Europe/Paris]');
+      const next = zdt.add('PT2H');
+      expect(next.day).toBe(2);
+      expect(next.hour).toBe(1);
+      expect(next.offsetNanoseconds).toBe(3_600_000_000_000);
+    });
+  });
+
+  describe('Binary encoding', () => {
+    it('should round-trip through 24-byte records', () => {
+      const zdt = ZonedDateTime.from(
+        '2024-03-10T03:30:00.123456789-04:00[America/New_York][u-ca=japanese]'
+      );
+      const bytes = zdt.toBytes();
+      expect(bytes.byteLength).toBe(24);
+      expect(bytes[0]).toBe(1);
+      expect(bytes[1]).toBe(2);
+      expect(ZonedDateTime.fromBytes(bytes).toString()).toBe(zdt.toString());
+    });
+
+    it('should round-trip batches through one ArrayBuffer', () => {
+      const items = [
+        ZonedDateTime.from('2024-01-01T00:00:00+00:00[UTC]'),
+        ZonedDateTime.from('2024-06-01T12:00:00+09:00[Asia/Tokyo]'),
+        ZonedDateTime.from('1969-12-31T23:00:00.5-05:30[-05:30]'),
+      ];
+      const buffer = ZonedDateTime.toBytesMany(items);
+      expect(buffer.byteLength).toBe(72);
+      const decoded = ZonedDateTime.fromBytesMany(buffer);
+      expect(decoded.map((z) => z.toString())).toEqual(
+        items.map((z) => z.toString())
+      );
+      const second = ZonedDateTime.fromBytes(new Uint8Array(buffer, 24, 24));
+      expect(second.timeZoneId).toBe('Asia/Tokyo');
+    });
+
+    it('should reject malformed records', () => {
+      const bytes = ZonedDateTime.from(
+        '2024-01-01T00:00:00+00:00[UTC]'
+      ).toBytes();
+      expect(() => ZonedDateTime.fromBytes(bytes.subarray(0, 23))).toThrow(
+        RangeError
+      );
+      bytes[0] = 2;
+      expect(() => ZonedDateTime.fromBytes(bytes)).toThrow(RangeError);
+    });
+  });
+
+  describe('ZonedDateTime.prototype.toString options', () => {
+    it('should omit annotations on request', () => {
+      const zdt = ZonedDateTime.from(
+        '2024-07-01T08:30:15.5-04:00[America/New_York][u-ca=japanese]'
+      );
+      expect(zdt.toString({ calendarName: 'never' })).toBe(
+        '2024-07-01T08:30:15.5-04:00[America/New_York]'
+      );
+      expect(
+        zdt.toString({
+          smallestUnit: 'second',
+          timeZoneName: 'never',
+          calendarName: 'never',
+          offset: 'never',
+        })
+      ).toBe('2024-07-01T08:30:15');
+    });
+  });
 });
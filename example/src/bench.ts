@@ -0,0 +1,77 @@
+/**
+ * Timing helpers for the on-device benchmark harness files.
+ *
+ * Each phase is logged as one `[temporal-bench]` JSON line so runs can be
+ * scraped from logcat / the simulator log and compared across builds. The
+ * `bridge` field records whether the JSI bindings were installed, which is
+ * what separates the string bridge from the JSI path.
+ */
+
+export interface BenchPhase {
+  suite: string;
+  phase: string;
+  bridge: 'jsi' | 'turbomodule';
+  calls: number;
+  totalMs: number;
+  perCallUs: number;
+}
+
+const WARMUP_CALLS = 200;
+
+export function bridgeKind(): BenchPhase['bridge'] {
+  return globalThis.__TemporalJSI === undefined ? 'turbomodule' : 'jsi';
+}
+
+/**
+ * Times `fn`, which performs `calls` operations, and logs the result. A short
+ * warm-up pass runs first when `warmup` is given so JIT-less engines still
+ * measure steady state rather than first-call setup.
+ */
+export function benchPhase<T>(
+  suite: string,
+  phase: string,
+  calls: number,
+  fn: () => T,
+  warmup?: () => void
+): { result: T; phase: BenchPhase } {
+  if (warmup) {
+    for (let i = 0; i < WARMUP_CALLS; i++) {
+      warmup();
+    }
+  }
+  const start = performance.now();
+  const result = fn();
+  const totalMs = performance.now() - start;
+  const report: BenchPhase = {
+    suite,
+    phase,
+    bridge: bridgeKind(),
+    calls,
+    totalMs: Math.round(totalMs * 1000) / 1000,
+    perCallUs: Math.round((totalMs * 1000 * 1000) / calls) / 1000,
+  };
+  console.log('[temporal-bench]', JSON.stringify(report));
+  return { result, phase: report };
+}
+
+/**
+ * Deterministic ISO instant strings spread over roughly three years, in a
+ * seeded shuffled order so every run parses and sorts the same input.
+ */
+export function generateInstantStrings(count: number): string[] {
+  let seed = 0x5eed;
+  // Park–Miller LCG
+  const next = () => (seed = (seed * 16807) % 2147483647);
+
+  const strings = new Array<string>(count);
+  let ms = Date.UTC(2023, 0, 1);
+  for (let i = 0; i < count; i++) {
+    ms += next() % 9_500_000;
+    strings[i] = new Date(ms).toISOString();
+  }
+  for (let i = count - 1; i > 0; i--) {
+    const j = next() % (i + 1);
+    [strings[i], strings[j]] = [strings[j]!, strings[i]!];
+  }
+  return strings;
+}
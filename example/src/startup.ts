@@ -0,0 +1,84 @@
+/**
+ * Cold-start marks for tracking time-to-interactive regressions.
+ *
+ * Import this module first in index.js: the `bundleStart` mark is taken when
+ * it is evaluated, and every later mark is reported relative to it. The full
+ * report is logged once under the `[temporal-startup]` tag so CI can scrape
+ * it from logcat / the simulator log.
+ */
+
+export type StartupMark =
+  | 'bundleStart'
+  | 'polyfillInstalled'
+  | 'firstTemporalAccess'
+  | 'firstRender';
+
+export interface StartupReport {
+  /** Milliseconds from `bundleStart` to each recorded mark. */
+  marks: Partial<Record<StartupMark, number>>;
+  /** Milliseconds spent inside each `measureStartup` callback. */
+  durations: Record<string, number>;
+  /** Native process start to bundle execution, when the runtime exposes it. */
+  nativeToBundleStart?: number;
+}
+
+interface RNStartupTiming {
+  startTime?: number;
+  executeJavaScriptBundleEntryPointStart?: number;
+}
+
+const bundleStart = performance.now();
+const marks: Partial<Record<StartupMark, number>> = { bundleStart: 0 };
+const durations: Record<string, number> = {};
+let logged = false;
+
+/**
+ * Records `name` relative to `bundleStart`. Only the first call per mark
+ * counts, so re-renders don't overwrite cold-start numbers.
+ */
+export function markStartup(name: StartupMark): void {
+  if (marks[name] === undefined) {
+    marks[name] = performance.now() - bundleStart;
+  }
+}
+
+/**
+ * Runs `fn`, records how long it took under `name`, and marks its end.
+ */
+export function measureStartup<T>(name: StartupMark, fn: () => T): T {
+  const start = performance.now();
+  try {
+    return fn();
+  } finally {
+    durations[name] = performance.now() - start;
+    markStartup(name);
+  }
+}
+
+export function getStartupReport(): StartupReport {
+  const report: StartupReport = {
+    marks: { ...marks },
+    durations: { ...durations },
+  };
+  const timing = (performance as { rnStartupTiming?: RNStartupTiming })
+    .rnStartupTiming;
+  if (
+    timing?.startTime !== undefined &&
+    timing.executeJavaScriptBundleEntryPointStart !== undefined
+  ) {
+    report.nativeToBundleStart =
+      timing.executeJavaScriptBundleEntryPointStart - timing.startTime;
+  }
+  return report;
+}
+
+/**
+ * Logs the report once; call after the first frame has been committed.
+ */
+export function logStartupReport(): void {
+  if (logged) {
+    return;
+  }
+  logged = true;
+  console.log('[temporal-startup]', JSON.stringify(getStartupReport()));
+}
@@ -1,5 +1,6 @@
 #import <TemporalSpec/TemporalSpec.h>
+#import <ReactCommon/RCTTurboModuleWithJSIBindings.h>
 
-@interface Temporal : NSObject <NativeTemporalSpec>
+@interface Temporal : NSObject <NativeTemporalSpec, RCTTurboModuleWithJSIBindings>
 
 @end
@@ -1,6 +1,11 @@
 #import "Temporal.h"
 #import "temporal_rn.h"
+#import "TemporalJSI.h"
 #import <React/RCTUtils.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
 
 // Helper macros for throwing errors with type markers for JS to parse
 #define THROW_RANGE_ERROR(msg) \
@@ -72,6 +77,212 @@ static NSString *extractResultValue(TemporalResult result) {
     return value;
 }
 
+// Helper to call a *_into function with a stack buffer, so the formatted string
+// is copied once into the NSString. Retries on the heap if it was truncated.
+typedef int32_t (^TemporalFormatInto)(char *buf, size_t cap, size_t *len);
+
+// Helper to throw for a failed status-returning call, whose message is kept
+// in temporal_last_error_message()
+static void throwStatusError(int32_t errorType) {
+    if (errorType == TEMPORAL_ERROR_NONE) {
+        return;
+    }
+    const char *message = temporal_last_error_message();
+    NSString *baseMessage = message ? [NSString stringWithUTF8String:message] : @"Unknown error";
+    if (errorType == TEMPORAL_ERROR_RANGE) {
+        THROW_RANGE_ERROR(baseMessage);
+    } else {
+        THROW_TYPE_ERROR(baseMessage);
+    }
+}
+
+static NSString *extractIntoValue(TemporalFormatInto format) {
+    char stackBuffer[64];
+    size_t length = 0;
+    int32_t errorType = format(stackBuffer, sizeof(stackBuffer), &length);
+    throwStatusError(errorType);
+    if (length < sizeof(stackBuffer)) {
+        return [[NSString alloc] initWithBytes:stackBuffer length:length encoding:NSUTF8StringEncoding];
+    }
+    std::vector<char> heapBuffer(length + 1);
+    format(heapBuffer.data(), heapBuffer.size(), &length);
+    return [[NSString alloc] initWithBytes:heapBuffer.data() length:length encoding:NSUTF8StringEncoding];
+}
+
+// Helper to turn a status-returning epoch call into [seconds, nanoseconds]
+static NSArray<NSNumber *> *extractEpochValue(int32_t errorType, TemporalEpochNanoseconds epoch) {
+    throwStatusError(errorType);
+    return @[@(epoch.seconds), @(epoch.nanoseconds)];
+}
+
+// Saturating, with NaN as 0: casting a double outside int32_t's range is
+// undefined behavior.
+static int32_t toInt32(double value) {
+    if (std::isnan(value)) {
+        return 0;
+    }
+    if (value <= (double)INT32_MIN) {
+        return INT32_MIN;
+    }
+    if (value >= (double)INT32_MAX) {
+        return INT32_MAX;
+    }
+    return (int32_t)value;
+}
+
+static TemporalEpochNanoseconds toEpochNanoseconds(double seconds, double nanoseconds) {
+    TemporalEpochNanoseconds epoch;
+    epoch.seconds = (int64_t)seconds;
+    epoch.nanoseconds = (int32_t)nanoseconds;
+    return epoch;
+}
+
+// Values from temporal_rounding_options_new; Rust rejects any other bits.
+static TemporalRoundingOptions toRoundingOptions(double options) {
+    if (options < 0 || options >= 9007199254740992.0 || options != floor(options)) {
+        THROW_RANGE_ERROR(@"Invalid rounding options");
+    }
+    return (TemporalRoundingOptions)options;
+}
+
+// Values from temporal_to_string_options_new; Rust rejects any other bits.
+static TemporalToStringOptions toToStringOptions(double options) {
+    if (options < 0 || options >= 9007199254740992.0 || options != floor(options)) {
+        THROW_RANGE_ERROR(@"Invalid toString options");
+    }
+    return (TemporalToStringOptions)options;
+}
+
+// Helper to throw appropriate JS exception based on HandleResult error type
+static void throwHandleError(HandleResult *result) {
+    if (result->error_type == TEMPORAL_ERROR_NONE) {
+        return;
+    }
+
+    NSString *baseMessage = result->error_message
+        ? [NSString stringWithUTF8String:result->error_message]
+        : @"Unknown error";
+
+    int errorType = result->error_type;
+
+    // Free the result before throwing
+    temporal_free_handle_result(result);
+
+    if (errorType == TEMPORAL_ERROR_RANGE) {
+        THROW_RANGE_ERROR(baseMessage);
+    } else {
+        THROW_TYPE_ERROR(baseMessage);
+    }
+}
+
+// Helper to extract a handle from result as a JS number, throwing on error
+static double extractHandle(HandleResult result) {
+    if (result.error_type != TEMPORAL_ERROR_NONE) {
+        throwHandleError(&result);
+        return 0; // Never reached
+    }
+    return (double)(uintptr_t)result.handle;
+}
+
+// Helper to turn a JS number back into a handle pointer. Rust checks the
+// pointer against its live handles; the cast is only defined for integers.
+static inline TemporalHandle *toHandle(double handle) {
+    if (handle < 0 || handle >= 18446744073709551616.0 || handle != floor(handle)) {
+        THROW_TYPE_ERROR(@"Invalid handle");
+    }
+    return (TemporalHandle *)(uintptr_t)handle;
+}
+
+// Helper to throw appropriate JS exception based on BatchResult error type
+static void throwBatchError(BatchResult *result) {
+    if (result->error_type == TEMPORAL_ERROR_NONE) {
+        return;
+    }
+
+    NSString *baseMessage = result->error_message
+        ? [NSString stringWithUTF8String:result->error_message]
+        : @"Unknown error";
+
+    int errorType = result->error_type;
+
+    // Free the result before throwing
+    temporal_free_batch_result(result);
+
+    if (errorType == TEMPORAL_ERROR_RANGE) {
+        THROW_RANGE_ERROR(baseMessage);
+    } else {
+        THROW_TYPE_ERROR(baseMessage);
+    }
+}
+
+// Helper to borrow UTF-8 pointers for every string in an array. The pointers
+// live as long as the autoreleased NSStrings, i.e. for the current call.
+static std::vector<const char *> toCStringArray(NSArray *strings) {
+    std::vector<const char *> out;
+    out.reserve(strings.count);
+    for (id value in strings) {
+        if (![value isKindOfClass:[NSString class]]) {
+            THROW_TYPE_ERROR(@"Array elements must be strings");
+        }
+        out.push_back([(NSString *)value UTF8String]);
+    }
+    return out;
+}
+
+static NSArray<NSNumber *> *parseManyToArray(
+    NSArray *strings,
+    BatchResult (*parse)(const char *const *, int32_t, TemporalEpochNanoseconds *)
+) {
+    std::vector<const char *> items = toCStringArray(strings);
+    std::vector<TemporalEpochNanoseconds> out(items.size());
+    BatchResult result = parse(items.data(), (int32_t)items.size(), out.data());
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:out.size() * 2];
+    for (const TemporalEpochNanoseconds &e : out) {
+        [values addObject:@(e.seconds)];
+        [values addObject:@(e.nanoseconds)];
+    }
+    return values;
+}
+
+static NSArray<NSNumber *> *sortToArray(
+    NSArray *strings,
+    BatchResult (*sort)(const char *const *, int32_t, int32_t *)
+) {
+    std::vector<const char *> items = toCStringArray(strings);
+    std::vector<int32_t> out(items.size());
+    BatchResult result = sort(items.data(), (int32_t)items.size(), out.data());
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:out.size()];
+    for (int32_t index : out) {
+        [values addObject:@(index)];
+    }
+    return values;
+}
+
+static NSArray<NSNumber *> *compareManyToArray(
+    NSArray *a,
+    NSArray *b,
+    BatchResult (*compare)(const char *const *, const char *const *, int32_t, int8_t *)
+) {
+    if (a.count != b.count) {
+        THROW_RANGE_ERROR(@"Arrays must have the same length");
+    }
+    std::vector<const char *> itemsA = toCStringArray(a);
+    std::vector<const char *> itemsB = toCStringArray(b);
+    std::vector<int8_t> out(itemsA.size());
+    BatchResult result = compare(itemsA.data(), itemsB.data(), (int32_t)itemsA.size(), out.data());
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:out.size()];
+    for (int8_t order : out) {
+        [values addObject:@(order)];
+    }
+    return values;
+}
+
 @implementation Temporal
 
 - (NSNumber *)multiply:(double)a b:(double)b {
@@ -79,6 +290,16 @@ static NSString *extractResultValue(TemporalResult result) {
     return result;
 }
 
+- (void)installJSIBindingsWithRuntime:(facebook::jsi::Runtime &)runtime
+                          callInvoker:(const std::shared_ptr<facebook::react::CallInvoker> &)callInvoker {
+    temporal::install(runtime);
+}
+
+- (NSNumber *)install {
+    // Bindings are installed by installJSIBindingsWithRuntime: when the module is created
+    return @YES;
+}
+
 - (NSString *)instantNow {
     char *result = temporal_instant_now();
     if (result == NULL) {
@@ -97,13 +318,15 @@ static NSString *extractResultValue(TemporalResult result) {
     if (sCStr == NULL) {
         THROW_TYPE_ERROR(@"Invalid instant string encoding");
     }
-    TemporalResult result = temporal_instant_from_string(sCStr);
-    return extractResultValue(result);
+    return extractIntoValue(^(char *buf, size_t cap, size_t *len) {
+        return temporal_instant_from_string_into(sCStr, buf, cap, len);
+    });
 }
 
 - (NSString *)instantFromEpochMilliseconds:(double)ms {
-    TemporalResult result = temporal_instant_from_epoch_milliseconds((int64_t)ms);
-    return extractResultValue(result);
+    return extractIntoValue(^(char *buf, size_t cap, size_t *len) {
+        return temporal_instant_from_epoch_milliseconds_into((int64_t)ms, buf, cap, len);
+    });
 }
 
 - (NSString *)instantFromEpochNanoseconds:(NSString *)nsStr {
@@ -152,8 +375,9 @@ static NSString *extractResultValue(TemporalResult result) {
     if (iCStr == NULL || dCStr == NULL) {
         THROW_TYPE_ERROR(@"Invalid string encoding");
     }
-    TemporalResult result = temporal_instant_add(iCStr, dCStr);
-    return extractResultValue(result);
+    return extractIntoValue(^(char *buf, size_t cap, size_t *len) {
+        return temporal_instant_add_into(iCStr, dCStr, buf, cap, len);
+    });
 }
 
 - (NSString *)instantSubtract:(NSString *)instant duration:(NSString *)duration {
@@ -165,8 +389,9 @@ static NSString *extractResultValue(TemporalResult result) {
     if (iCStr == NULL || dCStr == NULL) {
         THROW_TYPE_ERROR(@"Invalid string encoding");
     }
-    TemporalResult result = temporal_instant_subtract(iCStr, dCStr);
-    return extractResultValue(result);
+    return extractIntoValue(^(char *buf, size_t cap, size_t *len) {
+        return temporal_instant_subtract_into(iCStr, dCStr, buf, cap, len);
+    });
 }
 
 - (double)instantCompare:(NSString *)one two:(NSString *)two {
@@ -225,6 +450,54 @@ static NSString *extractResultValue(TemporalResult result) {
     return extractResultValue(result);
 }
 
+// Epoch nanosecond instant methods
+
+- (NSArray<NSNumber *> *)instantParseEpochNanoseconds:(NSString *)s {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalEpochNanoseconds epoch = {0, 0};
+    int32_t errorType = temporal_instant_parse_epoch_nanoseconds([s UTF8String], &epoch);
+    return extractEpochValue(errorType, epoch);
+}
+
+- (NSArray<NSNumber *> *)instantNowEpochNanoseconds {
+    TemporalEpochNanoseconds epoch = {0, 0};
+    int32_t errorType = temporal_instant_now_epoch_nanoseconds(&epoch);
+    return extractEpochValue(errorType, epoch);
+}
+
+- (NSString *)instantFormatEpochNanoseconds:(double)seconds nanoseconds:(double)nanoseconds {
+    TemporalEpochNanoseconds epoch = toEpochNanoseconds(seconds, nanoseconds);
+    return extractIntoValue(^int32_t(char *buf, size_t cap, size_t *len) {
+        return temporal_instant_format_epoch_nanoseconds_into(epoch, buf, cap, len);
+    });
+}
+
+- (NSArray<NSNumber *> *)instantRoundEpochNanoseconds:(double)seconds nanoseconds:(double)nanoseconds smallestUnit:(NSString *)smallestUnit roundingIncrement:(double)roundingIncrement roundingMode:(NSString *)roundingMode {
+    if (!smallestUnit) THROW_TYPE_ERROR(@"Arguments cannot be null");
+    const char *modeCStr = roundingMode ? [roundingMode UTF8String] : NULL;
+    TemporalEpochNanoseconds rounded = {0, 0};
+    int32_t errorType = temporal_instant_round_epoch_nanoseconds(toEpochNanoseconds(seconds, nanoseconds), [smallestUnit UTF8String], (int64_t)roundingIncrement, modeCStr, &rounded);
+    return extractEpochValue(errorType, rounded);
+}
+
+- (NSString *)instantUntilEpochNanoseconds:(double)oneSeconds oneNanoseconds:(double)oneNanoseconds twoSeconds:(double)twoSeconds twoNanoseconds:(double)twoNanoseconds largestUnit:(NSString *)largestUnit smallestUnit:(NSString *)smallestUnit roundingIncrement:(double)roundingIncrement roundingMode:(NSString *)roundingMode {
+    const char *largestCStr = largestUnit ? [largestUnit UTF8String] : NULL;
+    const char *smallestCStr = smallestUnit ? [smallestUnit UTF8String] : NULL;
+    const char *modeCStr = roundingMode ? [roundingMode UTF8String] : NULL;
+
+    TemporalResult result = temporal_instant_until_epoch_nanoseconds(toEpochNanoseconds(oneSeconds, oneNanoseconds), toEpochNanoseconds(twoSeconds, twoNanoseconds), largestCStr, smallestCStr, (int64_t)roundingIncrement, modeCStr);
+    return extractResultValue(result);
+}
+
+- (NSString *)instantSinceEpochNanoseconds:(double)oneSeconds oneNanoseconds:(double)oneNanoseconds twoSeconds:(double)twoSeconds twoNanoseconds:(double)twoNanoseconds largestUnit:(NSString *)largestUnit smallestUnit:(NSString *)smallestUnit roundingIncrement:(double)roundingIncrement roundingMode:(NSString *)roundingMode {
+    const char *largestCStr = largestUnit ? [largestUnit UTF8String] : NULL;
+    const char *smallestCStr = smallestUnit ? [smallestUnit UTF8String] : NULL;
+    const char *modeCStr = roundingMode ? [roundingMode UTF8String] : NULL;
+
+    TemporalResult result = temporal_instant_since_epoch_nanoseconds(toEpochNanoseconds(oneSeconds, oneNanoseconds), toEpochNanoseconds(twoSeconds, twoNanoseconds), largestCStr, smallestCStr, (int64_t)roundingIncrement, modeCStr);
+    return extractResultValue(result);
+}
+
 // Now methods
 
 - (NSString *)nowTimeZoneId {
@@ -286,7 +559,7 @@ static NSString *extractResultValue(TemporalResult result) {
     return extractResultValue(result);
 }
 
-- (NSDictionary *)plainTimeGetAllComponents:(NSString *)plainTimeStr {
+- (NSArray<NSNumber *> *)plainTimeGetAllComponents:(NSString *)plainTimeStr {
     if (plainTimeStr == nil) {
         THROW_TYPE_ERROR(@"PlainTime string cannot be null");
     }
@@ -302,14 +575,10 @@ static NSString *extractResultValue(TemporalResult result) {
         THROW_RANGE_ERROR(@"Invalid plain time");
     }
 
-    return @{
-        @"hour": @(components.hour),
-        @"minute": @(components.minute),
-        @"second": @(components.second),
-        @"millisecond": @(components.millisecond),
-        @"microsecond": @(components.microsecond),
-        @"nanosecond": @(components.nanosecond)
-    };
+    return @[
+        @(components.hour), @(components.minute), @(components.second),
+        @(components.millisecond), @(components.microsecond), @(components.nanosecond)
+    ];
 }
 
 - (NSString *)plainTimeAdd:(NSString *)plainTime duration:(NSString *)duration {
@@ -501,8 +770,9 @@ static NSString *extractResultValue(TemporalResult result) {
     if (sCStr == NULL) {
         THROW_TYPE_ERROR(@"Invalid plain date time string encoding");
     }
-    TemporalResult result = temporal_plain_date_time_from_string(sCStr);
-    return extractResultValue(result);
+    return extractIntoValue(^(char *buf, size_t cap, size_t *len) {
+        return temporal_plain_date_time_from_string_into(sCStr, buf, cap, len);
+    });
 }
 
 - (NSString *)plainDateTimeFromComponents:(double)year
@@ -1027,12 +1297,192 @@ static NSString *extractResultValue(TemporalResult result) {
     return [val length] > 0 ? val : nil;
 }
 
+- (NSArray<NSNumber *> *)timeZoneCacheStats {
+    TimeZoneCacheStats stats = temporal_time_zone_cache_stats();
+    return @[@(stats.hits), @(stats.misses), @(stats.size)];
+}
+
+- (void)timeZoneCacheClear {
+    temporal_time_zone_cache_clear();
+}
+
+- (void)setBatchThreads:(double)threads {
+    throwStatusError(temporal_set_batch_threads((int32_t)threads));
+}
+
+- (double)getBatchThreads {
+    return temporal_get_batch_threads();
+}
+
+- (double)validate:(double)kind s:(NSString *)s {
+    return temporal_validate((int32_t)kind, [s UTF8String]);
+}
+
+- (NSString *)lastErrorMessage {
+    const char *message = temporal_last_error_message();
+    return message ? [NSString stringWithUTF8String:message] : nil;
+}
+
+- (NSString *)getStats {
+    return extractResultValue(temporal_stats_to_json());
+}
+
+- (void)resetStats {
+    temporal_stats_reset();
+}
+
+- (NSArray<NSNumber *> *)zonedDateTimeToBytes:(NSString *)s {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    uint8_t out[TEMPORAL_BINARY_SIZE];
+    throwStatusError(temporal_zoned_date_time_to_bytes([s UTF8String], out));
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:TEMPORAL_BINARY_SIZE];
+    for (uint8_t byte : out) {
+        [values addObject:@(byte)];
+    }
+    return values;
+}
+
+- (NSString *)zonedDateTimeFromBytes:(NSArray *)bytes {
+    if (!bytes) THROW_TYPE_ERROR(@"Argument cannot be null");
+    if (bytes.count != TEMPORAL_BINARY_SIZE) {
+        THROW_RANGE_ERROR(([NSString stringWithFormat:@"Binary record must be %d bytes", TEMPORAL_BINARY_SIZE]));
+    }
+    uint8_t record[TEMPORAL_BINARY_SIZE];
+    for (NSUInteger i = 0; i < TEMPORAL_BINARY_SIZE; i++) {
+        double value = [bytes[i] doubleValue];
+        if (value < 0 || value > 255 || value != floor(value)) {
+            THROW_RANGE_ERROR(([NSString stringWithFormat:@"Byte %lu must be an integer in [0, 255]", (unsigned long)i]));
+        }
+        record[i] = (uint8_t)value;
+    }
+    return extractResultValue(temporal_zoned_date_time_from_bytes(record));
+}
+
+// toString(options)
+
+- (NSString *)instantToStringWithOptions:(NSString *)s fractionalSecondDigits:(double)fractionalSecondDigits smallestUnit:(NSString *)smallestUnit roundingMode:(NSString *)roundingMode {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_instant_to_string_with_options(
+        [s UTF8String], (int32_t)fractionalSecondDigits,
+        smallestUnit ? [smallestUnit UTF8String] : NULL, roundingMode ? [roundingMode UTF8String] : NULL);
+    return extractResultValue(result);
+}
+
+- (NSString *)plainTimeToStringWithOptions:(NSString *)s fractionalSecondDigits:(double)fractionalSecondDigits smallestUnit:(NSString *)smallestUnit roundingMode:(NSString *)roundingMode {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_plain_time_to_string_with_options(
+        [s UTF8String], (int32_t)fractionalSecondDigits,
+        smallestUnit ? [smallestUnit UTF8String] : NULL, roundingMode ? [roundingMode UTF8String] : NULL);
+    return extractResultValue(result);
+}
+
+- (NSString *)plainDateTimeToStringWithOptions:(NSString *)s fractionalSecondDigits:(double)fractionalSecondDigits smallestUnit:(NSString *)smallestUnit roundingMode:(NSString *)roundingMode calendarName:(NSString *)calendarName {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_plain_date_time_to_string_with_options(
+        [s UTF8String], (int32_t)fractionalSecondDigits,
+        smallestUnit ? [smallestUnit UTF8String] : NULL, roundingMode ? [roundingMode UTF8String] : NULL,
+        calendarName ? [calendarName UTF8String] : NULL);
+    return extractResultValue(result);
+}
+
+- (NSString *)zonedDateTimeToStringWithOptions:(NSString *)s fractionalSecondDigits:(double)fractionalSecondDigits smallestUnit:(NSString *)smallestUnit roundingMode:(NSString *)roundingMode calendarName:(NSString *)calendarName timeZoneName:(NSString *)timeZoneName offset:(NSString *)offset {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_zoned_date_time_to_string_with_options(
+        [s UTF8String], (int32_t)fractionalSecondDigits,
+        smallestUnit ? [smallestUnit UTF8String] : NULL, roundingMode ? [roundingMode UTF8String] : NULL,
+        calendarName ? [calendarName UTF8String] : NULL, timeZoneName ? [timeZoneName UTF8String] : NULL,
+        offset ? [offset UTF8String] : NULL);
+    return extractResultValue(result);
+}
+
+- (double)toStringOptionsNew:(double)fractionalSecondDigits smallestUnit:(NSString *)smallestUnit roundingMode:(NSString *)roundingMode calendarName:(NSString *)calendarName timeZoneName:(NSString *)timeZoneName offset:(NSString *)offset {
+    TemporalToStringOptions options = 0;
+    throwStatusError(temporal_to_string_options_new(
+        (int32_t)fractionalSecondDigits,
+        smallestUnit ? [smallestUnit UTF8String] : NULL, roundingMode ? [roundingMode UTF8String] : NULL,
+        calendarName ? [calendarName UTF8String] : NULL, timeZoneName ? [timeZoneName UTF8String] : NULL,
+        offset ? [offset UTF8String] : NULL, &options));
+    return (double)options;
+}
+
+- (NSString *)instantToStringWithPackedOptions:(NSString *)s options:(double)options {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_instant_to_string_with_packed_options([s UTF8String], toToStringOptions(options));
+    return extractResultValue(result);
+}
+
+- (NSString *)plainTimeToStringWithPackedOptions:(NSString *)s options:(double)options {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_plain_time_to_string_with_packed_options([s UTF8String], toToStringOptions(options));
+    return extractResultValue(result);
+}
+
+- (NSString *)plainDateTimeToStringWithPackedOptions:(NSString *)s options:(double)options {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_plain_date_time_to_string_with_packed_options([s UTF8String], toToStringOptions(options));
+    return extractResultValue(result);
+}
+
+- (NSString *)zonedDateTimeToStringWithPackedOptions:(NSString *)s options:(double)options {
+    if (!s) THROW_TYPE_ERROR(@"Argument cannot be null");
+    TemporalResult result = temporal_zoned_date_time_to_string_with_packed_options([s UTF8String], toToStringOptions(options));
+    return extractResultValue(result);
+}
+
+// Rounding options
+
+- (double)roundingOptionsNew:(NSString *)largestUnit smallestUnit:(NSString *)smallestUnit roundingIncrement:(double)roundingIncrement roundingMode:(NSString *)roundingMode {
+    TemporalRoundingOptions options = 0;
+    throwStatusError(temporal_rounding_options_new(
+        largestUnit ? [largestUnit UTF8String] : NULL, smallestUnit ? [smallestUnit UTF8String] : NULL,
+        (int64_t)roundingIncrement, roundingMode ? [roundingMode UTF8String] : NULL, &options));
+    return (double)options;
+}
+
+- (NSString *)instantUntilEpochNanosecondsWithOptions:(double)oneSeconds oneNanoseconds:(double)oneNanoseconds twoSeconds:(double)twoSeconds twoNanoseconds:(double)twoNanoseconds options:(double)options {
+    TemporalResult result = temporal_instant_until_epoch_nanoseconds_with_options(toEpochNanoseconds(oneSeconds, oneNanoseconds), toEpochNanoseconds(twoSeconds, twoNanoseconds), toRoundingOptions(options));
+    return extractResultValue(result);
+}
+
+- (NSString *)instantSinceEpochNanosecondsWithOptions:(double)oneSeconds oneNanoseconds:(double)oneNanoseconds twoSeconds:(double)twoSeconds twoNanoseconds:(double)twoNanoseconds options:(double)options {
+    TemporalResult result = temporal_instant_since_epoch_nanoseconds_with_options(toEpochNanoseconds(oneSeconds, oneNanoseconds), toEpochNanoseconds(twoSeconds, twoNanoseconds), toRoundingOptions(options));
+    return extractResultValue(result);
+}
+
+- (NSArray<NSNumber *> *)instantRoundEpochNanosecondsWithOptions:(double)seconds nanoseconds:(double)nanoseconds options:(double)options {
+    TemporalEpochNanoseconds rounded = {0, 0};
+    int32_t errorType = temporal_instant_round_epoch_nanoseconds_with_options(toEpochNanoseconds(seconds, nanoseconds), toRoundingOptions(options), &rounded);
+    return extractEpochValue(errorType, rounded);
+}
+
+- (NSString *)plainTimeUntilWithOptions:(NSString *)one two:(NSString *)two options:(double)options {
+    if (!one || !two) THROW_TYPE_ERROR(@"Arguments cannot be null");
+    return extractResultValue(temporal_plain_time_until_with_options([one UTF8String], [two UTF8String], toRoundingOptions(options)));
+}
+
+- (NSString *)plainTimeSinceWithOptions:(NSString *)one two:(NSString *)two options:(double)options {
+    if (!one || !two) THROW_TYPE_ERROR(@"Arguments cannot be null");
+    return extractResultValue(temporal_plain_time_since_with_options([one UTF8String], [two UTF8String], toRoundingOptions(options)));
+}
+
+- (NSString *)plainTimeRoundWithOptions:(NSString *)timeStr options:(double)options {
+    if (!timeStr) THROW_TYPE_ERROR(@"Argument cannot be null");
+    return extractResultValue(temporal_plain_time_round_with_options([timeStr UTF8String], toRoundingOptions(options)));
+}
+
+- (NSString *)zonedDateTimeRoundWithOptions:(NSString *)zonedDateTimeStr options:(double)options {
+    if (!zonedDateTimeStr) THROW_TYPE_ERROR(@"Argument cannot be null");
+    return extractResultValue(temporal_zoned_date_time_round_with_options([zonedDateTimeStr UTF8String], toRoundingOptions(options)));
+}
+
 // ZonedDateTime methods
 
 - (NSString *)zonedDateTimeFromString:(NSString *)s {
     if (s == nil) THROW_TYPE_ERROR(@"String cannot be null");
-    TemporalResult result = temporal_zoned_date_time_from_string([s UTF8String]);
-    return extractResultValue(result);
+    const char *sCStr = [s UTF8String];
+    return extractIntoValue(^(char *buf, size_t cap, size_t *len) {
+        return temporal_zoned_date_time_from_string_into(sCStr, buf, cap, len);
+    });
 }
 
 - (NSString *)zonedDateTimeFromComponents:(double)year month:(double)month day:(double)day hour:(double)hour minute:(double)minute second:(double)second millisecond:(double)millisecond microsecond:(double)microsecond nanosecond:(double)nanosecond calendarId:(NSString *)calendarId timeZoneId:(NSString *)timeZoneId offsetNanoseconds:(double)offsetNanoseconds {
@@ -1186,6 +1636,474 @@ static NSString *extractResultValue(TemporalResult result) {
     return extractResultValue(result);
 }
 
+- (void)handleRelease:(double)handle {
+    throwStatusError(temporal_handle_release(toHandle(handle)));
+}
+
+- (NSString *)handleToString:(double)handle {
+    TemporalHandle *h = toHandle(handle);
+    return extractIntoValue(^(char *buf, size_t cap, size_t *len) {
+        return temporal_handle_to_string_into(h, buf, cap, len);
+    });
+}
+
+- (double)handleCompare:(double)a b:(double)b {
+    CompareResult result = temporal_handle_compare(toHandle(a), toHandle(b));
+    throwCompareError(&result);
+    return result.value;
+}
+
+- (double)instantHandleFromString:(NSString *)s {
+    if (s == nil) THROW_TYPE_ERROR(@"Instant string cannot be null");
+    return extractHandle(temporal_instant_handle_from_string([s UTF8String]));
+}
+
+- (double)plainDateTimeHandleFromString:(NSString *)s {
+    if (s == nil) THROW_TYPE_ERROR(@"PlainDateTime string cannot be null");
+    return extractHandle(temporal_plain_date_time_handle_from_string([s UTF8String]));
+}
+
+- (double)zonedDateTimeHandleFromString:(NSString *)s {
+    if (s == nil) THROW_TYPE_ERROR(@"ZonedDateTime string cannot be null");
+    return extractHandle(temporal_zoned_date_time_handle_from_string([s UTF8String]));
+}
+
+- (double)durationHandleFromString:(NSString *)s {
+    if (s == nil) THROW_TYPE_ERROR(@"Duration string cannot be null");
+    return extractHandle(temporal_duration_handle_from_string([s UTF8String]));
+}
+
+- (double)instantHandleAdd:(double)handle duration:(double)duration {
+    return extractHandle(temporal_instant_handle_add(toHandle(handle), toHandle(duration)));
+}
+
+- (double)instantHandleSubtract:(double)handle duration:(double)duration {
+    return extractHandle(temporal_instant_handle_subtract(toHandle(handle), toHandle(duration)));
+}
+
+- (double)instantHandleRound:(double)handle smallestUnit:(NSString *)smallestUnit roundingIncrement:(double)roundingIncrement roundingMode:(NSString *)roundingMode {
+    if (smallestUnit == nil) THROW_TYPE_ERROR(@"smallestUnit is required");
+    const char *modeCStr = roundingMode ? [roundingMode UTF8String] : NULL;
+    return extractHandle(temporal_instant_handle_round(toHandle(handle), [smallestUnit UTF8String], (int64_t)roundingIncrement, modeCStr));
+}
+
+- (double)plainDateTimeHandleAdd:(double)handle duration:(double)duration {
+    return extractHandle(temporal_plain_date_time_handle_add(toHandle(handle), toHandle(duration)));
+}
+
+- (double)plainDateTimeHandleSubtract:(double)handle duration:(double)duration {
+    return extractHandle(temporal_plain_date_time_handle_subtract(toHandle(handle), toHandle(duration)));
+}
+
+- (double)plainDateTimeHandleWith:(double)handle year:(double)year month:(double)month day:(double)day hour:(double)hour minute:(double)minute second:(double)second millisecond:(double)millisecond microsecond:(double)microsecond nanosecond:(double)nanosecond calendarId:(NSString *)calendarId {
+    const char *cIdCStr = calendarId ? [calendarId UTF8String] : NULL;
+    HandleResult result = temporal_plain_date_time_handle_with(
+        toHandle(handle),
+        (int32_t)year, (int32_t)month, (int32_t)day,
+        (int32_t)hour, (int32_t)minute, (int32_t)second,
+        (int32_t)millisecond, (int32_t)microsecond, (int32_t)nanosecond,
+        cIdCStr
+    );
+    return extractHandle(result);
+}
+
+- (NSArray<NSNumber *> *)plainDateTimeHandleGetAllComponents:(double)handle {
+    PlainDateTimeComponents c;
+    temporal_plain_date_time_handle_get_components(toHandle(handle), &c);
+
+    if (c.is_valid == 0) {
+        THROW_TYPE_ERROR(@"Handle is not a PlainDateTime");
+    }
+
+    return @[
+        @(c.year), @(c.month), @(c.day),
+        @(c.day_of_week), @(c.day_of_year), @(c.week_of_year), @(c.year_of_week),
+        @(c.days_in_week), @(c.days_in_month), @(c.days_in_year), @(c.months_in_year),
+        @(c.in_leap_year),
+        @(c.hour), @(c.minute), @(c.second),
+        @(c.millisecond), @(c.microsecond), @(c.nanosecond)
+    ];
+}
+
+- (double)zonedDateTimeHandleAdd:(double)handle duration:(double)duration {
+    return extractHandle(temporal_zoned_date_time_handle_add(toHandle(handle), toHandle(duration)));
+}
+
+- (double)zonedDateTimeHandleSubtract:(double)handle duration:(double)duration {
+    return extractHandle(temporal_zoned_date_time_handle_subtract(toHandle(handle), toHandle(duration)));
+}
+
+- (double)zonedDateTimeHandleRound:(double)handle smallestUnit:(NSString *)smallestUnit roundingIncrement:(double)roundingIncrement roundingMode:(NSString *)roundingMode {
+    if (smallestUnit == nil) THROW_TYPE_ERROR(@"smallestUnit is required");
+    const char *modeCStr = roundingMode ? [roundingMode UTF8String] : NULL;
+    return extractHandle(temporal_zoned_date_time_handle_round(toHandle(handle), [smallestUnit UTF8String], (int64_t)roundingIncrement, modeCStr));
+}
+
+- (double)zonedDateTimeHandleRoundWithOptions:(double)handle options:(double)options {
+    return extractHandle(temporal_zoned_date_time_handle_round_with_options(toHandle(handle), toRoundingOptions(options)));
+}
+
+- (double)zonedDateTimeHandleWith:(double)handle year:(double)year month:(double)month day:(double)day hour:(double)hour minute:(double)minute second:(double)second millisecond:(double)millisecond microsecond:(double)microsecond nanosecond:(double)nanosecond calendarId:(NSString *)calendarId timeZoneId:(NSString *)timeZoneId {
+    const char *cIdCStr = calendarId ? [calendarId UTF8String] : NULL;
+    const char *tzIdCStr = timeZoneId ? [timeZoneId UTF8String] : NULL;
+    HandleResult result = temporal_zoned_date_time_handle_with(
+        toHandle(handle),
+        (int32_t)year, (int32_t)month, (int32_t)day,
+        (int32_t)hour, (int32_t)minute, (int32_t)second,
+        (int32_t)millisecond, (int32_t)microsecond, (int32_t)nanosecond,
+        cIdCStr, tzIdCStr
+    );
+    return extractHandle(result);
+}
+
+- (NSArray<NSNumber *> *)zonedDateTimeHandleGetAllComponents:(double)handle {
+    ZonedDateTimeComponents c;
+    temporal_zoned_date_time_handle_get_components(toHandle(handle), &c);
+
+    if (c.is_valid == 0) {
+        THROW_TYPE_ERROR(@"Handle is not a ZonedDateTime");
+    }
+
+    return @[
+        @(c.year), @(c.month), @(c.day),
+        @(c.day_of_week), @(c.day_of_year), @(c.week_of_year), @(c.year_of_week),
+        @(c.days_in_week), @(c.days_in_month), @(c.days_in_year), @(c.months_in_year),
+        @(c.in_leap_year),
+        @(c.hour), @(c.minute), @(c.second),
+        @(c.millisecond), @(c.microsecond), @(c.nanosecond),
+        @(c.offset_nanoseconds)
+    ];
+}
+
+- (double)zonedDateTimeRangeNew:(NSString *)start step:(NSString *)step end:(NSString *)end {
+    return extractHandle(temporal_zoned_date_time_range_new(
+        start ? [start UTF8String] : NULL,
+        step ? [step UTF8String] : NULL,
+        end ? [end UTF8String] : NULL
+    ));
+}
+
+- (NSArray<NSNumber *> *)zonedDateTimeRangeNextBatch:(double)range n:(double)n {
+    int32_t count = (int32_t)n;
+    std::vector<TemporalEpochNanoseconds> out(std::clamp<int32_t>(count, 0, TEMPORAL_MAX_RECURRENCE_COUNT));
+    BatchResult result = temporal_zoned_date_time_range_next_batch(toHandle(range), out.data(), count);
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:result.count * 2];
+    for (int32_t i = 0; i < result.count; i++) {
+        [values addObject:@(out[i].seconds)];
+        [values addObject:@(out[i].nanoseconds)];
+    }
+    return values;
+}
+
+// Columns
+
+static int32_t columnLength(double column) {
+    int32_t length = 0;
+    throwStatusError(temporal_column_length(toHandle(column), &length));
+    return length;
+}
+
+- (double)instantColumnFromEpochNanoseconds:(NSArray *)epochPairs {
+    if (epochPairs.count % 2 != 0) {
+        THROW_RANGE_ERROR(@"Epoch nanoseconds must be [seconds, nanoseconds] pairs");
+    }
+    std::vector<TemporalEpochNanoseconds> epochs(epochPairs.count / 2);
+    for (size_t i = 0; i < epochs.size(); i++) {
+        epochs[i].seconds = [epochPairs[i * 2] longLongValue];
+        epochs[i].nanoseconds = [epochPairs[i * 2 + 1] intValue];
+    }
+    return extractHandle(temporal_instant_column_from_epoch_nanoseconds(epochs.data(), (int32_t)epochs.size()));
+}
+
+- (double)instantColumnFromStrings:(NSArray *)strings {
+    std::vector<const char *> items = toCStringArray(strings);
+    return extractHandle(temporal_instant_column_from_strings(items.data(), (int32_t)items.size()));
+}
+
+- (double)plainDateColumnFromStrings:(NSArray *)strings {
+    std::vector<const char *> items = toCStringArray(strings);
+    return extractHandle(temporal_plain_date_column_from_strings(items.data(), (int32_t)items.size()));
+}
+
+- (double)columnLength:(double)column {
+    return columnLength(column);
+}
+
+- (double)columnSlice:(double)column start:(double)start end:(double)end {
+    return extractHandle(temporal_column_slice(toHandle(column), (int32_t)start, (int32_t)end));
+}
+
+- (double)instantColumnLowerBound:(double)column seconds:(double)seconds nanoseconds:(double)nanoseconds {
+    int32_t index = 0;
+    throwStatusError(temporal_instant_column_lower_bound(
+        toHandle(column), toEpochNanoseconds(seconds, nanoseconds), &index
+    ));
+    return index;
+}
+
+- (double)instantColumnRangeCount:(double)column
+                     startSeconds:(double)startSeconds
+                 startNanoseconds:(double)startNanoseconds
+                       endSeconds:(double)endSeconds
+                   endNanoseconds:(double)endNanoseconds {
+    int32_t count = 0;
+    throwStatusError(temporal_instant_column_range_count(
+        toHandle(column),
+        toEpochNanoseconds(startSeconds, startNanoseconds),
+        toEpochNanoseconds(endSeconds, endNanoseconds),
+        &count
+    ));
+    return count;
+}
+
+- (NSArray<NSNumber *> *)instantColumnRead:(double)column start:(double)start count:(double)count {
+    int32_t from = std::max<int32_t>((int32_t)start, 0);
+    int32_t n = std::clamp<int32_t>((int32_t)count, 0, std::max<int32_t>(columnLength(column) - from, 0));
+    std::vector<TemporalEpochNanoseconds> out(n);
+    BatchResult result = temporal_instant_column_read(toHandle(column), from, n, out.data());
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:result.count * 2];
+    for (int32_t i = 0; i < result.count; i++) {
+        [values addObject:@(out[i].seconds)];
+        [values addObject:@(out[i].nanoseconds)];
+    }
+    return values;
+}
+
+- (NSArray<NSNumber *> *)instantColumnBucketBy:(double)column unit:(NSString *)unit timeZoneId:(NSString *)timeZoneId {
+    int32_t cap = columnLength(column);
+    std::vector<TemporalEpochNanoseconds> starts(cap);
+    std::vector<int32_t> counts(cap);
+    BatchResult result = temporal_instant_column_bucket_by(
+        toHandle(column),
+        unit ? [unit UTF8String] : NULL,
+        timeZoneId ? [timeZoneId UTF8String] : NULL,
+        starts.data(),
+        counts.data(),
+        cap
+    );
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:result.count * 3];
+    for (int32_t i = 0; i < result.count; i++) {
+        [values addObject:@(starts[i].seconds)];
+        [values addObject:@(starts[i].nanoseconds)];
+        [values addObject:@(counts[i])];
+    }
+    return values;
+}
+
+- (double)plainDateColumnLowerBound:(double)column date:(NSString *)date {
+    int32_t index = 0;
+    throwStatusError(temporal_plain_date_column_lower_bound(
+        toHandle(column), date ? [date UTF8String] : NULL, &index
+    ));
+    return index;
+}
+
+- (double)plainDateColumnRangeCount:(double)column start:(NSString *)start end:(NSString *)end {
+    int32_t count = 0;
+    throwStatusError(temporal_plain_date_column_range_count(
+        toHandle(column), start ? [start UTF8String] : NULL, end ? [end UTF8String] : NULL, &count
+    ));
+    return count;
+}
+
+- (NSArray<NSNumber *> *)plainDateColumnRead:(double)column start:(double)start count:(double)count {
+    int32_t from = std::max<int32_t>((int32_t)start, 0);
+    int32_t n = std::clamp<int32_t>((int32_t)count, 0, std::max<int32_t>(columnLength(column) - from, 0));
+    std::vector<int32_t> out(n);
+    BatchResult result = temporal_plain_date_column_read(toHandle(column), from, n, out.data());
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:result.count];
+    for (int32_t i = 0; i < result.count; i++) {
+        [values addObject:@(out[i])];
+    }
+    return values;
+}
+
+- (NSArray<NSNumber *> *)plainDateColumnBucketBy:(double)column unit:(NSString *)unit {
+    int32_t cap = columnLength(column);
+    std::vector<int32_t> starts(cap);
+    std::vector<int32_t> counts(cap);
+    BatchResult result = temporal_plain_date_column_bucket_by(
+        toHandle(column), unit ? [unit UTF8String] : NULL, starts.data(), counts.data(), cap
+    );
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:result.count * 2];
+    for (int32_t i = 0; i < result.count; i++) {
+        [values addObject:@(starts[i])];
+        [values addObject:@(counts[i])];
+    }
+    return values;
+}
+
+// Zoned clocks
+
+- (double)zonedClockNew:(NSString *)timeZoneId {
+    return extractHandle(temporal_zoned_clock_new(timeZoneId ? [timeZoneId UTF8String] : NULL));
+}
+
+- (NSArray<NSNumber *> *)zonedClockRead:(double)clock {
+    ZonedClockReading r;
+    throwStatusError(temporal_zoned_clock_read(toHandle(clock), &r));
+    return @[
+        @(r.epoch_ns.seconds), @(r.epoch_ns.nanoseconds), @(r.offset_nanoseconds),
+        @(r.year), @(r.month), @(r.day),
+        @(r.hour), @(r.minute), @(r.second),
+        @(r.millisecond), @(r.microsecond), @(r.nanosecond),
+        @(r.day_of_week), @(r.day_of_year)
+    ];
+}
+
+// Batch methods
+
+- (NSArray<NSNumber *> *)instantParseMany:(NSArray *)strings {
+    return parseManyToArray(strings, temporal_instant_parse_many);
+}
+
+- (NSArray<NSNumber *> *)instantSort:(NSArray *)strings {
+    return sortToArray(strings, temporal_instant_sort);
+}
+
+- (NSArray<NSNumber *> *)instantCompareMany:(NSArray *)a b:(NSArray *)b {
+    return compareManyToArray(a, b, temporal_instant_compare_many);
+}
+
+- (NSArray<NSNumber *> *)plainDateSort:(NSArray *)strings {
+    return sortToArray(strings, temporal_plain_date_sort);
+}
+
+- (NSArray<NSNumber *> *)plainDateCompareMany:(NSArray *)a b:(NSArray *)b {
+    return compareManyToArray(a, b, temporal_plain_date_compare_many);
+}
+
+- (NSArray<NSNumber *> *)zonedDateTimeParseMany:(NSArray *)strings {
+    return parseManyToArray(strings, temporal_zoned_date_time_parse_many);
+}
+
+- (NSArray<NSNumber *> *)zonedDateTimeSort:(NSArray *)strings {
+    return sortToArray(strings, temporal_zoned_date_time_sort);
+}
+
+- (NSArray<NSNumber *> *)zonedDateTimeCompareMany:(NSArray *)a b:(NSArray *)b {
+    return compareManyToArray(a, b, temporal_zoned_date_time_compare_many);
+}
+
+- (NSArray<NSNumber *> *)timeZoneGetPlainDateTimesForMany:(NSString *)tzId epochPairs:(NSArray *)epochPairs {
+    if (!tzId) THROW_TYPE_ERROR(@"Timezone cannot be null");
+    if (epochPairs.count % 2 != 0) {
+        THROW_RANGE_ERROR(@"Epoch nanoseconds must be [seconds, nanoseconds] pairs");
+    }
+
+    std::vector<TemporalEpochNanoseconds> epochs(epochPairs.count / 2);
+    for (size_t i = 0; i < epochs.size(); i++) {
+        epochs[i].seconds = [epochPairs[i * 2] longLongValue];
+        epochs[i].nanoseconds = [epochPairs[i * 2 + 1] intValue];
+    }
+
+    std::vector<int32_t> out(epochs.size() * TEMPORAL_PLAIN_DATE_TIME_COLUMN_COUNT);
+    BatchResult result = temporal_time_zone_get_plain_date_times_for_many(
+        [tzId UTF8String], epochs.data(), (int32_t)epochs.size(), out.data()
+    );
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:out.size()];
+    for (int32_t value : out) {
+        [values addObject:@(value)];
+    }
+    return values;
+}
+
+- (NSArray<NSNumber *> *)timeZoneGetTransitions:(NSString *)tzId
+                                   startSeconds:(double)startSeconds
+                               startNanoseconds:(double)startNanoseconds
+                                     endSeconds:(double)endSeconds
+                                 endNanoseconds:(double)endNanoseconds
+                                            cap:(double)cap {
+    if (!tzId) THROW_TYPE_ERROR(@"Timezone cannot be null");
+    int32_t n = (int32_t)cap;
+    std::vector<TemporalEpochNanoseconds> out(std::clamp<int32_t>(n, 0, TEMPORAL_MAX_TRANSITION_COUNT));
+    BatchResult result = temporal_time_zone_get_transitions(
+        [tzId UTF8String],
+        toEpochNanoseconds(startSeconds, startNanoseconds),
+        toEpochNanoseconds(endSeconds, endNanoseconds),
+        out.data(),
+        n
+    );
+    throwBatchError(&result);
+
+    NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:result.count * 2];
+    for (int32_t i = 0; i < result.count; i++) {
+        [values addObject:@(out[i].seconds)];
+        [values addObject:@(out[i].nanoseconds)];
+    }
+    return values;
+}
+
+// Async methods
+//
+// Heavy batches run on a shared concurrent queue and settle a Promise; the
+// rejection code is the Temporal error name so JS can rethrow the right type.
+
+static dispatch_queue_t workerQueue(void) {
+    static dispatch_queue_t queue;
+    static dispatch_once_t once;
+    dispatch_once(&once, ^{
+        dispatch_queue_attr_t attr = dispatch_queue_attr_make_with_qos_class(
+            DISPATCH_QUEUE_CONCURRENT, QOS_CLASS_UTILITY, 0
+        );
+        queue = dispatch_queue_create("com.temporal.workers", attr);
+    });
+    return queue;
+}
+
+- (void)expandRecurrence:(NSString *)start
+                duration:(NSString *)duration
+                   count:(double)count
+              timeZoneId:(NSString *)timeZoneId
+                 resolve:(RCTPromiseResolveBlock)resolve
+                  reject:(RCTPromiseRejectBlock)reject {
+    if (!start || !duration || !timeZoneId) {
+        reject(@"TypeError", @"Arguments cannot be null", nil);
+        return;
+    }
+    std::string startStr([start UTF8String]);
+    std::string durationStr([duration UTF8String]);
+    std::string tzStr([timeZoneId UTF8String]);
+    int32_t n = toInt32(count);
+
+    dispatch_async(workerQueue(), ^{
+        std::vector<TemporalEpochNanoseconds> out(
+            std::clamp<int32_t>(n, 0, TEMPORAL_MAX_RECURRENCE_COUNT)
+        );
+        BatchResult result = temporal_zoned_date_time_expand_recurrence(
+            startStr.c_str(), durationStr.c_str(), n, tzStr.c_str(), out.data()
+        );
+        if (result.error_type != TEMPORAL_ERROR_NONE) {
+            NSString *message = result.error_message
+                ? [NSString stringWithUTF8String:result.error_message]
+                : @"Unknown error";
+            NSString *code = result.error_type == TEMPORAL_ERROR_TYPE ? @"TypeError" : @"RangeError";
+            temporal_free_batch_result(&result);
+            reject(code, message, nil);
+            return;
+        }
+
+        NSMutableArray<NSNumber *> *values = [NSMutableArray arrayWithCapacity:out.size() * 2];
+        for (const TemporalEpochNanoseconds &e : out) {
+            [values addObject:@(e.seconds)];
+            [values addObject:@(e.nanoseconds)];
+        }
+        resolve(values);
+    });
+}
+
 - (std::shared_ptr<facebook::react::TurboModule>)getTurboModule:
 
     (const facebook::react::ObjCTurboModule::InitParams &)params
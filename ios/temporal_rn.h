@@ -2,12 +2,24 @@
 #ifndef TEMPORAL_RN_H
 #define TEMPORAL_RN_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Threading: every function may be called from any number of threads at
+ * once. Shared caches (time zones, transitions, interned IDs) are read
+ * through thread-local copies or lock-free slots, so concurrent callers
+ * don't serialize on a lock once a value has been seen. Error messages and
+ * batch scratch buffers are per thread. Handles can be shared; calls that
+ * advance a range or read a clock take turns on that handle, and a handle
+ * released while another thread is using it stays valid until that call
+ * returns.
+ */
+
 // ============================================================================
 // Error Types (matching TC39 Temporal)
 // ============================================================================
@@ -183,6 +195,11 @@ TemporalResult temporal_plain_time_from_components(
  */
 void temporal_plain_time_get_components(const char *s, PlainTimeComponents *out);
 
+/**
+ * Parses a PlainTime string and fills its components in one call.
+ */
+TemporalResult temporal_plain_time_from_string_with_components(const char *s, PlainTimeComponents *out);
+
 /**
  * Adds a duration to a PlainTime.
  */
@@ -238,6 +255,7 @@ typedef struct {
 TemporalResult temporal_plain_date_from_string(const char *s);
 TemporalResult temporal_plain_date_from_components(int32_t year, uint8_t month, uint8_t day, const char *calendar_id);
 void temporal_plain_date_get_components(const char *s, PlainDateComponents *out);
+TemporalResult temporal_plain_date_from_string_with_components(const char *s, PlainDateComponents *out);
 TemporalResult temporal_plain_date_get_month_code(const char *s);
 TemporalResult temporal_plain_date_get_calendar(const char *s);
 TemporalResult temporal_plain_date_add(const char *date_str, const char *duration_str);
@@ -281,6 +299,7 @@ TemporalResult temporal_plain_date_time_from_components(
     const char *calendar_id
 );
 void temporal_plain_date_time_get_components(const char *s, PlainDateTimeComponents *out);
+TemporalResult temporal_plain_date_time_from_string_with_components(const char *s, PlainDateTimeComponents *out);
 TemporalResult temporal_plain_date_time_get_month_code(const char *s);
 TemporalResult temporal_plain_date_time_get_calendar(const char *s);
 TemporalResult temporal_plain_date_time_add(const char *dt_str, const char *duration_str);
@@ -475,6 +494,61 @@ TemporalResult temporal_time_zone_get_instant_for(const char *tz_id, const char
 TemporalResult temporal_time_zone_get_next_transition(const char *tz_id, const char *instant_str);
 TemporalResult temporal_time_zone_get_previous_transition(const char *tz_id, const char *instant_str);
 
+/**
+ * Counters for the process-wide TimeZone cache.
+ */
+typedef struct {
+    uint64_t hits;         // Lookups served from the cache
+    uint64_t misses;       // Lookups that had to resolve the zone
+    uint64_t size;         // Cached identifiers (including normalized aliases)
+} TimeZoneCacheStats;
+
+/**
+ * Returns the TimeZone cache hit/miss counters.
+ */
+TimeZoneCacheStats temporal_time_zone_cache_stats(void);
+
+/**
+ * Empties the TimeZone cache and resets its counters.
+ */
+void temporal_time_zone_cache_clear(void);
+
+// ============================================================================
+// Instrumentation
+// ============================================================================
+
+/**
+ * Process-wide counters. All zero (and `enabled` 0) unless the library was
+ * built with the `stats` cargo feature. Totals only count outermost calls.
+ */
+typedef struct {
+    int32_t enabled;             // 1 when built with the `stats` feature
+    uint64_t calls;              // outermost entry point calls
+    uint64_t total_nanoseconds;  // wall time spent in those calls
+    uint64_t parse_count;        // Temporal values parsed from strings
+    uint64_t format_count;       // strings produced for the caller
+    uint64_t error_count;        // outermost calls that failed
+    uint64_t allocation_count;   // heap allocations made by the library
+    uint64_t allocation_bytes;   // bytes requested by those allocations
+} TemporalStats;
+
+/**
+ * Writes the current totals into `out`. Returns a TemporalErrorType.
+ */
+int32_t temporal_stats_snapshot(TemporalStats *out);
+
+/**
+ * Returns the totals plus per-entry-point counters (calls, totalNanoseconds,
+ * parseCount, formatCount, errorCount) as a JSON object. Caller must free
+ * the result with temporal_free_result.
+ */
+TemporalResult temporal_stats_to_json(void);
+
+/**
+ * Zeroes every counter.
+ */
+void temporal_stats_reset(void);
+
 // ============================================================================
 // ZonedDateTime API
 // ============================================================================
@@ -510,6 +584,7 @@ TemporalResult temporal_zoned_date_time_from_components(
     const char *calendar_id, const char *time_zone_id, int64_t offset_nanoseconds
 );
 void temporal_zoned_date_time_get_components(const char *s, ZonedDateTimeComponents *out);
+TemporalResult temporal_zoned_date_time_from_string_with_components(const char *s, ZonedDateTimeComponents *out);
 TemporalResult temporal_zoned_date_time_epoch_milliseconds(const char *s);
 TemporalResult temporal_zoned_date_time_epoch_nanoseconds(const char *s);
 TemporalResult temporal_zoned_date_time_get_calendar(const char *s);
@@ -539,6 +614,747 @@ TemporalResult temporal_zoned_date_time_to_plain_date(const char *s);
 TemporalResult temporal_zoned_date_time_to_plain_time(const char *s);
 TemporalResult temporal_zoned_date_time_to_plain_date_time(const char *s);
 
+// ============================================================================
+// Handle API
+// ============================================================================
+
+/**
+ * Opaque handle to a parsed Temporal value kept on the native side.
+ * Chained operations on handles skip the string parse/format round-trip.
+ * Every handle must be released with `temporal_handle_release`. Released or
+ * made-up handles are reported as TypeErrors, never dereferenced.
+ */
+typedef struct TemporalHandle TemporalHandle;
+
+/**
+ * Kind of value held by a handle.
+ */
+typedef enum {
+    TEMPORAL_HANDLE_INSTANT = 1,
+    TEMPORAL_HANDLE_PLAIN_DATE_TIME = 2,
+    TEMPORAL_HANDLE_ZONED_DATE_TIME = 3,
+    TEMPORAL_HANDLE_DURATION = 4,
+    TEMPORAL_HANDLE_ZONED_DATE_TIME_RANGE = 5,
+    TEMPORAL_HANDLE_INSTANT_COLUMN = 6,
+    TEMPORAL_HANDLE_PLAIN_DATE_COLUMN = 7,
+    TEMPORAL_HANDLE_ZONED_CLOCK = 8,
+} TemporalHandleKind;
+
+/**
+ * Result structure for operations that return a new handle.
+ */
+typedef struct {
+    TemporalHandle *handle; // New handle (NULL if error)
+    int32_t error_type;     // Error type (0 = success)
+    char *error_message;    // Error message (NULL if success)
+} HandleResult;
+
+/**
+ * Frees a HandleResult's error message. The handle itself is not released.
+ */
+void temporal_free_handle_result(HandleResult *result);
+
+/**
+ * Releases a handle and returns a TemporalErrorType. Passing NULL is a
+ * no-op; a released or unknown handle is a TypeError, with the message in
+ * temporal_last_error_message(). A call still using the handle on another
+ * thread keeps its value alive until it returns.
+ */
+int32_t temporal_handle_release(TemporalHandle *handle);
+
+/**
+ * Returns the TemporalHandleKind of a handle, or 0 for NULL or a handle that
+ * is not live.
+ */
+int32_t temporal_handle_kind(const TemporalHandle *handle);
+
+/**
+ * Formats the value held by a handle as an ISO 8601 string.
+ */
+TemporalResult temporal_handle_to_string(const TemporalHandle *handle);
+
+/**
+ * Compares two handles of the same kind. Duration handles are not comparable.
+ */
+CompareResult temporal_handle_compare(const TemporalHandle *a, const TemporalHandle *b);
+
+HandleResult temporal_instant_handle_from_string(const char *s);
+HandleResult temporal_plain_date_time_handle_from_string(const char *s);
+HandleResult temporal_zoned_date_time_handle_from_string(const char *s);
+HandleResult temporal_duration_handle_from_string(const char *s);
+
+HandleResult temporal_instant_handle_add(const TemporalHandle *handle, const TemporalHandle *duration);
+HandleResult temporal_instant_handle_subtract(const TemporalHandle *handle, const TemporalHandle *duration);
+HandleResult temporal_instant_handle_round(
+    const TemporalHandle *handle,
+    const char *smallest_unit,
+    int64_t rounding_increment,
+    const char *rounding_mode
+);
+
+HandleResult temporal_plain_date_time_handle_add(const TemporalHandle *handle, const TemporalHandle *duration);
+HandleResult temporal_plain_date_time_handle_subtract(const TemporalHandle *handle, const TemporalHandle *duration);
+HandleResult temporal_plain_date_time_handle_with(
+    const TemporalHandle *handle,
+    int32_t year, int32_t month, int32_t day,
+    int32_t hour, int32_t minute, int32_t second,
+    int32_t millisecond, int32_t microsecond, int32_t nanosecond,
+    const char *calendar_id
+);
+void temporal_plain_date_time_handle_get_components(const TemporalHandle *handle, PlainDateTimeComponents *out);
+
+HandleResult temporal_zoned_date_time_handle_add(const TemporalHandle *handle, const TemporalHandle *duration);
+HandleResult temporal_zoned_date_time_handle_subtract(const TemporalHandle *handle, const TemporalHandle *duration);
+HandleResult temporal_zoned_date_time_handle_round(
+    const TemporalHandle *handle,
+    const char *smallest_unit,
+    int64_t rounding_increment,
+    const char *rounding_mode
+);
+HandleResult temporal_zoned_date_time_handle_with(
+    const TemporalHandle *handle,
+    int32_t year, int32_t month, int32_t day,
+    int32_t hour, int32_t minute, int32_t second,
+    int32_t millisecond, int32_t microsecond, int32_t nanosecond,
+    const char *calendar_id, const char *time_zone_id
+);
+void temporal_zoned_date_time_handle_get_components(const TemporalHandle *handle, ZonedDateTimeComponents *out);
+
+// ============================================================================
+// Batch API
+// ============================================================================
+
+/**
+ * Epoch nanoseconds split into floored whole seconds and a nanosecond
+ * remainder in [0, 1e9).
+ */
+typedef struct {
+    int64_t seconds;
+    int32_t nanoseconds;
+} TemporalEpochNanoseconds;
+
+/**
+ * Result structure for batch operations writing into caller-provided buffers.
+ */
+typedef struct {
+    int32_t count;         // Number of elements written
+    int32_t error_index;   // Index of the first failing input (-1 if none)
+    int32_t error_type;    // Error type (0 = success)
+    char *error_message;   // Error message (NULL if success)
+} BatchResult;
+
+/**
+ * Frees a BatchResult's error message.
+ */
+void temporal_free_batch_result(BatchResult *result);
+
+/** Largest thread count accepted by temporal_set_batch_threads. */
+#define TEMPORAL_MAX_BATCH_THREADS 16
+
+/**
+ * Sets how many threads the batch functions (parse, sort and compare many,
+ * to-bytes many, plain date-times for many, recurrence expansion) may use
+ * for batches of a few thousand items or more. 0 restores the default, the
+ * device's performance cores; 1 keeps every batch on the calling thread.
+ * Results and reported errors are the same for every setting. Returns a
+ * TemporalErrorType; the message is available from
+ * temporal_last_error_message().
+ */
+int32_t temporal_set_batch_threads(int32_t threads);
+
+/**
+ * Returns the number of threads large batches run on.
+ */
+int32_t temporal_get_batch_threads(void);
+
+/**
+ * Parses `count` instant strings into epoch nanoseconds, writing to `out`.
+ */
+BatchResult temporal_instant_parse_many(const char *const *strings, int32_t count, TemporalEpochNanoseconds *out);
+
+/**
+ * Writes the stable ascending sort permutation of `count` instants to `out_permutation`.
+ */
+BatchResult temporal_instant_sort(const char *const *strings, int32_t count, int32_t *out_permutation);
+
+/**
+ * Compares `a[i]` with `b[i]` for each index, writing -1, 0, or 1 to `out`.
+ */
+BatchResult temporal_instant_compare_many(const char *const *a, const char *const *b, int32_t count, int8_t *out);
+
+BatchResult temporal_plain_date_sort(const char *const *strings, int32_t count, int32_t *out_permutation);
+BatchResult temporal_plain_date_compare_many(const char *const *a, const char *const *b, int32_t count, int8_t *out);
+
+BatchResult temporal_zoned_date_time_parse_many(const char *const *strings, int32_t count, TemporalEpochNanoseconds *out);
+BatchResult temporal_zoned_date_time_sort(const char *const *strings, int32_t count, int32_t *out_permutation);
+BatchResult temporal_zoned_date_time_compare_many(const char *const *a, const char *const *b, int32_t count, int8_t *out);
+
+/**
+ * Number of int32 columns written per item by
+ * temporal_time_zone_get_plain_date_times_for_many: year, month, day, hour,
+ * minute, second, millisecond, microsecond, nanosecond.
+ */
+#define TEMPORAL_PLAIN_DATE_TIME_COLUMN_COUNT 9
+
+/**
+ * Converts `count` epoch nanoseconds to ISO wall-clock fields in one time zone.
+ * `out` must hold TEMPORAL_PLAIN_DATE_TIME_COLUMN_COUNT * count values; column
+ * `c` occupies out[c * count .. (c + 1) * count].
+ */
+BatchResult temporal_time_zone_get_plain_date_times_for_many(
+    const char *tz_id,
+    const TemporalEpochNanoseconds *epoch_ns,
+    int32_t count,
+    int32_t *out
+);
+
+/** Largest cap accepted by temporal_time_zone_get_transitions. */
+#define TEMPORAL_MAX_TRANSITION_COUNT 100000
+
+/**
+ * Writes the transitions t of a zone with start <= t < end into `out`,
+ * ascending, from the zone's precomputed transition index. At most `cap` are
+ * written; when `count == cap`, call again with `start` just after the last
+ * one to continue.
+ */
+BatchResult temporal_time_zone_get_transitions(
+    const char *tz_id,
+    TemporalEpochNanoseconds start,
+    TemporalEpochNanoseconds end,
+    TemporalEpochNanoseconds *out,
+    int32_t cap
+);
+
+/** Largest count accepted by temporal_zoned_date_time_expand_recurrence. */
+#define TEMPORAL_MAX_RECURRENCE_COUNT 1000000
+
+/**
+ * Writes the exact times of `start + duration * i` for i in [0, count) into
+ * `out`. `start` is a plain date-time placed in `tz_id` with compatible
+ * disambiguation. Safe to call from a worker thread.
+ */
+BatchResult temporal_zoned_date_time_expand_recurrence(
+    const char *start,
+    const char *duration,
+    int32_t count,
+    const char *tz_id,
+    TemporalEpochNanoseconds *out
+);
+
+/**
+ * Creates a range handle over `start + step * i` for i = 0, 1, 2, ...
+ * `start` and `end` are zoned date-time strings; `end` is an exclusive bound
+ * in the direction of `step`, or NULL for an unbounded range. The range keeps
+ * its parsed state between batches. Release with temporal_handle_release.
+ */
+HandleResult temporal_zoned_date_time_range_new(const char *start, const char *step, const char *end);
+
+/**
+ * Writes up to `n` further occurrences of a range into `out` and returns how
+ * many were written in `count`; 0 means the range is exhausted. Calls on the
+ * same range from several threads take turns.
+ */
+BatchResult temporal_zoned_date_time_range_next_batch(
+    TemporalHandle *range,
+    TemporalEpochNanoseconds *out,
+    int32_t n
+);
+
+// ============================================================================
+// Columns
+// ============================================================================
+
+/**
+ * A column is a sorted array of instants or plain dates kept natively, for
+ * binary searches, range counts and histograms in one call. Plain dates are
+ * stored as days since 1970-01-01 in the ISO calendar. Columns are handles
+ * of kind TEMPORAL_HANDLE_INSTANT_COLUMN or TEMPORAL_HANDLE_PLAIN_DATE_COLUMN
+ * and must be released with temporal_handle_release. Columns are immutable
+ * and may be read from several threads at once.
+ */
+HandleResult temporal_instant_column_from_epoch_nanoseconds(const TemporalEpochNanoseconds *epoch_ns, int32_t count);
+HandleResult temporal_instant_column_from_strings(const char *const *strings, int32_t count);
+HandleResult temporal_plain_date_column_from_strings(const char *const *strings, int32_t count);
+
+/**
+ * Column status functions write their result to `out` and return a
+ * TemporalErrorType, with the message from temporal_last_error_message().
+ */
+int32_t temporal_column_length(const TemporalHandle *column, int32_t *out);
+
+/**
+ * Creates a view of the values at [from, to) of either kind of column,
+ * sharing its memory. Both bounds are clamped to the column.
+ */
+HandleResult temporal_column_slice(const TemporalHandle *column, int32_t from, int32_t to);
+
+/** Index of the first instant not before `instant`. */
+int32_t temporal_instant_column_lower_bound(
+    const TemporalHandle *column,
+    TemporalEpochNanoseconds instant,
+    int32_t *out
+);
+
+/** Number of instants in [start, end). */
+int32_t temporal_instant_column_range_count(
+    const TemporalHandle *column,
+    TemporalEpochNanoseconds start,
+    TemporalEpochNanoseconds end,
+    int32_t *out
+);
+
+/** Copies up to `n` instants starting at index `from` into `out`. */
+BatchResult temporal_instant_column_read(
+    const TemporalHandle *column,
+    int32_t from,
+    int32_t n,
+    TemporalEpochNanoseconds *out
+);
+
+/**
+ * Groups a column by the "day", "week" (from Monday), "month" or "year" it
+ * falls in, in time zone `tz_id`. For each non-empty bucket, in order, writes
+ * the instant the bucket starts to `out_starts` and its size to `out_counts`,
+ * stopping after `cap` buckets. `count` is the number of buckets written.
+ */
+BatchResult temporal_instant_column_bucket_by(
+    const TemporalHandle *column,
+    const char *unit,
+    const char *tz_id,
+    TemporalEpochNanoseconds *out_starts,
+    int32_t *out_counts,
+    int32_t cap
+);
+
+/** Index of the first date not before the plain date string `date`. */
+int32_t temporal_plain_date_column_lower_bound(const TemporalHandle *column, const char *date, int32_t *out);
+
+/** Number of dates in [start, end). */
+int32_t temporal_plain_date_column_range_count(
+    const TemporalHandle *column,
+    const char *start,
+    const char *end,
+    int32_t *out
+);
+
+/** Copies up to `n` dates, as day numbers, starting at index `from`. */
+BatchResult temporal_plain_date_column_read(
+    const TemporalHandle *column,
+    int32_t from,
+    int32_t n,
+    int32_t *out_days
+);
+
+/**
+ * Like temporal_instant_column_bucket_by, writing the day number each
+ * bucket starts on to `out_start_days`.
+ */
+BatchResult temporal_plain_date_column_bucket_by(
+    const TemporalHandle *column,
+    const char *unit,
+    int32_t *out_start_days,
+    int32_t *out_counts,
+    int32_t cap
+);
+
+// ============================================================================
+// Zoned clocks
+// ============================================================================
+
+/**
+ * The current instant and its ISO wall-clock fields in a clock's zone.
+ * day_of_week runs from 1 (Monday) to 7.
+ */
+typedef struct {
+    TemporalEpochNanoseconds epoch_ns;
+    int64_t offset_nanoseconds;
+    int32_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t day_of_week;
+    uint16_t day_of_year;
+    uint16_t millisecond;
+    uint16_t microsecond;
+    uint16_t nanosecond;
+} ZonedClockReading;
+
+/**
+ * Creates a clock bound to `tz_id`, of kind TEMPORAL_HANDLE_ZONED_CLOCK.
+ * Reading it costs a monotonic clock read and integer arithmetic: the system
+ * clock is re-read once a second and the zone's UTC offset is kept until its
+ * next transition. Release with temporal_handle_release.
+ */
+HandleResult temporal_zoned_clock_new(const char *tz_id);
+
+/**
+ * Writes the current time in the clock's zone to `out` and returns a
+ * TemporalErrorType. Reads of the same clock from several threads take
+ * turns.
+ */
+int32_t temporal_zoned_clock_read(TemporalHandle *clock, ZonedClockReading *out);
+
+// ============================================================================
+// Caller-provided output buffers
+// ============================================================================
+
+/**
+ * The _into variants write their string into `buf` instead of allocating a
+ * TemporalResult. Like snprintf, at most `cap - 1` bytes plus a NUL are
+ * written and `*len` receives the full length; `*len >= cap` means the output
+ * was truncated. They return a TemporalErrorType; on failure the message is
+ * available from temporal_last_error_message() on the same thread.
+ */
+int32_t temporal_instant_from_string_into(const char *s, char *buf, size_t cap, size_t *len);
+int32_t temporal_instant_from_epoch_milliseconds_into(int64_t ms, char *buf, size_t cap, size_t *len);
+int32_t temporal_instant_add_into(const char *instant_str, const char *duration_str, char *buf, size_t cap, size_t *len);
+int32_t temporal_instant_subtract_into(const char *instant_str, const char *duration_str, char *buf, size_t cap, size_t *len);
+int32_t temporal_plain_date_time_from_string_into(const char *s, char *buf, size_t cap, size_t *len);
+int32_t temporal_zoned_date_time_from_string_into(const char *s, char *buf, size_t cap, size_t *len);
+int32_t temporal_handle_to_string_into(const TemporalHandle *handle, char *buf, size_t cap, size_t *len);
+
+/**
+ * Message of the last failed _into, status or temporal_validate call on this
+ * thread, or NULL. Valid until the next such failure on the same thread.
+ */
+const char *temporal_last_error_message(void);
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+/**
+ * Temporal types accepted by temporal_validate.
+ */
+typedef enum {
+    TEMPORAL_VALUE_INSTANT = 0,
+    TEMPORAL_VALUE_DURATION = 1,
+    TEMPORAL_VALUE_PLAIN_TIME = 2,
+    TEMPORAL_VALUE_PLAIN_DATE = 3,
+    TEMPORAL_VALUE_PLAIN_DATE_TIME = 4,
+    TEMPORAL_VALUE_PLAIN_YEAR_MONTH = 5,
+    TEMPORAL_VALUE_PLAIN_MONTH_DAY = 6,
+    TEMPORAL_VALUE_ZONED_DATE_TIME = 7,
+} TemporalValueKind;
+
+/**
+ * Returns 0 if the matching _from_string function would accept `s`,
+ * otherwise its TemporalErrorType. Failures format no message and allocate
+ * nothing; temporal_last_error_message() builds the message on demand.
+ */
+int32_t temporal_validate(int32_t kind, const char *s);
+
+// ============================================================================
+// Binary encoding
+// ============================================================================
+
+/**
+ * Fixed-size little-endian records for persistence and bulk transfer:
+ * version, kind (1 Instant, 2 ZonedDateTime), calendar tag, zone kind
+ * (0 none, 1 IANA table index, 2 UTC offset in minutes), the zone, then the
+ * floored epoch seconds (int64) and nanosecond remainder (uint32). The last
+ * four bytes are reserved and zero.
+ */
+#define TEMPORAL_BINARY_SIZE 24
+#define TEMPORAL_BINARY_VERSION 1
+
+/**
+ * Encode into the TEMPORAL_BINARY_SIZE bytes at `out`. Return a
+ * TemporalErrorType; on failure the message is available from
+ * temporal_last_error_message(). Zones outside the built-in table and
+ * unknown calendars are a RangeError.
+ */
+int32_t temporal_instant_to_bytes(const char *s, uint8_t *out);
+int32_t temporal_zoned_date_time_to_bytes(const char *s, uint8_t *out);
+
+/**
+ * Decode a record into its ISO 8601 string. A record of the other kind is a
+ * TypeError; an unknown version, table index or calendar tag a RangeError.
+ */
+TemporalResult temporal_instant_from_bytes(const uint8_t *bytes);
+TemporalResult temporal_zoned_date_time_from_bytes(const uint8_t *bytes);
+
+/**
+ * Encode `count` strings into consecutive records. `out` must have room for
+ * `count * TEMPORAL_BINARY_SIZE` bytes; nothing is written if any item fails.
+ */
+BatchResult temporal_instant_to_bytes_many(const char *const *strings, int32_t count, uint8_t *out);
+BatchResult temporal_zoned_date_time_to_bytes_many(const char *const *strings, int32_t count, uint8_t *out);
+
+// ============================================================================
+// Streaming parse
+// ============================================================================
+
+/**
+ * Layouts accepted by temporal_instant_parse_stream.
+ */
+typedef enum {
+    TEMPORAL_STREAM_LINES = 0,       // one item per line, whitespace trimmed
+    TEMPORAL_STREAM_JSON_ARRAY = 1,  // the string elements of a JSON array
+} TemporalStreamFormat;
+
+/**
+ * Parses the instant strings in the UTF-8 `buf[0..len)` into `out` (room for
+ * `cap` elements) without a C string or TemporalResult per item.
+ *
+ * With `out_errors` every item gets its TemporalErrorType, failed items get a
+ * zero epoch and parsing continues; with `out_errors` NULL the first invalid
+ * item fails the call. With `out` NULL nothing is parsed and `count` is the
+ * number of items in the buffer.
+ *
+ * `*consumed` (optional) receives the offset just past the last item
+ * processed. An item cut off by the end of the buffer is left unconsumed
+ * unless `last_chunk` is nonzero, so a body can be parsed chunk by chunk by
+ * prepending the unconsumed tail to the next chunk.
+ */
+BatchResult temporal_instant_parse_stream(
+    const uint8_t *buf,
+    size_t len,
+    int32_t format,
+    int32_t last_chunk,
+    TemporalEpochNanoseconds *out,
+    int8_t *out_errors,
+    int32_t cap,
+    size_t *consumed
+);
+
+// ============================================================================
+// Interned identifiers
+// ============================================================================
+
+/**
+ * Interns a time zone or calendar identifier into a small process-wide ID,
+ * written to `out`, for the _interned variants below. Those skip parsing
+ * the identifier on every call. IDs are never reused. Return a
+ * TemporalErrorType; on failure the message is available from
+ * temporal_last_error_message().
+ */
+int32_t temporal_intern_time_zone(const char *identifier, uint32_t *out);
+int32_t temporal_intern_calendar(const char *identifier, uint32_t *out);
+
+/**
+ * Normalized identifier of an interned ID. Caller must free the result with
+ * temporal_free_result.
+ */
+TemporalResult temporal_interned_time_zone_identifier(uint32_t time_zone);
+TemporalResult temporal_interned_calendar_identifier(uint32_t calendar);
+
+/**
+ * The TimeZone API with interned IDs. An unknown ID is a RangeError.
+ */
+TemporalResult temporal_time_zone_get_offset_nanoseconds_for_interned(uint32_t time_zone, const char *instant_str);
+TemporalResult temporal_time_zone_get_offset_string_for_interned(uint32_t time_zone, const char *instant_str);
+TemporalResult temporal_time_zone_get_plain_date_time_for_interned(uint32_t time_zone, const char *instant_str, uint32_t calendar);
+TemporalResult temporal_time_zone_get_instant_for_interned(uint32_t time_zone, const char *dt_str, const char *disambiguation);
+TemporalResult temporal_time_zone_get_next_transition_interned(uint32_t time_zone, const char *instant_str);
+TemporalResult temporal_time_zone_get_previous_transition_interned(uint32_t time_zone, const char *instant_str);
+BatchResult temporal_time_zone_get_transitions_interned(
+    uint32_t time_zone,
+    TemporalEpochNanoseconds start,
+    TemporalEpochNanoseconds end,
+    TemporalEpochNanoseconds *out,
+    int32_t cap
+);
+BatchResult temporal_time_zone_get_plain_date_times_for_many_interned(
+    uint32_t time_zone,
+    const TemporalEpochNanoseconds *epoch_ns,
+    int32_t count,
+    int32_t *out
+);
+
+/**
+ * Converts epoch nanoseconds to a ZonedDateTime string in an interned time
+ * zone and calendar. Caller must free the result with temporal_free_result.
+ */
+TemporalResult temporal_instant_to_zoned_date_time_interned(
+    TemporalEpochNanoseconds epoch_ns,
+    uint32_t calendar,
+    uint32_t time_zone
+);
+
+// ============================================================================
+// Formatting options
+// ============================================================================
+
+/**
+ * toString(options) for the types with a time. `fractional_second_digits` is
+ * 0-9, or negative for "auto"; NULL strings take the Temporal defaults
+ * ("auto" display, "trunc" rounding). Caller must free the result with
+ * temporal_free_result.
+ */
+TemporalResult temporal_instant_to_string_with_options(
+    const char *instant_str,
+    int32_t fractional_second_digits,
+    const char *smallest_unit,
+    const char *rounding_mode
+);
+TemporalResult temporal_plain_time_to_string_with_options(
+    const char *s,
+    int32_t fractional_second_digits,
+    const char *smallest_unit,
+    const char *rounding_mode
+);
+TemporalResult temporal_plain_date_time_to_string_with_options(
+    const char *s,
+    int32_t fractional_second_digits,
+    const char *smallest_unit,
+    const char *rounding_mode,
+    const char *calendar_name
+);
+TemporalResult temporal_zoned_date_time_to_string_with_options(
+    const char *s,
+    int32_t fractional_second_digits,
+    const char *smallest_unit,
+    const char *rounding_mode,
+    const char *calendar_name,
+    const char *time_zone_name,
+    const char *offset
+);
+
+/**
+ * The toString options above packed into one value, so formatting parses no
+ * option strings. The value is self-contained and fits in 24 bits; nothing
+ * needs freeing.
+ */
+typedef uint64_t TemporalToStringOptions;
+
+/**
+ * Packs toString options into `out`, validating them as the _with_options
+ * variants do. Returns a TemporalErrorType; on failure the message is
+ * available from temporal_last_error_message().
+ */
+int32_t temporal_to_string_options_new(
+    int32_t fractional_second_digits,
+    const char *smallest_unit,
+    const char *rounding_mode,
+    const char *calendar_name,
+    const char *time_zone_name,
+    const char *offset,
+    TemporalToStringOptions *out
+);
+
+/**
+ * The _with_options variants with packed options. Options a type does not
+ * print are ignored. Caller must free the result with temporal_free_result.
+ */
+TemporalResult temporal_instant_to_string_with_packed_options(
+    const char *instant_str,
+    TemporalToStringOptions options
+);
+TemporalResult temporal_plain_time_to_string_with_packed_options(
+    const char *s,
+    TemporalToStringOptions options
+);
+TemporalResult temporal_plain_date_time_to_string_with_packed_options(
+    const char *s,
+    TemporalToStringOptions options
+);
+TemporalResult temporal_zoned_date_time_to_string_with_packed_options(
+    const char *s,
+    TemporalToStringOptions options
+);
+
+// ============================================================================
+// Rounding options
+// ============================================================================
+
+/**
+ * largestUnit / smallestUnit / roundingIncrement / roundingMode packed into
+ * one value for the _with_options variants below, which then parse no
+ * strings. The value is self-contained and fits in 42 bits; nothing needs
+ * freeing.
+ */
+typedef uint64_t TemporalRoundingOptions;
+
+/**
+ * Packs rounding options into `out`. NULL units and mode are unset, and an
+ * increment below 1 means 1. Returns a TemporalErrorType; on failure the
+ * message is available from temporal_last_error_message().
+ */
+int32_t temporal_rounding_options_new(
+    const char *largest_unit,
+    const char *smallest_unit,
+    int64_t rounding_increment,
+    const char *rounding_mode,
+    TemporalRoundingOptions *out
+);
+
+TemporalResult temporal_instant_until_epoch_nanoseconds_with_options(
+    TemporalEpochNanoseconds one,
+    TemporalEpochNanoseconds two,
+    TemporalRoundingOptions options
+);
+TemporalResult temporal_instant_since_epoch_nanoseconds_with_options(
+    TemporalEpochNanoseconds one,
+    TemporalEpochNanoseconds two,
+    TemporalRoundingOptions options
+);
+int32_t temporal_instant_round_epoch_nanoseconds_with_options(
+    TemporalEpochNanoseconds epoch_ns,
+    TemporalRoundingOptions options,
+    TemporalEpochNanoseconds *out
+);
+TemporalResult temporal_plain_time_until_with_options(
+    const char *one_str,
+    const char *two_str,
+    TemporalRoundingOptions options
+);
+TemporalResult temporal_plain_time_since_with_options(
+    const char *one_str,
+    const char *two_str,
+    TemporalRoundingOptions options
+);
+TemporalResult temporal_plain_time_round_with_options(
+    const char *time_str,
+    TemporalRoundingOptions options
+);
+TemporalResult temporal_zoned_date_time_round_with_options(
+    const char *zdt_str,
+    TemporalRoundingOptions options
+);
+HandleResult temporal_zoned_date_time_handle_round_with_options(
+    const TemporalHandle *handle,
+    TemporalRoundingOptions options
+);
+
+// ============================================================================
+// Instant API (epoch nanoseconds)
+// ============================================================================
+
+/**
+ * Instants as TemporalEpochNanoseconds instead of ISO strings. Functions
+ * producing an instant write it to `out` and return a TemporalErrorType; on
+ * failure the message is available from temporal_last_error_message().
+ */
+int32_t temporal_instant_parse_epoch_nanoseconds(const char *s, TemporalEpochNanoseconds *out);
+int32_t temporal_instant_now_epoch_nanoseconds(TemporalEpochNanoseconds *out);
+int32_t temporal_instant_format_epoch_nanoseconds_into(TemporalEpochNanoseconds epoch_ns, char *buf, size_t cap, size_t *len);
+int32_t temporal_instant_round_epoch_nanoseconds(
+    TemporalEpochNanoseconds epoch_ns,
+    const char *smallest_unit,
+    int64_t rounding_increment,
+    const char *rounding_mode,
+    TemporalEpochNanoseconds *out
+);
+TemporalResult temporal_instant_until_epoch_nanoseconds(
+    TemporalEpochNanoseconds one,
+    TemporalEpochNanoseconds two,
+    const char *largest_unit,
+    const char *smallest_unit,
+    int64_t rounding_increment,
+    const char *rounding_mode
+);
+TemporalResult temporal_instant_since_epoch_nanoseconds(
+    TemporalEpochNanoseconds one,
+    TemporalEpochNanoseconds two,
+    const char *largest_unit,
+    const char *smallest_unit,
+    int64_t rounding_increment,
+    const char *rounding_mode
+);
+
 #ifdef __cplusplus
 
 }
@@ -0,0 +1,361 @@
+//! Throughput and allocations per call of the hot C ABI entry points.
+//!
+//! Every case calls the `extern "C"` function exactly as the platform
+//! bindings do, including freeing the returned strings, so the numbers
+//! include the marshalling cost the apps actually pay.
+//!
+//! ```sh
+//! cargo bench --bench ffi                          # print results
+//! cargo bench --bench ffi -- --save-baseline main  # record a baseline
+//! cargo bench --bench ffi -- --baseline main       # compare against it
+//! cargo bench --bench ffi -- compare               # only matching cases
+//! ```
+//!
+//! Baselines are TSV files in `benches/baselines/`, so they can be committed
+//! and diffed in review. `scripts/bench-rust.sh` wraps the common flows.
+
+use std::collections::BTreeMap;
+use std::ffi::{c_char, CString};
+use std::fs;
+use std::hint::black_box;
+use std::path::PathBuf;
+use std::ptr;
+use std::time::{Duration, Instant as Clock};
+
+use temporal_rn::*;
+
+/// Counts every allocation made by the process, including temporal_rs's.
+#[cfg(not(feature = "stats"))]
+mod counting {
+    use std::alloc::{GlobalAlloc, Layout, System};
+    use std::sync::atomic::{AtomicU64, Ordering};
+
+    struct CountingAllocator;
+
+    static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+    static ALLOCATED_BYTES: AtomicU64 = AtomicU64::new(0);
+
+    unsafe impl GlobalAlloc for CountingAllocator {
+        unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+            ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+            ALLOCATED_BYTES.fetch_add(layout.size() as u64, Ordering::Relaxed);
+            System.alloc(layout)
+        }
+
+        unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+            System.dealloc(ptr, layout)
+        }
+
+        unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+            ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+            ALLOCATED_BYTES.fetch_add(new_size as u64, Ordering::Relaxed);
+            System.realloc(ptr, layout, new_size)
+        }
+    }
+
+    #[global_allocator]
+    static GLOBAL: CountingAllocator = CountingAllocator;
+
+    /// Allocations and bytes allocated so far.
+    pub fn totals() -> (u64, u64) {
+        (ALLOCATIONS.load(Ordering::Relaxed), ALLOCATED_BYTES.load(Ordering::Relaxed))
+    }
+}
+
+/// With the `stats` feature the library installs its own counting allocator,
+/// so read its totals instead.
+#[cfg(feature = "stats")]
+mod counting {
+    use temporal_rn::{temporal_stats_snapshot, TemporalStats};
+
+    pub fn totals() -> (u64, u64) {
+        let mut stats = TemporalStats::default();
+        temporal_stats_snapshot(&mut stats);
+        (stats.allocation_count, stats.allocation_bytes)
+    }
+}
+
+/// Time spent per sample; the iteration count is calibrated to hit it.
+const SAMPLE_TIME: Duration = Duration::from_millis(200);
+const SAMPLES: usize = 10;
+
+struct Measurement {
+    /// The first call, before anything is warm: page-in of the code and
+    /// data it touches plus any lazy initialization.
+    first_call: Duration,
+    ops_per_sec: f64,
+    allocs_per_call: f64,
+    bytes_per_call: f64,
+}
+
+/// Times one cold call of `f`, then runs it until a sample takes
+/// `SAMPLE_TIME` and reports the median of `SAMPLES` samples. Allocations
+/// are counted over all timed iterations.
+fn measure(mut f: impl FnMut()) -> Measurement {
+    let start = Clock::now();
+    f();
+    let first_call = start.elapsed();
+
+    let mut iterations: u64 = 1;
+    loop {
+        let start = Clock::now();
+        for _ in 0..iterations {
+            f();
+        }
+        if start.elapsed() >= SAMPLE_TIME / 10 {
+            break;
+        }
+        iterations *= 2;
+    }
+    iterations *= 10;
+
+    let (allocs_before, bytes_before) = counting::totals();
+    let mut rates = Vec::with_capacity(SAMPLES);
+    for _ in 0..SAMPLES {
+        let start = Clock::now();
+        for _ in 0..iterations {
+            f();
+        }
+        rates.push(iterations as f64 / start.elapsed().as_secs_f64());
+    }
+    let calls = (iterations * SAMPLES as u64) as f64;
+    let (allocs_after, bytes_after) = counting::totals();
+    let allocs = allocs_after - allocs_before;
+    let bytes = bytes_after - bytes_before;
+
+    rates.sort_by(|a, b| a.total_cmp(b));
+    Measurement {
+        first_call,
+        ops_per_sec: rates[SAMPLES / 2],
+        allocs_per_call: allocs as f64 / calls,
+        bytes_per_call: bytes as f64 / calls,
+    }
+}
+
+fn c(s: &str) -> CString {
+    CString::new(s).unwrap()
+}
+
+fn consume(mut result: TemporalResult) {
+    assert_eq!(result.error_type, 0, "benchmark input failed");
+    unsafe { temporal_free_result(&mut result) };
+}
+
+fn consume_compare(mut result: CompareResult) {
+    assert_eq!(result.error_type, 0, "benchmark input failed");
+    black_box(result.value);
+    unsafe { temporal_free_compare_result(&mut result) };
+}
+
+type Case = (&'static str, Box<dyn FnMut()>);
+
+fn cases() -> Vec<Case> {
+    let instant_a = c("2024-01-15T10:30:45.123456789Z");
+    let instant_b = c("2024-07-04T18:00:00Z");
+    let pdt = c("2024-01-15T10:30:45.123");
+    let pdt_b = c("2024-03-10T02:30:00");
+    let duration = c("P1M2DT3H4M");
+    let zdt = c("2024-03-10T01:30:00-05:00[America/New_York]");
+    let zdt_b = c("2024-11-03T01:30:00-04:00[America/New_York]");
+    let time_zone = c("America/New_York");
+    let time_a = c("08:15:30.5");
+    let time_b = c("17:45:00");
+    let hour = c("hour");
+    let minute = c("minute");
+    let half_expand = c("halfExpand");
+    let epoch_a = TemporalEpochNanoseconds { seconds: 1_705_314_645, nanoseconds: 123_456_789 };
+    let epoch_b = TemporalEpochNanoseconds { seconds: 1_720_116_000, nanoseconds: 0 };
+
+    // The CStrings are moved into the closures so their pointers stay valid.
+    let ptr = |s: &CString| -> *const c_char { s.as_ptr() };
+    vec![
+        ("instant_from_string", {
+            let s = instant_a.clone();
+            Box::new(move || consume(temporal_instant_from_string(black_box(ptr(&s)))))
+        }),
+        ("plain_date_time_add", {
+            let (dt, d) = (pdt.clone(), duration.clone());
+            Box::new(move || consume(temporal_plain_date_time_add(ptr(&dt), ptr(&d))))
+        }),
+        ("zoned_date_time_get_components", {
+            let s = zdt.clone();
+            Box::new(move || {
+                let mut out = ZonedDateTimeComponents::default();
+                temporal_zoned_date_time_get_components(ptr(&s), &mut out);
+                assert_eq!(out.is_valid, 1, "benchmark input failed");
+                black_box(&out);
+            })
+        }),
+        ("time_zone_get_offset_nanoseconds_for", {
+            let (tz, i) = (time_zone.clone(), instant_a.clone());
+            Box::new(move || {
+                consume(temporal_time_zone_get_offset_nanoseconds_for(ptr(&tz), ptr(&i)))
+            })
+        }),
+        ("instant_compare", {
+            let (a, b) = (instant_a.clone(), instant_b.clone());
+            Box::new(move || consume_compare(temporal_instant_compare(ptr(&a), ptr(&b))))
+        }),
+        ("plain_date_time_compare", {
+            let (a, b) = (pdt.clone(), pdt_b.clone());
+            Box::new(move || {
+                consume_compare(temporal_plain_date_time_compare(ptr(&a), ptr(&b)))
+            })
+        }),
+        ("zoned_date_time_compare", {
+            let (a, b) = (zdt.clone(), zdt_b.clone());
+            Box::new(move || {
+                consume_compare(temporal_zoned_date_time_compare(ptr(&a), ptr(&b)))
+            })
+        }),
+        ("instant_until_rounded", {
+            let (a, b) = (instant_a.clone(), instant_b.clone());
+            let (largest, smallest, mode) = (hour.clone(), minute.clone(), half_expand.clone());
+            Box::new(move || {
+                consume(temporal_instant_until(
+                    ptr(&a),
+                    ptr(&b),
+                    ptr(&largest),
+                    ptr(&smallest),
+                    15,
+                    ptr(&mode),
+                ))
+            })
+        }),
+        ("instant_until_epoch_nanoseconds_rounded", {
+            let (largest, smallest, mode) = (hour.clone(), minute.clone(), half_expand.clone());
+            Box::new(move || {
+                consume(temporal_instant_until_epoch_nanoseconds(
+                    epoch_a,
+                    epoch_b,
+                    ptr(&largest),
+                    ptr(&smallest),
+                    15,
+                    ptr(&mode),
+                ))
+            })
+        }),
+        ("plain_time_until_rounded", {
+            let (a, b) = (time_a.clone(), time_b.clone());
+            let (largest, smallest, mode) = (hour, minute, half_expand);
+            Box::new(move || {
+                consume(temporal_plain_time_until(
+                    ptr(&a),
+                    ptr(&b),
+                    ptr(&largest),
+                    ptr(&smallest),
+                    15,
+                    ptr(&mode),
+                ))
+            })
+        }),
+        ("plain_time_until_default", {
+            Box::new(move || {
+                consume(temporal_plain_time_until(
+                    ptr(&time_a),
+                    ptr(&time_b),
+                    ptr::null(),
+                    ptr::null(),
+                    0,
+                    ptr::null(),
+                ))
+            })
+        }),
+    ]
+}
+
+fn baseline_path(name: &str) -> PathBuf {
+    PathBuf::from(env!("CARGO_MANIFEST_DIR"))
+        .join("benches")
+        .join("baselines")
+        .join(format!("{}.tsv", name))
+}
+
+/// Reads `name\tops_per_sec\tallocs_per_call\tbytes_per_call` rows; later
+/// columns are informational.
+fn load_baseline(name: &str) -> BTreeMap<String, (f64, f64)> {
+    let path = baseline_path(name);
+    let contents = fs::read_to_string(&path)
+        .unwrap_or_else(|e| panic!("cannot read baseline {}: {}", path.display(), e));
+    contents
+        .lines()
+        .filter(|line| !line.starts_with('#') && !line.is_empty())
+        .filter_map(|line| {
+            let fields: Vec<&str> = line.split('\t').collect();
+            let ops = fields.get(1)?.parse().ok()?;
+            let allocs = fields.get(2)?.parse().ok()?;
+            Some((fields[0].to_string(), (ops, allocs)))
+        })
+        .collect()
+}
+
+fn save_baseline(name: &str, rows: &[(&str, Measurement)]) {
+    let path = baseline_path(name);
+    fs::create_dir_all(path.parent().unwrap()).unwrap();
+    let mut contents =
+        String::from("# case\tops_per_sec\tallocs_per_call\tbytes_per_call\tfirst_call_us\n");
+    for (case, m) in rows {
+        contents.push_str(&format!(
+            "{}\t{:.0}\t{:.2}\t{:.1}\t{:.1}\n",
+            case,
+            m.ops_per_sec,
+            m.allocs_per_call,
+            m.bytes_per_call,
+            m.first_call.as_secs_f64() * 1e6
+        ));
+    }
+    fs::write(&path, contents).unwrap();
+    println!("\nSaved baseline to {}", path.display());
+}
+
+fn main() {
+    let mut save = None;
+    let mut compare = None;
+    let mut filter = None;
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        match arg.as_str() {
+            "--save-baseline" => save = args.next(),
+            "--baseline" => compare = args.next(),
+            // Passed by `cargo bench` itself
+            "--bench" => {}
+            other if !other.starts_with("--") => filter = Some(other.to_string()),
+            other => panic!("unknown argument: {}", other),
+        }
+    }
+    let baseline = compare.as_deref().map(load_baseline);
+
+    println!(
+        "{:<42} {:>12} {:>11} {:>11} {:>9} {:>9}",
+        "case", "ops/s", "allocs/call", "bytes/call", "first µs", "vs base"
+    );
+    let mut rows = Vec::new();
+    for (name, mut f) in cases() {
+        if filter.as_deref().is_some_and(|f| !name.contains(f)) {
+            continue;
+        }
+        let m = measure(&mut f);
+        let delta = match baseline.as_ref().and_then(|b| b.get(name)) {
+            Some((ops, allocs)) => format!(
+                "{:+.1}%{}",
+                (m.ops_per_sec / ops - 1.0) * 100.0,
+                if m.allocs_per_call > allocs + 0.01 { " +alloc" } else { "" }
+            ),
+            None => String::from("-"),
+        };
+        println!(
+            "{:<42} {:>12.0} {:>11.2} {:>11.1} {:>9.1} {:>9}",
+            name,
+            m.ops_per_sec,
+            m.allocs_per_call,
+            m.bytes_per_call,
+            m.first_call.as_secs_f64() * 1e6,
+            delta
+        );
+        rows.push((name, m));
+    }
+
+    if let Some(name) = save {
+        save_baseline(&name, &rows);
+    }
+}
@@ -0,0 +1,73 @@
+//! Parse throughput of `temporal_instant_from_string`.
+//!
+//! Compares the previous path (the general IXDTF parser followed by
+//! formatting) against the FFI entry point, which tries the fixed-width fast
+//! path first. Run with `cargo bench --bench instant_parse`.
+
+use std::ffi::CString;
+use std::hint::black_box;
+use std::str::FromStr;
+use std::time::{Duration, Instant as Clock};
+
+use temporal_rn::{temporal_free_result, temporal_instant_from_string};
+use temporal_rs::{provider::COMPILED_TZ_PROVIDER, Instant};
+
+const ITERATIONS: usize = 200_000;
+
+const INPUTS: &[(&str, &str)] = &[
+    ("seconds", "2024-01-15T10:30:45Z"),
+    ("millis", "2024-01-15T10:30:45.123Z"),
+    ("nanos", "2024-01-15T10:30:45.123456789Z"),
+    // Not a canonical shape: measures the fallback overhead
+    ("offset", "2024-01-15T10:30:45.123+01:00"),
+];
+
+fn measure(mut f: impl FnMut()) -> Duration {
+    // Warm up caches and the provider before timing
+    for _ in 0..ITERATIONS / 10 {
+        f();
+    }
+    let start = Clock::now();
+    for _ in 0..ITERATIONS {
+        f();
+    }
+    start.elapsed()
+}
+
+fn throughput(elapsed: Duration) -> f64 {
+    ITERATIONS as f64 / elapsed.as_secs_f64() / 1e6
+}
+
+fn main() {
+    let provider = &*COMPILED_TZ_PROVIDER;
+    println!(
+        "{:<8} {:>14} {:>14} {:>8}",
+        "input", "before Mops/s", "after Mops/s", "speedup"
+    );
+
+    for (name, input) in INPUTS {
+        let before = measure(|| {
+            let instant = Instant::from_str(black_box(input)).unwrap();
+            black_box(
+                instant
+                    .to_ixdtf_string_with_provider(None, Default::default(), provider)
+                    .unwrap(),
+            );
+        });
+
+        let c_input = CString::new(*input).unwrap();
+        let after = measure(|| {
+            let mut result = temporal_instant_from_string(black_box(c_input.as_ptr()));
+            assert_eq!(result.error_type, 0);
+            unsafe { temporal_free_result(&mut result) };
+        });
+
+        println!(
+            "{:<8} {:>14.2} {:>14.2} {:>7.2}x",
+            name,
+            throughput(before),
+            throughput(after),
+            before.as_secs_f64() / after.as_secs_f64()
+        );
+    }
+}
@@ -1,15 +1,38 @@
+use std::any::Any;
+use std::cell::{Cell, RefCell};
+use std::collections::{HashMap, HashSet};
 use std::ffi::{c_char, CString};
+use std::hash::{BuildHasherDefault, Hasher};
+use std::ops::Deref;
+use std::panic::{catch_unwind, AssertUnwindSafe};
 use std::ptr;
 use std::str::FromStr;
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, Condvar, Mutex, MutexGuard, OnceLock, PoisonError, RwLock, TryLockError};
+use std::thread::LocalKey;
+use std::time::Instant as MonotonicInstant;
 
+use temporal_rs::parsers::Precision;
 use temporal_rs::sys::Temporal;
 use temporal_rs::{
     options::{DisplayCalendar, ToStringRoundingOptions, DisplayOffset, DisplayTimeZone, Disambiguation, OffsetDisambiguation, Overflow, RoundingOptions, RoundingMode, Unit, RoundingIncrement},
-    provider::COMPILED_TZ_PROVIDER,
+    provider::{TimeZoneProvider, TransitionDirection, COMPILED_TZ_PROVIDER},
     Calendar, Duration, Instant, PlainDate, PlainDateTime, PlainMonthDay, PlainTime,
     PlainYearMonth, TimeZone, ZonedDateTime, TemporalError,
 };
 
+/// Counts calls and time spent in the enclosing `extern "C"` function when
+/// the `stats` feature is enabled; expands to nothing otherwise.
+macro_rules! stats_scope {
+    ($name:literal) => {
+        #[cfg(feature = "stats")]
+        let _stats_scope = {
+            static SITE: $crate::stats::Site = $crate::stats::Site::new($name);
+            $crate::stats::Scope::enter(&SITE)
+        };
+    };
+}
+
 // ============================================================================
 // Error Types (matching TC39 Temporal)
 // ============================================================================
@@ -39,6 +62,7 @@ pub struct TemporalResult {
 
 impl TemporalResult {
     fn success(value: String) -> Self {
+        stats::record_format();
         match CString::new(value) {
             Ok(c_str) => Self {
                 value: c_str.into_raw(),
@@ -53,6 +77,7 @@ impl TemporalResult {
         let error_msg = CString::new(message)
             .map(|s| s.into_raw())
             .unwrap_or(ptr::null_mut());
+        stats::record_error();
         Self {
             value: ptr::null_mut(),
             error_type: TemporalErrorType::RangeError as i32,
@@ -64,6 +89,7 @@ impl TemporalResult {
         let error_msg = CString::new(message)
             .map(|s| s.into_raw())
             .unwrap_or(ptr::null_mut());
+        stats::record_error();
         Self {
             value: ptr::null_mut(),
             error_type: TemporalErrorType::TypeError as i32,
@@ -98,6 +124,7 @@ pub unsafe extern "C" fn temporal_free_result(result: *mut TemporalResult) {
 /// Returns NULL on error.
 #[no_mangle]
 pub extern "C" fn temporal_instant_now() -> *mut c_char {
+    stats_scope!("temporal_instant_now");
     match get_instant_now_string() {
         Ok(s) => match CString::new(s) {
             Ok(c_str) => c_str.into_raw(),
@@ -133,18 +160,13 @@ fn get_instant_now_string() -> Result<String, Box<dyn std::error::Error>> {
 /// Parses an ISO 8601 string into an Instant and returns the normalized string.
 #[no_mangle]
 pub extern "C" fn temporal_instant_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_instant_from_string");
     let s_str = match parse_c_str(s, "instant string") {
         Ok(s) => s,
         Err(e) => return e,
     };
-    match Instant::from_str(s_str) {
-        Ok(instant) => {
-            let provider = &*COMPILED_TZ_PROVIDER;
-            match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                Ok(s) => TemporalResult::success(s),
-                Err(e) => TemporalResult::range_error(&format!("Failed to format instant: {}", e)),
-            }
-        },
+    match instant_from_str(s_str) {
+        Ok(instant) => format_instant(&instant),
         Err(e) => TemporalResult::range_error(&format!("Invalid instant '{}': {}", s_str, e)),
     }
 }
@@ -152,17 +174,12 @@ pub extern "C" fn temporal_instant_from_string(s: *const c_char) -> TemporalResu
 /// Creates an Instant from epoch milliseconds.
 #[no_mangle]
 pub extern "C" fn temporal_instant_from_epoch_milliseconds(ms: i64) -> TemporalResult {
+    stats_scope!("temporal_instant_from_epoch_milliseconds");
     // Instant::from_epoch_milliseconds is the likely API, or we construct via ns
     // Using i128 arithmetic to be safe: ms * 1,000,000
     let ns = (ms as i128).saturating_mul(1_000_000);
     match Instant::try_new(ns) {
-        Ok(instant) => {
-            let provider = &*COMPILED_TZ_PROVIDER;
-            match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                Ok(s) => TemporalResult::success(s),
-                Err(e) => TemporalResult::range_error(&format!("Failed to format instant: {}", e)),
-            }
-        },
+        Ok(instant) => format_instant(&instant),
         Err(e) => TemporalResult::range_error(&format!("Invalid epoch milliseconds: {}", e)),
     }
 }
@@ -170,6 +187,7 @@ pub extern "C" fn temporal_instant_from_epoch_milliseconds(ms: i64) -> TemporalR
 /// Creates an Instant from epoch nanoseconds (string input for i128 precision).
 #[no_mangle]
 pub extern "C" fn temporal_instant_from_epoch_nanoseconds(ns_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_instant_from_epoch_nanoseconds");
     let s_str = match parse_c_str(ns_str, "nanoseconds string") {
         Ok(s) => s,
         Err(e) => return e,
@@ -195,6 +213,7 @@ pub extern "C" fn temporal_instant_from_epoch_nanoseconds(ns_str: *const c_char)
 /// Returns the epoch milliseconds of an Instant.
 #[no_mangle]
 pub extern "C" fn temporal_instant_epoch_milliseconds(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_instant_epoch_milliseconds");
     let instant = match parse_instant(s, "instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -213,6 +232,7 @@ pub extern "C" fn temporal_instant_epoch_milliseconds(s: *const c_char) -> Tempo
 /// Returns the epoch nanoseconds of an Instant (as string).
 #[no_mangle]
 pub extern "C" fn temporal_instant_epoch_nanoseconds(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_instant_epoch_nanoseconds");
     let instant = match parse_instant(s, "instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -224,6 +244,7 @@ pub extern "C" fn temporal_instant_epoch_nanoseconds(s: *const c_char) -> Tempor
 /// Adds a duration to an instant.
 #[no_mangle]
 pub extern "C" fn temporal_instant_add(instant_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_instant_add");
     let instant = match parse_instant(instant_str, "instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -234,13 +255,7 @@ pub extern "C" fn temporal_instant_add(instant_str: *const c_char, duration_str:
     };
     
     match instant.add(&duration) {
-        Ok(result) => {
-            let provider = &*COMPILED_TZ_PROVIDER;
-            match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                Ok(s) => TemporalResult::success(s),
-                Err(e) => TemporalResult::range_error(&format!("Failed to format instant: {}", e)),
-            }
-        },
+        Ok(result) => format_instant(&result),
         Err(e) => TemporalResult::range_error(&format!("Failed to add duration: {}", e)),
     }
 }
@@ -248,6 +263,7 @@ pub extern "C" fn temporal_instant_add(instant_str: *const c_char, duration_str:
 /// Subtracts a duration from an instant.
 #[no_mangle]
 pub extern "C" fn temporal_instant_subtract(instant_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_instant_subtract");
     let instant = match parse_instant(instant_str, "instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -258,13 +274,7 @@ pub extern "C" fn temporal_instant_subtract(instant_str: *const c_char, duration
     };
     
     match instant.subtract(&duration) {
-        Ok(result) => {
-            let provider = &*COMPILED_TZ_PROVIDER;
-            match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                Ok(s) => TemporalResult::success(s),
-                Err(e) => TemporalResult::range_error(&format!("Failed to format instant: {}", e)),
-            }
-        },
+        Ok(result) => format_instant(&result),
         Err(e) => TemporalResult::range_error(&format!("Failed to subtract duration: {}", e)),
     }
 }
@@ -272,6 +282,7 @@ pub extern "C" fn temporal_instant_subtract(instant_str: *const c_char, duration
 /// Compares two instants.
 #[no_mangle]
 pub extern "C" fn temporal_instant_compare(a: *const c_char, b: *const c_char) -> CompareResult {
+    stats_scope!("temporal_instant_compare");
     let instant_a = match parse_instant(a, "first instant") {
         Ok(i) => i,
         Err(e) => return CompareResult::range_error(
@@ -298,6 +309,7 @@ pub extern "C" fn temporal_instant_until(
     rounding_increment: i64,
     rounding_mode: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_instant_until");
     let one = match parse_instant(one_str, "first instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -379,6 +391,7 @@ pub extern "C" fn temporal_instant_since(
     rounding_increment: i64,
     rounding_mode: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_instant_since");
     let one = match parse_instant(one_str, "first instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -458,6 +471,7 @@ pub extern "C" fn temporal_instant_round(
     rounding_increment: i64,
     rounding_mode: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_instant_round");
     let instant = match parse_instant(instant_str, "instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -524,6 +538,7 @@ pub extern "C" fn temporal_instant_to_zoned_date_time(
     calendar_id: *const c_char,
     time_zone_id: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_instant_to_zoned_date_time");
     let instant = match parse_instant(instant_str, "instant") {
         Ok(i) => i,
         Err(e) => return e,
@@ -550,7 +565,7 @@ pub extern "C" fn temporal_instant_to_zoned_date_time(
         return TemporalResult::type_error("Timezone ID is required");
     };
 
-    let tz = match TimeZone::try_from_str(tz_str) {
+    let tz = match resolve_time_zone(tz_str) {
         Ok(t) => t,
         Err(e) => return TemporalResult::range_error(&format!("Invalid timezone: {}", e)),
     };
@@ -564,12 +579,179 @@ pub extern "C" fn temporal_instant_to_zoned_date_time(
     }
 }
 
+// ============================================================================
+// Instant API (epoch nanoseconds)
+// ============================================================================
+
+// Instants cross the FFI boundary as `TemporalEpochNanoseconds` instead of ISO
+// strings, so callers can keep them numeric and do comparison and time
+// arithmetic themselves. Functions producing an instant write it to `out` and
+// return a `TemporalErrorType`, with the message available from
+// `temporal_last_error_message` like the `_into` variants.
+
+impl TemporalEpochNanoseconds {
+    fn from_instant(instant: &Instant) -> Self {
+        Self::from_i128(instant.epoch_nanoseconds().0)
+    }
+
+    fn to_instant(self) -> Result<Instant, TemporalResult> {
+        if !(0..1_000_000_000).contains(&self.nanoseconds) {
+            return Err(TemporalResult::range_error("Epoch nanoseconds remainder must be in [0, 1e9)"));
+        }
+        let ns = self.seconds as i128 * 1_000_000_000 + self.nanoseconds as i128;
+        Instant::try_new(ns).map_err(|e| TemporalResult::range_error(&format!("Invalid epoch nanoseconds: {}", e)))
+    }
+}
+
+/// Writes an instant to `out`, or records the error. Returns the `TemporalErrorType`.
+fn write_epoch_nanoseconds(value: Result<Instant, TemporalResult>, out: *mut TemporalEpochNanoseconds) -> i32 {
+    match value {
+        Ok(instant) => {
+            if !out.is_null() {
+                unsafe { *out = TemporalEpochNanoseconds::from_instant(&instant) };
+            }
+            TemporalErrorType::None as i32
+        }
+        Err(e) => record_error(e),
+    }
+}
+
+fn parse_difference_settings(
+    largest_unit: *const c_char,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+) -> Result<temporal_rs::options::DifferenceSettings, TemporalResult> {
+    let parse_unit = |unit: *const c_char, name: &str| -> Result<Option<Unit>, TemporalResult> {
+        if unit.is_null() {
+            return Ok(None);
+        }
+        let s = parse_c_str(unit, name)?;
+        Unit::from_str(s)
+            .map(Some)
+            .map_err(|_| TemporalResult::range_error(&format!("Invalid {}: {}", name, s)))
+    };
+
+    let mut options = temporal_rs::options::DifferenceSettings::default();
+    options.largest_unit = parse_unit(largest_unit, "largest unit")?;
+    options.smallest_unit = parse_unit(smallest_unit, "smallest unit")?;
+    if !rounding_mode.is_null() {
+        let s = parse_c_str(rounding_mode, "rounding mode")?;
+        options.rounding_mode = Some(
+            RoundingMode::from_str(s).map_err(|_| TemporalResult::range_error(&format!("Invalid rounding mode: {}", s)))?,
+        );
+    }
+    let increment = if rounding_increment > 0 { rounding_increment as u32 } else { 1 };
+    options.increment = Some(
+        RoundingIncrement::try_new(increment)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid rounding increment: {}", e)))?,
+    );
+    Ok(options)
+}
+
+/// Parses an ISO 8601 instant string into epoch nanoseconds.
+#[no_mangle]
+pub extern "C" fn temporal_instant_parse_epoch_nanoseconds(
+    s: *const c_char,
+    out: *mut TemporalEpochNanoseconds,
+) -> i32 {
+    stats_scope!("temporal_instant_parse_epoch_nanoseconds");
+    write_epoch_nanoseconds(parse_instant(s, "instant string"), out)
+}
+
+/// Writes the current instant's epoch nanoseconds to `out`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_now_epoch_nanoseconds(out: *mut TemporalEpochNanoseconds) -> i32 {
+    stats_scope!("temporal_instant_now_epoch_nanoseconds");
+    let now = Temporal::utc_now()
+        .instant()
+        .map_err(|e| TemporalResult::range_error(&format!("Failed to get current instant: {}", e)));
+    write_epoch_nanoseconds(now, out)
+}
+
+/// Formats epoch nanoseconds as an ISO 8601 instant string into `buf`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_format_epoch_nanoseconds_into(
+    epoch_ns: TemporalEpochNanoseconds,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_instant_format_epoch_nanoseconds_into");
+    write_into(epoch_ns.to_instant().and_then(|i| instant_formatted(&i)), buf, cap, len)
+}
+
+/// Rounds epoch nanoseconds to the given smallest unit.
+#[no_mangle]
+pub extern "C" fn temporal_instant_round_epoch_nanoseconds(
+    epoch_ns: TemporalEpochNanoseconds,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+    out: *mut TemporalEpochNanoseconds,
+) -> i32 {
+    stats_scope!("temporal_instant_round_epoch_nanoseconds");
+    let result = epoch_ns.to_instant().and_then(|instant| {
+        let options = parse_rounding_options(smallest_unit, rounding_increment, rounding_mode)?;
+        instant.round(options).map_err(|e| TemporalResult::range_error(&format!("Failed to round: {}", e)))
+    });
+    write_epoch_nanoseconds(result, out)
+}
+
+fn instant_difference_epoch_nanoseconds(
+    one: TemporalEpochNanoseconds,
+    two: TemporalEpochNanoseconds,
+    since: bool,
+    largest_unit: *const c_char,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+) -> TemporalResult {
+    let result = (|| {
+        let one = one.to_instant()?;
+        let two = two.to_instant()?;
+        let options = parse_difference_settings(largest_unit, smallest_unit, rounding_increment, rounding_mode)?;
+        let duration = if since { one.since(&two, options) } else { one.until(&two, options) };
+        duration.map_err(|e| TemporalResult::range_error(&format!("Failed to compute difference: {}", e)))
+    })();
+    result.map_or_else(|e| e, |d| TemporalResult::success(d.to_string()))
+}
+
+/// Computes the duration from `one` until `two`, given as epoch nanoseconds.
+#[no_mangle]
+pub extern "C" fn temporal_instant_until_epoch_nanoseconds(
+    one: TemporalEpochNanoseconds,
+    two: TemporalEpochNanoseconds,
+    largest_unit: *const c_char,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_instant_until_epoch_nanoseconds");
+    instant_difference_epoch_nanoseconds(one, two, false, largest_unit, smallest_unit, rounding_increment, rounding_mode)
+}
+
+/// Computes the duration from `two` to `one` (`one.since(two)`), given as epoch nanoseconds.
+#[no_mangle]
+pub extern "C" fn temporal_instant_since_epoch_nanoseconds(
+    one: TemporalEpochNanoseconds,
+    two: TemporalEpochNanoseconds,
+    largest_unit: *const c_char,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_instant_since_epoch_nanoseconds");
+    instant_difference_epoch_nanoseconds(one, two, true, largest_unit, smallest_unit, rounding_increment, rounding_mode)
+}
+
 // ============================================================================
 // Now API
 // ============================================================================
 
 #[no_mangle]
 pub extern "C" fn temporal_now_plain_date_time_iso(tz_id: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_now_plain_date_time_iso");
     let tz_str = match parse_c_str(tz_id, "timezone id") {
         Ok(s) => s,
         Err(e) => return e,
@@ -583,6 +765,7 @@ pub extern "C" fn temporal_now_plain_date_time_iso(tz_id: *const c_char) -> Temp
 
 #[no_mangle]
 pub extern "C" fn temporal_now_plain_date_iso(tz_id: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_now_plain_date_iso");
     let tz_str = match parse_c_str(tz_id, "timezone id") {
         Ok(s) => s,
         Err(e) => return e,
@@ -596,6 +779,7 @@ pub extern "C" fn temporal_now_plain_date_iso(tz_id: *const c_char) -> TemporalR
 
 #[no_mangle]
 pub extern "C" fn temporal_now_plain_time_iso(tz_id: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_now_plain_time_iso");
     let tz_str = match parse_c_str(tz_id, "timezone id") {
         Ok(s) => s,
         Err(e) => return e,
@@ -609,6 +793,7 @@ pub extern "C" fn temporal_now_plain_time_iso(tz_id: *const c_char) -> TemporalR
 
 #[no_mangle]
 pub extern "C" fn temporal_now_zoned_date_time_iso(tz_id: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_now_zoned_date_time_iso");
     let tz_str = match parse_c_str(tz_id, "timezone id") {
         Ok(s) => s,
         Err(e) => return e,
@@ -623,7 +808,7 @@ pub extern "C" fn temporal_now_zoned_date_time_iso(tz_id: *const c_char) -> Temp
 fn get_now_zoned_date_time_string(tz_id: &str) -> Result<String, Box<dyn std::error::Error>> {
     let now = Temporal::utc_now();
     let instant = now.instant()?;
-    let time_zone = TimeZone::try_from_str(tz_id)?;
+    let time_zone = resolve_time_zone(tz_id)?;
     let zdt = instant.to_zoned_date_time_iso(time_zone)?;
     Ok(zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default())?)
 }
@@ -631,7 +816,7 @@ fn get_now_zoned_date_time_string(tz_id: &str) -> Result<String, Box<dyn std::er
 fn get_now_plain_date_time_string(tz_id: &str) -> Result<String, Box<dyn std::error::Error>> {
     let now = Temporal::utc_now();
     let instant = now.instant()?;
-    let time_zone = TimeZone::try_from_str(tz_id)?;
+    let time_zone = resolve_time_zone(tz_id)?;
     let zdt = instant.to_zoned_date_time_iso(time_zone)?;
     Ok(zdt
         .to_plain_date_time()
@@ -641,7 +826,7 @@ fn get_now_plain_date_time_string(tz_id: &str) -> Result<String, Box<dyn std::er
 fn get_now_plain_date_string(tz_id: &str) -> Result<String, Box<dyn std::error::Error>> {
     let now = Temporal::utc_now();
     let instant = now.instant()?;
-    let time_zone = TimeZone::try_from_str(tz_id)?;
+    let time_zone = resolve_time_zone(tz_id)?;
     let zdt = instant.to_zoned_date_time_iso(time_zone)?;
     Ok(zdt.to_plain_date().to_ixdtf_string(DisplayCalendar::Auto))
 }
@@ -649,7 +834,7 @@ fn get_now_plain_date_string(tz_id: &str) -> Result<String, Box<dyn std::error::
 fn get_now_plain_time_string(tz_id: &str) -> Result<String, Box<dyn std::error::Error>> {
     let now = Temporal::utc_now();
     let instant = now.instant()?;
-    let time_zone = TimeZone::try_from_str(tz_id)?;
+    let time_zone = resolve_time_zone(tz_id)?;
     let zdt = instant.to_zoned_date_time_iso(time_zone)?;
     Ok(zdt
         .to_plain_time()
@@ -690,6 +875,7 @@ impl Default for PlainTimeComponents {
 /// Parses an ISO 8601 string into a PlainTime and returns the normalized string.
 #[no_mangle]
 pub extern "C" fn temporal_plain_time_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_time_from_string");
     let s_str = match parse_c_str(s, "plain time string") {
         Ok(s) => s,
         Err(e) => return e,
@@ -715,6 +901,7 @@ pub extern "C" fn temporal_plain_time_from_components(
     microsecond: u16,
     nanosecond: u16,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_time_from_components");
     // Validate ranges
     if hour > 23 {
         return TemporalResult::range_error(&format!("Invalid hour: {} (must be 0-23)", hour));
@@ -750,6 +937,7 @@ pub extern "C" fn temporal_plain_time_get_components(
     s: *const c_char,
     out: *mut PlainTimeComponents,
 ) {
+    stats_scope!("temporal_plain_time_get_components");
     if out.is_null() {
         return;
     }
@@ -765,20 +953,37 @@ pub extern "C" fn temporal_plain_time_get_components(
         Err(_) => return,
     };
 
-    unsafe {
-        (*out).hour = time.hour();
-        (*out).minute = time.minute();
-        (*out).second = time.second();
-        (*out).millisecond = time.millisecond();
-        (*out).microsecond = time.microsecond();
-        (*out).nanosecond = time.nanosecond();
-        (*out).is_valid = 1;
+    unsafe { fill_plain_time_components(&time, &mut *out) };
+}
+
+/// Parses a PlainTime string, returning the normalized string and filling
+/// `out` (if not NULL) in the same call.
+#[no_mangle]
+pub extern "C" fn temporal_plain_time_from_string_with_components(
+    s: *const c_char,
+    out: *mut PlainTimeComponents,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_time_from_string_with_components");
+    if !out.is_null() {
+        unsafe { *out = PlainTimeComponents::default() };
+    }
+    let time = match parse_plain_time(s, "plain time string") {
+        Ok(t) => t,
+        Err(e) => return e,
+    };
+    if !out.is_null() {
+        unsafe { fill_plain_time_components(&time, &mut *out) };
+    }
+    match time.to_ixdtf_string(ToStringRoundingOptions::default()) {
+        Ok(s) => TemporalResult::success(s),
+        Err(e) => TemporalResult::range_error(&format!("Failed to format plain time: {}", e)),
     }
 }
 
 /// Adds a duration to a PlainTime.
 #[no_mangle]
 pub extern "C" fn temporal_plain_time_add(time_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_time_add");
     let time = match parse_plain_time(time_str, "plain time") {
         Ok(t) => t,
         Err(e) => return e,
@@ -800,6 +1005,7 @@ pub extern "C" fn temporal_plain_time_add(time_str: *const c_char, duration_str:
 /// Subtracts a duration from a PlainTime.
 #[no_mangle]
 pub extern "C" fn temporal_plain_time_subtract(time_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_time_subtract");
     let time = match parse_plain_time(time_str, "plain time") {
         Ok(t) => t,
         Err(e) => return e,
@@ -821,6 +1027,7 @@ pub extern "C" fn temporal_plain_time_subtract(time_str: *const c_char, duration
 /// Compares two PlainTime objects.
 #[no_mangle]
 pub extern "C" fn temporal_plain_time_compare(a: *const c_char, b: *const c_char) -> CompareResult {
+    stats_scope!("temporal_plain_time_compare");
     let time_a = match parse_plain_time(a, "first plain time") {
         Ok(t) => t,
         Err(e) => return CompareResult::range_error(
@@ -847,6 +1054,7 @@ pub extern "C" fn temporal_plain_time_until(
     rounding_increment: i64,
     rounding_mode: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_time_until");
     let one = match parse_plain_time(one_str, "first plain time") {
         Ok(t) => t,
         Err(e) => return e,
@@ -928,6 +1136,7 @@ pub extern "C" fn temporal_plain_time_since(
     rounding_increment: i64,
     rounding_mode: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_time_since");
     let one = match parse_plain_time(one_str, "first plain time") {
         Ok(t) => t,
         Err(e) => return e,
@@ -1007,6 +1216,7 @@ pub extern "C" fn temporal_plain_time_round(
     rounding_increment: i64,
     rounding_mode: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_time_round");
     let time = match parse_plain_time(time_str, "plain time") {
         Ok(t) => t,
         Err(e) => return e,
@@ -1108,11 +1318,12 @@ impl Default for PlainDateComponents {
 /// Parses an ISO 8601 string into a PlainDate and returns the normalized string.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_from_string");
     let s_str = match parse_c_str(s, "plain date string") {
         Ok(s) => s,
         Err(e) => return e,
     };
-    match PlainDate::from_str(s_str) {
+    match plain_date_from_str(s_str) {
         Ok(date) => TemporalResult::success(date.to_ixdtf_string(DisplayCalendar::Auto)),
         Err(e) => TemporalResult::range_error(&format!("Invalid plain date '{}': {}", s_str, e)),
     }
@@ -1126,6 +1337,7 @@ pub extern "C" fn temporal_plain_date_from_components(
     day: u8,
     calendar_id: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_from_components");
     let calendar = if !calendar_id.is_null() {
         match parse_c_str(calendar_id, "calendar id") {
             Ok(s) => match Calendar::from_str(s) {
@@ -1150,6 +1362,7 @@ pub extern "C" fn temporal_plain_date_get_components(
     s: *const c_char,
     out: *mut PlainDateComponents,
 ) {
+    stats_scope!("temporal_plain_date_get_components");
     if out.is_null() {
         return;
     }
@@ -1165,26 +1378,34 @@ pub extern "C" fn temporal_plain_date_get_components(
         Err(_) => return,
     };
 
-    unsafe {
-        (*out).year = date.year();
-        (*out).month = date.month();
-        (*out).day = date.day();
-        (*out).day_of_week = date.day_of_week();
-        (*out).day_of_year = date.day_of_year();
-        (*out).week_of_year = date.week_of_year().unwrap_or(0) as u16;
-        (*out).year_of_week = date.year_of_week().unwrap_or(0);
-        (*out).days_in_week = date.days_in_week();
-        (*out).days_in_month = date.days_in_month();
-        (*out).days_in_year = date.days_in_year();
-        (*out).months_in_year = date.months_in_year();
-        (*out).in_leap_year = if date.in_leap_year() { 1 } else { 0 };
-        (*out).is_valid = 1;
+    unsafe { fill_plain_date_components(&date, &mut *out) };
+}
+
+/// Parses a PlainDate string, returning the normalized string and filling
+/// `out` (if not NULL) in the same call.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_from_string_with_components(
+    s: *const c_char,
+    out: *mut PlainDateComponents,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_date_from_string_with_components");
+    if !out.is_null() {
+        unsafe { *out = PlainDateComponents::default() };
+    }
+    let date = match parse_plain_date(s, "plain date string") {
+        Ok(d) => d,
+        Err(e) => return e,
+    };
+    if !out.is_null() {
+        unsafe { fill_plain_date_components(&date, &mut *out) };
     }
+    TemporalResult::success(date.to_ixdtf_string(DisplayCalendar::Auto))
 }
 
 /// Gets the month code of a PlainDate.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_get_month_code(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_get_month_code");
     let date = match parse_plain_date(s, "plain date") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1195,6 +1416,7 @@ pub extern "C" fn temporal_plain_date_get_month_code(s: *const c_char) -> Tempor
 /// Gets the calendar ID of a PlainDate.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_get_calendar(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_get_calendar");
     let date = match parse_plain_date(s, "plain date") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1205,6 +1427,7 @@ pub extern "C" fn temporal_plain_date_get_calendar(s: *const c_char) -> Temporal
 /// Adds a duration to a PlainDate.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_add(date_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_add");
     let date = match parse_plain_date(date_str, "plain date") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1223,6 +1446,7 @@ pub extern "C" fn temporal_plain_date_add(date_str: *const c_char, duration_str:
 /// Subtracts a duration from a PlainDate.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_subtract(date_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_subtract");
     let date = match parse_plain_date(date_str, "plain date") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1241,6 +1465,7 @@ pub extern "C" fn temporal_plain_date_subtract(date_str: *const c_char, duration
 /// Compares two PlainDates.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_compare(a: *const c_char, b: *const c_char) -> CompareResult {
+    stats_scope!("temporal_plain_date_compare");
     let date_a = match parse_plain_date(a, "first plain date") {
         Ok(d) => d,
         Err(e) => return CompareResult::range_error(
@@ -1277,6 +1502,7 @@ pub extern "C" fn temporal_plain_date_with(
     day: i32,
     calendar_id: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_with");
     let date = match parse_plain_date(date_str, "plain date") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1310,6 +1536,7 @@ pub extern "C" fn temporal_plain_date_until(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_until");
     let one = match parse_plain_date(one_str, "first plain date") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1331,6 +1558,7 @@ pub extern "C" fn temporal_plain_date_since(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_since");
     let one = match parse_plain_date(one_str, "first plain date") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1349,7 +1577,8 @@ pub extern "C" fn temporal_plain_date_since(
 // Helper functions for PlainDate
 fn parse_plain_date(s: *const c_char, param_name: &str) -> Result<PlainDate, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
-    PlainDate::from_str(str_val)
+    stats::record_parse();
+    plain_date_from_str(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid plain date '{}': {}", str_val, e)))
 }
 
@@ -1410,6 +1639,7 @@ impl Default for PlainDateTimeComponents {
 /// Parses an ISO 8601 string into a PlainDateTime and returns the normalized string.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_time_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_from_string");
     let s_str = match parse_c_str(s, "plain date time string") {
         Ok(s) => s,
         Err(e) => return e,
@@ -1437,6 +1667,7 @@ pub extern "C" fn temporal_plain_date_time_from_components(
     nanosecond: u16,
     calendar_id: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_from_components");
     let calendar = if !calendar_id.is_null() {
         match parse_c_str(calendar_id, "calendar id") {
             Ok(s) => match Calendar::from_str(s) {
@@ -1464,6 +1695,7 @@ pub extern "C" fn temporal_plain_date_time_get_components(
     s: *const c_char,
     out: *mut PlainDateTimeComponents,
 ) {
+    stats_scope!("temporal_plain_date_time_get_components");
     if out.is_null() {
         return;
     }
@@ -1479,34 +1711,34 @@ pub extern "C" fn temporal_plain_date_time_get_components(
         Err(_) => return,
     };
 
-    unsafe {
-        (*out).year = dt.year();
-        (*out).month = dt.month();
-        (*out).day = dt.day();
-        (*out).day_of_week = dt.day_of_week();
-        (*out).day_of_year = dt.day_of_year();
-        (*out).week_of_year = dt.week_of_year().unwrap_or(0) as u16;
-        (*out).year_of_week = dt.year_of_week().unwrap_or(0);
-        (*out).days_in_week = dt.days_in_week();
-        (*out).days_in_month = dt.days_in_month();
-        (*out).days_in_year = dt.days_in_year();
-        (*out).months_in_year = dt.months_in_year();
-        (*out).in_leap_year = if dt.in_leap_year() { 1 } else { 0 };
-
-        (*out).hour = dt.hour();
-        (*out).minute = dt.minute();
-        (*out).second = dt.second();
-        (*out).millisecond = dt.millisecond();
-        (*out).microsecond = dt.microsecond();
-        (*out).nanosecond = dt.nanosecond();
-        
-        (*out).is_valid = 1;
+    unsafe { fill_plain_date_time_components(&dt, &mut *out) };
+}
+
+/// Parses a PlainDateTime string, returning the normalized string and filling
+/// `out` (if not NULL) in the same call.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_from_string_with_components(
+    s: *const c_char,
+    out: *mut PlainDateTimeComponents,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_from_string_with_components");
+    if !out.is_null() {
+        unsafe { *out = PlainDateTimeComponents::default() };
+    }
+    let dt = match parse_plain_date_time(s, "plain date time string") {
+        Ok(d) => d,
+        Err(e) => return e,
+    };
+    if !out.is_null() {
+        unsafe { fill_plain_date_time_components(&dt, &mut *out) };
     }
+    format_plain_date_time(&dt)
 }
 
 /// Gets the month code of a PlainDateTime.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_time_get_month_code(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_get_month_code");
     let dt = match parse_plain_date_time(s, "plain date time") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1517,6 +1749,7 @@ pub extern "C" fn temporal_plain_date_time_get_month_code(s: *const c_char) -> T
 /// Gets the calendar ID of a PlainDateTime.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_time_get_calendar(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_get_calendar");
     let dt = match parse_plain_date_time(s, "plain date time") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1527,6 +1760,7 @@ pub extern "C" fn temporal_plain_date_time_get_calendar(s: *const c_char) -> Tem
 /// Adds a duration to a PlainDateTime.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_time_add(dt_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_add");
     let dt: PlainDateTime = match parse_plain_date_time(dt_str, "plain date time") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1548,6 +1782,7 @@ pub extern "C" fn temporal_plain_date_time_add(dt_str: *const c_char, duration_s
 /// Subtracts a duration from a PlainDateTime.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_time_subtract(dt_str: *const c_char, duration_str: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_subtract");
     let dt: PlainDateTime = match parse_plain_date_time(dt_str, "plain date time") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1569,6 +1804,7 @@ pub extern "C" fn temporal_plain_date_time_subtract(dt_str: *const c_char, durat
 /// Compares two PlainDateTimes.
 #[no_mangle]
 pub extern "C" fn temporal_plain_date_time_compare(a: *const c_char, b: *const c_char) -> CompareResult {
+    stats_scope!("temporal_plain_date_time_compare");
     let dt_a: PlainDateTime = match parse_plain_date_time(a, "first plain date time") {
         Ok(d) => d,
         Err(e) => return CompareResult::range_error(
@@ -1600,11 +1836,32 @@ pub extern "C" fn temporal_plain_date_time_with(
     nanosecond: i32,
     calendar_id: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_with");
     let dt: PlainDateTime = match parse_plain_date_time(dt_str, "plain date time") {
         Ok(d) => d,
         Err(e) => return e,
     };
-    
+
+    match plain_date_time_with_fields(&dt, year, month, day, hour, minute, second, millisecond, microsecond, nanosecond, calendar_id) {
+        Ok(new_dt) => format_plain_date_time(&new_dt),
+        Err(e) => e,
+    }
+}
+
+/// Overlays the given fields on a PlainDateTime. Fields equal to i32::MIN keep their current value.
+fn plain_date_time_with_fields(
+    dt: &PlainDateTime,
+    year: i32,
+    month: i32,
+    day: i32,
+    hour: i32,
+    minute: i32,
+    second: i32,
+    millisecond: i32,
+    microsecond: i32,
+    nanosecond: i32,
+    calendar_id: *const c_char,
+) -> Result<PlainDateTime, TemporalResult> {
     let new_year = if year == i32::MIN { dt.year() } else { year };
     let new_month = if month == i32::MIN { dt.month() } else { month as u8 };
     let new_day = if day == i32::MIN { dt.day() } else { day as u8 };
@@ -1617,24 +1874,25 @@ pub extern "C" fn temporal_plain_date_time_with(
     let new_nanosecond = if nanosecond == i32::MIN { dt.nanosecond() } else { nanosecond as u16 };
 
     let new_calendar = if !calendar_id.is_null() {
-        match parse_c_str(calendar_id, "calendar id") {
-            Ok(s) => match Calendar::from_str(s) {
-                Ok(c) => c,
-                Err(e) => return TemporalResult::range_error(&format!("Invalid calendar: {}", e)),
-            },
-            Err(e) => return e,
-        }
+        let s = parse_c_str(calendar_id, "calendar id")?;
+        Calendar::from_str(s)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid calendar: {}", e)))?
     } else {
         dt.calendar().clone()
     };
 
-    match PlainDateTime::new(new_year, new_month, new_day, new_hour, new_minute, new_second, new_millisecond, new_microsecond, new_nanosecond, new_calendar) {
-         Ok(new_dt) => match new_dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-             Ok(s) => TemporalResult::success(s),
-             Err(e) => TemporalResult::range_error(&format!("Failed to format plain date time: {}", e)),
-         },
-        Err(e) => TemporalResult::range_error(&format!("Invalid date time components: {}", e)),
-    }
+    PlainDateTime::new(new_year, new_month, new_day, new_hour, new_minute, new_second, new_millisecond, new_microsecond, new_nanosecond, new_calendar)
+        .map_err(|e| TemporalResult::range_error(&format!("Invalid date time components: {}", e)))
+}
+
+/// Formats a PlainDateTime as an ISO 8601 string result.
+fn plain_date_time_string(dt: &PlainDateTime) -> Result<String, TemporalResult> {
+    dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto)
+        .map_err(|e| TemporalResult::range_error(&format!("Failed to format plain date time: {}", e)))
+}
+
+fn format_plain_date_time(dt: &PlainDateTime) -> TemporalResult {
+    plain_date_time_string(dt).map_or_else(|e| e, TemporalResult::success)
 }
 
 /// Computes the difference between two PlainDateTimes (until).
@@ -1643,6 +1901,7 @@ pub extern "C" fn temporal_plain_date_time_until(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_until");
     let one: PlainDateTime = match parse_plain_date_time(one_str, "first plain date time") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1664,6 +1923,7 @@ pub extern "C" fn temporal_plain_date_time_since(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_since");
     let one: PlainDateTime = match parse_plain_date_time(one_str, "first plain date time") {
         Ok(d) => d,
         Err(e) => return e,
@@ -1682,6 +1942,7 @@ pub extern "C" fn temporal_plain_date_time_since(
 // Helper functions for PlainDateTime
 fn parse_plain_date_time(s: *const c_char, param_name: &str) -> Result<PlainDateTime, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
+    stats::record_parse();
     PlainDateTime::from_str(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid plain date time '{}': {}", str_val, e)))
 }
@@ -1723,6 +1984,7 @@ impl Default for PlainYearMonthComponents {
 /// Parses an ISO 8601 string into a PlainYearMonth.
 #[no_mangle]
 pub extern "C" fn temporal_plain_year_month_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_from_string");
     let s_str = match parse_c_str(s, "plain year month string") {
         Ok(s) => s,
         Err(e) => return e,
@@ -1741,6 +2003,7 @@ pub extern "C" fn temporal_plain_year_month_from_components(
     calendar_id: *const c_char,
     _reference_day: u8,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_from_components");
     let calendar = if !calendar_id.is_null() {
         match parse_c_str(calendar_id, "calendar id") {
             Ok(s) => match Calendar::from_str(s) {
@@ -1770,6 +2033,7 @@ pub extern "C" fn temporal_plain_year_month_get_components(
     s: *const c_char,
     out: *mut PlainYearMonthComponents,
 ) {
+    stats_scope!("temporal_plain_year_month_get_components");
     if out.is_null() { return; }
     unsafe { *out = PlainYearMonthComponents::default(); }
     if s.is_null() { return; }
@@ -1795,6 +2059,7 @@ pub extern "C" fn temporal_plain_year_month_get_components(
 /// Gets the month code of a PlainYearMonth.
 #[no_mangle]
 pub extern "C" fn temporal_plain_year_month_get_month_code(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_get_month_code");
     let ym = match parse_plain_year_month(s, "plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1805,6 +2070,7 @@ pub extern "C" fn temporal_plain_year_month_get_month_code(s: *const c_char) ->
 /// Gets the calendar ID of a PlainYearMonth.
 #[no_mangle]
 pub extern "C" fn temporal_plain_year_month_get_calendar(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_get_calendar");
     let ym = match parse_plain_year_month(s, "plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1818,6 +2084,7 @@ pub extern "C" fn temporal_plain_year_month_add(
     ym_str: *const c_char,
     duration_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_add");
     let ym = match parse_plain_year_month(ym_str, "plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1839,6 +2106,7 @@ pub extern "C" fn temporal_plain_year_month_subtract(
     ym_str: *const c_char,
     duration_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_subtract");
     let ym = match parse_plain_year_month(ym_str, "plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1857,6 +2125,7 @@ pub extern "C" fn temporal_plain_year_month_subtract(
 /// Compares two PlainYearMonths.
 #[no_mangle]
 pub extern "C" fn temporal_plain_year_month_compare(a: *const c_char, b: *const c_char) -> CompareResult {
+    stats_scope!("temporal_plain_year_month_compare");
     let ym_a = match parse_plain_year_month(a, "first plain year month") {
         Ok(y) => y,
         Err(e) => return CompareResult::range_error(
@@ -1896,6 +2165,7 @@ pub extern "C" fn temporal_plain_year_month_with(
     month: i32,
     calendar_id: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_with");
     let ym = match parse_plain_year_month(ym_str, "plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1928,6 +2198,7 @@ pub extern "C" fn temporal_plain_year_month_until(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_until");
     let one = match parse_plain_year_month(one_str, "first plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1949,6 +2220,7 @@ pub extern "C" fn temporal_plain_year_month_since(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_since");
     let one = match parse_plain_year_month(one_str, "first plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1970,6 +2242,7 @@ pub extern "C" fn temporal_plain_year_month_to_plain_date(
     ym_str: *const c_char,
     day: i32,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_year_month_to_plain_date");
     let ym = match parse_plain_year_month(ym_str, "plain year month") {
         Ok(y) => y,
         Err(e) => return e,
@@ -1989,6 +2262,7 @@ pub extern "C" fn temporal_plain_year_month_to_plain_date(
 // Helper
 fn parse_plain_year_month(s: *const c_char, param_name: &str) -> Result<PlainYearMonth, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
+    stats::record_parse();
     PlainYearMonth::from_str(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid plain year month '{}': {}", str_val, e)))
 }
@@ -2018,6 +2292,7 @@ impl Default for PlainMonthDayComponents {
 /// Parses an ISO 8601 string into a PlainMonthDay.
 #[no_mangle]
 pub extern "C" fn temporal_plain_month_day_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_month_day_from_string");
     let s_str = match parse_c_str(s, "plain month day string") {
         Ok(s) => s,
         Err(e) => return e,
@@ -2036,6 +2311,7 @@ pub extern "C" fn temporal_plain_month_day_from_components(
     calendar_id: *const c_char,
     _reference_year: i32,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_month_day_from_components");
     let calendar = if !calendar_id.is_null() {
         match parse_c_str(calendar_id, "calendar id") {
             Ok(s) => match Calendar::from_str(s) {
@@ -2069,6 +2345,7 @@ pub extern "C" fn temporal_plain_month_day_get_components(
     s: *const c_char,
     out: *mut PlainMonthDayComponents,
 ) {
+    stats_scope!("temporal_plain_month_day_get_components");
     if out.is_null() { return; }
     unsafe { *out = PlainMonthDayComponents::default(); }
     if s.is_null() { return; }
@@ -2091,6 +2368,7 @@ pub extern "C" fn temporal_plain_month_day_get_components(
 /// Gets the month code of a PlainMonthDay.
 #[no_mangle]
 pub extern "C" fn temporal_plain_month_day_get_month_code(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_month_day_get_month_code");
     let md = match parse_plain_month_day(s, "plain month day") {
         Ok(m) => m,
         Err(e) => return e,
@@ -2101,6 +2379,7 @@ pub extern "C" fn temporal_plain_month_day_get_month_code(s: *const c_char) -> T
 /// Gets the calendar ID of a PlainMonthDay.
 #[no_mangle]
 pub extern "C" fn temporal_plain_month_day_get_calendar(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_plain_month_day_get_calendar");
     let md = match parse_plain_month_day(s, "plain month day") {
         Ok(m) => m,
         Err(e) => return e,
@@ -2114,6 +2393,7 @@ pub extern "C" fn temporal_plain_month_day_to_plain_date(
     md_str: *const c_char,
     year: i32,
 ) -> TemporalResult {
+    stats_scope!("temporal_plain_month_day_to_plain_date");
     let md = match parse_plain_month_day(md_str, "plain month day") {
         Ok(m) => m,
         Err(e) => return e,
@@ -2133,6 +2413,7 @@ pub extern "C" fn temporal_plain_month_day_to_plain_date(
 // Helper
 fn parse_plain_month_day(s: *const c_char, param_name: &str) -> Result<PlainMonthDay, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
+    stats::record_parse();
     PlainMonthDay::from_str(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid plain month day '{}': {}", str_val, e)))
 }
@@ -2144,6 +2425,7 @@ fn parse_plain_month_day(s: *const c_char, param_name: &str) -> Result<PlainMont
 /// Gets a Calendar from a string identifier.
 #[no_mangle]
 pub extern "C" fn temporal_calendar_from(id: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_calendar_from");
     let id_str = match parse_c_str(id, "calendar identifier") {
         Ok(s) => s,
         Err(e) => return e,
@@ -2158,6 +2440,7 @@ pub extern "C" fn temporal_calendar_from(id: *const c_char) -> TemporalResult {
 /// Gets the identifier of a calendar.
 #[no_mangle]
 pub extern "C" fn temporal_calendar_id(id: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_calendar_id");
     // This function essentially normalizes the calendar ID
     // If the input is already a valid ID, it returns it.
     let id_str = match parse_c_str(id, "calendar identifier") {
@@ -2216,6 +2499,7 @@ impl Default for DurationComponents {
 /// Parses an ISO 8601 duration string and returns a TemporalResult.
 #[no_mangle]
 pub extern "C" fn temporal_duration_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_duration_from_string");
     if s.is_null() {
         return TemporalResult::type_error("Duration string cannot be null");
     }
@@ -2238,6 +2522,7 @@ pub extern "C" fn temporal_duration_get_components(
     s: *const c_char,
     out: *mut DurationComponents,
 ) {
+    stats_scope!("temporal_duration_get_components");
     if out.is_null() {
         return;
     }
@@ -2282,24 +2567,28 @@ pub extern "C" fn temporal_duration_get_components(
 /// Adds two durations and returns a TemporalResult.
 #[no_mangle]
 pub extern "C" fn temporal_duration_add(a: *const c_char, b: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_duration_add");
     duration_binary_op(a, b, "add", |d1, d2| d1.add(&d2))
 }
 
 /// Subtracts duration b from a and returns a TemporalResult.
 #[no_mangle]
 pub extern "C" fn temporal_duration_subtract(a: *const c_char, b: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_duration_subtract");
     duration_binary_op(a, b, "subtract", |d1, d2| d1.subtract(&d2))
 }
 
 /// Negates a duration and returns a TemporalResult.
 #[no_mangle]
 pub extern "C" fn temporal_duration_negated(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_duration_negated");
     duration_unary_op(s, "negate", |d| Ok(d.negated()))
 }
 
 /// Gets the absolute value of a duration and returns a TemporalResult.
 #[no_mangle]
 pub extern "C" fn temporal_duration_abs(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_duration_abs");
     duration_unary_op(s, "abs", |d| Ok(d.abs()))
 }
 
@@ -2318,6 +2607,7 @@ pub extern "C" fn temporal_duration_from_components(
     microseconds: i64,
     nanoseconds: i64,
 ) -> TemporalResult {
+    stats_scope!("temporal_duration_from_components");
     // Check for mixed signs (TC39 requirement)
     let values = [years, months, weeks, days, hours, minutes, seconds, milliseconds, microseconds, nanoseconds];
     let non_zero: Vec<i64> = values.iter().copied().filter(|&v| v != 0).collect();
@@ -2373,6 +2663,7 @@ impl CompareResult {
         let error_msg = CString::new(message)
             .map(|s| s.into_raw())
             .unwrap_or(ptr::null_mut());
+        stats::record_error();
         Self {
             value: 0,
             error_type: TemporalErrorType::RangeError as i32,
@@ -2384,6 +2675,7 @@ impl CompareResult {
         let error_msg = CString::new(message)
             .map(|s| s.into_raw())
             .unwrap_or(ptr::null_mut());
+        stats::record_error();
         Self {
             value: 0,
             error_type: TemporalErrorType::TypeError as i32,
@@ -2407,6 +2699,7 @@ pub unsafe extern "C" fn temporal_free_compare_result(result: *mut CompareResult
 
 #[no_mangle]
 pub extern "C" fn temporal_duration_compare(a: *const c_char, b: *const c_char) -> CompareResult {
+    stats_scope!("temporal_duration_compare");
     let duration_a = match parse_duration(a, "first duration") {
         Ok(d) => d,
         Err(e) => return CompareResult::range_error(
@@ -2470,6 +2763,7 @@ pub extern "C" fn temporal_duration_with(
     microseconds: i64,
     nanoseconds: i64,
 ) -> TemporalResult {
+    stats_scope!("temporal_duration_with");
     let duration = match parse_duration(original, "duration") {
         Ok(d) => d,
         Err(e) => return e,
@@ -2537,18 +2831,21 @@ fn parse_c_str(s: *const c_char, param_name: &str) -> Result<&str, TemporalResul
 
 fn parse_duration(s: *const c_char, param_name: &str) -> Result<Duration, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
+    stats::record_parse();
     Duration::from_str(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid duration '{}': {}", str_val, e)))
 }
 
 fn parse_instant(s: *const c_char, param_name: &str) -> Result<Instant, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
-    Instant::from_str(str_val)
+    stats::record_parse();
+    instant_from_str(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid instant '{}': {}", str_val, e)))
 }
 
 fn parse_plain_time(s: *const c_char, param_name: &str) -> Result<PlainTime, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
+    stats::record_parse();
     PlainTime::from_str(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid plain time '{}': {}", str_val, e)))
 }
@@ -2602,93 +2899,515 @@ where
 
 
 // ============================================================================
-// TimeZone API
+// TimeZone cache
 // ============================================================================
 
-/// Gets a TimeZone from a string identifier.
-#[no_mangle]
-pub extern "C" fn temporal_time_zone_from_string(s: *const c_char) -> TemporalResult {
-    let s_str = match parse_c_str(s, "timezone string") {
-        Ok(s) => s,
-        Err(e) => return e,
-    };
-    match TimeZone::try_from_str(s_str) {
-        Ok(tz) => match tz.identifier() {
-            Ok(id) => TemporalResult::success(id),
-            Err(e) => TemporalResult::range_error(&format!("Failed to get timezone id: {}", e)),
-        },
-        Err(e) => TemporalResult::range_error(&format!("Invalid timezone '{}': {}", s_str, e)),
+/// Upper bound on cached identifiers. Keys come from JS, so the table must not
+/// grow without limit; once full, further zones are resolved uncached.
+const TIME_ZONE_CACHE_CAPACITY: usize = 256;
+
+/// Process-wide cache of resolved time zones, keyed by both the identifier as
+/// given and its normalized form. Resolution (identifier normalization and the
+/// provider lookup) happens once per zone. Transition indexes are built on the
+/// first transition or offset query for a zone and keyed by its normalized
+/// identifier.
+struct TimeZoneCache {
+    zones: RwLock<HashMap<String, TimeZone>>,
+    transitions: RwLock<HashMap<String, Arc<TransitionIndex>>>,
+    hits: AtomicU64,
+    misses: AtomicU64,
+}
+
+fn time_zone_cache() -> &'static TimeZoneCache {
+    static CACHE: OnceLock<TimeZoneCache> = OnceLock::new();
+    CACHE.get_or_init(|| TimeZoneCache {
+        zones: RwLock::new(HashMap::new()),
+        transitions: RwLock::new(HashMap::new()),
+        hits: AtomicU64::new(0),
+        misses: AtomicU64::new(0),
+    })
+}
+
+/// Bumped when the shared maps are cleared, while their write locks are held.
+/// Thread-local copies remember the generation they were filled at and empty
+/// themselves once it moves on. Inserts into the shared maps re-check it under
+/// the write lock, so an entry built before a clear is never stored after it.
+static TIME_ZONE_CACHE_GENERATION: AtomicU64 = AtomicU64::new(0);
+
+/// One thread's copy of the entries it has looked up. Once a zone is here,
+/// resolving it again touches no lock and no memory shared with other
+/// threads, so runtimes on different threads don't contend on the RwLocks.
+struct LocalTimeZoneCache {
+    generation: u64,
+    zones: HashMap<String, TimeZone>,
+    transitions: HashMap<String, Arc<TransitionIndex>>,
+}
+
+thread_local! {
+    static LOCAL_TIME_ZONE_CACHE: RefCell<LocalTimeZoneCache> = RefCell::new(LocalTimeZoneCache {
+        generation: 0,
+        zones: HashMap::new(),
+        transitions: HashMap::new(),
+    });
+}
+
+/// Runs `f` on this thread's cache as of `generation`. The borrow ends with
+/// `f`, which must not resolve zones itself.
+fn with_local_time_zone_cache<R>(generation: u64, f: impl FnOnce(&mut LocalTimeZoneCache) -> R) -> R {
+    LOCAL_TIME_ZONE_CACHE.with(|local| {
+        let mut local = local.borrow_mut();
+        if local.generation != generation {
+            local.zones.clear();
+            local.transitions.clear();
+            local.generation = generation;
+        }
+        f(&mut local)
+    })
+}
+
+/// Resolves a time zone identifier through the process-wide cache.
+/// Drop-in replacement for `TimeZone::try_from_str`.
+fn resolve_time_zone(id: &str) -> Result<TimeZone, TemporalError> {
+    let cache = time_zone_cache();
+    let generation = TIME_ZONE_CACHE_GENERATION.load(Ordering::Acquire);
+    if let Some(tz) = with_local_time_zone_cache(generation, |local| local.zones.get(id).cloned()) {
+        cache.hits.fetch_add(1, Ordering::Relaxed);
+        return Ok(tz);
     }
+
+    let shared = cache.zones.read().unwrap_or_else(PoisonError::into_inner).get(id).cloned();
+    let tz = match shared {
+        Some(tz) => {
+            cache.hits.fetch_add(1, Ordering::Relaxed);
+            tz
+        }
+        None => {
+            cache.misses.fetch_add(1, Ordering::Relaxed);
+            let tz = TimeZone::try_from_str(id)?;
+            let mut zones = cache.zones.write().unwrap_or_else(PoisonError::into_inner);
+            if zones.len() + 2 > TIME_ZONE_CACHE_CAPACITY
+                || TIME_ZONE_CACHE_GENERATION.load(Ordering::Acquire) != generation
+            {
+                return Ok(tz);
+            }
+            if let Ok(normalized) = tz.identifier() {
+                if normalized != id {
+                    zones.entry(normalized).or_insert_with(|| tz.clone());
+                }
+            }
+            zones.insert(id.to_string(), tz.clone());
+            tz
+        }
+    };
+    with_local_time_zone_cache(generation, |local| {
+        if local.zones.len() < TIME_ZONE_CACHE_CAPACITY {
+            local.zones.insert(id.to_string(), tz.clone());
+        }
+    });
+    Ok(tz)
 }
 
-/// Gets the identifier of a TimeZone.
+/// Counters for the process-wide TimeZone cache
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TimeZoneCacheStats {
+    /// Lookups served from the cache
+    pub hits: u64,
+    /// Lookups that had to resolve the zone
+    pub misses: u64,
+    /// Number of cached identifiers (including normalized aliases)
+    pub size: u64,
+}
+
+/// Returns the TimeZone cache hit/miss counters.
 #[no_mangle]
-pub extern "C" fn temporal_time_zone_get_id(s: *const c_char) -> TemporalResult {
-    let s_str = match parse_c_str(s, "timezone string") {
-        Ok(s) => s,
-        Err(e) => return e,
-    };
-    match TimeZone::try_from_str(s_str) {
-        Ok(tz) => match tz.identifier() {
-            Ok(id) => TemporalResult::success(id),
-            Err(e) => TemporalResult::range_error(&format!("Failed to get timezone id: {}", e)),
-        },
-        Err(e) => TemporalResult::range_error(&format!("Invalid timezone '{}': {}", s_str, e)),
+pub extern "C" fn temporal_time_zone_cache_stats() -> TimeZoneCacheStats {
+    stats_scope!("temporal_time_zone_cache_stats");
+    let cache = time_zone_cache();
+    TimeZoneCacheStats {
+        hits: cache.hits.load(Ordering::Relaxed),
+        misses: cache.misses.load(Ordering::Relaxed),
+        size: cache.zones.read().unwrap_or_else(PoisonError::into_inner).len() as u64,
     }
 }
 
-/// Gets the offset nanoseconds for an instant in a timezone.
+/// Empties the TimeZone cache and resets its counters.
 #[no_mangle]
-pub extern "C" fn temporal_time_zone_get_offset_nanoseconds_for(
-    tz_id: *const c_char,
-    instant_str: *const c_char,
-) -> TemporalResult {
-    let tz = match parse_time_zone(tz_id, "timezone") {
-        Ok(t) => t,
-        Err(e) => return e,
-    };
-    let instant = match parse_instant(instant_str, "instant") {
-        Ok(i) => i,
-        Err(e) => return e,
-    };
+pub extern "C" fn temporal_time_zone_cache_clear() {
+    stats_scope!("temporal_time_zone_cache_clear");
+    let cache = time_zone_cache();
+    let mut zones = cache.zones.write().unwrap_or_else(PoisonError::into_inner);
+    let mut transitions = cache.transitions.write().unwrap_or_else(PoisonError::into_inner);
+    zones.clear();
+    transitions.clear();
+    cache.hits.store(0, Ordering::Relaxed);
+    cache.misses.store(0, Ordering::Relaxed);
+    // An insert racing the clear either lands before it and is cleared, or
+    // takes the lock after this bump and sees a newer generation.
+    TIME_ZONE_CACHE_GENERATION.fetch_add(1, Ordering::Release);
+}
 
-    let provider = &*COMPILED_TZ_PROVIDER;
-    match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, Calendar::default()) {
-        Ok(zdt) => TemporalResult::success(zdt.offset_nanoseconds().to_string()),
-        Err(e) => TemporalResult::range_error(&format!("Failed to get offset: {}", e)),
-    }
+// ============================================================================
+// Transition index
+// ============================================================================
+
+// A zone's transitions between 1900 and 2100 are read from the provider once
+// and kept sorted together with the offset in effect after each, so next,
+// previous and offset queries inside that window are binary searches. Queries
+// outside it go to the provider directly.
+
+/// Start of the indexed window: 1900-01-01T00:00:00Z.
+const TRANSITION_INDEX_START_NS: i128 = -2_208_988_800 * 1_000_000_000;
+/// End (exclusive) of the indexed window: 2100-01-01T00:00:00Z.
+const TRANSITION_INDEX_END_NS: i128 = 4_102_444_800 * 1_000_000_000;
+
+/// Sorted UTC offset transitions of one zone within the indexed window.
+struct TransitionIndex {
+    tz: TimeZone,
+    /// Transition instants in epoch nanoseconds, ascending.
+    epochs: Vec<i128>,
+    /// `offsets[i]` is the offset in effect from `epochs[i]` until the next
+    /// transition.
+    offsets: Vec<i64>,
+    /// Offset in effect at the start of the window.
+    initial_offset: i64,
 }
 
-/// Gets the offset string for an instant in a timezone.
-#[no_mangle]
-pub extern "C" fn temporal_time_zone_get_offset_string_for(
-    tz_id: *const c_char,
-    instant_str: *const c_char,
-) -> TemporalResult {
-    let tz = match parse_time_zone(tz_id, "timezone") {
-        Ok(t) => t,
-        Err(e) => return e,
-    };
-    let instant = match parse_instant(instant_str, "instant") {
-        Ok(i) => i,
-        Err(e) => return e,
-    };
+impl TransitionIndex {
+    fn build(tz: TimeZone) -> Result<Self, TemporalError> {
+        let mut epochs = Vec::new();
+        let mut offsets = Vec::new();
+        let mut cursor = TRANSITION_INDEX_START_NS;
+        while let Some(ns) = provider_transition(&tz, cursor, TransitionDirection::Next)? {
+            if ns >= TRANSITION_INDEX_END_NS || ns <= cursor {
+                break;
+            }
+            epochs.push(ns);
+            offsets.push(provider_offset(&tz, ns)?);
+            cursor = ns;
+        }
+        let initial_offset = provider_offset(&tz, TRANSITION_INDEX_START_NS)?;
+        Ok(Self {
+            tz,
+            epochs,
+            offsets,
+            initial_offset,
+        })
+    }
 
-    let provider = &*COMPILED_TZ_PROVIDER;
-    match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, Calendar::default()) {
-        Ok(zdt) => TemporalResult::success(zdt.offset().to_string()),
-        Err(e) => TemporalResult::range_error(&format!("Failed to get offset string: {}", e)),
+    fn in_window(ns: i128) -> bool {
+        (TRANSITION_INDEX_START_NS..TRANSITION_INDEX_END_NS).contains(&ns)
     }
-}
 
-/// Gets the PlainDateTime for an instant in a timezone.
-#[no_mangle]
-pub extern "C" fn temporal_time_zone_get_plain_date_time_for(
+    /// First transition strictly after `ns`.
+    fn next(&self, ns: i128) -> Result<Option<i128>, TemporalError> {
+        if Self::in_window(ns) {
+            if let Some(&t) = self.epochs.get(self.epochs.partition_point(|&t| t <= ns)) {
+                return Ok(Some(t));
+            }
+        }
+        provider_transition(&self.tz, ns, TransitionDirection::Next)
+    }
+
+    /// Last transition strictly before `ns`.
+    fn previous(&self, ns: i128) -> Result<Option<i128>, TemporalError> {
+        if ns > TRANSITION_INDEX_START_NS && ns <= TRANSITION_INDEX_END_NS {
+            let i = self.epochs.partition_point(|&t| t < ns);
+            if i > 0 {
+                return Ok(Some(self.epochs[i - 1]));
+            }
+        }
+        provider_transition(&self.tz, ns, TransitionDirection::Previous)
+    }
+
+    /// UTC offset in nanoseconds at `ns`.
+    fn offset(&self, ns: i128) -> Result<i64, TemporalError> {
+        if !Self::in_window(ns) {
+            return provider_offset(&self.tz, ns);
+        }
+        Ok(match self.epochs.partition_point(|&t| t <= ns) {
+            0 => self.initial_offset,
+            i => self.offsets[i - 1],
+        })
+    }
+
+    /// First instant of the local `day` (days since 1970-01-01), as
+    /// `startOfDay()` finds it: the earlier of two midnights, or the end of
+    /// the gap when midnight is skipped. Assumes at most one transition
+    /// within a day of midnight, as the spec's disambiguation does.
+    fn start_of_day(&self, day: i64) -> Result<i128, TemporalError> {
+        let midnight = day as i128 * NANOSECONDS_PER_DAY;
+        let before = self.offset(midnight - NANOSECONDS_PER_DAY)?;
+        let after = self.offset(midnight + NANOSECONDS_PER_DAY)?;
+        for offset in [before, after] {
+            let candidate = midnight - offset as i128;
+            if self.offset(candidate)? == offset {
+                return Ok(candidate);
+            }
+        }
+        // Skipped: the day starts at the transition that ends the gap.
+        let gap_start = midnight - after as i128;
+        Ok(self.next(gap_start)?.unwrap_or(gap_start))
+    }
+}
+
+fn provider_transition(
+    tz: &TimeZone,
+    ns: i128,
+    direction: TransitionDirection,
+) -> Result<Option<i128>, TemporalError> {
+    match tz {
+        TimeZone::IanaIdentifier(id) => {
+            let provider = &*COMPILED_TZ_PROVIDER;
+            Ok(provider.get_time_zone_transition(id.clone(), ns, direction)?.map(|t| t.0))
+        }
+        TimeZone::UtcOffset(_) => Ok(None),
+    }
+}
+
+fn provider_offset(tz: &TimeZone, ns: i128) -> Result<i64, TemporalError> {
+    ZonedDateTime::try_new(ns, tz.clone(), Calendar::default()).map(|zdt| zdt.offset_nanoseconds() as i64)
+}
+
+/// Returns the transition index of a zone, building it on first use.
+fn transition_index(tz: &TimeZone) -> Result<Arc<TransitionIndex>, TemporalResult> {
+    let build_error = |e: TemporalError| TemporalResult::range_error(&format!("Failed to read transitions: {}", e));
+    let key = tz.identifier().map_err(build_error)?;
+    let cache = time_zone_cache();
+    let generation = TIME_ZONE_CACHE_GENERATION.load(Ordering::Acquire);
+    if let Some(index) = with_local_time_zone_cache(generation, |local| local.transitions.get(&key).cloned()) {
+        return Ok(index);
+    }
+
+    let shared = cache.transitions.read().unwrap_or_else(PoisonError::into_inner).get(&key).cloned();
+    let index = match shared {
+        Some(index) => index,
+        None => {
+            let index = Arc::new(TransitionIndex::build(tz.clone()).map_err(build_error)?);
+            let mut transitions = cache.transitions.write().unwrap_or_else(PoisonError::into_inner);
+            if transitions.len() >= TIME_ZONE_CACHE_CAPACITY
+                || TIME_ZONE_CACHE_GENERATION.load(Ordering::Acquire) != generation
+            {
+                return Ok(index);
+            }
+            transitions.insert(key.clone(), index.clone());
+            index
+        }
+    };
+    with_local_time_zone_cache(generation, |local| {
+        if local.transitions.len() < TIME_ZONE_CACHE_CAPACITY {
+            local.transitions.insert(key, index.clone());
+        }
+    });
+    Ok(index)
+}
+
+/// UTC offset of `tz` at `ns`, answered from the zone's transition index.
+fn time_zone_offset_nanoseconds(tz: &TimeZone, ns: i128) -> Result<i64, TemporalResult> {
+    transition_index(tz)?
+        .offset(ns)
+        .map_err(|e| TemporalResult::range_error(&format!("Failed to get offset: {}", e)))
+}
+
+// ============================================================================
+// Fast-path ISO 8601 parsing
+// ============================================================================
+
+// Most inputs are the canonical fixed-width shapes `YYYY-MM-DDTHH:MM:SS(.f)Z`
+// and `YYYY-MM-DD`. Those are decoded directly here; anything else (offsets,
+// annotations, lowercase designators, extended years, leap seconds, ...)
+// falls back to the full IXDTF parser, which also produces the error message.
+
+/// Builds the SWAR comparison constants for an 8-byte pattern in which `0`
+/// marks a digit and any other byte must match exactly. Returns the pattern
+/// and the per-byte addend that sets a byte's high bit when it is out of range
+/// after XOR: digits must be below 10, separators must be exactly 0.
+const fn swar_pattern(pattern: &[u8; 8]) -> (u64, u64) {
+    let mut addend = [0u8; 8];
+    let mut i = 0;
+    while i < 8 {
+        addend[i] = if pattern[i] == b'0' { 0x76 } else { 0x7F };
+        i += 1;
+    }
+    (u64::from_le_bytes(*pattern), u64::from_le_bytes(addend))
+}
+
+const SWAR_DATE_HEAD: (u64, u64) = swar_pattern(b"0000-00-");
+const SWAR_DATE_TIME_TAIL: (u64, u64) = swar_pattern(b"00T00:00");
+const SWAR_HIGH_BITS: u64 = 0x8080_8080_8080_8080;
+
+/// Checks 8 bytes against a `swar_pattern` in a handful of integer ops.
+/// Carries between lanes only happen from bytes that already have the high
+/// bit set, so they can't mask a mismatch.
+#[inline]
+fn swar_matches(bytes: &[u8], (pattern, addend): (u64, u64)) -> bool {
+    let chunk: [u8; 8] = match bytes.get(..8).and_then(|b| b.try_into().ok()) {
+        Some(chunk) => chunk,
+        None => return false,
+    };
+    let x = u64::from_le_bytes(chunk) ^ pattern;
+    (x.wrapping_add(addend) | x) & SWAR_HIGH_BITS == 0
+}
+
+/// Decimal value of already-validated ASCII digits.
+#[inline]
+fn ascii_digits(bytes: &[u8]) -> u32 {
+    bytes.iter().fold(0, |acc, b| acc * 10 + (b - b'0') as u32)
+}
+
+fn is_leap_year(year: i32) -> bool {
+    year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)
+}
+
+fn iso_days_in_month(year: i32, month: u32) -> u32 {
+    match month {
+        2 if is_leap_year(year) => 29,
+        2 => 28,
+        4 | 6 | 9 | 11 => 30,
+        _ => 31,
+    }
+}
+
+/// Days since 1970-01-01 for a proleptic Gregorian date.
+fn days_from_civil(year: i32, month: u32, day: u32) -> i64 {
+    let year = if month <= 2 { year as i64 - 1 } else { year as i64 };
+    let era = year.div_euclid(400);
+    let year_of_era = year - era * 400;
+    let shifted_month = (month as i64 + 9) % 12;
+    let day_of_year = (153 * shifted_month + 2) / 5 + day as i64 - 1;
+    let day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    era * 146_097 + day_of_era - 719_468
+}
+
+/// Decodes a `YYYY-MM-DD` prefix, validating the calendar date.
+fn fast_parse_date(bytes: &[u8]) -> Option<(i32, u32, u32)> {
+    if bytes.len() < 10
+        || !swar_matches(bytes, SWAR_DATE_HEAD)
+        || !bytes[8].is_ascii_digit()
+        || !bytes[9].is_ascii_digit()
+    {
+        return None;
+    }
+    let year = ascii_digits(&bytes[0..4]) as i32;
+    let month = ascii_digits(&bytes[5..7]);
+    let day = ascii_digits(&bytes[8..10]);
+    if !(1..=12).contains(&month) || day == 0 || day > iso_days_in_month(year, month) {
+        return None;
+    }
+    Some((year, month, day))
+}
+
+/// Fast path for `YYYY-MM-DDTHH:MM:SS[.fffffffff]Z`.
+fn fast_parse_instant(s: &str) -> Option<Instant> {
+    let bytes = s.as_bytes();
+    let len = bytes.len();
+    if !(20..=30).contains(&len) || bytes[len - 1] != b'Z' {
+        return None;
+    }
+    let (year, month, day) = fast_parse_date(bytes)?;
+    if !swar_matches(&bytes[8..], SWAR_DATE_TIME_TAIL)
+        || bytes[16] != b':'
+        || !bytes[17].is_ascii_digit()
+        || !bytes[18].is_ascii_digit()
+    {
+        return None;
+    }
+    let hour = ascii_digits(&bytes[11..13]);
+    let minute = ascii_digits(&bytes[14..16]);
+    let second = ascii_digits(&bytes[17..19]);
+    if hour > 23 || minute > 59 || second > 59 {
+        return None;
+    }
+
+    let fraction = match len {
+        20 => 0,
+        21 => return None,
+        _ => {
+            let digits = &bytes[20..len - 1];
+            if bytes[19] != b'.' || !digits.iter().all(u8::is_ascii_digit) {
+                return None;
+            }
+            ascii_digits(digits) as i128 * 10i128.pow(9 - digits.len() as u32)
+        }
+    };
+
+    let seconds = days_from_civil(year, month, day) * 86_400
+        + (hour * 3_600 + minute * 60 + second) as i64;
+    Instant::try_new(seconds as i128 * 1_000_000_000 + fraction).ok()
+}
+
+/// Parses an Instant, trying the fixed-width fast path first.
+/// Drop-in replacement for `Instant::from_str`.
+fn instant_from_str(s: &str) -> Result<Instant, TemporalError> {
+    match fast_parse_instant(s) {
+        Some(instant) => Ok(instant),
+        None => Instant::from_str(s),
+    }
+}
+
+/// Parses a PlainDate, trying the `YYYY-MM-DD` fast path first.
+/// Drop-in replacement for `PlainDate::from_str`.
+fn plain_date_from_str(s: &str) -> Result<PlainDate, TemporalError> {
+    if s.len() == 10 {
+        if let Some((year, month, day)) = fast_parse_date(s.as_bytes()) {
+            if let Ok(date) = PlainDate::new(year, month as u8, day as u8, Calendar::default()) {
+                return Ok(date);
+            }
+        }
+    }
+    PlainDate::from_str(s)
+}
+
+// ============================================================================
+// TimeZone API
+// ============================================================================
+
+/// Gets a TimeZone from a string identifier.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_from_string(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_time_zone_from_string");
+    let s_str = match parse_c_str(s, "timezone string") {
+        Ok(s) => s,
+        Err(e) => return e,
+    };
+    match resolve_time_zone(s_str) {
+        Ok(tz) => match tz.identifier() {
+            Ok(id) => TemporalResult::success(id),
+            Err(e) => TemporalResult::range_error(&format!("Failed to get timezone id: {}", e)),
+        },
+        Err(e) => TemporalResult::range_error(&format!("Invalid timezone '{}': {}", s_str, e)),
+    }
+}
+
+/// Gets the identifier of a TimeZone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_id(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_id");
+    let s_str = match parse_c_str(s, "timezone string") {
+        Ok(s) => s,
+        Err(e) => return e,
+    };
+    match resolve_time_zone(s_str) {
+        Ok(tz) => match tz.identifier() {
+            Ok(id) => TemporalResult::success(id),
+            Err(e) => TemporalResult::range_error(&format!("Failed to get timezone id: {}", e)),
+        },
+        Err(e) => TemporalResult::range_error(&format!("Invalid timezone '{}': {}", s_str, e)),
+    }
+}
+
+/// Gets the offset nanoseconds for an instant in a timezone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_offset_nanoseconds_for(
     tz_id: *const c_char,
     instant_str: *const c_char,
-    calendar_id: *const c_char,
 ) -> TemporalResult {
-    let tz = match parse_time_zone(tz_id, "timezone") {
+    stats_scope!("temporal_time_zone_get_offset_nanoseconds_for");
+    time_zone_offset_nanoseconds_for(parse_time_zone(tz_id, "timezone"), instant_str)
+}
+
+fn time_zone_offset_nanoseconds_for(tz: Result<TimeZone, TemporalResult>, instant_str: *const c_char) -> TemporalResult {
+    let tz = match tz {
         Ok(t) => t,
         Err(e) => return e,
     };
@@ -2696,17 +3415,73 @@ pub extern "C" fn temporal_time_zone_get_plain_date_time_for(
         Ok(i) => i,
         Err(e) => return e,
     };
-    
-    let calendar = if !calendar_id.is_null() {
-        match parse_c_str(calendar_id, "calendar id") {
-            Ok(s) => match Calendar::from_str(s) {
-                Ok(c) => c,
-                Err(e) => return TemporalResult::range_error(&format!("Invalid calendar: {}", e)),
-            },
-            Err(e) => return e,
+
+    match time_zone_offset_nanoseconds(&tz, instant.epoch_nanoseconds().0) {
+        Ok(offset) => TemporalResult::success(offset.to_string()),
+        Err(e) => e,
+    }
+}
+
+/// Gets the offset string for an instant in a timezone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_offset_string_for(
+    tz_id: *const c_char,
+    instant_str: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_offset_string_for");
+    time_zone_offset_string_for(parse_time_zone(tz_id, "timezone"), instant_str)
+}
+
+fn time_zone_offset_string_for(tz: Result<TimeZone, TemporalResult>, instant_str: *const c_char) -> TemporalResult {
+    let tz = match tz {
+        Ok(t) => t,
+        Err(e) => return e,
+    };
+    let instant = match parse_instant(instant_str, "instant") {
+        Ok(i) => i,
+        Err(e) => return e,
+    };
+
+    let provider = &*COMPILED_TZ_PROVIDER;
+    match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, Calendar::default()) {
+        Ok(zdt) => TemporalResult::success(zdt.offset().to_string()),
+        Err(e) => TemporalResult::range_error(&format!("Failed to get offset string: {}", e)),
+    }
+}
+
+/// Gets the PlainDateTime for an instant in a timezone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_plain_date_time_for(
+    tz_id: *const c_char,
+    instant_str: *const c_char,
+    calendar_id: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_plain_date_time_for");
+    time_zone_plain_date_time_for(parse_time_zone(tz_id, "timezone"), instant_str, || {
+        if calendar_id.is_null() {
+            return Ok(Calendar::default());
         }
-    } else {
-        Calendar::default()
+        let s = parse_c_str(calendar_id, "calendar id")?;
+        Calendar::from_str(s).map_err(|e| TemporalResult::range_error(&format!("Invalid calendar: {}", e)))
+    })
+}
+
+fn time_zone_plain_date_time_for(
+    tz: Result<TimeZone, TemporalResult>,
+    instant_str: *const c_char,
+    calendar: impl FnOnce() -> Result<Calendar, TemporalResult>,
+) -> TemporalResult {
+    let tz = match tz {
+        Ok(t) => t,
+        Err(e) => return e,
+    };
+    let instant = match parse_instant(instant_str, "instant") {
+        Ok(i) => i,
+        Err(e) => return e,
+    };
+    let calendar = match calendar() {
+        Ok(c) => c,
+        Err(e) => return e,
     };
 
     match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, calendar) {
@@ -2725,7 +3500,16 @@ pub extern "C" fn temporal_time_zone_get_instant_for(
     dt_str: *const c_char,
     disambiguation: *const c_char,
 ) -> TemporalResult {
-    let tz = match parse_time_zone(tz_id, "timezone") {
+    stats_scope!("temporal_time_zone_get_instant_for");
+    time_zone_instant_for(parse_time_zone(tz_id, "timezone"), dt_str, disambiguation)
+}
+
+fn time_zone_instant_for(
+    tz: Result<TimeZone, TemporalResult>,
+    dt_str: *const c_char,
+    disambiguation: *const c_char,
+) -> TemporalResult {
+    let tz = match tz {
         Ok(t) => t,
         Err(e) => return e,
     };
@@ -2762,13 +3546,34 @@ pub extern "C" fn temporal_time_zone_get_instant_for(
     }
 }
 
-/// Gets the next transition instant.
+/// Gets the first transition instant after `instant_str`, or an empty string
+/// if the zone has no further transitions.
 #[no_mangle]
 pub extern "C" fn temporal_time_zone_get_next_transition(
     tz_id: *const c_char,
     instant_str: *const c_char,
 ) -> TemporalResult {
-    let tz = match parse_time_zone(tz_id, "timezone") {
+    stats_scope!("temporal_time_zone_get_next_transition");
+    time_zone_transition(parse_time_zone(tz_id, "timezone"), instant_str, TransitionDirection::Next)
+}
+
+/// Gets the last transition instant before `instant_str`, or an empty string
+/// if the zone has no earlier transitions.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_previous_transition(
+    tz_id: *const c_char,
+    instant_str: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_previous_transition");
+    time_zone_transition(parse_time_zone(tz_id, "timezone"), instant_str, TransitionDirection::Previous)
+}
+
+fn time_zone_transition(
+    tz: Result<TimeZone, TemporalResult>,
+    instant_str: *const c_char,
+    direction: TransitionDirection,
+) -> TemporalResult {
+    let tz = match tz {
         Ok(t) => t,
         Err(e) => return e,
     };
@@ -2776,48 +3581,94 @@ pub extern "C" fn temporal_time_zone_get_next_transition(
         Ok(i) => i,
         Err(e) => return e,
     };
+    let index = match transition_index(&tz) {
+        Ok(index) => index,
+        Err(e) => return e,
+    };
 
-    // TODO: Implement using provider directly when API is clear
-    match Ok::<Option<Instant>, TemporalError>(None) { // Stub
-        Ok(Some(i)) => {
-            let provider = &*COMPILED_TZ_PROVIDER;
-            match i.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                Ok(s) => TemporalResult::success(s),
-                Err(e) => TemporalResult::range_error(&format!("Failed to format instant: {}", e)),
-            }
-        },
+    let ns = instant.epoch_nanoseconds().0;
+    let transition = match direction {
+        TransitionDirection::Next => index.next(ns),
+        TransitionDirection::Previous => index.previous(ns),
+    };
+    match transition.and_then(|t| t.map(Instant::try_new).transpose()) {
+        Ok(Some(i)) => format_instant(&i),
         Ok(None) => TemporalResult::success(String::new()),
-        Err(e) => TemporalResult::range_error(&format!("Failed to get next transition: {}", e)),
+        Err(e) => TemporalResult::range_error(&format!("Failed to get transition: {}", e)),
     }
 }
 
-/// Gets the previous transition instant.
+/// Largest `cap` accepted by `temporal_time_zone_get_transitions`.
+pub const MAX_TRANSITION_COUNT: i32 = 100_000;
+
+/// Writes the transitions `t` of a zone with `start <= t < end` into `out`,
+/// ascending, and returns how many were written in `count`. At most `cap`
+/// (up to MAX_TRANSITION_COUNT) are written; when `count == cap`, call again
+/// with `start` just after the last one to continue. Zones without
+/// transitions (UTC, fixed offsets) write nothing.
 #[no_mangle]
-pub extern "C" fn temporal_time_zone_get_previous_transition(
+pub extern "C" fn temporal_time_zone_get_transitions(
     tz_id: *const c_char,
-    instant_str: *const c_char,
-) -> TemporalResult {
-    let tz = match parse_time_zone(tz_id, "timezone") {
+    start: TemporalEpochNanoseconds,
+    end: TemporalEpochNanoseconds,
+    out: *mut TemporalEpochNanoseconds,
+    cap: i32,
+) -> BatchResult {
+    stats_scope!("temporal_time_zone_get_transitions");
+    time_zone_transitions(parse_time_zone(tz_id, "timezone"), start, end, out, cap)
+}
+
+fn time_zone_transitions(
+    tz: Result<TimeZone, TemporalResult>,
+    start: TemporalEpochNanoseconds,
+    end: TemporalEpochNanoseconds,
+    out: *mut TemporalEpochNanoseconds,
+    cap: i32,
+) -> BatchResult {
+    let tz = match tz {
         Ok(t) => t,
-        Err(e) => return e,
+        Err(e) => return BatchResult::from_error(-1, e),
     };
-    let instant = match parse_instant(instant_str, "instant") {
-        Ok(i) => i,
+    let (start, end) = match (start.to_instant(), end.to_instant()) {
+        (Ok(s), Ok(e)) => (s.epoch_nanoseconds().0, e.epoch_nanoseconds().0),
+        (Err(e), _) | (_, Err(e)) => return BatchResult::from_error(-1, e),
+    };
+    if !(0..=MAX_TRANSITION_COUNT).contains(&cap) {
+        return BatchResult::from_error(
+            -1,
+            TemporalResult::range_error(&format!("cap must be between 0 and {}", MAX_TRANSITION_COUNT)),
+        );
+    }
+    let out = match batch_output(out, cap as usize) {
+        Ok(o) => o,
         Err(e) => return e,
     };
+    let index = match transition_index(&tz) {
+        Ok(index) => index,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
 
-    // TODO: Implement using provider directly
-    match Ok::<Option<Instant>, TemporalError>(None) {
-        Ok(Some(i)) => {
-            let provider = &*COMPILED_TZ_PROVIDER;
-            match i.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                Ok(s) => TemporalResult::success(s),
-                Err(e) => TemporalResult::range_error(&format!("Failed to format instant: {}", e)),
+    let mut written = 0;
+    // `next` is strictly after its argument, so step back one nanosecond to
+    // include a transition exactly at `start`.
+    let mut cursor = start - 1;
+    while written < out.len() {
+        match index.next(cursor) {
+            Ok(Some(t)) if t < end => {
+                out[written] = TemporalEpochNanoseconds::from_i128(t);
+                written += 1;
+                cursor = t;
             }
-        },
-        Ok(None) => TemporalResult::success(String::new()),
-        Err(e) => TemporalResult::range_error(&format!("Failed to get previous transition: {}", e)),
+            Ok(_) => break,
+            Err(e) => {
+                return BatchResult::from_error(
+                    -1,
+                    TemporalResult::range_error(&format!("Failed to get transitions: {}", e)),
+                )
+            }
+        }
     }
+    BatchResult::success(written)
 }
 
 // ============================================================================
@@ -2881,6 +3732,7 @@ impl Default for ZonedDateTimeComponents {
 pub extern "C" fn temporal_zoned_date_time_from_string(
     s: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_from_string");
     let s_str = match parse_c_str(s, "zoned date time string") {
         Ok(s) => s,
         Err(e) => return e,
@@ -2913,6 +3765,7 @@ pub extern "C" fn temporal_zoned_date_time_from_components(
     offset_nanoseconds: i64, // Optional offset for conflict resolution, 0 if ignored? 
     // Spec: needs disambiguation options if offset is ignored/provided
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_from_components");
     // Constructing ZDT from components usually requires creating a PlainDateTime first, 
     // then converting to ZDT with timezone and disambiguation.
     
@@ -2947,7 +3800,7 @@ pub extern "C" fn temporal_zoned_date_time_from_components(
         return TemporalResult::type_error("Timezone ID is required");
     };
 
-    let tz = match TimeZone::try_from_str(tz_str) {
+    let tz = match resolve_time_zone(tz_str) {
         Ok(t) => t,
         Err(e) => return TemporalResult::range_error(&format!("Invalid timezone: {}", e)),
     };
@@ -2971,6 +3824,7 @@ pub extern "C" fn temporal_zoned_date_time_get_components(
     s: *const c_char,
     out: *mut ZonedDateTimeComponents,
 ) {
+    stats_scope!("temporal_zoned_date_time_get_components");
     if out.is_null() { return; }
     unsafe { *out = ZonedDateTimeComponents::default(); }
     if s.is_null() { return; }
@@ -2980,36 +3834,37 @@ pub extern "C" fn temporal_zoned_date_time_get_components(
         Err(_) => return,
     };
 
-    unsafe {
-        (*out).year = zdt.year();
-        (*out).month = zdt.month();
-        (*out).day = zdt.day();
-        (*out).day_of_week = zdt.day_of_week();
-        (*out).day_of_year = zdt.day_of_year();
-        (*out).week_of_year = zdt.week_of_year().unwrap_or(0) as u16;
-        (*out).year_of_week = zdt.year_of_week().unwrap_or(0);
-        (*out).days_in_week = zdt.days_in_week();
-        (*out).days_in_month = zdt.days_in_month();
-        (*out).days_in_year = zdt.days_in_year();
-        (*out).months_in_year = zdt.months_in_year();
-        (*out).in_leap_year = if zdt.in_leap_year() { 1 } else { 0 };
-        
-        (*out).hour = zdt.hour();
-        (*out).minute = zdt.minute();
-        (*out).second = zdt.second();
-        (*out).millisecond = zdt.millisecond();
-        (*out).microsecond = zdt.microsecond();
-        (*out).nanosecond = zdt.nanosecond();
-        
-        (*out).offset_nanoseconds = zdt.offset_nanoseconds() as i64;
-        
-        (*out).is_valid = 1;
+    unsafe { fill_zoned_date_time_components(&zdt, &mut *out) };
+}
+
+/// Parses a ZonedDateTime string, returning the normalized string and filling
+/// `out` (if not NULL) in the same call.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_from_string_with_components(
+    s: *const c_char,
+    out: *mut ZonedDateTimeComponents,
+) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_from_string_with_components");
+    if !out.is_null() {
+        unsafe { *out = ZonedDateTimeComponents::default() };
+    }
+    let zdt = match parse_zoned_date_time(s, "zoned date time string") {
+        Ok(z) => z,
+        Err(e) => return e,
+    };
+    if !out.is_null() {
+        unsafe { fill_zoned_date_time_components(&zdt, &mut *out) };
+    }
+    match zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+        Ok(s) => TemporalResult::success(s),
+        Err(e) => TemporalResult::range_error(&format!("Failed to format zoned date time: {}", e)),
     }
 }
 
 /// Gets the epoch values.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_epoch_milliseconds(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_epoch_milliseconds");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3019,6 +3874,7 @@ pub extern "C" fn temporal_zoned_date_time_epoch_milliseconds(s: *const c_char)
 
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_epoch_nanoseconds(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_epoch_nanoseconds");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3029,6 +3885,7 @@ pub extern "C" fn temporal_zoned_date_time_epoch_nanoseconds(s: *const c_char) -
 /// Gets the calendar ID.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_get_calendar(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_get_calendar");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3039,6 +3896,7 @@ pub extern "C" fn temporal_zoned_date_time_get_calendar(s: *const c_char) -> Tem
 /// Gets the TimeZone ID.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_get_time_zone(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_get_time_zone");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3052,6 +3910,7 @@ pub extern "C" fn temporal_zoned_date_time_get_time_zone(s: *const c_char) -> Te
 /// Gets the offset string.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_get_offset(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_get_offset");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3065,6 +3924,7 @@ pub extern "C" fn temporal_zoned_date_time_add(
     zdt_str: *const c_char,
     duration_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_add");
     let zdt = match parse_zoned_date_time(zdt_str, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3089,6 +3949,7 @@ pub extern "C" fn temporal_zoned_date_time_subtract(
     zdt_str: *const c_char,
     duration_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_subtract");
     let zdt = match parse_zoned_date_time(zdt_str, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3113,6 +3974,7 @@ pub extern "C" fn temporal_zoned_date_time_compare(
     a: *const c_char,
     b: *const c_char,
 ) -> CompareResult {
+    stats_scope!("temporal_zoned_date_time_compare");
     let zdt_a = match parse_zoned_date_time(a, "first zoned date time") {
         Ok(z) => z,
         Err(e) => return CompareResult::range_error(
@@ -3146,15 +4008,36 @@ pub extern "C" fn temporal_zoned_date_time_with(
     calendar_id: *const c_char,
     time_zone_id: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_with");
     let zdt = match parse_zoned_date_time(zdt_str, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
     };
-    
-    // This is complex. `with` works on PlainDateTime components then resolves.
-    // We need to implement partial update logic similar to PlainDateTime but then re-resolve.
-    // For simplicity, we can extract current components, overlay new ones, create new ZDT.
-    
+
+    match zoned_date_time_with_fields(&zdt, year, month, day, hour, minute, second, millisecond, microsecond, nanosecond, calendar_id, time_zone_id) {
+        Ok(new_zdt) => format_zoned_date_time(&new_zdt),
+        Err(e) => e,
+    }
+}
+
+/// Overlays the given wall-clock fields on a ZonedDateTime and re-resolves it in its
+/// (possibly replaced) time zone. Fields equal to i32::MIN keep their current value.
+fn zoned_date_time_with_fields(
+    zdt: &ZonedDateTime,
+    year: i32,
+    month: i32,
+    day: i32,
+    hour: i32,
+    minute: i32,
+    second: i32,
+    millisecond: i32,
+    microsecond: i32,
+    nanosecond: i32,
+    calendar_id: *const c_char,
+    time_zone_id: *const c_char,
+) -> Result<ZonedDateTime, TemporalResult> {
+    // `with` works on PlainDateTime components then resolves: extract the current
+    // components, overlay the new ones and create a new ZDT.
     let current_pdt = zdt.to_plain_date_time();
     
     let new_year = if year == i32::MIN { current_pdt.year() } else { year };
@@ -3169,46 +4052,40 @@ pub extern "C" fn temporal_zoned_date_time_with(
     let new_nanosecond = if nanosecond == i32::MIN { current_pdt.nanosecond() } else { nanosecond as u16 };
 
     let new_calendar = if !calendar_id.is_null() {
-        match parse_c_str(calendar_id, "calendar id") {
-            Ok(s) => match Calendar::from_str(s) {
-                Ok(c) => c,
-                Err(e) => return TemporalResult::range_error(&format!("Invalid calendar: {}", e)),
-            },
-            Err(e) => return e,
-        }
+        let s = parse_c_str(calendar_id, "calendar id")?;
+        Calendar::from_str(s)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid calendar: {}", e)))?
     } else {
         zdt.calendar().clone()
     };
     
     let new_timezone = if !time_zone_id.is_null() {
-        match parse_c_str(time_zone_id, "timezone id") {
-            Ok(s) => match TimeZone::try_from_str(s) {
-                Ok(t) => t,
-                Err(e) => return TemporalResult::range_error(&format!("Invalid timezone: {}", e)),
-            },
-            Err(e) => return e,
-        }
+        let s = parse_c_str(time_zone_id, "timezone id")?;
+        resolve_time_zone(s)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid timezone: {}", e)))?
     } else {
         zdt.time_zone().clone()
     };
 
-    let pdt = match PlainDateTime::new(
+    let pdt = PlainDateTime::new(
         new_year, new_month, new_day, 
         new_hour, new_minute, new_second, 
         new_millisecond, new_microsecond, new_nanosecond, 
         new_calendar
-    ) {
-        Ok(d) => d,
-        Err(e) => return TemporalResult::range_error(&format!("Invalid components: {}", e)),
-    };
+    ).map_err(|e| TemporalResult::range_error(&format!("Invalid components: {}", e)))?;
     
-    match pdt.to_zoned_date_time(new_timezone, Disambiguation::Compatible) {
-        Ok(new_zdt) => match new_zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-            Ok(s) => TemporalResult::success(s),
-            Err(e) => TemporalResult::range_error(&format!("Failed to format: {}", e)),
-        },
-        Err(e) => TemporalResult::range_error(&format!("Failed to create zoned date time: {}", e)),
-    }
+    pdt.to_zoned_date_time(new_timezone, Disambiguation::Compatible)
+        .map_err(|e| TemporalResult::range_error(&format!("Failed to create zoned date time: {}", e)))
+}
+
+/// Formats a ZonedDateTime as an ISO 8601 string result.
+fn zoned_date_time_string(zdt: &ZonedDateTime) -> Result<String, TemporalResult> {
+    zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default())
+        .map_err(|e| TemporalResult::range_error(&format!("Failed to format: {}", e)))
+}
+
+fn format_zoned_date_time(zdt: &ZonedDateTime) -> TemporalResult {
+    zoned_date_time_string(zdt).map_or_else(|e| e, TemporalResult::success)
 }
 
 /// Computes difference (until).
@@ -3217,6 +4094,7 @@ pub extern "C" fn temporal_zoned_date_time_until(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_until");
     let one = match parse_zoned_date_time(one_str, "first zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3238,6 +4116,7 @@ pub extern "C" fn temporal_zoned_date_time_since(
     one_str: *const c_char,
     two_str: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_since");
     let one = match parse_zoned_date_time(one_str, "first zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3261,53 +4140,17 @@ pub extern "C" fn temporal_zoned_date_time_round(
     rounding_increment: i64,
     rounding_mode: *const c_char,
 ) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_round");
     let zdt = match parse_zoned_date_time(zdt_str, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
     };
 
-    let unit = if !smallest_unit.is_null() {
-        let s = match parse_c_str(smallest_unit, "smallest unit") {
-            Ok(s) => s,
-            Err(e) => return e,
-        };
-        match Unit::from_str(s) {
-            Ok(u) => u,
-            Err(_) => return TemporalResult::range_error(&format!("Invalid smallest unit: {}", s)),
-        }
-    } else {
-        return TemporalResult::type_error("smallestUnit is required");
-    };
-
-    let mode = if !rounding_mode.is_null() {
-        let s = match parse_c_str(rounding_mode, "rounding mode") {
-            Ok(s) => s,
-            Err(e) => return e,
-        };
-        match RoundingMode::from_str(s) {
-            Ok(m) => m,
-            Err(_) => return TemporalResult::range_error(&format!("Invalid rounding mode: {}", s)),
-        }
-    } else {
-        RoundingMode::HalfExpand
-    };
-
-    let increment = if rounding_increment > 0 {
-        rounding_increment as u32
-    } else {
-        1
-    };
-    
-    let increment_opt = match RoundingIncrement::try_new(increment) {
-        Ok(i) => i,
-        Err(e) => return TemporalResult::range_error(&format!("Invalid rounding increment: {}", e)),
+    let options = match parse_rounding_options(smallest_unit, rounding_increment, rounding_mode) {
+        Ok(o) => o,
+        Err(e) => return e,
     };
 
-    let mut options = RoundingOptions::default();
-    options.smallest_unit = Some(unit);
-    options.rounding_mode = Some(mode);
-    options.increment = Some(increment_opt);
-
     match zdt.round(options) {
         Ok(result) => match result.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
             Ok(s) => TemporalResult::success(s),
@@ -3320,6 +4163,7 @@ pub extern "C" fn temporal_zoned_date_time_round(
 /// Converts to Instant.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_to_instant(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_to_instant");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3334,6 +4178,7 @@ pub extern "C" fn temporal_zoned_date_time_to_instant(s: *const c_char) -> Tempo
 /// Converts to PlainDate.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_to_plain_date(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_to_plain_date");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3344,6 +4189,7 @@ pub extern "C" fn temporal_zoned_date_time_to_plain_date(s: *const c_char) -> Te
 /// Converts to PlainTime.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_to_plain_time(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_to_plain_time");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3357,6 +4203,7 @@ pub extern "C" fn temporal_zoned_date_time_to_plain_time(s: *const c_char) -> Te
 /// Converts to PlainDateTime.
 #[no_mangle]
 pub extern "C" fn temporal_zoned_date_time_to_plain_date_time(s: *const c_char) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_to_plain_date_time");
     let zdt = match parse_zoned_date_time(s, "zoned date time") {
         Ok(z) => z,
         Err(e) => return e,
@@ -3370,923 +4217,6934 @@ pub extern "C" fn temporal_zoned_date_time_to_plain_date_time(s: *const c_char)
 // Helper functions for ZonedDateTime/TimeZone
 fn parse_time_zone(s: *const c_char, param_name: &str) -> Result<TimeZone, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
-    TimeZone::try_from_str(str_val)
+    stats::record_parse();
+    resolve_time_zone(str_val)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid timezone '{}': {}", str_val, e)))
 }
 
 fn parse_zoned_date_time(s: *const c_char, param_name: &str) -> Result<ZonedDateTime, TemporalResult> {
     let str_val = parse_c_str(s, param_name)?;
+    stats::record_parse();
     ZonedDateTime::from_utf8(str_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject)
         .map_err(|e| TemporalResult::range_error(&format!("Invalid zoned date time '{}': {}", str_val, e)))
 }
 
-#[cfg(target_os = "android")]
-
-mod android {
-    use jni::objects::{JClass, JString};
-    use jni::sys::{jint, jlong, jlongArray, jstring};
-    use jni::JNIEnv;
+/// Builds `RoundingOptions` for `round()` from its C arguments.
+/// `smallest_unit` is required; a NULL rounding mode defaults to halfExpand.
+fn parse_rounding_options(
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+) -> Result<RoundingOptions, TemporalResult> {
+    if smallest_unit.is_null() {
+        return Err(TemporalResult::type_error("smallestUnit is required"));
+    }
+    let s = parse_c_str(smallest_unit, "smallest unit")?;
+    let unit = Unit::from_str(s)
+        .map_err(|_| TemporalResult::range_error(&format!("Invalid smallest unit: {}", s)))?;
 
-    use super::{
-        get_instant_now_string, get_now_plain_date_string, get_now_plain_date_time_string,
-        get_now_plain_time_string, get_now_zoned_date_time_string,
+    let mode = if !rounding_mode.is_null() {
+        let s = parse_c_str(rounding_mode, "rounding mode")?;
+        RoundingMode::from_str(s)
+            .map_err(|_| TemporalResult::range_error(&format!("Invalid rounding mode: {}", s)))?
+    } else {
+        RoundingMode::HalfExpand
     };
-    use temporal_rs::{
-        options::{DisplayCalendar, ToStringRoundingOptions, Overflow, DisplayOffset, DisplayTimeZone, Disambiguation, OffsetDisambiguation, Unit, RoundingMode, RoundingIncrement, RoundingOptions},
-        provider::{TransitionDirection, TimeZoneProvider, COMPILED_TZ_PROVIDER},
-        Calendar, Duration, Instant, PlainDate, PlainDateTime, PlainMonthDay, PlainTime,
-        PlainYearMonth, TimeZone, ZonedDateTime, TemporalError,
+
+    let increment = if rounding_increment > 0 {
+        rounding_increment as u32
+    } else {
+        1
     };
-    use std::str::FromStr;
-    use std::ptr;
+    let increment_opt = RoundingIncrement::try_new(increment)
+        .map_err(|e| TemporalResult::range_error(&format!("Invalid rounding increment: {}", e)))?;
 
+    let mut options = RoundingOptions::default();
+    options.smallest_unit = Some(unit);
+    options.rounding_mode = Some(mode);
+    options.increment = Some(increment_opt);
+    Ok(options)
+}
 
-    
-    const RANGE_ERROR_CLASS: &str = "java/lang/RuntimeException";
-    const TYPE_ERROR_CLASS: &str = "java/lang/RuntimeException";
+// ============================================================================
+// Handle API
+// ============================================================================
+//
+// Handles keep a parsed Temporal value in native memory so that chained
+// operations (`add().with().round()`) never re-parse or re-format ISO strings.
+// A string is only produced when `temporal_handle_to_string` is called.
+//
+// Handles cross the bridges as plain numbers, so a released or made-up one
+// can come back at any time. Every live handle's address is registered, and
+// the accessors return a TypeError for any other pointer instead of
+// dereferencing it. A stale number whose address was reused by a newer
+// handle reaches that handle, which is wrong but memory-safe.
+//
+// A handle is reference counted. The live set holds one reference until
+// release, and each call takes its own under the shard lock, so a release on
+// another thread never frees a value that is still being read.
+
+/// Kind of value held by a TemporalHandle.
+#[repr(i32)]
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub enum TemporalHandleKind {
+    Instant = 1,
+    PlainDateTime = 2,
+    ZonedDateTime = 3,
+    Duration = 4,
+    ZonedDateTimeRange = 5,
+    InstantColumn = 6,
+    PlainDateColumn = 7,
+    ZonedClock = 8,
+}
 
-    /// Throws a RangeError exception
-    fn throw_range_error(env: &mut JNIEnv, message: &str) {
-        let _ = env.throw_new(RANGE_ERROR_CLASS, &format!("[RangeError] {}", message));
+/// Opaque, heap-allocated Temporal value.
+pub enum TemporalHandle {
+    Instant(Instant),
+    PlainDateTime(PlainDateTime),
+    ZonedDateTime(ZonedDateTime),
+    Duration(Duration),
+    ZonedDateTimeRange(Mutex<ZonedDateTimeRange>),
+    InstantColumn(Column<i128>),
+    PlainDateColumn(Column<i32>),
+    ZonedClock(Mutex<ZonedClock>),
+}
+
+impl TemporalHandle {
+    fn kind(&self) -> TemporalHandleKind {
+        match self {
+            TemporalHandle::Instant(_) => TemporalHandleKind::Instant,
+            TemporalHandle::PlainDateTime(_) => TemporalHandleKind::PlainDateTime,
+            TemporalHandle::ZonedDateTime(_) => TemporalHandleKind::ZonedDateTime,
+            TemporalHandle::Duration(_) => TemporalHandleKind::Duration,
+            TemporalHandle::ZonedDateTimeRange(_) => TemporalHandleKind::ZonedDateTimeRange,
+            TemporalHandle::InstantColumn(_) => TemporalHandleKind::InstantColumn,
+            TemporalHandle::PlainDateColumn(_) => TemporalHandleKind::PlainDateColumn,
+            TemporalHandle::ZonedClock(_) => TemporalHandleKind::ZonedClock,
+        }
     }
+}
 
-    /// Throws a TypeError exception
-    fn throw_type_error(env: &mut JNIEnv, message: &str) {
-        let _ = env.throw_new(TYPE_ERROR_CLASS, &format!("[TypeError] {}", message));
+/// Result structure for operations that produce a handle.
+#[repr(C)]
+pub struct HandleResult {
+    /// The new handle (NULL if error). Caller must release with temporal_handle_release.
+    pub handle: *mut TemporalHandle,
+    /// Error type (0 = success)
+    pub error_type: i32,
+    /// Error message (NULL if success)
+    pub error_message: *mut c_char,
+}
+
+/// Live handles, sharded by address so threads working on different handles
+/// rarely share a lock.
+const LIVE_HANDLE_SHARDS: usize = 16;
+
+/// Heap addresses are already well spread; a multiply mixes in the high bits.
+#[derive(Default)]
+struct AddressHasher(u64);
+
+impl Hasher for AddressHasher {
+    fn finish(&self) -> u64 {
+        self.0
     }
 
-    /// Parses a JNI string, throwing TypeError if null or invalid
-    fn parse_jstring(env: &mut JNIEnv, s: &JString, name: &str) -> Option<String> {
-        if s.is_null() {
-            throw_type_error(env, &format!("{} cannot be null", name));
-            return None;
-        }
-        match env.get_string(s) {
-            Ok(js) => Some(js.to_string_lossy().into_owned()),
-            Err(_) => {
-                throw_type_error(env, &format!("Invalid UTF-8 in {}", name));
-                None
-            }
+    fn write(&mut self, bytes: &[u8]) {
+        for &b in bytes {
+            self.0 = ((self.0 << 8) | b as u64).wrapping_mul(0x9E37_79B9_7F4A_7C15);
         }
     }
 
-    /// Parses a duration string, throwing RangeError if invalid
-    fn parse_duration(env: &mut JNIEnv, s: &JString, name: &str) -> Option<Duration> {
-        let s_str = parse_jstring(env, s, name)?;
-        match Duration::from_str(&s_str) {
-            Ok(d) => Some(d),
-            Err(e) => {
-                throw_range_error(env, &format!("Invalid duration '{}': {}", s_str, e));
-                None
-            }
-        }
+    fn write_usize(&mut self, n: usize) {
+        self.0 = (n as u64).wrapping_mul(0x9E37_79B9_7F4A_7C15);
     }
+}
 
-    /// Parses an instant string, throwing RangeError if invalid
-    fn parse_instant(env: &mut JNIEnv, s: &JString, name: &str) -> Option<Instant> {
-        let s_str = parse_jstring(env, s, name)?;
-        match Instant::from_str(&s_str) {
-            Ok(i) => Some(i),
-            Err(e) => {
-                throw_range_error(env, &format!("Invalid instant '{}': {}", s_str, e));
-                None
-            }
-        }
+type LiveHandleShard = RwLock<HashSet<usize, BuildHasherDefault<AddressHasher>>>;
+
+fn live_handle_shard(handle: *const TemporalHandle) -> &'static LiveHandleShard {
+    static SHARDS: OnceLock<[LiveHandleShard; LIVE_HANDLE_SHARDS]> = OnceLock::new();
+    let shards = SHARDS.get_or_init(|| std::array::from_fn(|_| RwLock::default()));
+    // Skip the alignment bits, which are the same for every handle.
+    &shards[(handle as usize >> 4) % LIVE_HANDLE_SHARDS]
+}
+
+fn register_handle(value: TemporalHandle) -> *mut TemporalHandle {
+    let handle = Arc::into_raw(Arc::new(value)) as *mut TemporalHandle;
+    live_handle_shard(handle).write().unwrap_or_else(PoisonError::into_inner).insert(handle as usize);
+    handle
+}
+
+/// Removes `handle` from the live set; false if it wasn't there.
+fn unregister_handle(handle: *const TemporalHandle) -> bool {
+    live_handle_shard(handle).write().unwrap_or_else(PoisonError::into_inner).remove(&(handle as usize))
+}
+
+/// Takes a reference to a live handle; None if `handle` is not live.
+fn acquire_handle(handle: *const TemporalHandle) -> Option<Arc<TemporalHandle>> {
+    let live = live_handle_shard(handle).read().unwrap_or_else(PoisonError::into_inner);
+    if !live.contains(&(handle as usize)) {
+        return None;
+    }
+    // Release removes the address under the write lock before dropping the
+    // live set's reference, so the count is at least one here.
+    unsafe {
+        Arc::increment_strong_count(handle);
+        Some(Arc::from_raw(handle))
     }
+}
 
-    /// JNI function for `com.temporal.TemporalNative.instantNow()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantNow(
-        mut env: JNIEnv,
-        _class: JClass,
-    ) -> jstring {
-        match get_instant_now_string() {
-            Ok(s) => env
-                .new_string(s)
-                .map(|js| js.into_raw())
-                .unwrap_or_else(|_| {
-                    throw_range_error(&mut env, "Failed to create string");
-                    ptr::null_mut()
-                }),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get current instant: {}", e));
-                ptr::null_mut()
-            }
+/// Part of a handle, kept alive for as long as the guard is held.
+struct HandleRef<T> {
+    value: *const T,
+    _owner: Arc<TemporalHandle>,
+}
+
+impl<T> Deref for HandleRef<T> {
+    type Target = T;
+
+    fn deref(&self) -> &T {
+        unsafe { &*self.value }
+    }
+}
+
+impl HandleRef<TemporalHandle> {
+    /// Narrows the guard to the part of the handle `part` picks, or returns a
+    /// TypeError with `error` if it picks none.
+    fn project<T>(self, part: fn(&TemporalHandle) -> Option<&T>, error: &str) -> Result<HandleRef<T>, TemporalResult> {
+        match part(&self).map(|v| v as *const T) {
+            Some(value) => Ok(HandleRef { value, _owner: self._owner }),
+            None => Err(TemporalResult::type_error(error)),
         }
     }
+}
 
-    /// JNI function for `com.temporal.TemporalNative.instantFromString()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantFromString(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let instant = match parse_instant(&mut env, &s, "instant string") {
-            Some(i) => i,
-            None => return ptr::null_mut(),
-        };
-        let provider = &*COMPILED_TZ_PROVIDER;
-        match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-            Ok(s) => env
-                .new_string(s)
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                ptr::null_mut()
-            }
+impl HandleResult {
+    fn success(value: TemporalHandle) -> Self {
+        Self {
+            handle: register_handle(value),
+            error_type: TemporalErrorType::None as i32,
+            error_message: ptr::null_mut(),
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantFromEpochMilliseconds()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantFromEpochMilliseconds(
-        mut env: JNIEnv,
-        _class: JClass,
-        ms: jlong,
-    ) -> jstring {
-        let ns = (ms as i128).saturating_mul(1_000_000);
-        match Instant::try_new(ns) {
-            Ok(instant) => {
-                let provider = &*COMPILED_TZ_PROVIDER;
-                match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env
-                        .new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid epoch milliseconds: {}", e));
-                ptr::null_mut()
-            }
+    fn range_error(message: &str) -> Self {
+        Self::from_error(TemporalResult::range_error(message))
+    }
+
+    /// Moves the error out of a failed TemporalResult without copying the message.
+    fn from_error(result: TemporalResult) -> Self {
+        Self {
+            handle: ptr::null_mut(),
+            error_type: result.error_type,
+            error_message: result.error_message,
         }
     }
+}
 
-    /// JNI function for `com.temporal.TemporalNative.instantFromEpochNanoseconds()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantFromEpochNanoseconds(
-        mut env: JNIEnv,
-        _class: JClass,
-        ns_str: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &ns_str, "nanoseconds string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        
-        let ns = match i128::from_str(&s_val) {
-            Ok(n) => n,
+/// Frees a HandleResult's error message. The handle itself is not released.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_free_handle_result(result: *mut HandleResult) {
+    if result.is_null() {
+        return;
+    }
+    let r = &mut *result;
+    if !r.error_message.is_null() {
+        drop(CString::from_raw(r.error_message));
+        r.error_message = ptr::null_mut();
+    }
+}
+
+/// Releases a handle and returns a TemporalErrorType. Passing NULL is a
+/// no-op; a handle that was already released or never issued is left alone
+/// and reported as a TypeError, with the message in
+/// `temporal_last_error_message`. A call still using the handle on another
+/// thread keeps its value alive until that call returns.
+///
+/// # Safety
+/// `handle` is only compared against the live set, never dereferenced
+/// unless it is live.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_handle_release(handle: *mut TemporalHandle) -> i32 {
+    stats_scope!("temporal_handle_release");
+    if handle.is_null() {
+        return TemporalErrorType::None as i32;
+    }
+    if !unregister_handle(handle) {
+        return record_error(TemporalResult::type_error("Invalid or released handle"));
+    }
+    drop(Arc::from_raw(handle));
+    TemporalErrorType::None as i32
+}
+
+/// Returns the TemporalHandleKind of a handle, or 0 for NULL or a handle
+/// that is not live.
+#[no_mangle]
+pub extern "C" fn temporal_handle_kind(handle: *const TemporalHandle) -> i32 {
+    stats_scope!("temporal_handle_kind");
+    acquire_handle(handle).map_or(0, |h| h.kind() as i32)
+}
+
+/// Formats the value held by a handle as an ISO 8601 string.
+#[no_mangle]
+pub extern "C" fn temporal_handle_to_string(handle: *const TemporalHandle) -> TemporalResult {
+    stats_scope!("temporal_handle_to_string");
+    handle_formatted(handle).map_or_else(|e| e, Formatted::into_result)
+}
+
+/// Compares two handles of the same kind. Returns -1, 0, or 1.
+/// Durations are not comparable without relativeTo and return a RangeError.
+#[no_mangle]
+pub extern "C" fn temporal_handle_compare(a: *const TemporalHandle, b: *const TemporalHandle) -> CompareResult {
+    stats_scope!("temporal_handle_compare");
+    if a.is_null() || b.is_null() {
+        return CompareResult::type_error("Handle cannot be null");
+    }
+    let (a, b) = match (acquire_handle(a), acquire_handle(b)) {
+        (Some(a), Some(b)) => (a, b),
+        _ => return CompareResult::type_error("Invalid or released handle"),
+    };
+    match (&*a, &*b) {
+        (TemporalHandle::Instant(x), TemporalHandle::Instant(y)) => CompareResult::success(x.cmp(y) as i32),
+        (TemporalHandle::PlainDateTime(x), TemporalHandle::PlainDateTime(y)) => CompareResult::success(x.compare_iso(y) as i32),
+        (TemporalHandle::ZonedDateTime(x), TemporalHandle::ZonedDateTime(y)) => {
+            CompareResult::success(x.epoch_nanoseconds().0.cmp(&y.epoch_nanoseconds().0) as i32)
+        }
+        (TemporalHandle::Duration(_), TemporalHandle::Duration(_)) => {
+            CompareResult::range_error("Comparing duration handles requires a relativeTo option (not yet supported)")
+        }
+        (TemporalHandle::ZonedDateTimeRange(_), TemporalHandle::ZonedDateTimeRange(_)) => {
+            CompareResult::type_error("Range handles are not comparable")
+        }
+        (TemporalHandle::InstantColumn(_), TemporalHandle::InstantColumn(_))
+        | (TemporalHandle::PlainDateColumn(_), TemporalHandle::PlainDateColumn(_)) => {
+            CompareResult::type_error("Column handles are not comparable")
+        }
+        (TemporalHandle::ZonedClock(_), TemporalHandle::ZonedClock(_)) => {
+            CompareResult::type_error("Clock handles are not comparable")
+        }
+        _ => CompareResult::type_error("Cannot compare handles of different kinds"),
+    }
+}
+
+/// Parses an ISO 8601 string into an Instant handle.
+#[no_mangle]
+pub extern "C" fn temporal_instant_handle_from_string(s: *const c_char) -> HandleResult {
+    stats_scope!("temporal_instant_handle_from_string");
+    match parse_instant(s, "instant string") {
+        Ok(i) => HandleResult::success(TemporalHandle::Instant(i)),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Parses an ISO 8601 string into a PlainDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_handle_from_string(s: *const c_char) -> HandleResult {
+    stats_scope!("temporal_plain_date_time_handle_from_string");
+    match parse_plain_date_time(s, "plain date time string") {
+        Ok(dt) => HandleResult::success(TemporalHandle::PlainDateTime(dt)),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Parses an ISO 8601 string into a ZonedDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_handle_from_string(s: *const c_char) -> HandleResult {
+    stats_scope!("temporal_zoned_date_time_handle_from_string");
+    match parse_zoned_date_time(s, "zoned date time string") {
+        Ok(zdt) => HandleResult::success(TemporalHandle::ZonedDateTime(zdt)),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Parses an ISO 8601 duration string into a Duration handle.
+#[no_mangle]
+pub extern "C" fn temporal_duration_handle_from_string(s: *const c_char) -> HandleResult {
+    stats_scope!("temporal_duration_handle_from_string");
+    match parse_duration(s, "duration string") {
+        Ok(d) => HandleResult::success(TemporalHandle::Duration(d)),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Adds a Duration handle to an Instant handle.
+#[no_mangle]
+pub extern "C" fn temporal_instant_handle_add(handle: *const TemporalHandle, duration: *const TemporalHandle) -> HandleResult {
+    stats_scope!("temporal_instant_handle_add");
+    let instant = match instant_handle(handle) {
+        Ok(v) => v,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let duration = match duration_handle(duration) {
+        Ok(d) => d,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match instant.add(&duration) {
+        Ok(result) => HandleResult::success(TemporalHandle::Instant(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to add duration: {}", e)),
+    }
+}
+
+/// Subtracts a Duration handle from an Instant handle.
+#[no_mangle]
+pub extern "C" fn temporal_instant_handle_subtract(handle: *const TemporalHandle, duration: *const TemporalHandle) -> HandleResult {
+    stats_scope!("temporal_instant_handle_subtract");
+    let instant = match instant_handle(handle) {
+        Ok(v) => v,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let duration = match duration_handle(duration) {
+        Ok(d) => d,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match instant.subtract(&duration) {
+        Ok(result) => HandleResult::success(TemporalHandle::Instant(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to subtract duration: {}", e)),
+    }
+}
+
+/// Rounds an Instant handle.
+#[no_mangle]
+pub extern "C" fn temporal_instant_handle_round(
+    handle: *const TemporalHandle,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+) -> HandleResult {
+    stats_scope!("temporal_instant_handle_round");
+    let instant = match instant_handle(handle) {
+        Ok(i) => i,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let options = match parse_rounding_options(smallest_unit, rounding_increment, rounding_mode) {
+        Ok(o) => o,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match instant.round(options) {
+        Ok(result) => HandleResult::success(TemporalHandle::Instant(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to round: {}", e)),
+    }
+}
+
+/// Adds a Duration handle to a PlainDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_handle_add(handle: *const TemporalHandle, duration: *const TemporalHandle) -> HandleResult {
+    stats_scope!("temporal_plain_date_time_handle_add");
+    let dt = match plain_date_time_handle(handle) {
+        Ok(v) => v,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let duration = match duration_handle(duration) {
+        Ok(d) => d,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match dt.add(&duration, None) {
+        Ok(result) => HandleResult::success(TemporalHandle::PlainDateTime(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to add duration: {}", e)),
+    }
+}
+
+/// Subtracts a Duration handle from a PlainDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_handle_subtract(handle: *const TemporalHandle, duration: *const TemporalHandle) -> HandleResult {
+    stats_scope!("temporal_plain_date_time_handle_subtract");
+    let dt = match plain_date_time_handle(handle) {
+        Ok(v) => v,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let duration = match duration_handle(duration) {
+        Ok(d) => d,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match dt.subtract(&duration, None) {
+        Ok(result) => HandleResult::success(TemporalHandle::PlainDateTime(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to subtract duration: {}", e)),
+    }
+}
+
+/// Returns a new PlainDateTime handle with updated fields.
+/// Pass i32::MIN for fields that should not be changed.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_handle_with(
+    handle: *const TemporalHandle,
+    year: i32,
+    month: i32,
+    day: i32,
+    hour: i32,
+    minute: i32,
+    second: i32,
+    millisecond: i32,
+    microsecond: i32,
+    nanosecond: i32,
+    calendar_id: *const c_char,
+) -> HandleResult {
+    stats_scope!("temporal_plain_date_time_handle_with");
+    let dt = match plain_date_time_handle(handle) {
+        Ok(dt) => dt,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match plain_date_time_with_fields(&dt, year, month, day, hour, minute, second, millisecond, microsecond, nanosecond, calendar_id) {
+        Ok(result) => HandleResult::success(TemporalHandle::PlainDateTime(result)),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Gets all component values from a PlainDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_handle_get_components(
+    handle: *const TemporalHandle,
+    out: *mut PlainDateTimeComponents,
+) {
+    stats_scope!("temporal_plain_date_time_handle_get_components");
+    if out.is_null() {
+        return;
+    }
+    unsafe { *out = PlainDateTimeComponents::default(); }
+
+    if let Ok(dt) = plain_date_time_handle(handle) {
+        unsafe { fill_plain_date_time_components(&dt, &mut *out) };
+    }
+}
+
+/// Adds a Duration handle to a ZonedDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_handle_add(handle: *const TemporalHandle, duration: *const TemporalHandle) -> HandleResult {
+    stats_scope!("temporal_zoned_date_time_handle_add");
+    let zdt = match zoned_date_time_handle(handle) {
+        Ok(v) => v,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let duration = match duration_handle(duration) {
+        Ok(d) => d,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match zdt.add(&duration, Some(Overflow::Reject)) {
+        Ok(result) => HandleResult::success(TemporalHandle::ZonedDateTime(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to add duration: {}", e)),
+    }
+}
+
+/// Subtracts a Duration handle from a ZonedDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_handle_subtract(handle: *const TemporalHandle, duration: *const TemporalHandle) -> HandleResult {
+    stats_scope!("temporal_zoned_date_time_handle_subtract");
+    let zdt = match zoned_date_time_handle(handle) {
+        Ok(v) => v,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let duration = match duration_handle(duration) {
+        Ok(d) => d,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match zdt.subtract(&duration, Some(Overflow::Reject)) {
+        Ok(result) => HandleResult::success(TemporalHandle::ZonedDateTime(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to subtract duration: {}", e)),
+    }
+}
+
+/// Rounds a ZonedDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_handle_round(
+    handle: *const TemporalHandle,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+) -> HandleResult {
+    stats_scope!("temporal_zoned_date_time_handle_round");
+    let zdt = match zoned_date_time_handle(handle) {
+        Ok(z) => z,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let options = match parse_rounding_options(smallest_unit, rounding_increment, rounding_mode) {
+        Ok(o) => o,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match zdt.round(options) {
+        Ok(result) => HandleResult::success(TemporalHandle::ZonedDateTime(result)),
+        Err(e) => HandleResult::range_error(&format!("Failed to round: {}", e)),
+    }
+}
+
+/// Returns a new ZonedDateTime handle with updated fields.
+/// Pass i32::MIN for fields that should not be changed, NULL to keep the calendar or time zone.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_handle_with(
+    handle: *const TemporalHandle,
+    year: i32,
+    month: i32,
+    day: i32,
+    hour: i32,
+    minute: i32,
+    second: i32,
+    millisecond: i32,
+    microsecond: i32,
+    nanosecond: i32,
+    calendar_id: *const c_char,
+    time_zone_id: *const c_char,
+) -> HandleResult {
+    stats_scope!("temporal_zoned_date_time_handle_with");
+    let zdt = match zoned_date_time_handle(handle) {
+        Ok(z) => z,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    match zoned_date_time_with_fields(&zdt, year, month, day, hour, minute, second, millisecond, microsecond, nanosecond, calendar_id, time_zone_id) {
+        Ok(result) => HandleResult::success(TemporalHandle::ZonedDateTime(result)),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Gets all component values from a ZonedDateTime handle.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_handle_get_components(
+    handle: *const TemporalHandle,
+    out: *mut ZonedDateTimeComponents,
+) {
+    stats_scope!("temporal_zoned_date_time_handle_get_components");
+    if out.is_null() {
+        return;
+    }
+    unsafe { *out = ZonedDateTimeComponents::default(); }
+
+    if let Ok(zdt) = zoned_date_time_handle(handle) {
+        unsafe { fill_zoned_date_time_components(&zdt, &mut *out) };
+    }
+}
+
+// Helper functions for handles
+
+fn handle_ref(handle: *const TemporalHandle, param_name: &str) -> Result<HandleRef<TemporalHandle>, TemporalResult> {
+    if handle.is_null() {
+        return Err(TemporalResult::type_error(&format!("{} handle cannot be null", param_name)));
+    }
+    match acquire_handle(handle) {
+        Some(owner) => Ok(HandleRef { value: Arc::as_ptr(&owner), _owner: owner }),
+        None => Err(TemporalResult::type_error(&format!("Invalid or released {} handle", param_name))),
+    }
+}
+
+fn instant_handle(handle: *const TemporalHandle) -> Result<HandleRef<Instant>, TemporalResult> {
+    handle_ref(handle, "instant")?.project(
+        |h| match h {
+            TemporalHandle::Instant(i) => Some(i),
+            _ => None,
+        },
+        "Handle is not an Instant",
+    )
+}
+
+fn plain_date_time_handle(handle: *const TemporalHandle) -> Result<HandleRef<PlainDateTime>, TemporalResult> {
+    handle_ref(handle, "plain date time")?.project(
+        |h| match h {
+            TemporalHandle::PlainDateTime(dt) => Some(dt),
+            _ => None,
+        },
+        "Handle is not a PlainDateTime",
+    )
+}
+
+fn zoned_date_time_handle(handle: *const TemporalHandle) -> Result<HandleRef<ZonedDateTime>, TemporalResult> {
+    handle_ref(handle, "zoned date time")?.project(
+        |h| match h {
+            TemporalHandle::ZonedDateTime(zdt) => Some(zdt),
+            _ => None,
+        },
+        "Handle is not a ZonedDateTime",
+    )
+}
+
+fn duration_handle(handle: *const TemporalHandle) -> Result<HandleRef<Duration>, TemporalResult> {
+    handle_ref(handle, "duration")?.project(
+        |h| match h {
+            TemporalHandle::Duration(d) => Some(d),
+            _ => None,
+        },
+        "Handle is not a Duration",
+    )
+}
+
+/// Formats an Instant as an ISO 8601 string result.
+fn format_instant(instant: &Instant) -> TemporalResult {
+    instant_formatted(instant).map_or_else(|e| e, Formatted::into_result)
+}
+
+fn fill_plain_time_components(time: &PlainTime, out: &mut PlainTimeComponents) {
+    out.hour = time.hour();
+    out.minute = time.minute();
+    out.second = time.second();
+    out.millisecond = time.millisecond();
+    out.microsecond = time.microsecond();
+    out.nanosecond = time.nanosecond();
+    out.is_valid = 1;
+}
+
+fn fill_plain_date_components(date: &PlainDate, out: &mut PlainDateComponents) {
+    out.year = date.year();
+    out.month = date.month();
+    out.day = date.day();
+    out.day_of_week = date.day_of_week();
+    out.day_of_year = date.day_of_year();
+    out.week_of_year = date.week_of_year().unwrap_or(0) as u16;
+    out.year_of_week = date.year_of_week().unwrap_or(0);
+    out.days_in_week = date.days_in_week();
+    out.days_in_month = date.days_in_month();
+    out.days_in_year = date.days_in_year();
+    out.months_in_year = date.months_in_year();
+    out.in_leap_year = if date.in_leap_year() { 1 } else { 0 };
+    out.is_valid = 1;
+}
+
+fn fill_plain_date_time_components(dt: &PlainDateTime, out: &mut PlainDateTimeComponents) {
+    out.year = dt.year();
+    out.month = dt.month();
+    out.day = dt.day();
+    out.day_of_week = dt.day_of_week();
+    out.day_of_year = dt.day_of_year();
+    out.week_of_year = dt.week_of_year().unwrap_or(0) as u16;
+    out.year_of_week = dt.year_of_week().unwrap_or(0);
+    out.days_in_week = dt.days_in_week();
+    out.days_in_month = dt.days_in_month();
+    out.days_in_year = dt.days_in_year();
+    out.months_in_year = dt.months_in_year();
+    out.in_leap_year = if dt.in_leap_year() { 1 } else { 0 };
+    out.hour = dt.hour();
+    out.minute = dt.minute();
+    out.second = dt.second();
+    out.millisecond = dt.millisecond();
+    out.microsecond = dt.microsecond();
+    out.nanosecond = dt.nanosecond();
+    out.is_valid = 1;
+}
+
+fn fill_zoned_date_time_components(zdt: &ZonedDateTime, out: &mut ZonedDateTimeComponents) {
+    out.year = zdt.year();
+    out.month = zdt.month();
+    out.day = zdt.day();
+    out.day_of_week = zdt.day_of_week();
+    out.day_of_year = zdt.day_of_year();
+    out.week_of_year = zdt.week_of_year().unwrap_or(0) as u16;
+    out.year_of_week = zdt.year_of_week().unwrap_or(0);
+    out.days_in_week = zdt.days_in_week();
+    out.days_in_month = zdt.days_in_month();
+    out.days_in_year = zdt.days_in_year();
+    out.months_in_year = zdt.months_in_year();
+    out.in_leap_year = if zdt.in_leap_year() { 1 } else { 0 };
+    out.hour = zdt.hour();
+    out.minute = zdt.minute();
+    out.second = zdt.second();
+    out.millisecond = zdt.millisecond();
+    out.microsecond = zdt.microsecond();
+    out.nanosecond = zdt.nanosecond();
+    out.offset_nanoseconds = zdt.offset_nanoseconds() as i64;
+    out.is_valid = 1;
+}
+
+// ============================================================================
+// Batch API
+// ============================================================================
+
+/// Epoch nanoseconds split into floored whole seconds and a nanosecond
+/// remainder in [0, 1e9), so keys fit in two machine words and order the same
+/// way as the underlying i128.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, PartialOrd, Ord)]
+pub struct TemporalEpochNanoseconds {
+    pub seconds: i64,
+    pub nanoseconds: i32,
+}
+
+impl TemporalEpochNanoseconds {
+    fn from_i128(ns: i128) -> Self {
+        Self {
+            seconds: ns.div_euclid(1_000_000_000) as i64,
+            nanoseconds: ns.rem_euclid(1_000_000_000) as i32,
+        }
+    }
+}
+
+/// Result structure for batch operations writing into caller-provided buffers
+#[repr(C)]
+pub struct BatchResult {
+    /// Number of elements written to the output buffer
+    pub count: i32,
+    /// Index of the first input that failed (-1 if none or not item-specific)
+    pub error_index: i32,
+    /// Error type (0 = success)
+    pub error_type: i32,
+    /// Error message (NULL if success)
+    pub error_message: *mut c_char,
+}
+
+impl BatchResult {
+    fn success(count: usize) -> Self {
+        Self {
+            count: count as i32,
+            error_index: -1,
+            error_type: TemporalErrorType::None as i32,
+            error_message: ptr::null_mut(),
+        }
+    }
+
+    /// Takes ownership of the error in `result`, prefixing the message with the item index.
+    fn from_error(index: i32, mut result: TemporalResult) -> Self {
+        let error_type = result.error_type;
+        let message = if result.error_message.is_null() {
+            "Unknown error".to_string()
+        } else {
+            unsafe { CString::from_raw(result.error_message) }
+                .to_string_lossy()
+                .into_owned()
+        };
+        result.error_message = ptr::null_mut();
+        unsafe { temporal_free_result(&mut result) };
+
+        let message = if index >= 0 {
+            format!("Item {}: {}", index, message)
+        } else {
+            message
+        };
+        Self {
+            count: 0,
+            error_index: index,
+            error_type,
+            error_message: CString::new(message)
+                .map(|s| s.into_raw())
+                .unwrap_or(ptr::null_mut()),
+        }
+    }
+}
+
+/// Frees a BatchResult's error message.
+#[no_mangle]
+pub unsafe extern "C" fn temporal_free_batch_result(result: *mut BatchResult) {
+    if result.is_null() {
+        return;
+    }
+    let r = &mut *result;
+    if !r.error_message.is_null() {
+        drop(CString::from_raw(r.error_message));
+        r.error_message = ptr::null_mut();
+    }
+}
+
+/// Batches shorter than this run on the calling thread; below it, waking
+/// helpers costs more than the parsing and time zone math it would spread.
+const PARALLEL_BATCH_THRESHOLD: usize = 4096;
+
+/// Smallest number of items a worker claims at once.
+const PARALLEL_BATCH_MIN_CHUNK: usize = 512;
+
+/// Upper bound for `temporal_set_batch_threads`.
+pub const MAX_BATCH_THREADS: i32 = 16;
+
+/// Threads batch entry points may use, 0 meaning the default.
+static BATCH_THREADS: AtomicUsize = AtomicUsize::new(0);
+
+/// Number of performance cores: `hw.perflevel0` is the fastest level on
+/// Apple silicon, and equals every core on chips with a single level.
+#[cfg(target_vendor = "apple")]
+fn performance_core_count() -> Option<usize> {
+    extern "C" {
+        fn sysctlbyname(
+            name: *const c_char,
+            oldp: *mut std::ffi::c_void,
+            oldlenp: *mut usize,
+            newp: *mut std::ffi::c_void,
+            newlen: usize,
+        ) -> i32;
+    }
+    let mut value: i32 = 0;
+    let mut len = std::mem::size_of::<i32>();
+    let name = b"hw.perflevel0.logicalcpu\0";
+    let status = unsafe {
+        sysctlbyname(
+            name.as_ptr() as *const c_char,
+            &mut value as *mut i32 as *mut std::ffi::c_void,
+            &mut len,
+            ptr::null_mut(),
+            0,
+        )
+    };
+    (status == 0 && value > 0).then_some(value as usize)
+}
+
+/// Number of performance cores: on big.LITTLE designs the efficiency cluster
+/// reports the lowest maximum frequency, so every faster core counts.
+#[cfg(any(target_os = "android", target_os = "linux"))]
+fn performance_core_count() -> Option<usize> {
+    let cores = std::thread::available_parallelism().ok()?.get();
+    let frequencies: Vec<u64> = (0..cores)
+        .filter_map(|cpu| {
+            let path = format!("/sys/devices/system/cpu/cpu{}/cpufreq/cpuinfo_max_freq", cpu);
+            std::fs::read_to_string(path).ok()?.trim().parse().ok()
+        })
+        .collect();
+    let slowest = *frequencies.iter().min()?;
+    match frequencies.iter().filter(|&&f| f > slowest).count() {
+        0 => Some(frequencies.len()),
+        faster => Some(faster),
+    }
+}
+
+#[cfg(not(any(target_vendor = "apple", target_os = "android", target_os = "linux")))]
+fn performance_core_count() -> Option<usize> {
+    None
+}
+
+fn default_batch_threads() -> usize {
+    static DEFAULT: OnceLock<usize> = OnceLock::new();
+    *DEFAULT.get_or_init(|| {
+        performance_core_count()
+            .or_else(|| std::thread::available_parallelism().ok().map(|n| n.get()))
+            .unwrap_or(1)
+            .clamp(1, MAX_BATCH_THREADS as usize)
+    })
+}
+
+fn batch_threads() -> usize {
+    match BATCH_THREADS.load(Ordering::Relaxed) {
+        0 => default_batch_threads(),
+        n => n,
+    }
+}
+
+/// Sets how many threads batch entry points (parse, sort and compare many,
+/// to-bytes many, plain date-times for many, recurrence expansion) may use.
+/// 0 restores the default, the device's performance cores; 1 keeps every
+/// batch on the calling thread. Helper threads are started as batches first
+/// need them and then kept, so lowering the count leaves some of them idle.
+/// Returns a `TemporalErrorType`.
+#[no_mangle]
+pub extern "C" fn temporal_set_batch_threads(threads: i32) -> i32 {
+    stats_scope!("temporal_set_batch_threads");
+    if !(0..=MAX_BATCH_THREADS).contains(&threads) {
+        return record_error(TemporalResult::range_error(&format!(
+            "Batch threads must be between 0 and {}",
+            MAX_BATCH_THREADS
+        )));
+    }
+    BATCH_THREADS.store(threads as usize, Ordering::Relaxed);
+    TemporalErrorType::None as i32
+}
+
+/// Returns the number of threads large batches run on.
+#[no_mangle]
+pub extern "C" fn temporal_get_batch_threads() -> i32 {
+    stats_scope!("temporal_get_batch_threads");
+    batch_threads() as i32
+}
+
+/// A borrowed C array of strings that batch workers read concurrently. The
+/// strings are only read while the batch call that lent them is running.
+#[derive(Clone, Copy)]
+struct SharedInputs<'a, T>(&'a [T]);
+
+unsafe impl<T> Send for SharedInputs<'_, T> {}
+unsafe impl<T> Sync for SharedInputs<'_, T> {}
+
+impl<T: Copy> SharedInputs<'_, T> {
+    fn len(self) -> usize {
+        self.0.len()
+    }
+
+    fn get(self, i: usize) -> T {
+        self.0[i]
+    }
+}
+
+/// An item's error, moved from the worker that hit it to the caller.
+struct BatchFailure(usize, TemporalResult);
+
+unsafe impl Send for BatchFailure {}
+
+impl BatchFailure {
+    fn free(mut self) {
+        unsafe { temporal_free_result(&mut self.1) };
+    }
+}
+
+/// Helper threads for batch_map, started as batches first need them and kept
+/// for later ones. One batch uses them at a time; a batch that finds them
+/// busy runs on its calling thread alone.
+struct BatchPool {
+    busy: Mutex<()>,
+    state: Mutex<BatchPoolState>,
+    /// Wakes helpers when a job is posted.
+    posted: Condvar,
+    /// Wakes the poster when the last helper leaves its job.
+    finished: Condvar,
+}
+
+#[derive(Default)]
+struct BatchPoolState {
+    job: Option<BatchJob>,
+    /// Helpers that may still join the posted job.
+    seats: usize,
+    /// Helpers running the posted job.
+    running: usize,
+    started: usize,
+    panic: Option<Box<dyn Any + Send>>,
+}
+
+/// The posted job with its lifetime erased. `BatchPool::run` doesn't return
+/// while a helper is running it or can still join it.
+#[derive(Clone, Copy)]
+struct BatchJob(*const (dyn Fn() + Sync));
+
+unsafe impl Send for BatchJob {}
+
+impl BatchPool {
+    fn get() -> &'static BatchPool {
+        static POOL: OnceLock<BatchPool> = OnceLock::new();
+        POOL.get_or_init(|| BatchPool {
+            busy: Mutex::new(()),
+            state: Mutex::default(),
+            posted: Condvar::new(),
+            finished: Condvar::new(),
+        })
+    }
+
+    fn state(&self) -> MutexGuard<'_, BatchPoolState> {
+        self.state.lock().unwrap_or_else(PoisonError::into_inner)
+    }
+
+    /// Runs `job` on the calling thread and on up to `helpers` pool threads,
+    /// returning once every copy has returned.
+    fn run(&'static self, helpers: usize, job: &(dyn Fn() + Sync)) {
+        let _busy = match self.busy.try_lock() {
+            Ok(guard) => guard,
+            Err(TryLockError::Poisoned(e)) => e.into_inner(),
+            Err(TryLockError::WouldBlock) => return job(),
+        };
+        let mut state = self.state();
+        while state.started < helpers {
+            let spawned = std::thread::Builder::new().name("temporal-batch".into()).spawn(move || self.serve());
+            if spawned.is_err() {
+                break;
+            }
+            state.started += 1;
+        }
+        // Waited out below before `job` goes out of scope.
+        let erased = unsafe { std::mem::transmute::<&(dyn Fn() + Sync + '_), &'static (dyn Fn() + Sync)>(job) };
+        state.job = Some(BatchJob(erased));
+        state.seats = helpers.min(state.started);
+        drop(state);
+        self.posted.notify_all();
+
+        let outcome = catch_unwind(AssertUnwindSafe(job));
+        let mut state = self.state();
+        state.seats = 0;
+        while state.running > 0 {
+            state = self.finished.wait(state).unwrap_or_else(PoisonError::into_inner);
+        }
+        state.job = None;
+        let panic = outcome.err().or_else(|| state.panic.take());
+        drop(state);
+        if let Some(payload) = panic {
+            std::panic::resume_unwind(payload);
+        }
+    }
+
+    fn serve(&self) {
+        let mut state = self.state();
+        loop {
+            let job = state.job.filter(|_| state.seats > 0);
+            let Some(job) = job else {
+                state = self.posted.wait(state).unwrap_or_else(PoisonError::into_inner);
+                continue;
+            };
+            state.seats -= 1;
+            state.running += 1;
+            drop(state);
+            let outcome = catch_unwind(AssertUnwindSafe(|| unsafe { (*job.0)() }));
+            state = self.state();
+            state.running -= 1;
+            if let Err(payload) = outcome {
+                state.panic.get_or_insert(payload);
+            }
+            if state.running == 0 {
+                self.finished.notify_one();
+            }
+        }
+    }
+}
+
+/// Appends `f(i)` for every i in `0..n` to `out`, in order. Large batches are
+/// split into chunks that the calling thread and the pool's helpers claim
+/// from a shared counter, so a thread that finishes early takes more chunks
+/// instead of idling. On
+/// failure nothing is appended and the error of the lowest failing index is
+/// returned, the same one a serial loop would stop at.
+fn batch_map<R: Send>(
+    n: usize,
+    out: &mut Vec<R>,
+    f: impl Fn(usize) -> Result<R, TemporalResult> + Sync,
+) -> Result<(), (usize, TemporalResult)> {
+    let threads = batch_threads().min(n / PARALLEL_BATCH_MIN_CHUNK);
+    if n < PARALLEL_BATCH_THRESHOLD || threads < 2 {
+        let start = out.len();
+        out.reserve(n);
+        for i in 0..n {
+            match f(i) {
+                Ok(value) => out.push(value),
+                Err(e) => {
+                    out.truncate(start);
+                    return Err((i, e));
+                }
+            }
+        }
+        return Ok(());
+    }
+
+    // Several chunks per thread even out items that cost more than others.
+    let chunk = (n / (threads * 4)).max(PARALLEL_BATCH_MIN_CHUNK);
+    let next_chunk = AtomicUsize::new(0);
+    let first_failure = AtomicUsize::new(usize::MAX);
+    let worker = || {
+        let mut done: Vec<(usize, Vec<R>)> = Vec::new();
+        loop {
+            let index = next_chunk.fetch_add(1, Ordering::Relaxed);
+            let start = index * chunk;
+            // Chunks past a known failure can't change the result.
+            if start >= n || start > first_failure.load(Ordering::Relaxed) {
+                return (done, None);
+            }
+            let end = (start + chunk).min(n);
+            let mut values = Vec::with_capacity(end - start);
+            for i in start..end {
+                match f(i) {
+                    Ok(value) => values.push(value),
+                    Err(e) => {
+                        first_failure.fetch_min(i, Ordering::Relaxed);
+                        // Later chunks only start further on
+                        return (done, Some(BatchFailure(i, e)));
+                    }
+                }
+            }
+            done.push((index, values));
+        }
+    };
+
+    let results = Mutex::new(Vec::with_capacity(threads));
+    BatchPool::get().run(threads - 1, &|| {
+        let result = worker();
+        results.lock().unwrap_or_else(PoisonError::into_inner).push(result);
+    });
+    let mut results = results.into_inner().unwrap_or_else(PoisonError::into_inner);
+
+    let mut failure: Option<BatchFailure> = None;
+    for (_, error) in results.iter_mut() {
+        if let Some(error) = error.take() {
+            match &failure {
+                Some(current) if current.0 <= error.0 => error.free(),
+                _ => {
+                    if let Some(previous) = failure.replace(error) {
+                        previous.free();
+                    }
+                }
+            }
+        }
+    }
+    if let Some(BatchFailure(i, e)) = failure {
+        return Err((i, e));
+    }
+    let mut chunks: Vec<(usize, Vec<R>)> = results.into_iter().flat_map(|(done, _)| done).collect();
+    chunks.sort_unstable_by_key(|&(index, _)| index);
+    out.reserve(n);
+    for (_, values) in chunks {
+        out.extend(values);
+    }
+    Ok(())
+}
+
+/// Largest scratch buffer, in elements, a thread keeps between calls. Larger
+/// batches still work; their buffer is freed instead of staying pinned.
+const SCRATCH_RETAIN_LIMIT: usize = 1 << 16;
+
+thread_local! {
+    static EPOCH_SCRATCH: Cell<Vec<i128>> = const { Cell::new(Vec::new()) };
+    static ORDER_SCRATCH: Cell<Vec<usize>> = const { Cell::new(Vec::new()) };
+}
+
+/// Runs `f` with an empty buffer from this thread's `scratch`, so repeated
+/// batches on a thread reuse one allocation and threads never share one.
+/// The buffer is moved out of the cell while `f` runs: a nested call finds
+/// the cell empty and allocates its own instead of aliasing this one.
+fn with_scratch<T, R>(scratch: &'static LocalKey<Cell<Vec<T>>>, f: impl FnOnce(&mut Vec<T>) -> R) -> R {
+    let mut buffer = scratch.with(Cell::take);
+    buffer.clear();
+    let result = f(&mut buffer);
+    if buffer.capacity() <= SCRATCH_RETAIN_LIMIT {
+        buffer.clear();
+        scratch.with(|cell| cell.set(buffer));
+    }
+    result
+}
+
+/// Parses every string in a C array, stopping at the first failure.
+fn parse_batch<T: Send>(
+    strings: *const *const c_char,
+    count: i32,
+    param_name: &str,
+    parse: fn(*const c_char, &str) -> Result<T, TemporalResult>,
+) -> Result<Vec<T>, BatchResult> {
+    let mut values = Vec::new();
+    parse_batch_into(strings, count, param_name, parse, &mut values).map(|()| values)
+}
+
+/// Like `parse_batch`, appending to `out`. Error indexes count from the start
+/// of `strings`, not of `out`.
+fn parse_batch_into<T: Send>(
+    strings: *const *const c_char,
+    count: i32,
+    param_name: &str,
+    parse: fn(*const c_char, &str) -> Result<T, TemporalResult>,
+    out: &mut Vec<T>,
+) -> Result<(), BatchResult> {
+    if count < 0 {
+        return Err(BatchResult::from_error(-1, TemporalResult::range_error("count cannot be negative")));
+    }
+    if count == 0 {
+        return Ok(());
+    }
+    if strings.is_null() {
+        return Err(BatchResult::from_error(-1, TemporalResult::type_error("Input array cannot be null")));
+    }
+    let inputs = SharedInputs(unsafe { std::slice::from_raw_parts(strings, count as usize) });
+    batch_map(inputs.len(), out, |i| parse(inputs.get(i), param_name))
+        .map_err(|(i, e)| BatchResult::from_error(i as i32, e))
+}
+
+/// Parses `count` strings into epoch nanosecond keys in this thread's
+/// scratch buffer and writes them to `out`.
+fn parse_epochs_many(
+    strings: *const *const c_char,
+    count: i32,
+    param_name: &str,
+    parse: fn(*const c_char, &str) -> Result<i128, TemporalResult>,
+    out: *mut TemporalEpochNanoseconds,
+) -> BatchResult {
+    with_scratch(&EPOCH_SCRATCH, |keys| {
+        if let Err(e) = parse_batch_into(strings, count, param_name, parse, keys) {
+            return e;
+        }
+        let out = match batch_output(out, keys.len()) {
+            Ok(o) => o,
+            Err(e) => return e,
+        };
+        for (slot, ns) in out.iter_mut().zip(keys.iter()) {
+            *slot = TemporalEpochNanoseconds::from_i128(*ns);
+        }
+        BatchResult::success(keys.len())
+    })
+}
+
+/// Writes the sort permutation of `count` epoch keys parsed into scratch.
+fn sort_epochs_many(
+    strings: *const *const c_char,
+    count: i32,
+    param_name: &str,
+    parse: fn(*const c_char, &str) -> Result<i128, TemporalResult>,
+    out_permutation: *mut i32,
+) -> BatchResult {
+    with_scratch(&EPOCH_SCRATCH, |keys| match parse_batch_into(strings, count, param_name, parse, keys) {
+        Ok(()) => write_sort_permutation(keys, out_permutation),
+        Err(e) => e,
+    })
+}
+
+/// Compares two arrays of `count` epoch keys, both parsed into one scratch
+/// buffer: `a` fills its front half and `b` its back half.
+fn compare_epochs_many(
+    a: *const *const c_char,
+    b: *const *const c_char,
+    count: i32,
+    param_names: (&str, &str),
+    parse: fn(*const c_char, &str) -> Result<i128, TemporalResult>,
+    out: *mut i8,
+) -> BatchResult {
+    with_scratch(&EPOCH_SCRATCH, |keys| {
+        if let Err(e) = parse_batch_into(a, count, param_names.0, parse, keys) {
+            return e;
+        }
+        let split = keys.len();
+        if let Err(e) = parse_batch_into(b, count, param_names.1, parse, keys) {
+            return e;
+        }
+        let (keys_a, keys_b) = keys.split_at(split);
+        write_pairwise_compare(keys_a, keys_b, out)
+    })
+}
+
+fn batch_output<'a, T>(out: *mut T, count: usize) -> Result<&'a mut [T], BatchResult> {
+    if count == 0 {
+        return Ok(&mut []);
+    }
+    if out.is_null() {
+        return Err(BatchResult::from_error(-1, TemporalResult::type_error("Output buffer cannot be null")));
+    }
+    Ok(unsafe { std::slice::from_raw_parts_mut(out, count) })
+}
+
+/// Writes the stable sort permutation of `keys` into `out`.
+fn write_sort_permutation<K: Ord>(keys: &[K], out: *mut i32) -> BatchResult {
+    let out = match batch_output(out, keys.len()) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+    with_scratch(&ORDER_SCRATCH, |order| {
+        order.extend(0..keys.len());
+        order.sort_by(|&a, &b| keys[a].cmp(&keys[b]));
+        for (slot, &index) in out.iter_mut().zip(order.iter()) {
+            *slot = index as i32;
+        }
+    });
+    BatchResult::success(keys.len())
+}
+
+/// Writes the pairwise comparison (-1, 0, 1) of `a[i]` and `b[i]` into `out`.
+fn write_pairwise_compare<K: Ord>(a: &[K], b: &[K], out: *mut i8) -> BatchResult {
+    let out = match batch_output(out, a.len()) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+    for ((slot, x), y) in out.iter_mut().zip(a).zip(b) {
+        *slot = x.cmp(y) as i8;
+    }
+    BatchResult::success(a.len())
+}
+
+fn instant_sort_key(s: *const c_char, param_name: &str) -> Result<i128, TemporalResult> {
+    parse_instant(s, param_name).map(|i| i.epoch_nanoseconds().0)
+}
+
+fn zoned_date_time_sort_key(s: *const c_char, param_name: &str) -> Result<i128, TemporalResult> {
+    parse_zoned_date_time(s, param_name).map(|z| z.epoch_nanoseconds().0)
+}
+
+/// Parses `count` instant strings into epoch nanoseconds.
+/// `out` must have room for `count` elements.
+#[no_mangle]
+pub extern "C" fn temporal_instant_parse_many(
+    strings: *const *const c_char,
+    count: i32,
+    out: *mut TemporalEpochNanoseconds,
+) -> BatchResult {
+    stats_scope!("temporal_instant_parse_many");
+    parse_epochs_many(strings, count, "instant", instant_sort_key, out)
+}
+
+/// Writes into `out_permutation` the indices of `strings` in ascending order.
+/// The sort is stable, so equal instants keep their input order.
+#[no_mangle]
+pub extern "C" fn temporal_instant_sort(
+    strings: *const *const c_char,
+    count: i32,
+    out_permutation: *mut i32,
+) -> BatchResult {
+    stats_scope!("temporal_instant_sort");
+    sort_epochs_many(strings, count, "instant", instant_sort_key, out_permutation)
+}
+
+/// Compares `a[i]` with `b[i]` for every i, writing -1, 0 or 1 into `out`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_compare_many(
+    a: *const *const c_char,
+    b: *const *const c_char,
+    count: i32,
+    out: *mut i8,
+) -> BatchResult {
+    stats_scope!("temporal_instant_compare_many");
+    compare_epochs_many(a, b, count, ("first instant", "second instant"), instant_sort_key, out)
+}
+
+/// Writes into `out_permutation` the indices of `strings` in ascending ISO order.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_sort(
+    strings: *const *const c_char,
+    count: i32,
+    out_permutation: *mut i32,
+) -> BatchResult {
+    stats_scope!("temporal_plain_date_sort");
+    match parse_batch(strings, count, "plain date", plain_date_day_key) {
+        Ok(keys) => write_sort_permutation(&keys, out_permutation),
+        Err(e) => e,
+    }
+}
+
+/// Compares `a[i]` with `b[i]` for every i, writing -1, 0 or 1 into `out`.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_compare_many(
+    a: *const *const c_char,
+    b: *const *const c_char,
+    count: i32,
+    out: *mut i8,
+) -> BatchResult {
+    stats_scope!("temporal_plain_date_compare_many");
+    let keys_a = match parse_batch(a, count, "first plain date", plain_date_day_key) {
+        Ok(k) => k,
+        Err(e) => return e,
+    };
+    let keys_b = match parse_batch(b, count, "second plain date", plain_date_day_key) {
+        Ok(k) => k,
+        Err(e) => return e,
+    };
+    write_pairwise_compare(&keys_a, &keys_b, out)
+}
+
+/// Parses `count` zoned date time strings into epoch nanoseconds.
+/// `out` must have room for `count` elements.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_parse_many(
+    strings: *const *const c_char,
+    count: i32,
+    out: *mut TemporalEpochNanoseconds,
+) -> BatchResult {
+    stats_scope!("temporal_zoned_date_time_parse_many");
+    parse_epochs_many(strings, count, "zoned date time", zoned_date_time_sort_key, out)
+}
+
+/// Writes into `out_permutation` the indices of `strings` ordered by exact time.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_sort(
+    strings: *const *const c_char,
+    count: i32,
+    out_permutation: *mut i32,
+) -> BatchResult {
+    stats_scope!("temporal_zoned_date_time_sort");
+    sort_epochs_many(strings, count, "zoned date time", zoned_date_time_sort_key, out_permutation)
+}
+
+/// Compares `a[i]` with `b[i]` by exact time for every i, writing -1, 0 or 1 into `out`.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_compare_many(
+    a: *const *const c_char,
+    b: *const *const c_char,
+    count: i32,
+    out: *mut i8,
+) -> BatchResult {
+    stats_scope!("temporal_zoned_date_time_compare_many");
+    compare_epochs_many(a, b, count, ("first zoned date time", "second zoned date time"), zoned_date_time_sort_key, out)
+}
+
+/// Number of columns written by `temporal_time_zone_get_plain_date_times_for_many`:
+/// year, month, day, hour, minute, second, millisecond, microsecond, nanosecond.
+pub const PLAIN_DATE_TIME_COLUMN_COUNT: usize = 9;
+
+/// Converts `count` epoch nanoseconds to ISO wall-clock fields in one time zone.
+///
+/// `out` is a struct-of-arrays buffer of `9 * count` int32 values: column `c`
+/// (in the order listed on `PLAIN_DATE_TIME_COLUMN_COUNT`) occupies
+/// `out[c * count .. (c + 1) * count]`, so each column can be read as a
+/// contiguous typed array.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_plain_date_times_for_many(
+    tz_id: *const c_char,
+    epoch_ns: *const TemporalEpochNanoseconds,
+    count: i32,
+    out: *mut i32,
+) -> BatchResult {
+    stats_scope!("temporal_time_zone_get_plain_date_times_for_many");
+    time_zone_plain_date_times_for_many(parse_time_zone(tz_id, "timezone"), epoch_ns, count, out)
+}
+
+fn time_zone_plain_date_times_for_many(
+    tz: Result<TimeZone, TemporalResult>,
+    epoch_ns: *const TemporalEpochNanoseconds,
+    count: i32,
+    out: *mut i32,
+) -> BatchResult {
+    let tz = match tz {
+        Ok(t) => t,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    if count < 0 {
+        return BatchResult::from_error(-1, TemporalResult::range_error("count cannot be negative"));
+    }
+    let n = count as usize;
+    if n == 0 {
+        return BatchResult::success(0);
+    }
+    if epoch_ns.is_null() {
+        return BatchResult::from_error(-1, TemporalResult::type_error("Input array cannot be null"));
+    }
+    let inputs = unsafe { std::slice::from_raw_parts(epoch_ns, n) };
+    let out = match batch_output(out, n * PLAIN_DATE_TIME_COLUMN_COUNT) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+
+    let mut rows = Vec::new();
+    let converted = batch_map(n, &mut rows, |i| {
+        let e = &inputs[i];
+        let ns = e.seconds as i128 * 1_000_000_000 + e.nanoseconds as i128;
+        let zdt = ZonedDateTime::try_new(ns, tz.clone(), Calendar::default())
+            .map_err(|err| TemporalResult::range_error(&format!("Failed to get plain date time: {}", err)))?;
+        Ok([
+            zdt.year(),
+            zdt.month() as i32,
+            zdt.day() as i32,
+            zdt.hour() as i32,
+            zdt.minute() as i32,
+            zdt.second() as i32,
+            zdt.millisecond() as i32,
+            zdt.microsecond() as i32,
+            zdt.nanosecond() as i32,
+        ])
+    });
+    if let Err((i, e)) = converted {
+        return BatchResult::from_error(i as i32, e);
+    }
+    for (i, fields) in rows.into_iter().enumerate() {
+        for (column, value) in fields.into_iter().enumerate() {
+            out[column * n + i] = value;
+        }
+    }
+    BatchResult::success(n)
+}
+
+/// Largest number of occurrences `temporal_zoned_date_time_expand_recurrence`
+/// and `temporal_zoned_date_time_range_next_batch` produce in one call.
+pub const MAX_RECURRENCE_COUNT: i32 = 1_000_000;
+
+/// `duration` with every field multiplied by `factor`.
+fn scale_duration(duration: &Duration, factor: i64) -> Result<Duration, TemporalResult> {
+    let overflow = || TemporalResult::range_error("Recurrence duration overflows");
+    let scale = |v: i64| v.checked_mul(factor).ok_or_else(overflow);
+    let scale_wide = |v: i128| v.checked_mul(factor as i128).ok_or_else(overflow);
+    Duration::new(
+        scale(duration.years())?,
+        scale(duration.months())?,
+        scale(duration.weeks())?,
+        scale(duration.days())?,
+        scale(duration.hours())?,
+        scale(duration.minutes())?,
+        scale(duration.seconds())?,
+        scale(duration.milliseconds())?,
+        scale_wide(duration.microseconds())?,
+        scale_wide(duration.nanoseconds())?,
+    )
+    .map_err(|e| TemporalResult::range_error(&format!("Invalid recurrence duration: {}", e)))
+}
+
+/// Expands a recurrence into the exact times of `start + duration * i` for
+/// `i` in `0..count`, written to `out` as epoch nanoseconds.
+///
+/// `start` is a plain date-time (with an optional calendar annotation)
+/// placed in `tz_id` with compatible disambiguation. Each occurrence is
+/// computed from `start` rather than from the previous occurrence, so
+/// month-end dates don't drift (Jan 31, Feb 29, Mar 31, ...), and days
+/// past the end of a month are constrained.
+///
+/// The function touches no shared state other than the time zone cache, so
+/// it can run on a worker thread.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_expand_recurrence(
+    start: *const c_char,
+    duration: *const c_char,
+    count: i32,
+    tz_id: *const c_char,
+    out: *mut TemporalEpochNanoseconds,
+) -> BatchResult {
+    stats_scope!("temporal_zoned_date_time_expand_recurrence");
+    if !(0..=MAX_RECURRENCE_COUNT).contains(&count) {
+        return BatchResult::from_error(
+            -1,
+            TemporalResult::range_error(&format!("count must be between 0 and {}", MAX_RECURRENCE_COUNT)),
+        );
+    }
+    let pdt = match parse_plain_date_time(start, "start") {
+        Ok(p) => p,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let duration = match parse_duration(duration, "duration") {
+        Ok(d) => d,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let tz = match parse_time_zone(tz_id, "timezone") {
+        Ok(t) => t,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let n = count as usize;
+    let out = match batch_output(out, n) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+    if n == 0 {
+        return BatchResult::success(0);
+    }
+
+    let first = match pdt.to_zoned_date_time(tz, Disambiguation::Compatible) {
+        Ok(z) => z,
+        Err(e) => {
+            return BatchResult::from_error(
+                -1,
+                TemporalResult::range_error(&format!("Failed to place start in time zone: {}", e)),
+            )
+        }
+    };
+    // Occurrences are independent of each other, so large expansions are
+    // spread over the batch threads.
+    let mut occurrences = Vec::new();
+    let expanded = batch_map(n, &mut occurrences, |i| {
+        let step = scale_duration(&duration, i as i64)?;
+        first
+            .add(&step, Some(Overflow::Constrain))
+            .map(|zdt| TemporalEpochNanoseconds::from_i128(zdt.epoch_nanoseconds().0))
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to expand recurrence: {}", e)))
+    });
+    if let Err((i, e)) = expanded {
+        return BatchResult::from_error(i as i32, e);
+    }
+    out.copy_from_slice(&occurrences);
+    BatchResult::success(n)
+}
+
+// ============================================================================
+// Zoned date-time ranges
+// ============================================================================
+//
+// A range keeps its parsed start, step and end in native memory, so calendar
+// grids and reminder schedulers can pull thousands of occurrences with one
+// bridge crossing per batch instead of one parse, zone lookup and format per
+// step. Ranges are handles of kind ZonedDateTimeRange and are released with
+// `temporal_handle_release`.
+
+/// Iteration state held by a ZonedDateTimeRange handle.
+pub struct ZonedDateTimeRange {
+    start: ZonedDateTime,
+    step: Duration,
+    /// Length of the time units of `step` in nanoseconds.
+    time_step: i128,
+    /// Whether `step` has no calendar units. Such steps are exact time, so
+    /// occurrences are computed without consulting the time zone at all.
+    exact_step: bool,
+    /// The years, months, weeks and days of `step`, added to `start_date`.
+    date_step: Duration,
+    start_date: PlainDate,
+    /// Wall-clock time of day of `start` in nanoseconds.
+    start_time: i128,
+    /// The offset in effect over `[valid_from, valid_until)` around the last
+    /// wall time resolved through the zone, and the time zone cache
+    /// generation it was read at.
+    offset: i64,
+    valid_from: i128,
+    valid_until: i128,
+    generation: u64,
+    /// Exclusive end in epoch nanoseconds, or None for an unbounded range.
+    end: Option<i128>,
+    /// Index of the next occurrence.
+    index: i64,
+    done: bool,
+}
+
+impl ZonedDateTimeRange {
+    fn new(start: ZonedDateTime, step: Duration, end: Option<i128>) -> Result<Self, TemporalResult> {
+        if step.is_zero() {
+            return Err(TemporalResult::range_error("Range step cannot be zero"));
+        }
+        let time_step = step.hours() as i128 * 3_600_000_000_000
+            + step.minutes() as i128 * 60_000_000_000
+            + step.seconds() as i128 * 1_000_000_000
+            + step.milliseconds() as i128 * 1_000_000
+            + step.microseconds() * 1_000
+            + step.nanoseconds();
+        let date_step = Duration::new(step.years(), step.months(), step.weeks(), step.days(), 0, 0, 0, 0, 0, 0)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid range step: {}", e)))?;
+        let time = start.to_plain_time();
+        let start_time = time.hour() as i128 * 3_600_000_000_000
+            + time.minute() as i128 * 60_000_000_000
+            + time.second() as i128 * 1_000_000_000
+            + time.millisecond() as i128 * 1_000_000
+            + time.microsecond() as i128 * 1_000
+            + time.nanosecond() as i128;
+        Ok(Self {
+            start_date: start.to_plain_date(),
+            start,
+            exact_step: date_step.is_zero(),
+            step,
+            time_step,
+            date_step,
+            start_time,
+            offset: 0,
+            valid_from: 0,
+            valid_until: 0,
+            generation: 0,
+            end,
+            index: 0,
+            done: false,
+        })
+    }
+
+    /// Epoch nanoseconds of occurrence `i`. Like recurrences, occurrences are
+    /// computed from the start so month-end dates don't drift.
+    ///
+    /// A calendar step moves the wall-clock date, places the start's time of
+    /// day on it in the zone and then adds the time units. While the cached
+    /// transition window covers that wall time with a day to spare on either
+    /// side, it names exactly one instant under the window's offset and the
+    /// zone isn't consulted.
+    fn occurrence(&mut self, i: i64) -> Result<i128, TemporalResult> {
+        let overflow = || TemporalResult::range_error("Range occurrence is outside the supported range");
+        let advance_error = |e: TemporalError| TemporalResult::range_error(&format!("Failed to advance range: {}", e));
+        let time = self.time_step.checked_mul(i as i128).ok_or_else(overflow)?;
+        let in_range = |ns: Option<i128>| {
+            let ns = ns.ok_or_else(overflow)?;
+            Instant::try_new(ns).map(|_| ns).map_err(|_| overflow())
+        };
+        if self.exact_step {
+            return in_range(self.start.epoch_nanoseconds().0.checked_add(time));
+        }
+
+        let date = self
+            .start_date
+            .add(&scale_duration(&self.date_step, i)?, Some(Overflow::Constrain))
+            .map_err(advance_error)?;
+        let wall = plain_date_day_number(&date) as i128 * NANOSECONDS_PER_DAY + self.start_time;
+        let candidate = wall - self.offset as i128;
+        let generation = TIME_ZONE_CACHE_GENERATION.load(Ordering::Acquire);
+        if generation == self.generation
+            && self.valid_from.saturating_add(NANOSECONDS_PER_DAY) <= candidate
+            && candidate.saturating_add(NANOSECONDS_PER_DAY) <= self.valid_until
+        {
+            return in_range(candidate.checked_add(time));
+        }
+
+        let ns = self
+            .start
+            .add(&scale_duration(&self.step, i)?, Some(Overflow::Constrain))
+            .map_err(advance_error)?
+            .epoch_nanoseconds()
+            .0;
+        let resolved = ns - time;
+        let index = transition_index(self.start.time_zone())?;
+        self.offset = index.offset(resolved).map_err(advance_error)?;
+        self.valid_from = index.previous(resolved + 1).map_err(advance_error)?.unwrap_or(i128::MIN);
+        self.valid_until = index.next(resolved).map_err(advance_error)?.unwrap_or(i128::MAX);
+        self.generation = generation;
+        Ok(ns)
+    }
+
+    /// Whether `ns` lies at or past the end in the direction of the step.
+    fn is_past_end(&self, ns: i128) -> bool {
+        match self.end {
+            Some(end) if self.step.sign() as i32 > 0 => ns >= end,
+            Some(end) => ns <= end,
+            None => false,
+        }
+    }
+}
+
+/// Creates a range of `start + step * i` for i = 0, 1, 2, ...
+///
+/// `start` is a zoned date-time string whose zone and calendar the
+/// occurrences follow. `end` is an optional zoned date-time string marking
+/// an exclusive bound in the direction of `step`; NULL makes the range
+/// unbounded. A zero step is a RangeError. Release the handle with
+/// `temporal_handle_release`.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_range_new(
+    start: *const c_char,
+    step: *const c_char,
+    end: *const c_char,
+) -> HandleResult {
+    stats_scope!("temporal_zoned_date_time_range_new");
+    let start = match parse_zoned_date_time(start, "start") {
+        Ok(z) => z,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let step = match parse_duration(step, "step") {
+        Ok(d) => d,
+        Err(e) => return HandleResult::from_error(e),
+    };
+    let end = if end.is_null() {
+        None
+    } else {
+        match parse_zoned_date_time(end, "end") {
+            Ok(z) => Some(z.epoch_nanoseconds().0),
+            Err(e) => return HandleResult::from_error(e),
+        }
+    };
+    match ZonedDateTimeRange::new(start, step, end) {
+        Ok(range) => HandleResult::success(TemporalHandle::ZonedDateTimeRange(Mutex::new(range))),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Writes up to `n` further occurrences of a range into `out` as epoch
+/// nanoseconds and returns how many were written; 0 means the range is
+/// exhausted.
+///
+/// If an occurrence cannot be computed, the occurrences before it are
+/// returned and the next call reports the error. Calls on the same range
+/// from several threads take turns.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_range_next_batch(
+    range: *mut TemporalHandle,
+    out: *mut TemporalEpochNanoseconds,
+    n: i32,
+) -> BatchResult {
+    stats_scope!("temporal_zoned_date_time_range_next_batch");
+    let handle = match handle_ref(range, "range") {
+        Ok(h) => h,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let mut range = match &*handle {
+        TemporalHandle::ZonedDateTimeRange(r) => r.lock().unwrap_or_else(PoisonError::into_inner),
+        _ => return BatchResult::from_error(-1, TemporalResult::type_error("Handle is not a ZonedDateTimeRange")),
+    };
+    if !(0..=MAX_RECURRENCE_COUNT).contains(&n) {
+        return BatchResult::from_error(
+            -1,
+            TemporalResult::range_error(&format!("n must be between 0 and {}", MAX_RECURRENCE_COUNT)),
+        );
+    }
+    let out = match batch_output(out, n as usize) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+
+    let mut written = 0;
+    while written < out.len() && !range.done {
+        let index = range.index;
+        let ns = match range.occurrence(index) {
+            Ok(ns) => ns,
+            Err(e) if written == 0 => return BatchResult::from_error(-1, e),
+            Err(mut e) => {
+                unsafe { temporal_free_result(&mut e) };
+                break;
+            }
+        };
+        if range.is_past_end(ns) {
+            range.done = true;
+            break;
+        }
+        out[written] = TemporalEpochNanoseconds::from_i128(ns);
+        written += 1;
+        range.index += 1;
+    }
+    BatchResult::success(written)
+}
+
+// ============================================================================
+// Columns
+// ============================================================================
+//
+// A column is a sorted array of instants (epoch nanoseconds) or plain dates
+// (days since 1970-01-01) held in native memory, so timeline views can run
+// binary searches, range counts and histograms with one call instead of one
+// comparison per probe. Columns are handles of kind InstantColumn or
+// PlainDateColumn; slices share the values of the column they were taken
+// from. Release them with `temporal_handle_release`.
+
+/// A sorted, immutable window of values.
+pub struct Column<T> {
+    values: Arc<[T]>,
+    start: usize,
+    end: usize,
+}
+
+impl<T: Ord + Copy> Column<T> {
+    fn sorted(mut values: Vec<T>) -> Self {
+        values.sort_unstable();
+        let end = values.len();
+        Self { values: values.into(), start: 0, end }
+    }
+
+    fn as_slice(&self) -> &[T] {
+        &self.values[self.start..self.end]
+    }
+
+    /// Index of the first value not less than `value`.
+    fn lower_bound(&self, value: T) -> usize {
+        self.as_slice().partition_point(|&v| v < value)
+    }
+
+    /// Number of values in `[start, end)`.
+    fn range_count(&self, start: T, end: T) -> usize {
+        self.lower_bound(end).saturating_sub(self.lower_bound(start))
+    }
+
+    /// The values at `[from, to)`, both clamped to the column.
+    fn slice(&self, from: usize, to: usize) -> Self {
+        let len = self.end - self.start;
+        let from = from.min(len);
+        let to = to.clamp(from, len);
+        Self { values: self.values.clone(), start: self.start + from, end: self.start + to }
+    }
+}
+
+/// Calendar periods a column can be bucketed by.
+#[derive(Clone, Copy)]
+enum BucketUnit {
+    Day,
+    Week,
+    Month,
+    Year,
+}
+
+impl BucketUnit {
+    fn parse(s: *const c_char) -> Result<Self, TemporalResult> {
+        match parse_c_str(s, "unit")? {
+            "day" => Ok(Self::Day),
+            "week" => Ok(Self::Week),
+            "month" => Ok(Self::Month),
+            "year" => Ok(Self::Year),
+            other => Err(TemporalResult::range_error(&format!(
+                "Invalid bucket unit '{}': expected day, week, month or year",
+                other
+            ))),
+        }
+    }
+
+    /// The first day of the period containing `day` and of the period after
+    /// it, as days since 1970-01-01. Weeks start on Monday.
+    fn period(self, day: i64) -> (i64, i64) {
+        match self {
+            Self::Day => (day, day + 1),
+            // 1970-01-01 was a Thursday, three days after a Monday
+            Self::Week => {
+                let start = day - (day + 3).rem_euclid(7);
+                (start, start + 7)
+            }
+            Self::Month => {
+                let (year, month, _) = civil_from_days(day);
+                let (next_year, next_month) = if month == 12 { (year + 1, 1) } else { (year, month + 1) };
+                (days_from_civil(year as i32, month, 1), days_from_civil(next_year as i32, next_month, 1))
+            }
+            Self::Year => {
+                let (year, _, _) = civil_from_days(day);
+                (days_from_civil(year as i32, 1, 1), days_from_civil(year as i32 + 1, 1, 1))
+            }
+        }
+    }
+}
+
+const NANOSECONDS_PER_DAY: i128 = 86_400_000_000_000;
+
+/// Days since 1970-01-01 of the ISO date of `date`, whatever its calendar.
+fn plain_date_day_number(date: &PlainDate) -> i32 {
+    if date.calendar().identifier() == "iso8601" {
+        return days_from_civil(date.year(), date.month() as u32, date.day() as u32) as i32;
+    }
+    let iso = date.with_calendar(Calendar::default());
+    days_from_civil(iso.year(), iso.month() as u32, iso.day() as u32) as i32
+}
+
+fn plain_date_day_key(s: *const c_char, param_name: &str) -> Result<i32, TemporalResult> {
+    parse_plain_date(s, param_name).map(|date| plain_date_day_number(&date))
+}
+
+fn instant_column(handle: *const TemporalHandle) -> Result<HandleRef<Column<i128>>, TemporalResult> {
+    handle_ref(handle, "column")?.project(
+        |h| match h {
+            TemporalHandle::InstantColumn(c) => Some(c),
+            _ => None,
+        },
+        "Handle is not an InstantColumn",
+    )
+}
+
+fn plain_date_column(handle: *const TemporalHandle) -> Result<HandleRef<Column<i32>>, TemporalResult> {
+    handle_ref(handle, "column")?.project(
+        |h| match h {
+            TemporalHandle::PlainDateColumn(c) => Some(c),
+            _ => None,
+        },
+        "Handle is not a PlainDateColumn",
+    )
+}
+
+fn epoch_key(epoch: TemporalEpochNanoseconds) -> Result<i128, TemporalResult> {
+    epoch.to_instant().map(|i| i.epoch_nanoseconds().0)
+}
+
+/// Writes `value` through `out` and returns the `TemporalErrorType`.
+fn write_status<T>(value: Result<T, TemporalResult>, out: *mut T) -> i32 {
+    match value {
+        Ok(_) if out.is_null() => record_error(TemporalResult::type_error("Output cannot be null")),
+        Ok(v) => {
+            unsafe { *out = v };
+            TemporalErrorType::None as i32
+        }
+        Err(e) => record_error(e),
+    }
+}
+
+/// Creates an InstantColumn from `count` epoch nanoseconds in any order.
+#[no_mangle]
+pub extern "C" fn temporal_instant_column_from_epoch_nanoseconds(
+    epoch_ns: *const TemporalEpochNanoseconds,
+    count: i32,
+) -> HandleResult {
+    stats_scope!("temporal_instant_column_from_epoch_nanoseconds");
+    if count < 0 {
+        return HandleResult::from_error(TemporalResult::range_error("count cannot be negative"));
+    }
+    if count > 0 && epoch_ns.is_null() {
+        return HandleResult::from_error(TemporalResult::type_error("Input array cannot be null"));
+    }
+    let inputs = if count == 0 { &[][..] } else { unsafe { std::slice::from_raw_parts(epoch_ns, count as usize) } };
+    let mut values = Vec::with_capacity(inputs.len());
+    for &e in inputs {
+        match epoch_key(e) {
+            Ok(ns) => values.push(ns),
+            Err(e) => return HandleResult::from_error(e),
+        }
+    }
+    HandleResult::success(TemporalHandle::InstantColumn(Column::sorted(values)))
+}
+
+/// Creates an InstantColumn by parsing `count` instant strings.
+#[no_mangle]
+pub extern "C" fn temporal_instant_column_from_strings(strings: *const *const c_char, count: i32) -> HandleResult {
+    stats_scope!("temporal_instant_column_from_strings");
+    match parse_batch(strings, count, "instant", instant_sort_key) {
+        Ok(values) => HandleResult::success(TemporalHandle::InstantColumn(Column::sorted(values))),
+        Err(e) => HandleResult::from_error(batch_error(e)),
+    }
+}
+
+/// Creates a PlainDateColumn by parsing `count` plain date strings. Dates
+/// are ordered by their ISO date; calendars are not kept.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_column_from_strings(strings: *const *const c_char, count: i32) -> HandleResult {
+    stats_scope!("temporal_plain_date_column_from_strings");
+    match parse_batch(strings, count, "plain date", plain_date_day_key) {
+        Ok(values) => HandleResult::success(TemporalHandle::PlainDateColumn(Column::sorted(values))),
+        Err(e) => HandleResult::from_error(batch_error(e)),
+    }
+}
+
+/// Moves a batch failure into an ordinary TemporalResult error.
+fn batch_error(mut error: BatchResult) -> TemporalResult {
+    let message = if error.error_message.is_null() {
+        "Unknown error".to_string()
+    } else {
+        unsafe { CString::from_raw(error.error_message) }.to_string_lossy().into_owned()
+    };
+    error.error_message = ptr::null_mut();
+    if error.error_type == TemporalErrorType::TypeError as i32 {
+        TemporalResult::type_error(&message)
+    } else {
+        TemporalResult::range_error(&message)
+    }
+}
+
+/// Writes the number of values in a column of either kind to `out`.
+#[no_mangle]
+pub extern "C" fn temporal_column_length(column: *const TemporalHandle, out: *mut i32) -> i32 {
+    stats_scope!("temporal_column_length");
+    let len = handle_ref(column, "column").and_then(|column| match &*column {
+        TemporalHandle::InstantColumn(c) => Ok(c.as_slice().len()),
+        TemporalHandle::PlainDateColumn(c) => Ok(c.as_slice().len()),
+        _ => Err(TemporalResult::type_error("Handle is not a column")),
+    });
+    write_status(len.map(|n| n as i32), out)
+}
+
+/// Creates a view of the values at `[from, to)` of a column of either kind,
+/// without copying them. Both bounds are clamped to the column.
+#[no_mangle]
+pub extern "C" fn temporal_column_slice(column: *const TemporalHandle, from: i32, to: i32) -> HandleResult {
+    stats_scope!("temporal_column_slice");
+    let (from, to) = (from.max(0) as usize, to.max(0) as usize);
+    let slice = handle_ref(column, "column").and_then(|column| match &*column {
+        TemporalHandle::InstantColumn(c) => Ok(TemporalHandle::InstantColumn(c.slice(from, to))),
+        TemporalHandle::PlainDateColumn(c) => Ok(TemporalHandle::PlainDateColumn(c.slice(from, to))),
+        _ => Err(TemporalResult::type_error("Handle is not a column")),
+    });
+    match slice {
+        Ok(slice) => HandleResult::success(slice),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Writes to `out` the index of the first instant not before `instant`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_column_lower_bound(
+    column: *const TemporalHandle,
+    instant: TemporalEpochNanoseconds,
+    out: *mut i32,
+) -> i32 {
+    stats_scope!("temporal_instant_column_lower_bound");
+    let index = instant_column(column).and_then(|c| Ok(c.lower_bound(epoch_key(instant)?) as i32));
+    write_status(index, out)
+}
+
+/// Writes to `out` how many instants of a column lie in `[start, end)`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_column_range_count(
+    column: *const TemporalHandle,
+    start: TemporalEpochNanoseconds,
+    end: TemporalEpochNanoseconds,
+    out: *mut i32,
+) -> i32 {
+    stats_scope!("temporal_instant_column_range_count");
+    let count = instant_column(column).and_then(|c| Ok(c.range_count(epoch_key(start)?, epoch_key(end)?) as i32));
+    write_status(count, out)
+}
+
+/// Copies up to `n` instants starting at index `from` into `out`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_column_read(
+    column: *const TemporalHandle,
+    from: i32,
+    n: i32,
+    out: *mut TemporalEpochNanoseconds,
+) -> BatchResult {
+    stats_scope!("temporal_instant_column_read");
+    let values = match instant_column(column) {
+        Ok(c) => c.slice(from.max(0) as usize, from.max(0) as usize + n.max(0) as usize),
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let out = match batch_output(out, values.as_slice().len()) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+    for (slot, &ns) in out.iter_mut().zip(values.as_slice()) {
+        *slot = TemporalEpochNanoseconds::from_i128(ns);
+    }
+    BatchResult::success(out.len())
+}
+
+/// Counts the instants of a column per day, week (from Monday), month or
+/// year in `tz_id`.
+///
+/// Writes the start of each non-empty period, ascending, to `out_starts` and
+/// its number of instants to `out_counts`, at most `cap` of them. There are
+/// never more periods than instants. Each period costs a few offset lookups
+/// in the zone's transition index and one binary search, whatever the number
+/// of instants in it.
+#[no_mangle]
+pub extern "C" fn temporal_instant_column_bucket_by(
+    column: *const TemporalHandle,
+    unit: *const c_char,
+    tz_id: *const c_char,
+    out_starts: *mut TemporalEpochNanoseconds,
+    out_counts: *mut i32,
+    cap: i32,
+) -> BatchResult {
+    stats_scope!("temporal_instant_column_bucket_by");
+    let prepared = instant_column(column).and_then(|c| Ok((c, BucketUnit::parse(unit)?, parse_time_zone(tz_id, "timezone")?)));
+    let (column, unit, tz) = match prepared {
+        Ok(p) => p,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let values = column.as_slice();
+    let cap = (cap.max(0) as usize).min(values.len());
+    let (starts, counts) = match (batch_output(out_starts, cap), batch_output(out_counts, cap)) {
+        (Ok(s), Ok(c)) => (s, c),
+        (Err(e), _) | (_, Err(e)) => return e,
+    };
+
+    let mut written = 0;
+    let mut i = 0;
+    let index = match transition_index(&tz) {
+        Ok(index) => index,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    while i < values.len() && written < cap {
+        let bucket = index.offset(values[i]).and_then(|offset| {
+            let day = (values[i] + offset as i128).div_euclid(NANOSECONDS_PER_DAY) as i64;
+            let (first, next) = unit.period(day);
+            Ok((index.start_of_day(first)?, index.start_of_day(next)?))
+        });
+        let (start, next) = match bucket {
+            Ok(b) => b,
+            Err(e) => return BatchResult::from_error(i as i32, TemporalResult::range_error(&format!("Failed to find period: {}", e))),
+        };
+        // A wall clock set back across midnight puts the instants after the
+        // transition on the earlier day; they have no period of their own.
+        if !(start..next).contains(&values[i]) {
+            return BatchResult::from_error(
+                i as i32,
+                TemporalResult::range_error("Instant lies outside the period computed for it"),
+            );
+        }
+        let end = i + values[i..].partition_point(|&v| v < next);
+        starts[written] = TemporalEpochNanoseconds::from_i128(start);
+        counts[written] = (end - i) as i32;
+        written += 1;
+        i = end;
+    }
+    BatchResult::success(written)
+}
+
+/// Writes to `out` the index of the first date not before `date`.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_column_lower_bound(
+    column: *const TemporalHandle,
+    date: *const c_char,
+    out: *mut i32,
+) -> i32 {
+    stats_scope!("temporal_plain_date_column_lower_bound");
+    let index = plain_date_column(column)
+        .and_then(|c| Ok(c.lower_bound(plain_date_day_key(date, "date")?) as i32));
+    write_status(index, out)
+}
+
+/// Writes to `out` how many dates of a column lie in `[start, end)`.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_column_range_count(
+    column: *const TemporalHandle,
+    start: *const c_char,
+    end: *const c_char,
+    out: *mut i32,
+) -> i32 {
+    stats_scope!("temporal_plain_date_column_range_count");
+    let count = plain_date_column(column).and_then(|c| {
+        let range = (plain_date_day_key(start, "start")?, plain_date_day_key(end, "end")?);
+        Ok(c.range_count(range.0, range.1) as i32)
+    });
+    write_status(count, out)
+}
+
+/// Copies up to `n` dates starting at index `from` into `out_days`, as
+/// days since 1970-01-01.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_column_read(
+    column: *const TemporalHandle,
+    from: i32,
+    n: i32,
+    out_days: *mut i32,
+) -> BatchResult {
+    stats_scope!("temporal_plain_date_column_read");
+    let values = match plain_date_column(column) {
+        Ok(c) => c.slice(from.max(0) as usize, from.max(0) as usize + n.max(0) as usize),
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let out = match batch_output(out_days, values.as_slice().len()) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+    out.copy_from_slice(values.as_slice());
+    BatchResult::success(out.len())
+}
+
+/// Counts the dates of a column per day, week (from Monday), month or year.
+/// Writes the first day of each non-empty period, ascending, to
+/// `out_start_days` (days since 1970-01-01) and its number of dates to
+/// `out_counts`, at most `cap` of them.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_column_bucket_by(
+    column: *const TemporalHandle,
+    unit: *const c_char,
+    out_start_days: *mut i32,
+    out_counts: *mut i32,
+    cap: i32,
+) -> BatchResult {
+    stats_scope!("temporal_plain_date_column_bucket_by");
+    let (column, unit) = match plain_date_column(column).and_then(|c| Ok((c, BucketUnit::parse(unit)?))) {
+        Ok(p) => p,
+        Err(e) => return BatchResult::from_error(-1, e),
+    };
+    let values = column.as_slice();
+    let cap = (cap.max(0) as usize).min(values.len());
+    let (starts, counts) = match (batch_output(out_start_days, cap), batch_output(out_counts, cap)) {
+        (Ok(s), Ok(c)) => (s, c),
+        (Err(e), _) | (_, Err(e)) => return e,
+    };
+
+    let mut written = 0;
+    let mut i = 0;
+    while i < values.len() && written < cap {
+        let (first, next) = unit.period(values[i] as i64);
+        let end = i + values[i..].partition_point(|&v| (v as i64) < next);
+        starts[written] = first as i32;
+        counts[written] = (end - i) as i32;
+        written += 1;
+        i = end;
+    }
+    BatchResult::success(written)
+}
+
+// ============================================================================
+// Zoned clocks
+// ============================================================================
+//
+// A zoned clock answers "what time is it in this zone" for timers and
+// animations that ask every frame. It reads a monotonic clock anchored to the
+// system clock and keeps the zone's UTC offset until the next transition, so a
+// reading is a clock read plus integer arithmetic: no zone lookup, no parsing
+// and no formatting. Clocks are handles of kind ZonedClock.
+
+/// How often a clock re-reads the system clock, so that changes to the
+/// device time show up within this many nanoseconds.
+const CLOCK_RESYNC_NANOSECONDS: u128 = 1_000_000_000;
+
+/// One reading of a zoned clock: the current instant and its ISO wall-clock
+/// fields in the clock's zone. Days of the week run from 1 (Monday) to 7.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct ZonedClockReading {
+    pub epoch_ns: TemporalEpochNanoseconds,
+    pub offset_nanoseconds: i64,
+    pub year: i32,
+    pub month: u8,
+    pub day: u8,
+    pub hour: u8,
+    pub minute: u8,
+    pub second: u8,
+    pub day_of_week: u8,
+    pub day_of_year: u16,
+    pub millisecond: u16,
+    pub microsecond: u16,
+    pub nanosecond: u16,
+}
+
+/// State held by a ZonedClock handle.
+pub struct ZonedClock {
+    tz: TimeZone,
+    /// Monotonic time of the last system clock read, and the epoch
+    /// nanoseconds it returned.
+    anchor: Option<(MonotonicInstant, i128)>,
+    /// The offset in effect over `[valid_from, valid_until)`.
+    offset: i64,
+    valid_from: i128,
+    valid_until: i128,
+    /// Time zone cache generation the offset was read at; clearing the cache
+    /// invalidates it.
+    generation: u64,
+}
+
+impl ZonedClock {
+    fn new(tz: TimeZone) -> Self {
+        Self {
+            tz,
+            anchor: None,
+            offset: 0,
+            valid_from: 0,
+            valid_until: 0,
+            generation: 0,
+        }
+    }
+
+    fn now(&mut self) -> Result<i128, TemporalResult> {
+        if let Some((at, epoch)) = self.anchor {
+            let elapsed = at.elapsed().as_nanos();
+            if elapsed < CLOCK_RESYNC_NANOSECONDS {
+                return Ok(epoch + elapsed as i128);
+            }
+        }
+        let at = MonotonicInstant::now();
+        let epoch = Temporal::utc_now()
+            .instant()
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to get current instant: {}", e)))?
+            .epoch_nanoseconds()
+            .0;
+        self.anchor = Some((at, epoch));
+        Ok(epoch)
+    }
+
+    /// The UTC offset at `ns`, from the cached period when it covers `ns`.
+    fn offset_at(&mut self, ns: i128) -> Result<i64, TemporalResult> {
+        let generation = TIME_ZONE_CACHE_GENERATION.load(Ordering::Acquire);
+        if generation == self.generation && (self.valid_from..self.valid_until).contains(&ns) {
+            return Ok(self.offset);
+        }
+        let index = transition_index(&self.tz)?;
+        let error = |e: TemporalError| TemporalResult::range_error(&format!("Failed to get offset: {}", e));
+        self.offset = index.offset(ns).map_err(error)?;
+        self.valid_until = index.next(ns).map_err(error)?.unwrap_or(i128::MAX);
+        self.valid_from = ns;
+        self.generation = generation;
+        Ok(self.offset)
+    }
+
+    fn reading_at(&mut self, ns: i128) -> Result<ZonedClockReading, TemporalResult> {
+        let offset = self.offset_at(ns)?;
+        let local = ns + offset as i128;
+        let day = local.div_euclid(NANOSECONDS_PER_DAY) as i64;
+        let mut time = local.rem_euclid(NANOSECONDS_PER_DAY) as i64;
+        let (year, month, day_of_month) = civil_from_days(day);
+        let mut field = |unit: i64| {
+            let value = time / unit;
+            time %= unit;
+            value
+        };
+        let (hour, minute, second) = (field(3_600_000_000_000), field(60_000_000_000), field(1_000_000_000));
+        let (millisecond, microsecond, nanosecond) = (field(1_000_000), field(1_000), field(1));
+        Ok(ZonedClockReading {
+            epoch_ns: TemporalEpochNanoseconds::from_i128(ns),
+            offset_nanoseconds: offset,
+            year: year as i32,
+            month: month as u8,
+            day: day_of_month as u8,
+            hour: hour as u8,
+            minute: minute as u8,
+            second: second as u8,
+            day_of_week: ((day + 3).rem_euclid(7) + 1) as u8,
+            day_of_year: (day - days_from_civil(year as i32, 1, 1) + 1) as u16,
+            millisecond: millisecond as u16,
+            microsecond: microsecond as u16,
+            nanosecond: nanosecond as u16,
+        })
+    }
+}
+
+/// Creates a clock bound to the time zone `tz_id`.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_clock_new(tz_id: *const c_char) -> HandleResult {
+    stats_scope!("temporal_zoned_clock_new");
+    match parse_time_zone(tz_id, "timezone") {
+        Ok(tz) => HandleResult::success(TemporalHandle::ZonedClock(Mutex::new(ZonedClock::new(tz)))),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+/// Writes the current time in the clock's zone to `out` and returns a
+/// TemporalErrorType. Reads of the same clock from several threads take
+/// turns.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_clock_read(clock: *mut TemporalHandle, out: *mut ZonedClockReading) -> i32 {
+    stats_scope!("temporal_zoned_clock_read");
+    let reading = handle_ref(clock, "clock").and_then(|clock| match &*clock {
+        TemporalHandle::ZonedClock(c) => {
+            let mut c = c.lock().unwrap_or_else(PoisonError::into_inner);
+            c.now().and_then(|ns| c.reading_at(ns))
+        }
+        _ => Err(TemporalResult::type_error("Handle is not a ZonedClock")),
+    });
+    write_status(reading, out)
+}
+
+// ============================================================================
+// Caller-provided output buffers
+// ============================================================================
+
+// The `_into` variants write the formatted string into a buffer owned by the
+// caller instead of returning a heap-allocated `TemporalResult`, so a bridge
+// can format into stack memory and copy once into the JS engine.
+//
+// They follow `snprintf` semantics: up to `cap - 1` bytes plus a NUL are
+// written and `*len` receives the full length, so `*len >= cap` means the
+// output was truncated and the call should be repeated with a larger buffer.
+// The return value is a `TemporalErrorType`; on failure the message is
+// available from `temporal_last_error_message` on the same thread.
+
+/// Longest string produced by `format_instant_fast`: `YYYY-MM-DDTHH:MM:SS.fffffffffZ`.
+const INSTANT_FAST_FORMAT_LEN: usize = 30;
+
+/// A formatted value, kept on the stack when the fast formatter applies.
+enum Formatted {
+    Inline([u8; INSTANT_FAST_FORMAT_LEN], usize),
+    Heap(String),
+}
+
+impl Formatted {
+    fn as_bytes(&self) -> &[u8] {
+        match self {
+            Formatted::Inline(bytes, len) => &bytes[..*len],
+            Formatted::Heap(s) => s.as_bytes(),
+        }
+    }
+
+    fn into_result(self) -> TemporalResult {
+        match self {
+            Formatted::Heap(s) => TemporalResult::success(s),
+            inline => TemporalResult::success(String::from_utf8_lossy(inline.as_bytes()).into_owned()),
+        }
+    }
+}
+
+thread_local! {
+    static LAST_ERROR_MESSAGE: RefCell<Option<CString>> = const { RefCell::new(None) };
+}
+
+/// Inverse of `days_from_civil`.
+fn civil_from_days(days: i64) -> (i64, u32, u32) {
+    let z = days + 719_468;
+    let era = z.div_euclid(146_097);
+    let day_of_era = z - era * 146_097;
+    let year_of_era = (day_of_era - day_of_era / 1_460 + day_of_era / 36_524 - day_of_era / 146_096) / 365;
+    let day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    let shifted_month = (5 * day_of_year + 2) / 153;
+    let day = (day_of_year - (153 * shifted_month + 2) / 5 + 1) as u32;
+    let month = if shifted_month < 10 { shifted_month + 3 } else { shifted_month - 9 } as u32;
+    let year = year_of_era + era * 400 + if month <= 2 { 1 } else { 0 };
+    (year, month, day)
+}
+
+fn write_ascii_digits(out: &mut [u8], mut value: u32) {
+    for byte in out.iter_mut().rev() {
+        *byte = b'0' + (value % 10) as u8;
+        value /= 10;
+    }
+}
+
+/// Formats an instant the way `to_ixdtf_string_with_provider` does with default
+/// options (UTC, fractional seconds with trailing zeros trimmed) without
+/// allocating. Returns `None` outside years 0000-9999, which need the
+/// extended-year form.
+fn format_instant_fast(instant: &Instant) -> Option<Formatted> {
+    let ns = instant.epoch_nanoseconds().0;
+    let seconds = ns.div_euclid(1_000_000_000) as i64;
+    let fraction = ns.rem_euclid(1_000_000_000) as u32;
+    let (year, month, day) = civil_from_days(seconds.div_euclid(86_400));
+    if !(0..=9999).contains(&year) {
+        return None;
+    }
+    let second_of_day = seconds.rem_euclid(86_400) as u32;
+
+    let mut out = *b"0000-00-00T00:00:00.000000000Z";
+    write_ascii_digits(&mut out[0..4], year as u32);
+    write_ascii_digits(&mut out[5..7], month);
+    write_ascii_digits(&mut out[8..10], day);
+    write_ascii_digits(&mut out[11..13], second_of_day / 3_600);
+    write_ascii_digits(&mut out[14..16], second_of_day / 60 % 60);
+    write_ascii_digits(&mut out[17..19], second_of_day % 60);
+
+    let mut len = 19;
+    if fraction != 0 {
+        write_ascii_digits(&mut out[20..29], fraction);
+        len = 29;
+        while out[len - 1] == b'0' {
+            len -= 1;
+        }
+    }
+    out[len] = b'Z';
+    Some(Formatted::Inline(out, len + 1))
+}
+
+fn instant_formatted(instant: &Instant) -> Result<Formatted, TemporalResult> {
+    if let Some(formatted) = format_instant_fast(instant) {
+        return Ok(formatted);
+    }
+    let provider = &*COMPILED_TZ_PROVIDER;
+    instant
+        .to_ixdtf_string_with_provider(None, Default::default(), &provider)
+        .map(Formatted::Heap)
+        .map_err(|e| TemporalResult::range_error(&format!("Failed to format instant: {}", e)))
+}
+
+fn handle_formatted(handle: *const TemporalHandle) -> Result<Formatted, TemporalResult> {
+    match &*handle_ref(handle, "value")? {
+        TemporalHandle::Instant(i) => instant_formatted(i),
+        TemporalHandle::PlainDateTime(dt) => plain_date_time_string(dt).map(Formatted::Heap),
+        TemporalHandle::ZonedDateTime(zdt) => zoned_date_time_string(zdt).map(Formatted::Heap),
+        TemporalHandle::Duration(d) => Ok(Formatted::Heap(d.to_string())),
+        TemporalHandle::ZonedDateTimeRange(_) => Err(TemporalResult::type_error("Range handles have no string form")),
+        TemporalHandle::InstantColumn(_) | TemporalHandle::PlainDateColumn(_) => {
+            Err(TemporalResult::type_error("Column handles have no string form"))
+        }
+        TemporalHandle::ZonedClock(_) => Err(TemporalResult::type_error("Clock handles have no string form")),
+    }
+}
+
+/// Moves an error's message into `temporal_last_error_message` and returns
+/// its `TemporalErrorType`.
+fn record_error(mut error: TemporalResult) -> i32 {
+    let message = if error.error_message.is_null() {
+        None
+    } else {
+        let message = unsafe { CString::from_raw(error.error_message) };
+        error.error_message = ptr::null_mut();
+        Some(message)
+    };
+    LAST_ERROR_MESSAGE.with(|last| *last.borrow_mut() = message);
+    PENDING_VALIDATION.with(|p| p.borrow_mut().kind = None);
+    let error_type = error.error_type;
+    unsafe { temporal_free_result(&mut error) };
+    error_type
+}
+
+/// Copies `value` into the caller's buffer, or records the error for
+/// `temporal_last_error_message`. Returns the `TemporalErrorType`.
+fn write_into(value: Result<Formatted, TemporalResult>, buf: *mut c_char, cap: usize, len: *mut usize) -> i32 {
+    let formatted = match value {
+        Ok(f) => f,
+        Err(error) => return record_error(error),
+    };
+    stats::record_format();
+
+    let bytes = formatted.as_bytes();
+    if !len.is_null() {
+        unsafe { *len = bytes.len() };
+    }
+    if !buf.is_null() && cap > 0 {
+        let n = bytes.len().min(cap - 1);
+        unsafe {
+            ptr::copy_nonoverlapping(bytes.as_ptr(), buf as *mut u8, n);
+            *buf.add(n) = 0;
+        }
+    }
+    TemporalErrorType::None as i32
+}
+
+/// Returns the message of the last failed `_into`, status or `temporal_validate`
+/// call on this thread, or NULL. The pointer stays valid until the next such
+/// failure on the thread.
+#[no_mangle]
+pub extern "C" fn temporal_last_error_message() -> *const c_char {
+    materialize_pending_validation();
+    LAST_ERROR_MESSAGE.with(|last| last.borrow().as_ref().map_or(ptr::null(), |m| m.as_ptr()))
+}
+
+/// Buffer variant of `temporal_instant_from_string`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_from_string_into(
+    s: *const c_char,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_instant_from_string_into");
+    write_into(parse_instant(s, "instant string").and_then(|i| instant_formatted(&i)), buf, cap, len)
+}
+
+/// Buffer variant of `temporal_instant_from_epoch_milliseconds`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_from_epoch_milliseconds_into(
+    ms: i64,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_instant_from_epoch_milliseconds_into");
+    let instant = Instant::try_new((ms as i128).saturating_mul(1_000_000))
+        .map_err(|e| TemporalResult::range_error(&format!("Invalid epoch milliseconds: {}", e)));
+    write_into(instant.and_then(|i| instant_formatted(&i)), buf, cap, len)
+}
+
+fn instant_arithmetic_into<F>(
+    instant_str: *const c_char,
+    duration_str: *const c_char,
+    op_name: &str,
+    op: F,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32
+where
+    F: FnOnce(&Instant, &Duration) -> Result<Instant, TemporalError>,
+{
+    let result = parse_instant(instant_str, "instant").and_then(|instant| {
+        let duration = parse_duration(duration_str, "duration")?;
+        let result = op(&instant, &duration)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to {} duration: {}", op_name, e)))?;
+        instant_formatted(&result)
+    });
+    write_into(result, buf, cap, len)
+}
+
+/// Buffer variant of `temporal_instant_add`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_add_into(
+    instant_str: *const c_char,
+    duration_str: *const c_char,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_instant_add_into");
+    instant_arithmetic_into(instant_str, duration_str, "add", |i, d| i.add(d), buf, cap, len)
+}
+
+/// Buffer variant of `temporal_instant_subtract`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_subtract_into(
+    instant_str: *const c_char,
+    duration_str: *const c_char,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_instant_subtract_into");
+    instant_arithmetic_into(instant_str, duration_str, "subtract", |i, d| i.subtract(d), buf, cap, len)
+}
+
+/// Buffer variant of `temporal_plain_date_time_from_string`.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_from_string_into(
+    s: *const c_char,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_plain_date_time_from_string_into");
+    let result = parse_plain_date_time(s, "plain date time string")
+        .and_then(|dt| plain_date_time_string(&dt))
+        .map(Formatted::Heap);
+    write_into(result, buf, cap, len)
+}
+
+/// Buffer variant of `temporal_zoned_date_time_from_string`.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_from_string_into(
+    s: *const c_char,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_zoned_date_time_from_string_into");
+    let result = parse_zoned_date_time(s, "zoned date time string")
+        .and_then(|zdt| zoned_date_time_string(&zdt))
+        .map(Formatted::Heap);
+    write_into(result, buf, cap, len)
+}
+
+/// Buffer variant of `temporal_handle_to_string`.
+#[no_mangle]
+pub extern "C" fn temporal_handle_to_string_into(
+    handle: *const TemporalHandle,
+    buf: *mut c_char,
+    cap: usize,
+    len: *mut usize,
+) -> i32 {
+    stats_scope!("temporal_handle_to_string_into");
+    write_into(handle_formatted(handle), buf, cap, len)
+}
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+// `temporal_validate` answers "would `from_string` accept this?" with only a
+// `TemporalErrorType`. A failure builds no message: the input is copied into
+// a reused thread-local buffer, and the message is formatted by parsing it
+// again on the regular error path only if `temporal_last_error_message` is
+// called afterwards. Rejecting input on every keystroke therefore costs no
+// allocations once the buffer has grown to the longest input seen.
+
+/// Temporal types accepted by `temporal_validate`.
+#[repr(i32)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum TemporalValueKind {
+    Instant = 0,
+    Duration = 1,
+    PlainTime = 2,
+    PlainDate = 3,
+    PlainDateTime = 4,
+    PlainYearMonth = 5,
+    PlainMonthDay = 6,
+    ZonedDateTime = 7,
+}
+
+impl TemporalValueKind {
+    fn from_i32(kind: i32) -> Option<Self> {
+        Some(match kind {
+            0 => Self::Instant,
+            1 => Self::Duration,
+            2 => Self::PlainTime,
+            3 => Self::PlainDate,
+            4 => Self::PlainDateTime,
+            5 => Self::PlainYearMonth,
+            6 => Self::PlainMonthDay,
+            7 => Self::ZonedDateTime,
+            _ => return None,
+        })
+    }
+
+    /// Whether `from_string` would accept `s`, without formatting an error.
+    fn accepts(self, s: &str) -> bool {
+        match self {
+            Self::Instant => instant_from_str(s).is_ok(),
+            Self::Duration => Duration::from_str(s).is_ok(),
+            Self::PlainTime => PlainTime::from_str(s).is_ok(),
+            Self::PlainDate => plain_date_from_str(s).is_ok(),
+            Self::PlainDateTime => PlainDateTime::from_str(s).is_ok(),
+            Self::PlainYearMonth => PlainYearMonth::from_str(s).is_ok(),
+            Self::PlainMonthDay => PlainMonthDay::from_str(s).is_ok(),
+            Self::ZonedDateTime => {
+                ZonedDateTime::from_utf8(s.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject).is_ok()
+            }
+        }
+    }
+
+    /// The error `from_string` reports for `s`, message included.
+    fn error(self, s: *const c_char) -> Option<TemporalResult> {
+        match self {
+            Self::Instant => parse_instant(s, "instant string").err(),
+            Self::Duration => parse_duration(s, "duration string").err(),
+            Self::PlainTime => parse_plain_time(s, "plain time string").err(),
+            Self::PlainDate => parse_plain_date(s, "plain date string").err(),
+            Self::PlainDateTime => parse_plain_date_time(s, "plain date time string").err(),
+            Self::PlainYearMonth => parse_plain_year_month(s, "plain year month string").err(),
+            Self::PlainMonthDay => parse_plain_month_day(s, "plain month day string").err(),
+            Self::ZonedDateTime => parse_zoned_date_time(s, "zoned date time string").err(),
+        }
+    }
+}
+
+/// The last failed validation on this thread, for formatting its message.
+struct PendingValidation {
+    kind: Option<TemporalValueKind>,
+    input: Vec<u8>,
+    null_input: bool,
+}
+
+thread_local! {
+    static PENDING_VALIDATION: RefCell<PendingValidation> = const {
+        RefCell::new(PendingValidation { kind: None, input: Vec::new(), null_input: false })
+    };
+}
+
+/// Formats the message of a pending validation failure into
+/// `LAST_ERROR_MESSAGE`.
+fn materialize_pending_validation() {
+    let pending = PENDING_VALIDATION.with(|p| {
+        let mut p = p.borrow_mut();
+        let kind = p.kind.take()?;
+        let input = if p.null_input { None } else { CString::new(p.input.as_slice()).ok() };
+        Some((kind, input))
+    });
+    let Some((kind, input)) = pending else {
+        return;
+    };
+    let s = input.as_ref().map_or(ptr::null(), |c| c.as_ptr());
+    if let Some(error) = kind.error(s) {
+        record_error(error);
+    }
+}
+
+/// Returns 0 if `temporal_<kind>_from_string` would accept `s`, otherwise its
+/// `TemporalErrorType`. Nothing is formatted or allocated on failure; the
+/// message is available from `temporal_last_error_message` on the same thread.
+#[no_mangle]
+pub extern "C" fn temporal_validate(kind: i32, s: *const c_char) -> i32 {
+    stats_scope!("temporal_validate");
+    let Some(value_kind) = TemporalValueKind::from_i32(kind) else {
+        return record_error(TemporalResult::range_error(&format!("Unknown value kind {}", kind)));
+    };
+    let bytes = if s.is_null() { None } else { Some(unsafe { std::ffi::CStr::from_ptr(s) }.to_bytes()) };
+    let error_type = match bytes.map(std::str::from_utf8) {
+        Some(Ok(s)) if value_kind.accepts(s) => return TemporalErrorType::None as i32,
+        Some(Ok(_)) => TemporalErrorType::RangeError,
+        Some(Err(_)) | None => TemporalErrorType::TypeError,
+    };
+
+    stats::record_error();
+    PENDING_VALIDATION.with(|p| {
+        let mut p = p.borrow_mut();
+        p.kind = Some(value_kind);
+        p.null_input = bytes.is_none();
+        p.input.clear();
+        p.input.extend_from_slice(bytes.unwrap_or_default());
+    });
+    error_type as i32
+}
+
+// ============================================================================
+// Binary encoding
+// ============================================================================
+
+// Instants and zoned date-times can be stored as fixed-size records instead
+// of ISO strings, for persistence and bulk transfer. A record is
+// `TEMPORAL_BINARY_SIZE` bytes, little-endian:
+//
+//   0      u8   format version (`TEMPORAL_BINARY_VERSION`)
+//   1      u8   kind: 1 = Instant, 2 = ZonedDateTime
+//   2      u8   calendar tag, an index into `CALENDAR_TAGS` (0 = iso8601)
+//   3      u8   zone kind: 0 = none, 1 = IANA zone, 2 = UTC offset
+//   4..8   u32  index into `zone_ids::ZONE_IDS`, or i32 offset in minutes
+//   8..16  i64  epoch seconds, floored
+//   16..20 u32  nanosecond remainder in [0, 1e9)
+//   20..24      reserved, zero
+//
+// Zones outside the table and unknown calendars are a RangeError rather than
+// a lossy encoding.
+
+mod zone_ids;
+
+/// Size in bytes of an encoded Instant or ZonedDateTime.
+pub const TEMPORAL_BINARY_SIZE: usize = 24;
+
+/// Format version written to byte 0 of every record.
+pub const TEMPORAL_BINARY_VERSION: u8 = 1;
+
+const BINARY_KIND_INSTANT: u8 = 1;
+const BINARY_KIND_ZONED_DATE_TIME: u8 = 2;
+
+const BINARY_ZONE_NONE: u8 = 0;
+const BINARY_ZONE_IANA: u8 = 1;
+const BINARY_ZONE_OFFSET: u8 = 2;
+
+/// Calendar tags for the binary encoding. Append-only, like `ZONE_IDS`.
+const CALENDAR_TAGS: &[&str] = &[
+    "iso8601",
+    "buddhist",
+    "chinese",
+    "coptic",
+    "dangi",
+    "ethioaa",
+    "ethiopic",
+    "gregory",
+    "hebrew",
+    "indian",
+    "islamic-civil",
+    "islamic-tbla",
+    "islamic-umalqura",
+    "japanese",
+    "persian",
+    "roc",
+];
+
+/// Maps lowercased zone identifiers to their `ZONE_IDS` index.
+fn zone_id_index() -> &'static HashMap<String, u32> {
+    static INDEX: OnceLock<HashMap<String, u32>> = OnceLock::new();
+    INDEX.get_or_init(|| {
+        zone_ids::ZONE_IDS
+            .iter()
+            .enumerate()
+            .map(|(i, id)| (id.to_ascii_lowercase(), i as u32))
+            .collect()
+    })
+}
+
+/// Parses a `±HH:MM` offset time zone identifier into minutes.
+fn offset_id_minutes(id: &str) -> Option<i32> {
+    let bytes = id.as_bytes();
+    if bytes.len() != 6 || bytes[3] != b':' {
+        return None;
+    }
+    let sign = match bytes[0] {
+        b'+' => 1,
+        b'-' => -1,
+        _ => return None,
+    };
+    let hours: i32 = id.get(1..3)?.parse().ok()?;
+    let minutes: i32 = id.get(4..6)?.parse().ok()?;
+    Some(sign * (hours * 60 + minutes))
+}
+
+fn offset_id(minutes: i32) -> String {
+    let sign = if minutes < 0 { '-' } else { '+' };
+    let minutes = minutes.unsigned_abs();
+    format!("{}{:02}:{:02}", sign, minutes / 60, minutes % 60)
+}
+
+/// A decoded record, before its zone and calendar are resolved.
+struct BinaryRecord {
+    kind: u8,
+    calendar: u8,
+    zone_kind: u8,
+    zone: u32,
+    epoch_nanoseconds: i128,
+}
+
+impl BinaryRecord {
+    fn encode(&self) -> [u8; TEMPORAL_BINARY_SIZE] {
+        let key = TemporalEpochNanoseconds::from_i128(self.epoch_nanoseconds);
+        let mut bytes = [0u8; TEMPORAL_BINARY_SIZE];
+        bytes[0] = TEMPORAL_BINARY_VERSION;
+        bytes[1] = self.kind;
+        bytes[2] = self.calendar;
+        bytes[3] = self.zone_kind;
+        bytes[4..8].copy_from_slice(&self.zone.to_le_bytes());
+        bytes[8..16].copy_from_slice(&key.seconds.to_le_bytes());
+        bytes[16..20].copy_from_slice(&(key.nanoseconds as u32).to_le_bytes());
+        bytes
+    }
+
+    fn decode(bytes: &[u8; TEMPORAL_BINARY_SIZE], expected_kind: u8) -> Result<Self, TemporalResult> {
+        let word = |at: usize| u32::from_le_bytes([bytes[at], bytes[at + 1], bytes[at + 2], bytes[at + 3]]);
+        if bytes[0] != TEMPORAL_BINARY_VERSION {
+            return Err(TemporalResult::range_error(&format!("Unsupported binary format version {}", bytes[0])));
+        }
+        if bytes[1] != expected_kind {
+            return Err(TemporalResult::type_error(&format!("Binary record has kind {}, expected {}", bytes[1], expected_kind)));
+        }
+        if word(20) != 0 {
+            return Err(TemporalResult::range_error("Reserved bytes of binary record must be zero"));
+        }
+        let seconds = i64::from_le_bytes(bytes[8..16].try_into().unwrap());
+        let nanoseconds = word(16);
+        if nanoseconds >= 1_000_000_000 {
+            return Err(TemporalResult::range_error("Epoch nanoseconds remainder must be in [0, 1e9)"));
+        }
+        Ok(Self {
+            kind: bytes[1],
+            calendar: bytes[2],
+            zone_kind: bytes[3],
+            zone: word(4),
+            epoch_nanoseconds: seconds as i128 * 1_000_000_000 + nanoseconds as i128,
+        })
+    }
+
+    fn instant(&self) -> Result<Instant, TemporalResult> {
+        if self.calendar != 0 || self.zone_kind != BINARY_ZONE_NONE || self.zone != 0 {
+            return Err(TemporalResult::range_error("Instant record cannot carry a time zone or calendar"));
+        }
+        Instant::try_new(self.epoch_nanoseconds)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid epoch nanoseconds: {}", e)))
+    }
+
+    fn time_zone(&self) -> Result<TimeZone, TemporalResult> {
+        let id = match self.zone_kind {
+            BINARY_ZONE_IANA => zone_ids::ZONE_IDS
+                .get(self.zone as usize)
+                .map(|id| id.to_string())
+                .ok_or_else(|| TemporalResult::range_error(&format!("Unknown time zone index {}", self.zone)))?,
+            BINARY_ZONE_OFFSET => offset_id(self.zone as i32),
+            kind => return Err(TemporalResult::range_error(&format!("Unknown time zone kind {}", kind))),
+        };
+        resolve_time_zone(&id).map_err(|e| TemporalResult::range_error(&format!("Invalid time zone '{}': {}", id, e)))
+    }
+
+    fn zoned_date_time(&self) -> Result<ZonedDateTime, TemporalResult> {
+        let tz = self.time_zone()?;
+        let calendar_id = CALENDAR_TAGS
+            .get(self.calendar as usize)
+            .ok_or_else(|| TemporalResult::range_error(&format!("Unknown calendar tag {}", self.calendar)))?;
+        let calendar = Calendar::from_str(calendar_id)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid calendar '{}': {}", calendar_id, e)))?;
+        ZonedDateTime::try_new(self.epoch_nanoseconds, tz, calendar)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid zoned date time: {}", e)))
+    }
+
+    fn from_instant(instant: &Instant) -> Self {
+        Self {
+            kind: BINARY_KIND_INSTANT,
+            calendar: 0,
+            zone_kind: BINARY_ZONE_NONE,
+            zone: 0,
+            epoch_nanoseconds: instant.epoch_nanoseconds().0,
+        }
+    }
+
+    fn from_zoned_date_time(zdt: &ZonedDateTime) -> Result<Self, TemporalResult> {
+        let calendar_id = zdt.calendar().identifier();
+        let calendar = CALENDAR_TAGS
+            .iter()
+            .position(|tag| *tag == calendar_id)
+            .ok_or_else(|| TemporalResult::range_error(&format!("Calendar '{}' has no binary encoding", calendar_id)))?;
+        let id = zdt
+            .time_zone()
+            .identifier()
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to get timezone id: {}", e)))?;
+        let (zone_kind, zone) = match offset_id_minutes(&id) {
+            Some(minutes) => (BINARY_ZONE_OFFSET, minutes as u32),
+            None => match zone_id_index().get(&id.to_ascii_lowercase()) {
+                Some(&index) => (BINARY_ZONE_IANA, index),
+                None => {
+                    return Err(TemporalResult::range_error(&format!("Time zone '{}' has no binary encoding", id)));
+                }
+            },
+        };
+        Ok(Self {
+            kind: BINARY_KIND_ZONED_DATE_TIME,
+            calendar: calendar as u8,
+            zone_kind,
+            zone,
+            epoch_nanoseconds: zdt.epoch_nanoseconds().0,
+        })
+    }
+}
+
+fn binary_input<'a>(bytes: *const u8) -> Result<&'a [u8; TEMPORAL_BINARY_SIZE], TemporalResult> {
+    if bytes.is_null() {
+        return Err(TemporalResult::type_error("Binary record cannot be null"));
+    }
+    Ok(unsafe { &*(bytes as *const [u8; TEMPORAL_BINARY_SIZE]) })
+}
+
+/// Writes a record to `out`, or records the error. Returns the `TemporalErrorType`.
+fn write_binary_record(record: Result<BinaryRecord, TemporalResult>, out: *mut u8) -> i32 {
+    match record {
+        Ok(_) if out.is_null() => record_error(TemporalResult::type_error("Output buffer cannot be null")),
+        Ok(record) => {
+            unsafe { ptr::copy_nonoverlapping(record.encode().as_ptr(), out, TEMPORAL_BINARY_SIZE) };
+            TemporalErrorType::None as i32
+        }
+        Err(e) => record_error(e),
+    }
+}
+
+/// Encodes an instant string into the `TEMPORAL_BINARY_SIZE` bytes at `out`.
+/// Returns a `TemporalErrorType`; the message is available from
+/// `temporal_last_error_message`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_to_bytes(s: *const c_char, out: *mut u8) -> i32 {
+    stats_scope!("temporal_instant_to_bytes");
+    write_binary_record(parse_instant(s, "instant").map(|i| BinaryRecord::from_instant(&i)), out)
+}
+
+/// Decodes an Instant record into an ISO 8601 string.
+#[no_mangle]
+pub extern "C" fn temporal_instant_from_bytes(bytes: *const u8) -> TemporalResult {
+    stats_scope!("temporal_instant_from_bytes");
+    match binary_input(bytes)
+        .and_then(|b| BinaryRecord::decode(b, BINARY_KIND_INSTANT))
+        .and_then(|r| r.instant())
+    {
+        Ok(instant) => format_instant(&instant),
+        Err(e) => e,
+    }
+}
+
+/// Encodes a zoned date-time string into the `TEMPORAL_BINARY_SIZE` bytes at
+/// `out`. Returns a `TemporalErrorType`; the message is available from
+/// `temporal_last_error_message`.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_to_bytes(s: *const c_char, out: *mut u8) -> i32 {
+    stats_scope!("temporal_zoned_date_time_to_bytes");
+    write_binary_record(
+        parse_zoned_date_time(s, "zoned date time").and_then(|z| BinaryRecord::from_zoned_date_time(&z)),
+        out,
+    )
+}
+
+/// Decodes a ZonedDateTime record into an ISO 8601 string with its time zone
+/// and calendar annotations.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_from_bytes(bytes: *const u8) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_from_bytes");
+    match binary_input(bytes)
+        .and_then(|b| BinaryRecord::decode(b, BINARY_KIND_ZONED_DATE_TIME))
+        .and_then(|r| r.zoned_date_time())
+    {
+        Ok(zdt) => format_zoned_date_time(&zdt),
+        Err(e) => e,
+    }
+}
+
+/// Encodes `count` strings back to back into `out`, which must have room for
+/// `count * TEMPORAL_BINARY_SIZE` bytes. Nothing is written if any input fails.
+fn write_binary_batch<T>(
+    strings: *const *const c_char,
+    count: i32,
+    out: *mut u8,
+    param_name: &str,
+    parse: fn(*const c_char, &str) -> Result<T, TemporalResult>,
+    encode: fn(&T) -> Result<BinaryRecord, TemporalResult>,
+) -> BatchResult {
+    if count < 0 {
+        return BatchResult::from_error(-1, TemporalResult::range_error("count cannot be negative"));
+    }
+    if count > 0 && strings.is_null() {
+        return BatchResult::from_error(-1, TemporalResult::type_error("Input array cannot be null"));
+    }
+    let inputs = if count == 0 {
+        SharedInputs(&[])
+    } else {
+        SharedInputs(unsafe { std::slice::from_raw_parts(strings, count as usize) })
+    };
+    let mut records = Vec::new();
+    let encoded = batch_map(inputs.len(), &mut records, |i| {
+        parse(inputs.get(i), param_name).and_then(|value| encode(&value)).map(|record| record.encode())
+    });
+    if let Err((i, e)) = encoded {
+        return BatchResult::from_error(i as i32, e);
+    }
+    let out = match batch_output(out as *mut [u8; TEMPORAL_BINARY_SIZE], records.len()) {
+        Ok(o) => o,
+        Err(e) => return e,
+    };
+    out.copy_from_slice(&records);
+    BatchResult::success(records.len())
+}
+
+/// Encodes `count` instant strings into consecutive records at `out`.
+#[no_mangle]
+pub extern "C" fn temporal_instant_to_bytes_many(
+    strings: *const *const c_char,
+    count: i32,
+    out: *mut u8,
+) -> BatchResult {
+    stats_scope!("temporal_instant_to_bytes_many");
+    write_binary_batch(strings, count, out, "instant", parse_instant, |i| Ok(BinaryRecord::from_instant(i)))
+}
+
+/// Encodes `count` zoned date-time strings into consecutive records at `out`.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_to_bytes_many(
+    strings: *const *const c_char,
+    count: i32,
+    out: *mut u8,
+) -> BatchResult {
+    stats_scope!("temporal_zoned_date_time_to_bytes_many");
+    write_binary_batch(strings, count, out, "zoned date time", parse_zoned_date_time, BinaryRecord::from_zoned_date_time)
+}
+
+// ============================================================================
+// Streaming parse
+// ============================================================================
+
+// `temporal_instant_parse_stream` parses instant strings straight out of a
+// UTF-8 buffer such as a response body, with no C string or `TemporalResult`
+// per item. Items are newline-separated lines or the strings of a JSON
+// array. A body can be fed in chunks: `*consumed` receives the offset just
+// past the last item processed, and an item cut off by the end of the chunk
+// is left for the next call unless `last_chunk` is set.
+
+/// Layouts accepted by `temporal_instant_parse_stream`.
+#[repr(i32)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum TemporalStreamFormat {
+    /// One item per line; blank lines are skipped and whitespace trimmed.
+    Lines = 0,
+    /// The string elements of a JSON array.
+    JsonArray = 1,
+}
+
+impl TemporalStreamFormat {
+    fn from_i32(format: i32) -> Option<Self> {
+        match format {
+            0 => Some(Self::Lines),
+            1 => Some(Self::JsonArray),
+            _ => None,
+        }
+    }
+}
+
+/// The bytes of one item, or why it isn't an instant string at all.
+type StreamItem<'a> = Result<&'a [u8], &'static str>;
+
+/// Finds the item starting at or after `pos`, returning it with the offset
+/// just past it. Returns `None` at the end of the input, or at an item the
+/// end of a non-final chunk cuts off.
+fn next_stream_item(
+    buf: &[u8],
+    pos: usize,
+    format: TemporalStreamFormat,
+    last_chunk: bool,
+) -> Option<(StreamItem<'_>, usize)> {
+    match format {
+        TemporalStreamFormat::Lines => {
+            let mut start = pos;
+            loop {
+                if start >= buf.len() {
+                    return None;
+                }
+                let (line, next) = match buf[start..].iter().position(|&b| b == b'\n') {
+                    Some(i) => (&buf[start..start + i], start + i + 1),
+                    None if last_chunk => (&buf[start..], buf.len()),
+                    None => return None,
+                };
+                let line = line.trim_ascii();
+                if !line.is_empty() {
+                    return Some((Ok(line), next));
+                }
+                start = next;
+            }
+        }
+        TemporalStreamFormat::JsonArray => {
+            let is_separator = |b: u8| b.is_ascii_whitespace() || matches!(b, b'[' | b']' | b',');
+            let start = pos + buf[pos.min(buf.len())..].iter().position(|&b| !is_separator(b))?;
+            if buf[start] != b'"' {
+                let end = buf[start..].iter().position(|&b| is_separator(b)).map(|i| start + i);
+                return match end {
+                    Some(end) => Some((Err("Array elements must be strings"), end)),
+                    None if last_chunk => Some((Err("Array elements must be strings"), buf.len())),
+                    None => None,
+                };
+            }
+            let mut i = start + 1;
+            let mut escaped = false;
+            while i < buf.len() {
+                match buf[i] {
+                    b'\\' => {
+                        escaped = true;
+                        i += 2;
+                    }
+                    b'"' if escaped => return Some((Err("Escaped instant strings are not supported"), i + 1)),
+                    b'"' => return Some((Ok(&buf[start + 1..i]), i + 1)),
+                    _ => i += 1,
+                }
+            }
+            last_chunk.then_some((Err("Unterminated string"), buf.len()))
+        }
+    }
+}
+
+fn parse_stream_item(item: StreamItem<'_>) -> Result<i128, TemporalErrorType> {
+    let s = item
+        .ok()
+        .and_then(|bytes| std::str::from_utf8(bytes).ok())
+        .ok_or(TemporalErrorType::TypeError)?;
+    stats::record_parse();
+    instant_from_str(s)
+        .map(|instant| instant.epoch_nanoseconds().0)
+        .map_err(|_| TemporalErrorType::RangeError)
+}
+
+/// The error `parse_stream_item` reported, message included.
+fn stream_item_error(item: StreamItem<'_>) -> TemporalResult {
+    match item.map(std::str::from_utf8) {
+        Err(message) => TemporalResult::type_error(message),
+        Ok(Err(_)) => TemporalResult::type_error("Invalid UTF-8 in instant string"),
+        Ok(Ok(s)) => match instant_from_str(s) {
+            Err(e) => TemporalResult::range_error(&format!("Invalid instant '{}': {}", s, e)),
+            Ok(_) => TemporalResult::range_error(&format!("Invalid instant '{}'", s)),
+        },
+    }
+}
+
+/// Parses the instant strings in `buf[..len]` into `out`, which must have
+/// room for `cap` elements, stopping once `cap` items are written.
+///
+/// With `out_errors` (also `cap` elements) every item gets its
+/// `TemporalErrorType`, failed items leave a zero epoch in `out`, and parsing
+/// continues. Without it the first invalid item fails the call. With `out`
+/// NULL nothing is parsed and `count` is the number of items in the buffer.
+#[no_mangle]
+pub extern "C" fn temporal_instant_parse_stream(
+    buf: *const u8,
+    len: usize,
+    format: i32,
+    last_chunk: i32,
+    out: *mut TemporalEpochNanoseconds,
+    out_errors: *mut i8,
+    cap: i32,
+    consumed: *mut usize,
+) -> BatchResult {
+    stats_scope!("temporal_instant_parse_stream");
+    let Some(format) = TemporalStreamFormat::from_i32(format) else {
+        return BatchResult::from_error(-1, TemporalResult::range_error(&format!("Unknown stream format {}", format)));
+    };
+    if cap < 0 {
+        return BatchResult::from_error(-1, TemporalResult::range_error("cap cannot be negative"));
+    }
+    let input: &[u8] = match (buf.is_null(), len) {
+        (_, 0) => &[],
+        (true, _) => return BatchResult::from_error(-1, TemporalResult::type_error("Input buffer cannot be null")),
+        (false, _) => unsafe { std::slice::from_raw_parts(buf, len) },
+    };
+    let (mut out, mut errors) = if out.is_null() {
+        (None, None)
+    } else {
+        let out = unsafe { std::slice::from_raw_parts_mut(out, cap as usize) };
+        let errors = (!out_errors.is_null()).then(|| unsafe { std::slice::from_raw_parts_mut(out_errors, cap as usize) });
+        (Some(out), errors)
+    };
+
+    let mut pos = 0;
+    let mut count = 0;
+    let mut failure = None;
+    while let Some((item, next)) = next_stream_item(input, pos, format, last_chunk != 0) {
+        if let Some(out) = out.as_deref_mut() {
+            if count == out.len() {
+                break;
+            }
+            match (parse_stream_item(item), errors.as_deref_mut()) {
+                (Ok(ns), errors) => {
+                    out[count] = TemporalEpochNanoseconds::from_i128(ns);
+                    if let Some(errors) = errors {
+                        errors[count] = TemporalErrorType::None as i8;
+                    }
+                }
+                (Err(error_type), Some(errors)) => {
+                    out[count] = TemporalEpochNanoseconds::default();
+                    errors[count] = error_type as i8;
+                }
+                (Err(_), None) => {
+                    failure = Some(stream_item_error(item));
+                    break;
+                }
+            }
+        }
+        count += 1;
+        pos = next;
+    }
+    if !consumed.is_null() {
+        unsafe { *consumed = pos };
+    }
+    match failure {
+        Some(error) => BatchResult::from_error(count as i32, error),
+        None => BatchResult::success(count),
+    }
+}
+
+// ============================================================================
+// Interned identifiers
+// ============================================================================
+
+// A time zone or calendar can be interned once into a small integer ID and
+// passed to the `_interned` variants instead of its identifier, which then
+// skip parsing and normalizing the identifier on every call. IDs are
+// process-wide and never reused. The tables are bounded: there are only so
+// many distinct zones (IANA names plus minute offsets) and calendars.
+
+const MAX_INTERNED_TIME_ZONES: usize = 8192;
+const MAX_INTERNED_CALENDARS: usize = 64;
+
+/// Values by ID, and IDs by every identifier spelling seen so far.
+struct InternEntries {
+    /// Number of slots filled so far.
+    len: usize,
+    ids: HashMap<String, u32>,
+}
+
+/// Slots per lazily allocated segment of an InternTable.
+const INTERN_SEGMENT_SIZE: usize = 256;
+
+/// Values live in slots that are written once, so `get` is a lock-free load
+/// that never waits for a thread interning a new identifier. Only `intern`
+/// takes the lock, and only for identifiers it hasn't seen. Slots are
+/// allocated a segment at a time, so a table sized for every zone costs
+/// little until zones are interned.
+struct InternTable<T> {
+    segments: Box<[OnceLock<Box<[OnceLock<T>]>>]>,
+    capacity: usize,
+    entries: RwLock<InternEntries>,
+    kind: &'static str,
+}
+
+impl<T: Clone> InternTable<T> {
+    fn new(capacity: usize, kind: &'static str) -> Self {
+        Self {
+            segments: (0..capacity.div_ceil(INTERN_SEGMENT_SIZE)).map(|_| OnceLock::new()).collect(),
+            capacity,
+            entries: RwLock::new(InternEntries { len: 0, ids: HashMap::new() }),
+            kind,
+        }
+    }
+
+    fn slot(&self, id: usize) -> Option<&OnceLock<T>> {
+        let segment = self.segments.get(id / INTERN_SEGMENT_SIZE)?.get()?;
+        Some(&segment[id % INTERN_SEGMENT_SIZE])
+    }
+
+    fn get(&self, id: u32) -> Result<T, TemporalResult> {
+        self.slot(id as usize)
+            .and_then(OnceLock::get)
+            .cloned()
+            .ok_or_else(|| TemporalResult::range_error(&format!("Unknown interned {} {}", self.kind, id)))
+    }
+
+    /// Returns the ID of `identifier`, resolving it to a value and its
+    /// normalized identifier the first time it is seen.
+    fn intern(
+        &self,
+        identifier: &str,
+        resolve: impl FnOnce(&str) -> Result<(T, String), TemporalResult>,
+    ) -> Result<u32, TemporalResult> {
+        if let Some(&id) = self.entries.read().unwrap_or_else(PoisonError::into_inner).ids.get(identifier) {
+            return Ok(id);
+        }
+        let (value, normalized) = resolve(identifier)?;
+
+        let mut entries = self.entries.write().unwrap_or_else(PoisonError::into_inner);
+        let id = match entries.ids.get(&normalized) {
+            Some(&id) => id,
+            None => {
+                if entries.len >= self.capacity {
+                    return Err(TemporalResult::range_error(&format!("Too many interned {}s", self.kind)));
+                }
+                let id = entries.len as u32;
+                // The slot is filled before its ID is published in `ids`.
+                let segment = self.segments[entries.len / INTERN_SEGMENT_SIZE]
+                    .get_or_init(|| (0..INTERN_SEGMENT_SIZE).map(|_| OnceLock::new()).collect());
+                let _ = segment[entries.len % INTERN_SEGMENT_SIZE].set(value);
+                entries.len += 1;
+                entries.ids.insert(normalized.clone(), id);
+                id
+            }
+        };
+        // Other spellings are remembered only while the map stays small, so
+        // arbitrary casing of one zone can't grow it without bound.
+        if identifier != normalized && entries.ids.len() < 2 * self.capacity {
+            entries.ids.insert(identifier.to_string(), id);
+        }
+        Ok(id)
+    }
+}
+
+fn interned_time_zones() -> &'static InternTable<TimeZone> {
+    static TABLE: OnceLock<InternTable<TimeZone>> = OnceLock::new();
+    TABLE.get_or_init(|| InternTable::new(MAX_INTERNED_TIME_ZONES, "time zone"))
+}
+
+fn interned_calendars() -> &'static InternTable<Calendar> {
+    static TABLE: OnceLock<InternTable<Calendar>> = OnceLock::new();
+    TABLE.get_or_init(|| InternTable::new(MAX_INTERNED_CALENDARS, "calendar"))
+}
+
+fn interned_time_zone(id: u32) -> Result<TimeZone, TemporalResult> {
+    interned_time_zones().get(id)
+}
+
+fn interned_calendar(id: u32) -> Result<Calendar, TemporalResult> {
+    interned_calendars().get(id)
+}
+
+/// Writes the interned ID of a time zone identifier to `out`. Returns a
+/// `TemporalErrorType`; the message is available from
+/// `temporal_last_error_message`.
+#[no_mangle]
+pub extern "C" fn temporal_intern_time_zone(identifier: *const c_char, out: *mut u32) -> i32 {
+    stats_scope!("temporal_intern_time_zone");
+    if out.is_null() {
+        return record_error(TemporalResult::type_error("Output cannot be null"));
+    }
+    let id = parse_c_str(identifier, "timezone").and_then(|s| {
+        interned_time_zones().intern(s, |s| {
+            let tz = resolve_time_zone(s)
+                .map_err(|e| TemporalResult::range_error(&format!("Invalid timezone '{}': {}", s, e)))?;
+            let normalized = tz
+                .identifier()
+                .map_err(|e| TemporalResult::range_error(&format!("Failed to get timezone id: {}", e)))?;
+            Ok((tz, normalized))
+        })
+    });
+    match id {
+        Ok(id) => {
+            unsafe { *out = id };
+            TemporalErrorType::None as i32
+        }
+        Err(e) => record_error(e),
+    }
+}
+
+/// Writes the interned ID of a calendar identifier to `out`. Returns a
+/// `TemporalErrorType`; the message is available from
+/// `temporal_last_error_message`.
+#[no_mangle]
+pub extern "C" fn temporal_intern_calendar(identifier: *const c_char, out: *mut u32) -> i32 {
+    stats_scope!("temporal_intern_calendar");
+    if out.is_null() {
+        return record_error(TemporalResult::type_error("Output cannot be null"));
+    }
+    let id = parse_c_str(identifier, "calendar id").and_then(|s| {
+        interned_calendars().intern(s, |s| {
+            let calendar = Calendar::from_str(s)
+                .map_err(|e| TemporalResult::range_error(&format!("Invalid calendar: {}", e)))?;
+            let normalized = calendar.identifier().to_string();
+            Ok((calendar, normalized))
+        })
+    });
+    match id {
+        Ok(id) => {
+            unsafe { *out = id };
+            TemporalErrorType::None as i32
+        }
+        Err(e) => record_error(e),
+    }
+}
+
+/// Returns the normalized identifier of an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_interned_time_zone_identifier(time_zone: u32) -> TemporalResult {
+    stats_scope!("temporal_interned_time_zone_identifier");
+    match interned_time_zone(time_zone).map(|tz| tz.identifier()) {
+        Ok(Ok(id)) => TemporalResult::success(id),
+        Ok(Err(e)) => TemporalResult::range_error(&format!("Failed to get timezone id: {}", e)),
+        Err(e) => e,
+    }
+}
+
+/// Returns the identifier of an interned calendar.
+#[no_mangle]
+pub extern "C" fn temporal_interned_calendar_identifier(calendar: u32) -> TemporalResult {
+    stats_scope!("temporal_interned_calendar_identifier");
+    match interned_calendar(calendar) {
+        Ok(c) => TemporalResult::success(c.identifier().to_string()),
+        Err(e) => e,
+    }
+}
+
+/// `temporal_time_zone_get_offset_nanoseconds_for` with an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_offset_nanoseconds_for_interned(
+    time_zone: u32,
+    instant_str: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_offset_nanoseconds_for_interned");
+    time_zone_offset_nanoseconds_for(interned_time_zone(time_zone), instant_str)
+}
+
+/// `temporal_time_zone_get_offset_string_for` with an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_offset_string_for_interned(
+    time_zone: u32,
+    instant_str: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_offset_string_for_interned");
+    time_zone_offset_string_for(interned_time_zone(time_zone), instant_str)
+}
+
+/// `temporal_time_zone_get_plain_date_time_for` with an interned time zone
+/// and calendar.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_plain_date_time_for_interned(
+    time_zone: u32,
+    instant_str: *const c_char,
+    calendar: u32,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_plain_date_time_for_interned");
+    time_zone_plain_date_time_for(interned_time_zone(time_zone), instant_str, || interned_calendar(calendar))
+}
+
+/// `temporal_time_zone_get_instant_for` with an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_instant_for_interned(
+    time_zone: u32,
+    dt_str: *const c_char,
+    disambiguation: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_instant_for_interned");
+    time_zone_instant_for(interned_time_zone(time_zone), dt_str, disambiguation)
+}
+
+/// `temporal_time_zone_get_next_transition` with an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_next_transition_interned(
+    time_zone: u32,
+    instant_str: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_next_transition_interned");
+    time_zone_transition(interned_time_zone(time_zone), instant_str, TransitionDirection::Next)
+}
+
+/// `temporal_time_zone_get_previous_transition` with an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_previous_transition_interned(
+    time_zone: u32,
+    instant_str: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_time_zone_get_previous_transition_interned");
+    time_zone_transition(interned_time_zone(time_zone), instant_str, TransitionDirection::Previous)
+}
+
+/// `temporal_time_zone_get_transitions` with an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_transitions_interned(
+    time_zone: u32,
+    start: TemporalEpochNanoseconds,
+    end: TemporalEpochNanoseconds,
+    out: *mut TemporalEpochNanoseconds,
+    cap: i32,
+) -> BatchResult {
+    stats_scope!("temporal_time_zone_get_transitions_interned");
+    time_zone_transitions(interned_time_zone(time_zone), start, end, out, cap)
+}
+
+/// `temporal_time_zone_get_plain_date_times_for_many` with an interned time zone.
+#[no_mangle]
+pub extern "C" fn temporal_time_zone_get_plain_date_times_for_many_interned(
+    time_zone: u32,
+    epoch_ns: *const TemporalEpochNanoseconds,
+    count: i32,
+    out: *mut i32,
+) -> BatchResult {
+    stats_scope!("temporal_time_zone_get_plain_date_times_for_many_interned");
+    time_zone_plain_date_times_for_many(interned_time_zone(time_zone), epoch_ns, count, out)
+}
+
+/// Converts epoch nanoseconds to a ZonedDateTime string in an interned time
+/// zone and calendar, without an instant or identifier string.
+#[no_mangle]
+pub extern "C" fn temporal_instant_to_zoned_date_time_interned(
+    epoch_ns: TemporalEpochNanoseconds,
+    calendar: u32,
+    time_zone: u32,
+) -> TemporalResult {
+    stats_scope!("temporal_instant_to_zoned_date_time_interned");
+    let zdt = epoch_ns.to_instant().and_then(|instant| {
+        let tz = interned_time_zone(time_zone)?;
+        let calendar = interned_calendar(calendar)?;
+        ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, calendar)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to create zoned date time: {}", e)))
+    });
+    match zdt {
+        Ok(zdt) => format_zoned_date_time(&zdt),
+        Err(e) => e,
+    }
+}
+
+// ============================================================================
+// Formatting options
+// ============================================================================
+
+// `toString(options)`: precision and rounding of the seconds, plus which
+// annotations to print. `fractional_second_digits` is 0-9, or negative for
+// "auto"; NULL strings take the Temporal defaults.
+
+fn parse_to_string_rounding_options(
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+) -> Result<ToStringRoundingOptions, TemporalResult> {
+    let precision = match fractional_second_digits {
+        d if d < 0 => Precision::Auto,
+        d @ 0..=9 => Precision::Digit(d as u8),
+        d => return Err(TemporalResult::range_error(&format!("Invalid fractionalSecondDigits: {}", d))),
+    };
+    let smallest_unit = if smallest_unit.is_null() {
+        None
+    } else {
+        let s = parse_c_str(smallest_unit, "smallest unit")?;
+        Some(Unit::from_str(s).map_err(|_| TemporalResult::range_error(&format!("Invalid smallest unit: {}", s)))?)
+    };
+    let rounding_mode = if rounding_mode.is_null() {
+        None
+    } else {
+        let s = parse_c_str(rounding_mode, "rounding mode")?;
+        Some(RoundingMode::from_str(s).map_err(|_| TemporalResult::range_error(&format!("Invalid rounding mode: {}", s)))?)
+    };
+    Ok(ToStringRoundingOptions { precision, smallest_unit, rounding_mode })
+}
+
+const DISPLAY_CALENDARS: [(&str, DisplayCalendar); 4] = [
+    ("auto", DisplayCalendar::Auto),
+    ("always", DisplayCalendar::Always),
+    ("never", DisplayCalendar::Never),
+    ("critical", DisplayCalendar::Critical),
+];
+const DISPLAY_TIME_ZONES: [(&str, DisplayTimeZone); 3] = [
+    ("auto", DisplayTimeZone::Auto),
+    ("never", DisplayTimeZone::Never),
+    ("critical", DisplayTimeZone::Critical),
+];
+const DISPLAY_OFFSETS: [(&str, DisplayOffset); 2] = [("auto", DisplayOffset::Auto), ("never", DisplayOffset::Never)];
+
+/// Looks up an optional display option string in `values`: 0 for NULL,
+/// otherwise 1 + its index.
+fn display_option_code<T>(s: *const c_char, name: &str, values: &[(&str, T)]) -> Result<u64, TemporalResult> {
+    if s.is_null() {
+        return Ok(0);
+    }
+    let str_val = parse_c_str(s, name)?;
+    values
+        .iter()
+        .position(|(key, _)| *key == str_val)
+        .map(|i| i as u64 + 1)
+        .ok_or_else(|| TemporalResult::range_error(&format!("Invalid {}: {}", name, str_val)))
+}
+
+/// The display option `display_option_code` returned `code` for, or None if
+/// no option has that code.
+fn display_option<T: Copy>(code: u64, default: T, values: &[(&str, T)]) -> Option<T> {
+    match code {
+        0 => Some(default),
+        code => values.get(code as usize - 1).map(|&(_, value)| value),
+    }
+}
+
+/// Parses an optional display option string against its allowed values.
+fn parse_display_option<T: Copy>(
+    s: *const c_char,
+    name: &str,
+    default: T,
+    values: &[(&str, T)],
+) -> Result<T, TemporalResult> {
+    let code = display_option_code(s, name, values)?;
+    Ok(display_option(code, default, values).unwrap_or(default))
+}
+
+/// `toString(options)`, parsed.
+struct ToStringSettings {
+    rounding: ToStringRoundingOptions,
+    calendar: DisplayCalendar,
+    time_zone: DisplayTimeZone,
+    offset: DisplayOffset,
+}
+
+fn parse_to_string_settings(
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+    calendar_name: *const c_char,
+    time_zone_name: *const c_char,
+    offset: *const c_char,
+) -> Result<ToStringSettings, TemporalResult> {
+    Ok(ToStringSettings {
+        rounding: parse_to_string_rounding_options(fractional_second_digits, smallest_unit, rounding_mode)?,
+        calendar: parse_display_option(calendar_name, "calendarName", DisplayCalendar::Auto, &DISPLAY_CALENDARS)?,
+        time_zone: parse_display_option(time_zone_name, "timeZoneName", DisplayTimeZone::Auto, &DISPLAY_TIME_ZONES)?,
+        offset: parse_display_option(offset, "offset", DisplayOffset::Auto, &DISPLAY_OFFSETS)?,
+    })
+}
+
+fn instant_to_string_with(
+    instant_str: *const c_char,
+    settings: impl FnOnce() -> Result<ToStringSettings, TemporalResult>,
+) -> TemporalResult {
+    let result = (|| {
+        let instant = parse_instant(instant_str, "instant")?;
+        let settings = settings()?;
+        let provider = &*COMPILED_TZ_PROVIDER;
+        instant
+            .to_ixdtf_string_with_provider(None, settings.rounding, &provider)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to format instant: {}", e)))
+    })();
+    result.map_or_else(|e| e, TemporalResult::success)
+}
+
+fn plain_time_to_string_with(
+    s: *const c_char,
+    settings: impl FnOnce() -> Result<ToStringSettings, TemporalResult>,
+) -> TemporalResult {
+    let result = (|| {
+        let time = parse_plain_time(s, "plain time")?;
+        let settings = settings()?;
+        time.to_ixdtf_string(settings.rounding)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to format plain time: {}", e)))
+    })();
+    result.map_or_else(|e| e, TemporalResult::success)
+}
+
+fn plain_date_time_to_string_with(
+    s: *const c_char,
+    settings: impl FnOnce() -> Result<ToStringSettings, TemporalResult>,
+) -> TemporalResult {
+    let result = (|| {
+        let dt = parse_plain_date_time(s, "plain date time")?;
+        let settings = settings()?;
+        dt.to_ixdtf_string(settings.rounding, settings.calendar)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to format plain date time: {}", e)))
+    })();
+    result.map_or_else(|e| e, TemporalResult::success)
+}
+
+fn zoned_date_time_to_string_with(
+    s: *const c_char,
+    settings: impl FnOnce() -> Result<ToStringSettings, TemporalResult>,
+) -> TemporalResult {
+    let result = (|| {
+        let zdt = parse_zoned_date_time(s, "zoned date time")?;
+        let settings = settings()?;
+        zdt.to_ixdtf_string(settings.offset, settings.time_zone, settings.calendar, settings.rounding)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to format: {}", e)))
+    })();
+    result.map_or_else(|e| e, TemporalResult::success)
+}
+
+#[no_mangle]
+pub extern "C" fn temporal_instant_to_string_with_options(
+    instant_str: *const c_char,
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_instant_to_string_with_options");
+    instant_to_string_with(instant_str, || {
+        parse_to_string_settings(fractional_second_digits, smallest_unit, rounding_mode, ptr::null(), ptr::null(), ptr::null())
+    })
+}
+
+#[no_mangle]
+pub extern "C" fn temporal_plain_time_to_string_with_options(
+    s: *const c_char,
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_time_to_string_with_options");
+    plain_time_to_string_with(s, || {
+        parse_to_string_settings(fractional_second_digits, smallest_unit, rounding_mode, ptr::null(), ptr::null(), ptr::null())
+    })
+}
+
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_to_string_with_options(
+    s: *const c_char,
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+    calendar_name: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_to_string_with_options");
+    plain_date_time_to_string_with(s, || {
+        parse_to_string_settings(fractional_second_digits, smallest_unit, rounding_mode, calendar_name, ptr::null(), ptr::null())
+    })
+}
+
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_to_string_with_options(
+    s: *const c_char,
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+    calendar_name: *const c_char,
+    time_zone_name: *const c_char,
+    offset: *const c_char,
+) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_to_string_with_options");
+    zoned_date_time_to_string_with(s, || {
+        parse_to_string_settings(fractional_second_digits, smallest_unit, rounding_mode, calendar_name, time_zone_name, offset)
+    })
+}
+
+// ============================================================================
+// Rounding options
+// ============================================================================
+
+// largestUnit / smallestUnit / roundingIncrement / roundingMode packed into
+// one integer by `temporal_rounding_options_new`, for the `_with_options`
+// variants of until, since and round. A loop reusing the same options then
+// parses no strings at all. The value is self-contained, with no table
+// behind it, and fits in 42 bits so it crosses JSI and both bridges as a
+// plain number.
+//
+// Bits 0-3 hold the largest unit, 4-7 the smallest unit and 8-11 the
+// rounding mode, each 0 when unset and otherwise 1 + its index below.
+// Bits 12-41 hold the rounding increment.
+
+/// Rounding options packed by `temporal_rounding_options_new`.
+pub type TemporalRoundingOptions = u64;
+
+const PACKED_UNITS: [Unit; 11] = [
+    Unit::Auto,
+    Unit::Nanosecond,
+    Unit::Microsecond,
+    Unit::Millisecond,
+    Unit::Second,
+    Unit::Minute,
+    Unit::Hour,
+    Unit::Day,
+    Unit::Week,
+    Unit::Month,
+    Unit::Year,
+];
+const PACKED_ROUNDING_MODES: [RoundingMode; 9] = [
+    RoundingMode::Ceil,
+    RoundingMode::Floor,
+    RoundingMode::Expand,
+    RoundingMode::Trunc,
+    RoundingMode::HalfCeil,
+    RoundingMode::HalfFloor,
+    RoundingMode::HalfExpand,
+    RoundingMode::HalfTrunc,
+    RoundingMode::HalfEven,
+];
+const PACKED_INCREMENT_SHIFT: u32 = 12;
+const MAX_PACKED_INCREMENT: u64 = 1_000_000_000;
+
+#[derive(Clone, Copy, Debug, PartialEq)]
+struct PackedRoundingOptions {
+    largest_unit: Option<Unit>,
+    smallest_unit: Option<Unit>,
+    rounding_mode: Option<RoundingMode>,
+    increment: u32,
+}
+
+fn pack_code<T: PartialEq>(table: &[T], value: Option<T>) -> u64 {
+    value.and_then(|v| table.iter().position(|t| *t == v)).map_or(0, |i| i as u64 + 1)
+}
+
+fn unpack_code<T: Copy>(table: &[T], code: u64) -> Option<Option<T>> {
+    match code {
+        0 => Some(None),
+        code => table.get(code as usize - 1).copied().map(Some),
+    }
+}
+
+impl PackedRoundingOptions {
+    /// Parses and validates the C arguments, as `parse_difference_settings`
+    /// and `parse_rounding_options` do.
+    fn parse(
+        largest_unit: *const c_char,
+        smallest_unit: *const c_char,
+        rounding_increment: i64,
+        rounding_mode: *const c_char,
+    ) -> Result<Self, TemporalResult> {
+        let parse_unit = |unit: *const c_char, name: &str| -> Result<Option<Unit>, TemporalResult> {
+            if unit.is_null() {
+                return Ok(None);
+            }
+            let s = parse_c_str(unit, name)?;
+            Unit::from_str(s)
+                .map(Some)
+                .map_err(|_| TemporalResult::range_error(&format!("Invalid {}: {}", name, s)))
+        };
+        let rounding_mode = if rounding_mode.is_null() {
+            None
+        } else {
+            let s = parse_c_str(rounding_mode, "rounding mode")?;
+            Some(RoundingMode::from_str(s).map_err(|_| TemporalResult::range_error(&format!("Invalid rounding mode: {}", s)))?)
+        };
+        let increment = if rounding_increment > 0 { rounding_increment.min(u32::MAX as i64) as u32 } else { 1 };
+        let options = Self {
+            largest_unit: parse_unit(largest_unit, "largest unit")?,
+            smallest_unit: parse_unit(smallest_unit, "smallest unit")?,
+            rounding_mode,
+            increment,
+        };
+        options.rounding_increment()?;
+        Ok(options)
+    }
+
+    fn pack(self) -> TemporalRoundingOptions {
+        pack_code(&PACKED_UNITS, self.largest_unit)
+            | (pack_code(&PACKED_UNITS, self.smallest_unit) << 4)
+            | (pack_code(&PACKED_ROUNDING_MODES, self.rounding_mode) << 8)
+            | ((self.increment as u64) << PACKED_INCREMENT_SHIFT)
+    }
+
+    fn unpack(options: TemporalRoundingOptions) -> Result<Self, TemporalResult> {
+        let increment = options >> PACKED_INCREMENT_SHIFT;
+        let unpacked = (|| {
+            if increment == 0 || increment > MAX_PACKED_INCREMENT {
+                return None;
+            }
+            Some(Self {
+                largest_unit: unpack_code(&PACKED_UNITS, options & 0xf)?,
+                smallest_unit: unpack_code(&PACKED_UNITS, (options >> 4) & 0xf)?,
+                rounding_mode: unpack_code(&PACKED_ROUNDING_MODES, (options >> 8) & 0xf)?,
+                increment: increment as u32,
+            })
+        })();
+        unpacked.ok_or_else(|| TemporalResult::range_error(&format!("Invalid rounding options: {}", options)))
+    }
+
+    fn rounding_increment(&self) -> Result<RoundingIncrement, TemporalResult> {
+        RoundingIncrement::try_new(self.increment)
+            .map_err(|e| TemporalResult::range_error(&format!("Invalid rounding increment: {}", e)))
+    }
+
+    fn difference_settings(&self) -> Result<temporal_rs::options::DifferenceSettings, TemporalResult> {
+        let mut settings = temporal_rs::options::DifferenceSettings::default();
+        settings.largest_unit = self.largest_unit;
+        settings.smallest_unit = self.smallest_unit;
+        settings.rounding_mode = self.rounding_mode;
+        settings.increment = Some(self.rounding_increment()?);
+        Ok(settings)
+    }
+
+    /// `round()` options; the smallest unit is required and the rounding
+    /// mode defaults to halfExpand.
+    fn rounding_options(&self) -> Result<RoundingOptions, TemporalResult> {
+        let unit = self.smallest_unit.ok_or_else(|| TemporalResult::type_error("smallestUnit is required"))?;
+        let mut options = RoundingOptions::default();
+        options.smallest_unit = Some(unit);
+        options.rounding_mode = Some(self.rounding_mode.unwrap_or(RoundingMode::HalfExpand));
+        options.increment = Some(self.rounding_increment()?);
+        Ok(options)
+    }
+}
+
+fn unpack_difference_settings(
+    options: TemporalRoundingOptions,
+) -> Result<temporal_rs::options::DifferenceSettings, TemporalResult> {
+    PackedRoundingOptions::unpack(options)?.difference_settings()
+}
+
+fn unpack_rounding_options(options: TemporalRoundingOptions) -> Result<RoundingOptions, TemporalResult> {
+    PackedRoundingOptions::unpack(options)?.rounding_options()
+}
+
+/// Packs rounding options into `out`. NULL units and mode are unset, and an
+/// increment below 1 means 1. Returns a `TemporalErrorType`; the message is
+/// available from `temporal_last_error_message`.
+#[no_mangle]
+pub extern "C" fn temporal_rounding_options_new(
+    largest_unit: *const c_char,
+    smallest_unit: *const c_char,
+    rounding_increment: i64,
+    rounding_mode: *const c_char,
+    out: *mut TemporalRoundingOptions,
+) -> i32 {
+    stats_scope!("temporal_rounding_options_new");
+    if out.is_null() {
+        return record_error(TemporalResult::type_error("Output cannot be null"));
+    }
+    match PackedRoundingOptions::parse(largest_unit, smallest_unit, rounding_increment, rounding_mode) {
+        Ok(options) => {
+            unsafe { *out = options.pack() };
+            TemporalErrorType::None as i32
+        }
+        Err(e) => record_error(e),
+    }
+}
+
+fn instant_difference_epoch_nanoseconds_with_options(
+    one: TemporalEpochNanoseconds,
+    two: TemporalEpochNanoseconds,
+    since: bool,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    let result = (|| {
+        let one = one.to_instant()?;
+        let two = two.to_instant()?;
+        let settings = unpack_difference_settings(options)?;
+        let duration = if since { one.since(&two, settings) } else { one.until(&two, settings) };
+        duration.map_err(|e| TemporalResult::range_error(&format!("Failed to compute difference: {}", e)))
+    })();
+    result.map_or_else(|e| e, |d| TemporalResult::success(d.to_string()))
+}
+
+/// `temporal_instant_until_epoch_nanoseconds` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_instant_until_epoch_nanoseconds_with_options(
+    one: TemporalEpochNanoseconds,
+    two: TemporalEpochNanoseconds,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_instant_until_epoch_nanoseconds_with_options");
+    instant_difference_epoch_nanoseconds_with_options(one, two, false, options)
+}
+
+/// `temporal_instant_since_epoch_nanoseconds` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_instant_since_epoch_nanoseconds_with_options(
+    one: TemporalEpochNanoseconds,
+    two: TemporalEpochNanoseconds,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_instant_since_epoch_nanoseconds_with_options");
+    instant_difference_epoch_nanoseconds_with_options(one, two, true, options)
+}
+
+/// `temporal_instant_round_epoch_nanoseconds` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_instant_round_epoch_nanoseconds_with_options(
+    epoch_ns: TemporalEpochNanoseconds,
+    options: TemporalRoundingOptions,
+    out: *mut TemporalEpochNanoseconds,
+) -> i32 {
+    stats_scope!("temporal_instant_round_epoch_nanoseconds_with_options");
+    let result = epoch_ns.to_instant().and_then(|instant| {
+        let options = unpack_rounding_options(options)?;
+        instant.round(options).map_err(|e| TemporalResult::range_error(&format!("Failed to round: {}", e)))
+    });
+    write_epoch_nanoseconds(result, out)
+}
+
+fn plain_time_difference_with_options(
+    one_str: *const c_char,
+    two_str: *const c_char,
+    since: bool,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    let result = (|| {
+        let one = parse_plain_time(one_str, "first plain time")?;
+        let two = parse_plain_time(two_str, "second plain time")?;
+        let settings = unpack_difference_settings(options)?;
+        let duration = if since { one.since(&two, settings) } else { one.until(&two, settings) };
+        duration.map_err(|e| TemporalResult::range_error(&format!("Failed to compute difference: {}", e)))
+    })();
+    result.map_or_else(|e| e, |d| TemporalResult::success(d.to_string()))
+}
+
+/// `temporal_plain_time_until` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_plain_time_until_with_options(
+    one_str: *const c_char,
+    two_str: *const c_char,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_time_until_with_options");
+    plain_time_difference_with_options(one_str, two_str, false, options)
+}
+
+/// `temporal_plain_time_since` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_plain_time_since_with_options(
+    one_str: *const c_char,
+    two_str: *const c_char,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_time_since_with_options");
+    plain_time_difference_with_options(one_str, two_str, true, options)
+}
+
+/// `temporal_plain_time_round` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_plain_time_round_with_options(
+    time_str: *const c_char,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_time_round_with_options");
+    let result = (|| {
+        let time = parse_plain_time(time_str, "plain time")?;
+        let rounded = time
+            .round(unpack_rounding_options(options)?)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to round: {}", e)))?;
+        rounded
+            .to_ixdtf_string(ToStringRoundingOptions::default())
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to format plain time: {}", e)))
+    })();
+    result.map_or_else(|e| e, TemporalResult::success)
+}
+
+/// `temporal_zoned_date_time_round` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_round_with_options(
+    zdt_str: *const c_char,
+    options: TemporalRoundingOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_round_with_options");
+    let result = (|| {
+        let zdt = parse_zoned_date_time(zdt_str, "zoned date time")?;
+        zdt.round(unpack_rounding_options(options)?)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to round: {}", e)))
+    })();
+    match result {
+        Ok(zdt) => format_zoned_date_time(&zdt),
+        Err(e) => e,
+    }
+}
+
+/// `temporal_zoned_date_time_handle_round` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_handle_round_with_options(
+    handle: *const TemporalHandle,
+    options: TemporalRoundingOptions,
+) -> HandleResult {
+    stats_scope!("temporal_zoned_date_time_handle_round_with_options");
+    let result = zoned_date_time_handle(handle).and_then(|zdt| {
+        zdt.round(unpack_rounding_options(options)?)
+            .map_err(|e| TemporalResult::range_error(&format!("Failed to round: {}", e)))
+    });
+    match result {
+        Ok(zdt) => HandleResult::success(TemporalHandle::ZonedDateTime(zdt)),
+        Err(e) => HandleResult::from_error(e),
+    }
+}
+
+// ============================================================================
+// Packed formatting options
+// ============================================================================
+
+// `toString(options)` packed into one integer by
+// `temporal_to_string_options_new`, for the `_with_packed_options` variants.
+// Like packed rounding options, the value is self-contained and crosses the
+// bridges as a plain number.
+//
+// Each 4-bit field is 0 when unset: bits 0-3 hold 1 + fractionalSecondDigits,
+// 4-7 the smallest unit and 8-11 the rounding mode (coded as in packed
+// rounding options), 12-15 calendarName, 16-19 timeZoneName and 20-23
+// offset (1 + their index in the display option tables).
+
+/// Formatting options packed by `temporal_to_string_options_new`.
+pub type TemporalToStringOptions = u64;
+
+fn pack_to_string_options(
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+    calendar_name: *const c_char,
+    time_zone_name: *const c_char,
+    offset: *const c_char,
+) -> Result<TemporalToStringOptions, TemporalResult> {
+    let rounding = parse_to_string_rounding_options(fractional_second_digits, smallest_unit, rounding_mode)?;
+    let digits = match rounding.precision {
+        Precision::Digit(d) => d as u64 + 1,
+        _ => 0,
+    };
+    Ok(digits
+        | (pack_code(&PACKED_UNITS, rounding.smallest_unit) << 4)
+        | (pack_code(&PACKED_ROUNDING_MODES, rounding.rounding_mode) << 8)
+        | (display_option_code(calendar_name, "calendarName", &DISPLAY_CALENDARS)? << 12)
+        | (display_option_code(time_zone_name, "timeZoneName", &DISPLAY_TIME_ZONES)? << 16)
+        | (display_option_code(offset, "offset", &DISPLAY_OFFSETS)? << 20))
+}
+
+fn unpack_to_string_options(options: TemporalToStringOptions) -> Result<ToStringSettings, TemporalResult> {
+    let field = |shift: u32| (options >> shift) & 0xf;
+    let unpacked = (|| {
+        if options >> 24 != 0 {
+            return None;
+        }
+        let precision = match field(0) {
+            0 => Precision::Auto,
+            d @ 1..=10 => Precision::Digit(d as u8 - 1),
+            _ => return None,
+        };
+        Some(ToStringSettings {
+            rounding: ToStringRoundingOptions {
+                precision,
+                smallest_unit: unpack_code(&PACKED_UNITS, field(4))?,
+                rounding_mode: unpack_code(&PACKED_ROUNDING_MODES, field(8))?,
+            },
+            calendar: display_option(field(12), DisplayCalendar::Auto, &DISPLAY_CALENDARS)?,
+            time_zone: display_option(field(16), DisplayTimeZone::Auto, &DISPLAY_TIME_ZONES)?,
+            offset: display_option(field(20), DisplayOffset::Auto, &DISPLAY_OFFSETS)?,
+        })
+    })();
+    unpacked.ok_or_else(|| TemporalResult::range_error(&format!("Invalid toString options: {}", options)))
+}
+
+/// Packs `toString(options)` into `out`, validating them as the
+/// `_with_options` variants do. Returns a `TemporalErrorType`; the message is
+/// available from `temporal_last_error_message`.
+#[no_mangle]
+pub extern "C" fn temporal_to_string_options_new(
+    fractional_second_digits: i32,
+    smallest_unit: *const c_char,
+    rounding_mode: *const c_char,
+    calendar_name: *const c_char,
+    time_zone_name: *const c_char,
+    offset: *const c_char,
+    out: *mut TemporalToStringOptions,
+) -> i32 {
+    stats_scope!("temporal_to_string_options_new");
+    let options = pack_to_string_options(
+        fractional_second_digits,
+        smallest_unit,
+        rounding_mode,
+        calendar_name,
+        time_zone_name,
+        offset,
+    );
+    write_status(options, out)
+}
+
+/// `temporal_instant_to_string_with_options` with packed options; the
+/// annotation options are ignored.
+#[no_mangle]
+pub extern "C" fn temporal_instant_to_string_with_packed_options(
+    instant_str: *const c_char,
+    options: TemporalToStringOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_instant_to_string_with_packed_options");
+    instant_to_string_with(instant_str, || unpack_to_string_options(options))
+}
+
+/// `temporal_plain_time_to_string_with_options` with packed options; the
+/// annotation options are ignored.
+#[no_mangle]
+pub extern "C" fn temporal_plain_time_to_string_with_packed_options(
+    s: *const c_char,
+    options: TemporalToStringOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_time_to_string_with_packed_options");
+    plain_time_to_string_with(s, || unpack_to_string_options(options))
+}
+
+/// `temporal_plain_date_time_to_string_with_options` with packed options;
+/// timeZoneName and offset are ignored.
+#[no_mangle]
+pub extern "C" fn temporal_plain_date_time_to_string_with_packed_options(
+    s: *const c_char,
+    options: TemporalToStringOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_plain_date_time_to_string_with_packed_options");
+    plain_date_time_to_string_with(s, || unpack_to_string_options(options))
+}
+
+/// `temporal_zoned_date_time_to_string_with_options` with packed options.
+#[no_mangle]
+pub extern "C" fn temporal_zoned_date_time_to_string_with_packed_options(
+    s: *const c_char,
+    options: TemporalToStringOptions,
+) -> TemporalResult {
+    stats_scope!("temporal_zoned_date_time_to_string_with_packed_options");
+    zoned_date_time_to_string_with(s, || unpack_to_string_options(options))
+}
+
+// ============================================================================
+// Instrumentation
+// ============================================================================
+
+// With the `stats` feature every C entry point records its call count and
+// cumulative wall time, plus how many values it parsed and formatted and
+// whether it failed. Totals only count outermost calls, so an entry point
+// calling another isn't counted twice. The counters are read with
+// `temporal_stats_snapshot` / `temporal_stats_to_json` and cleared with
+// `temporal_stats_reset`; without the feature those report zeros.
+
+#[cfg(feature = "stats")]
+mod stats {
+    use std::alloc::{GlobalAlloc, Layout, System};
+    use std::cell::Cell;
+    use std::ptr;
+    use std::sync::atomic::{AtomicBool, AtomicU64, Ordering::Relaxed};
+    use std::sync::{Mutex, PoisonError};
+    use std::time::Instant as Clock;
+
+    /// Counters for one entry point, registered on its first call.
+    pub struct Site {
+        pub name: &'static str,
+        registered: AtomicBool,
+        pub calls: AtomicU64,
+        pub nanoseconds: AtomicU64,
+        pub parses: AtomicU64,
+        pub formats: AtomicU64,
+        pub errors: AtomicU64,
+    }
+
+    impl Site {
+        pub const fn new(name: &'static str) -> Self {
+            Self {
+                name,
+                registered: AtomicBool::new(false),
+                calls: AtomicU64::new(0),
+                nanoseconds: AtomicU64::new(0),
+                parses: AtomicU64::new(0),
+                formats: AtomicU64::new(0),
+                errors: AtomicU64::new(0),
+            }
+        }
+
+        fn reset(&self) {
+            for counter in [&self.calls, &self.nanoseconds, &self.parses, &self.formats, &self.errors] {
+                counter.store(0, Relaxed);
+            }
+        }
+    }
+
+    pub static SITES: Mutex<Vec<&'static Site>> = Mutex::new(Vec::new());
+
+    pub static CALLS: AtomicU64 = AtomicU64::new(0);
+    pub static NANOSECONDS: AtomicU64 = AtomicU64::new(0);
+    pub static PARSES: AtomicU64 = AtomicU64::new(0);
+    pub static FORMATS: AtomicU64 = AtomicU64::new(0);
+    pub static ERRORS: AtomicU64 = AtomicU64::new(0);
+    pub static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+    pub static ALLOCATED_BYTES: AtomicU64 = AtomicU64::new(0);
+
+    #[derive(Clone, Copy)]
+    struct Current {
+        site: *const Site,
+        failed: bool,
+    }
+
+    thread_local! {
+        static CURRENT: Cell<Current> = const {
+            Cell::new(Current { site: ptr::null(), failed: false })
+        };
+    }
+
+    /// Scope guard for one call; restores the caller's site when dropped.
+    pub struct Scope {
+        previous: Current,
+        start: Clock,
+    }
+
+    impl Scope {
+        pub fn enter(site: &'static Site) -> Self {
+            if !site.registered.swap(true, Relaxed) {
+                SITES.lock().unwrap_or_else(PoisonError::into_inner).push(site);
+            }
+            let previous = CURRENT.with(|c| c.replace(Current { site, failed: false }));
+            Self { previous, start: Clock::now() }
+        }
+    }
+
+    impl Drop for Scope {
+        fn drop(&mut self) {
+            let elapsed = self.start.elapsed().as_nanos() as u64;
+            let current = CURRENT.with(|c| c.replace(self.previous));
+            let site = unsafe { &*current.site };
+            site.calls.fetch_add(1, Relaxed);
+            site.nanoseconds.fetch_add(elapsed, Relaxed);
+            if current.failed {
+                site.errors.fetch_add(1, Relaxed);
+            }
+            if self.previous.site.is_null() {
+                CALLS.fetch_add(1, Relaxed);
+                NANOSECONDS.fetch_add(elapsed, Relaxed);
+                if current.failed {
+                    ERRORS.fetch_add(1, Relaxed);
+                }
+            }
+        }
+    }
+
+    fn with_site(f: impl FnOnce(&Site)) {
+        let site = CURRENT.with(|c| c.get().site);
+        if !site.is_null() {
+            f(unsafe { &*site });
+        }
+    }
+
+    pub fn record_parse() {
+        PARSES.fetch_add(1, Relaxed);
+        with_site(|site| {
+            site.parses.fetch_add(1, Relaxed);
+        });
+    }
+
+    pub fn record_format() {
+        FORMATS.fetch_add(1, Relaxed);
+        with_site(|site| {
+            site.formats.fetch_add(1, Relaxed);
+        });
+    }
+
+    /// Marks the current call as failed; counted once per call on exit.
+    pub fn record_error() {
+        CURRENT.with(|c| {
+            let mut current = c.get();
+            current.failed = !current.site.is_null();
+            c.set(current);
+        });
+    }
+
+    pub fn reset() {
+        for site in SITES.lock().unwrap_or_else(PoisonError::into_inner).iter() {
+            site.reset();
+        }
+        for counter in [&CALLS, &NANOSECONDS, &PARSES, &FORMATS, &ERRORS, &ALLOCATIONS, &ALLOCATED_BYTES] {
+            counter.store(0, Relaxed);
+        }
+    }
+
+    /// Counts heap traffic from the Rust side of the library. It only touches
+    /// atomics, never thread-locals, so it is safe to call from any context.
+    struct CountingAllocator;
+
+    unsafe impl GlobalAlloc for CountingAllocator {
+        unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+            ALLOCATIONS.fetch_add(1, Relaxed);
+            ALLOCATED_BYTES.fetch_add(layout.size() as u64, Relaxed);
+            System.alloc(layout)
+        }
+
+        unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+            System.dealloc(ptr, layout)
+        }
+
+        unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+            ALLOCATIONS.fetch_add(1, Relaxed);
+            ALLOCATED_BYTES.fetch_add(new_size as u64, Relaxed);
+            System.realloc(ptr, layout, new_size)
+        }
+    }
+
+    #[global_allocator]
+    static GLOBAL: CountingAllocator = CountingAllocator;
+}
+
+#[cfg(not(feature = "stats"))]
+mod stats {
+    #[inline(always)]
+    pub fn record_parse() {}
+    #[inline(always)]
+    pub fn record_format() {}
+    #[inline(always)]
+    pub fn record_error() {}
+}
+
+/// Process-wide totals from `temporal_stats_snapshot`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TemporalStats {
+    /// 1 when the library was built with the `stats` feature
+    pub enabled: i32,
+    /// Outermost entry point calls
+    pub calls: u64,
+    /// Wall time spent in outermost calls
+    pub total_nanoseconds: u64,
+    /// Temporal values parsed from strings
+    pub parse_count: u64,
+    /// Strings produced for the caller
+    pub format_count: u64,
+    /// Outermost calls that failed
+    pub error_count: u64,
+    /// Heap allocations made by the library
+    pub allocation_count: u64,
+    /// Bytes requested by those allocations
+    pub allocation_bytes: u64,
+}
+
+/// Writes the current totals into `out`. Returns a `TemporalErrorType`.
+#[no_mangle]
+pub extern "C" fn temporal_stats_snapshot(out: *mut TemporalStats) -> i32 {
+    if out.is_null() {
+        return record_error(TemporalResult::type_error("Output cannot be null"));
+    }
+    #[cfg(feature = "stats")]
+    let snapshot = {
+        use std::sync::atomic::Ordering::Relaxed;
+        TemporalStats {
+            enabled: 1,
+            calls: stats::CALLS.load(Relaxed),
+            total_nanoseconds: stats::NANOSECONDS.load(Relaxed),
+            parse_count: stats::PARSES.load(Relaxed),
+            format_count: stats::FORMATS.load(Relaxed),
+            error_count: stats::ERRORS.load(Relaxed),
+            allocation_count: stats::ALLOCATIONS.load(Relaxed),
+            allocation_bytes: stats::ALLOCATED_BYTES.load(Relaxed),
+        }
+    };
+    #[cfg(not(feature = "stats"))]
+    let snapshot = TemporalStats::default();
+    unsafe { *out = snapshot };
+    TemporalErrorType::None as i32
+}
+
+/// Returns the totals plus per-entry-point counters as JSON:
+/// `{"enabled":true,"totals":{...},"functions":{"temporal_...":{...}}}`.
+/// Entry points that were never called are omitted.
+#[no_mangle]
+pub extern "C" fn temporal_stats_to_json() -> TemporalResult {
+    let mut totals = TemporalStats::default();
+    temporal_stats_snapshot(&mut totals);
+    let mut json = format!(
+        concat!(
+            "{{\"enabled\":{},\"totals\":{{\"calls\":{},\"totalNanoseconds\":{},",
+            "\"parseCount\":{},\"formatCount\":{},\"errorCount\":{},",
+            "\"allocationCount\":{},\"allocationBytes\":{}}},\"functions\":{{"
+        ),
+        totals.enabled == 1,
+        totals.calls,
+        totals.total_nanoseconds,
+        totals.parse_count,
+        totals.format_count,
+        totals.error_count,
+        totals.allocation_count,
+        totals.allocation_bytes,
+    );
+    #[cfg(feature = "stats")]
+    {
+        use std::sync::atomic::Ordering::Relaxed;
+        let sites = stats::SITES.lock().unwrap_or_else(PoisonError::into_inner);
+        let mut first = true;
+        for site in sites.iter() {
+            let calls = site.calls.load(Relaxed);
+            if calls == 0 {
+                continue;
+            }
+            if !first {
+                json.push(',');
+            }
+            first = false;
+            json.push_str(&format!(
+                concat!(
+                    "\"{}\":{{\"calls\":{},\"totalNanoseconds\":{},",
+                    "\"parseCount\":{},\"formatCount\":{},\"errorCount\":{}}}"
+                ),
+                site.name,
+                calls,
+                site.nanoseconds.load(Relaxed),
+                site.parses.load(Relaxed),
+                site.formats.load(Relaxed),
+                site.errors.load(Relaxed),
+            ));
+        }
+    }
+    json.push_str("}}");
+    TemporalResult::success(json)
+}
+
+/// Zeroes every counter.
+#[no_mangle]
+pub extern "C" fn temporal_stats_reset() {
+    #[cfg(feature = "stats")]
+    stats::reset();
+}
+
+#[cfg(target_os = "android")]
+
+mod android {
+    use jni::objects::{JByteArray, JClass, JLongArray, JObjectArray, JString};
+    use jni::sys::{jbyteArray, jint, jintArray, jlong, jlongArray, jstring};
+    use jni::JNIEnv;
+
+    use super::{
+        get_instant_now_string, get_now_plain_date_string, get_now_plain_date_time_string,
+        get_now_plain_time_string, get_now_zoned_date_time_string, resolve_time_zone,
+        temporal_free_result, temporal_handle_compare, temporal_handle_release, temporal_handle_to_string,
+        temporal_duration_handle_from_string, temporal_instant_handle_add, temporal_instant_handle_from_string,
+        temporal_instant_handle_round, temporal_instant_handle_subtract, temporal_plain_date_time_handle_add,
+        temporal_plain_date_time_handle_from_string, temporal_plain_date_time_handle_get_components,
+        temporal_plain_date_time_handle_subtract, temporal_plain_date_time_handle_with,
+        temporal_zoned_date_time_handle_add, temporal_zoned_date_time_handle_from_string,
+        temporal_zoned_date_time_handle_get_components, temporal_zoned_date_time_handle_round,
+        temporal_zoned_date_time_handle_subtract, temporal_zoned_date_time_handle_with,
+        temporal_instant_compare_many, temporal_instant_parse_many, temporal_instant_sort,
+        temporal_plain_date_compare_many, temporal_plain_date_sort,
+        temporal_zoned_date_time_compare_many, temporal_zoned_date_time_parse_many,
+        temporal_zoned_date_time_sort, temporal_time_zone_cache_clear, temporal_time_zone_cache_stats,
+        temporal_set_batch_threads, temporal_get_batch_threads,
+        temporal_time_zone_get_plain_date_times_for_many, PLAIN_DATE_TIME_COLUMN_COUNT,
+        temporal_zoned_date_time_expand_recurrence, MAX_RECURRENCE_COUNT,
+        temporal_zoned_date_time_range_new, temporal_zoned_date_time_range_next_batch,
+        temporal_instant_column_from_epoch_nanoseconds, temporal_instant_column_from_strings,
+        temporal_plain_date_column_from_strings, temporal_column_length, temporal_column_slice,
+        temporal_instant_column_lower_bound, temporal_instant_column_range_count, temporal_instant_column_read,
+        temporal_instant_column_bucket_by, temporal_plain_date_column_lower_bound,
+        temporal_plain_date_column_range_count, temporal_plain_date_column_read,
+        temporal_plain_date_column_bucket_by,
+        temporal_zoned_clock_new, temporal_zoned_clock_read, ZonedClockReading,
+        temporal_time_zone_get_next_transition, temporal_time_zone_get_previous_transition,
+        temporal_time_zone_get_transitions, time_zone_offset_nanoseconds, MAX_TRANSITION_COUNT,
+        temporal_stats_reset, temporal_stats_to_json, temporal_validate,
+        temporal_instant_format_epoch_nanoseconds_into, temporal_instant_now_epoch_nanoseconds,
+        temporal_instant_parse_epoch_nanoseconds, temporal_instant_round_epoch_nanoseconds,
+        temporal_instant_since_epoch_nanoseconds, temporal_instant_until_epoch_nanoseconds,
+        temporal_last_error_message, temporal_zoned_date_time_from_bytes, temporal_zoned_date_time_to_bytes,
+        TEMPORAL_BINARY_SIZE, temporal_instant_to_string_with_options, temporal_plain_time_to_string_with_options,
+        temporal_plain_date_time_to_string_with_options, temporal_zoned_date_time_to_string_with_options,
+        temporal_rounding_options_new, temporal_instant_until_epoch_nanoseconds_with_options,
+        temporal_to_string_options_new, temporal_instant_to_string_with_packed_options,
+        temporal_plain_time_to_string_with_packed_options, temporal_plain_date_time_to_string_with_packed_options,
+        temporal_zoned_date_time_to_string_with_packed_options, TemporalToStringOptions,
+        temporal_instant_since_epoch_nanoseconds_with_options, temporal_instant_round_epoch_nanoseconds_with_options,
+        temporal_plain_time_until_with_options, temporal_plain_time_since_with_options,
+        temporal_plain_time_round_with_options, temporal_zoned_date_time_round_with_options,
+        temporal_zoned_date_time_handle_round_with_options, TemporalRoundingOptions,
+        BatchResult, HandleResult, PlainDateTimeComponents, TemporalEpochNanoseconds, TemporalErrorType,
+        TemporalHandle, TemporalResult, ZonedDateTimeComponents,
+    };
+    use temporal_rs::{
+        options::{DisplayCalendar, ToStringRoundingOptions, Overflow, DisplayOffset, DisplayTimeZone, Disambiguation, OffsetDisambiguation, Unit, RoundingMode, RoundingIncrement, RoundingOptions},
+        provider::COMPILED_TZ_PROVIDER,
+        Calendar, Duration, Instant, PlainDate, PlainDateTime, PlainMonthDay, PlainTime,
+        PlainYearMonth, TimeZone, ZonedDateTime, TemporalError,
+    };
+    use std::ffi::{c_char, CStr, CString};
+    use std::str::FromStr;
+    use std::ptr;
+
+
+    
+    const RANGE_ERROR_CLASS: &str = "java/lang/RuntimeException";
+    const TYPE_ERROR_CLASS: &str = "java/lang/RuntimeException";
+
+    /// Throws a RangeError exception
+    fn throw_range_error(env: &mut JNIEnv, message: &str) {
+        super::stats::record_error();
+        let _ = env.throw_new(RANGE_ERROR_CLASS, &format!("[RangeError] {}", message));
+    }
+
+    /// Throws a TypeError exception
+    fn throw_type_error(env: &mut JNIEnv, message: &str) {
+        super::stats::record_error();
+        let _ = env.throw_new(TYPE_ERROR_CLASS, &format!("[TypeError] {}", message));
+    }
+
+    /// Parses a JNI string, throwing TypeError if null or invalid
+    fn parse_jstring(env: &mut JNIEnv, s: &JString, name: &str) -> Option<String> {
+        if s.is_null() {
+            throw_type_error(env, &format!("{} cannot be null", name));
+            return None;
+        }
+        match env.get_string(s) {
+            Ok(js) => Some(js.to_string_lossy().into_owned()),
+            Err(_) => {
+                throw_type_error(env, &format!("Invalid UTF-8 in {}", name));
+                None
+            }
+        }
+    }
+
+    /// Parses a duration string, throwing RangeError if invalid
+    fn parse_duration(env: &mut JNIEnv, s: &JString, name: &str) -> Option<Duration> {
+        let s_str = parse_jstring(env, s, name)?;
+        super::stats::record_parse();
+        match Duration::from_str(&s_str) {
+            Ok(d) => Some(d),
+            Err(e) => {
+                throw_range_error(env, &format!("Invalid duration '{}': {}", s_str, e));
+                None
+            }
+        }
+    }
+
+    /// Parses an instant string, throwing RangeError if invalid
+    fn parse_instant(env: &mut JNIEnv, s: &JString, name: &str) -> Option<Instant> {
+        let s_str = parse_jstring(env, s, name)?;
+        super::stats::record_parse();
+        match instant_from_str(&s_str) {
+            Ok(i) => Some(i),
+            Err(e) => {
+                throw_range_error(env, &format!("Invalid instant '{}': {}", s_str, e));
+                None
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantNow()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantNow(
+        mut env: JNIEnv,
+        _class: JClass,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantNow");
+        match get_instant_now_string() {
+            Ok(s) => env
+                .new_string(s)
+                .map(|js| js.into_raw())
+                .unwrap_or_else(|_| {
+                    throw_range_error(&mut env, "Failed to create string");
+                    ptr::null_mut()
+                }),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to get current instant: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantFromString");
+        let instant = match parse_instant(&mut env, &s, "instant string") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+        let provider = &*COMPILED_TZ_PROVIDER;
+        match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+            Ok(s) => env
+                .new_string(s)
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantFromEpochMilliseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantFromEpochMilliseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+        ms: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantFromEpochMilliseconds");
+        let ns = (ms as i128).saturating_mul(1_000_000);
+        match Instant::try_new(ns) {
+            Ok(instant) => {
+                let provider = &*COMPILED_TZ_PROVIDER;
+                match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+                    Ok(s) => env
+                        .new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                        ptr::null_mut()
+                    }
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid epoch milliseconds: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantFromEpochNanoseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantFromEpochNanoseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+        ns_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantFromEpochNanoseconds");
+        let s_str = parse_jstring(&mut env, &ns_str, "nanoseconds string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        
+        let ns = match i128::from_str(&s_val) {
+            Ok(n) => n,
+            Err(_) => {
+                throw_range_error(&mut env, "Invalid nanoseconds string");
+                return ptr::null_mut();
+            }
+        };
+
+        match Instant::try_new(ns) {
+            Ok(instant) => {
+                let provider = &*COMPILED_TZ_PROVIDER;
+                match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+                    Ok(s) => env
+                        .new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                        ptr::null_mut()
+                    }
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid epoch nanoseconds: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantEpochMilliseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantEpochMilliseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantEpochMilliseconds");
+        let instant = match parse_instant(&mut env, &s, "instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+        let ms = instant.epoch_milliseconds();
+        env.new_string(ms.to_string())
+            .map(|js| js.into_raw())
+            .unwrap_or(ptr::null_mut())
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantEpochNanoseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantEpochNanoseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantEpochNanoseconds");
+        let instant = match parse_instant(&mut env, &s, "instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+        let ns = instant.epoch_nanoseconds();
+        env.new_string(ns.0.to_string())
+            .map(|js| js.into_raw())
+            .unwrap_or(ptr::null_mut())
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantAdd()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantAdd(
+        mut env: JNIEnv,
+        _class: JClass,
+        instant_str: JString,
+        duration_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantAdd");
+        let instant = match parse_instant(&mut env, &instant_str, "instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+        
+        match instant.add(&duration) {
+            Ok(result) => {
+                let provider = &*COMPILED_TZ_PROVIDER;
+                match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+                    Ok(s) => env
+                        .new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                        ptr::null_mut()
+                    }
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantSubtract()`
+
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantSubtract(
+        mut env: JNIEnv,
+        _class: JClass,
+        instant_str: JString,
+        duration_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantSubtract");
+        let instant = match parse_instant(&mut env, &instant_str, "instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+        
+        match instant.subtract(&duration) {
+            Ok(result) => {
+                let provider = &*COMPILED_TZ_PROVIDER;
+                match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+                    Ok(s) => env
+                        .new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                        ptr::null_mut()
+                    }
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantCompare()`
+
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantCompare(
+        mut env: JNIEnv,
+        _class: JClass,
+        a: JString,
+        b: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_instantCompare");
+        let instant_a = match parse_instant(&mut env, &a, "first instant") {
+            Some(i) => i,
+            None => return 0,
+        };
+        let instant_b = match parse_instant(&mut env, &b, "second instant") {
+            Some(i) => i,
+            None => return 0,
+        };
+        
+        instant_a.cmp(&instant_b) as jint
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantUntil()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantUntil(
+        mut env: JNIEnv,
+        _class: JClass,
+        one: JString,
+        two: JString,
+        largest_unit: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantUntil");
+        let one_inst = match parse_instant(&mut env, &one, "first instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+        let two_inst = match parse_instant(&mut env, &two, "second instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+
+        let largest = if !largest_unit.is_null() {
+            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None, // null passed
+            }
+        } else {
+            None
+        };
+
+        let smallest = if !smallest_unit.is_null() {
+            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let mode = if !rounding_mode.is_null() {
+            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
+            match s {
+                Some(s) => match RoundingMode::from_str(&s) {
+                    Ok(m) => Some(m),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let increment = if rounding_increment > 0 {
+            rounding_increment as u32
+        } else {
+            1
+        };
+        
+        let increment_opt = match RoundingIncrement::try_new(increment) {
+            Ok(i) => Some(i),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let mut options = temporal_rs::options::DifferenceSettings::default();
+        options.largest_unit = largest;
+        options.smallest_unit = smallest;
+        options.rounding_mode = mode;
+        options.increment = increment_opt;
+
+        match one_inst.until(&two_inst, options) {
+            Ok(d) => env
+                .new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantSince()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantSince(
+        mut env: JNIEnv,
+        _class: JClass,
+        one: JString,
+        two: JString,
+        largest_unit: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantSince");
+        let one_inst = match parse_instant(&mut env, &one, "first instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+        let two_inst = match parse_instant(&mut env, &two, "second instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+
+        let largest = if !largest_unit.is_null() {
+            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let smallest = if !smallest_unit.is_null() {
+            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let mode = if !rounding_mode.is_null() {
+            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
+            match s {
+                Some(s) => match RoundingMode::from_str(&s) {
+                    Ok(m) => Some(m),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let increment = if rounding_increment > 0 {
+            rounding_increment as u32
+        } else {
+            1
+        };
+        
+        let increment_opt = match RoundingIncrement::try_new(increment) {
+            Ok(i) => Some(i),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let mut options = temporal_rs::options::DifferenceSettings::default();
+        options.largest_unit = largest;
+        options.smallest_unit = smallest;
+        options.rounding_mode = mode;
+        options.increment = increment_opt;
+
+        match one_inst.since(&two_inst, options) {
+            Ok(d) => env
+                .new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantRound()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantRound(
+        mut env: JNIEnv,
+        _class: JClass,
+        instant_str: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantRound");
+        let instant = match parse_instant(&mut env, &instant_str, "instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+
+        let unit = if !smallest_unit.is_null() {
+            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => u,
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => {
+                    throw_type_error(&mut env, "smallestUnit is required");
+                    return ptr::null_mut();
+                }
+            }
+        } else {
+            throw_type_error(&mut env, "smallestUnit is required");
+            return ptr::null_mut();
+        };
+
+        let mode = if !rounding_mode.is_null() {
+            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
+            match s {
+                Some(s) => match RoundingMode::from_str(&s) {
+                    Ok(m) => m,
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => RoundingMode::HalfExpand,
+            }
+        } else {
+            RoundingMode::HalfExpand
+        };
+
+        let increment = if rounding_increment > 0 {
+            rounding_increment as u32
+        } else {
+            1
+        };
+        
+        let increment_opt = match RoundingIncrement::try_new(increment) {
+            Ok(i) => i,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let mut options = RoundingOptions::default();
+        options.smallest_unit = Some(unit);
+        options.rounding_mode = Some(mode);
+        options.increment = Some(increment_opt);
+
+        match instant.round(options) {
+            Ok(result) => {
+                let provider = &*COMPILED_TZ_PROVIDER;
+                match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+                    Ok(s) => env
+                        .new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                        ptr::null_mut()
+                    }
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to round: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantToZonedDateTime()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantToZonedDateTime(
+        mut env: JNIEnv,
+        _class: JClass,
+        instant_str: JString,
+        calendar_id: JString,
+        time_zone_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantToZonedDateTime");
+        let instant = match parse_instant(&mut env, &instant_str, "instant") {
+            Some(i) => i,
+            None => return ptr::null_mut(),
+        };
+
+        let calendar = if !calendar_id.is_null() {
+            let s = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match s {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => Calendar::default(),
+            }
+        } else {
+            Calendar::default()
+        };
+
+        let tz_str = if !time_zone_id.is_null() {
+            parse_jstring(&mut env, &time_zone_id, "timezone id")
+        } else {
+            throw_type_error(&mut env, "Timezone ID is required");
+            return ptr::null_mut();
+        };
+
+        let tz = match tz_str {
+            Some(s) => match resolve_time_zone(&s) {
+                Ok(t) => t,
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
+                    return ptr::null_mut();
+                }
+            },
+            None => {
+                throw_type_error(&mut env, "Timezone ID is required");
+                return ptr::null_mut();
+            }
+        };
+        
+        match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, calendar) {
+            Ok(zdt) => match zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to convert to zoned date time: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.nowPlainDateTimeISO()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_nowPlainDateTimeISO(
+        mut env: JNIEnv,
+        _class: JClass,
+        tz_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_nowPlainDateTimeISO");
+        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
+        let tz_val = match tz_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        
+        match get_now_plain_date_time_string(&tz_val) {
+            Ok(s) => env
+                .new_string(s)
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to get plain date time: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.nowPlainDateISO()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_nowPlainDateISO(
+        mut env: JNIEnv,
+        _class: JClass,
+        tz_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_nowPlainDateISO");
+        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
+        let tz_val = match tz_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        
+        match get_now_plain_date_string(&tz_val) {
+            Ok(s) => env
+                .new_string(s)
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to get plain date: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.nowPlainTimeISO()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_nowPlainTimeISO(
+        mut env: JNIEnv,
+        _class: JClass,
+        tz_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_nowPlainTimeISO");
+        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
+        let tz_val = match tz_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        
+        match get_now_plain_time_string(&tz_val) {
+            Ok(s) => env
+                .new_string(s)
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to get plain time: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.nowZonedDateTimeISO()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_nowZonedDateTimeISO(
+        mut env: JNIEnv,
+        _class: JClass,
+        tz_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_nowZonedDateTimeISO");
+        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
+        let tz_val = match tz_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        
+        match get_now_zoned_date_time_string(&tz_val) {
+            Ok(s) => env
+                .new_string(s)
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to get zoned date time: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// Parses a PlainTime string, throwing RangeError if invalid
+    fn parse_plain_time(env: &mut JNIEnv, s: &JString, name: &str) -> Option<PlainTime> {
+        let s_str = parse_jstring(env, s, name)?;
+        super::stats::record_parse();
+        match PlainTime::from_str(&s_str) {
+            Ok(t) => Some(t),
+            Err(e) => {
+                throw_range_error(env, &format!("Invalid plain time '{}': {}", s_str, e));
+                None
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeFromString");
+        let time = match parse_plain_time(&mut env, &s, "plain time string") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+        match time.to_ixdtf_string(ToStringRoundingOptions::default()) {
+            Ok(s) => env.new_string(s)
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeFromComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeFromComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        hour: jint,
+        minute: jint,
+        second: jint,
+        millisecond: jint,
+        microsecond: jint,
+        nanosecond: jint,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeFromComponents");
+        // Validate ranges before casting to narrower types
+        if hour < 0 || hour > 23 {
+            throw_range_error(&mut env, &format!("Invalid hour: {} (must be 0-23)", hour));
+            return ptr::null_mut();
+        }
+        if minute < 0 || minute > 59 {
+            throw_range_error(&mut env, &format!("Invalid minute: {} (must be 0-59)", minute));
+            return ptr::null_mut();
+        }
+        if second < 0 || second > 59 {
+            throw_range_error(&mut env, &format!("Invalid second: {} (must be 0-59)", second));
+            return ptr::null_mut();
+        }
+        if millisecond < 0 || millisecond > 999 {
+            throw_range_error(&mut env, &format!("Invalid millisecond: {} (must be 0-999)", millisecond));
+            return ptr::null_mut();
+        }
+        if microsecond < 0 || microsecond > 999 {
+            throw_range_error(&mut env, &format!("Invalid microsecond: {} (must be 0-999)", microsecond));
+            return ptr::null_mut();
+        }
+        if nanosecond < 0 || nanosecond > 999 {
+            throw_range_error(&mut env, &format!("Invalid nanosecond: {} (must be 0-999)", nanosecond));
+            return ptr::null_mut();
+        }
+
+        match PlainTime::new(
+            hour as u8,
+            minute as u8,
+            second as u8,
+            millisecond as u16,
+            microsecond as u16,
+            nanosecond as u16
+        ) {
+            Ok(time) => match time.to_ixdtf_string(ToStringRoundingOptions::default()) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or_else(|_| {
+                        throw_range_error(&mut env, "Failed to create result string");
+                        ptr::null_mut()
+                    }),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain time components: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeGetAllComponents()`
+    /// Returns: [hour, minute, second, millisecond, microsecond, nanosecond]
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeGetAllComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeGetAllComponents");
+        let time = match parse_plain_time(&mut env, &s, "plain time string") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+
+        let components: [i64; 6] = [
+            time.hour() as i64,
+            time.minute() as i64,
+            time.second() as i64,
+            time.millisecond() as i64,
+            time.microsecond() as i64,
+            time.nanosecond() as i64,
+        ];
+
+        match env.new_long_array(6) {
+            Ok(arr) => {
+                if env.set_long_array_region(&arr, 0, &components).is_err() {
+                    throw_range_error(&mut env, "Failed to set array elements");
+                    return ptr::null_mut();
+                }
+                arr.into_raw()
+            }
             Err(_) => {
-                throw_range_error(&mut env, "Invalid nanoseconds string");
+                throw_range_error(&mut env, "Failed to create result array");
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeAdd()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeAdd(
+        mut env: JNIEnv,
+        _class: JClass,
+        time_str: JString,
+        duration_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeAdd");
+        let time = match parse_plain_time(&mut env, &time_str, "plain time") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+
+        match time.add(&duration) {
+            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default()) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeSubtract()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeSubtract(
+        mut env: JNIEnv,
+        _class: JClass,
+        time_str: JString,
+        duration_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeSubtract");
+        let time = match parse_plain_time(&mut env, &time_str, "plain time") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+
+        match time.subtract(&duration) {
+            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default()) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeCompare()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeCompare(
+        mut env: JNIEnv,
+        _class: JClass,
+        a: JString,
+        b: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeCompare");
+        let time_a = match parse_plain_time(&mut env, &a, "first plain time") {
+            Some(t) => t,
+            None => return 0,
+        };
+        let time_b = match parse_plain_time(&mut env, &b, "second plain time") {
+            Some(t) => t,
+            None => return 0,
+        };
+
+        time_a.cmp(&time_b) as jint
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeUntil()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeUntil(
+        mut env: JNIEnv,
+        _class: JClass,
+        one: JString,
+        two: JString,
+        largest_unit: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeUntil");
+        let one_time = match parse_plain_time(&mut env, &one, "first plain time") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+        let two_time = match parse_plain_time(&mut env, &two, "second plain time") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+
+        let largest = if !largest_unit.is_null() {
+            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let smallest = if !smallest_unit.is_null() {
+            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let mode = if !rounding_mode.is_null() {
+            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
+            match s {
+                Some(s) => match RoundingMode::from_str(&s) {
+                    Ok(m) => Some(m),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let increment = if rounding_increment > 0 {
+            rounding_increment as u32
+        } else {
+            1
+        };
+        
+        let increment_opt = match RoundingIncrement::try_new(increment) {
+            Ok(i) => Some(i),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let mut options = temporal_rs::options::DifferenceSettings::default();
+        options.largest_unit = largest;
+        options.smallest_unit = smallest;
+        options.rounding_mode = mode;
+        options.increment = increment_opt;
+
+        match one_time.until(&two_time, options) {
+            Ok(d) => env
+                .new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeSince()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeSince(
+        mut env: JNIEnv,
+        _class: JClass,
+        one: JString,
+        two: JString,
+        largest_unit: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeSince");
+        let one_time = match parse_plain_time(&mut env, &one, "first plain time") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+        let two_time = match parse_plain_time(&mut env, &two, "second plain time") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+
+        let largest = if !largest_unit.is_null() {
+            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let smallest = if !smallest_unit.is_null() {
+            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => Some(u),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let mode = if !rounding_mode.is_null() {
+            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
+            match s {
+                Some(s) => match RoundingMode::from_str(&s) {
+                    Ok(m) => Some(m),
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => None,
+            }
+        } else {
+            None
+        };
+
+        let increment = if rounding_increment > 0 {
+            rounding_increment as u32
+        } else {
+            1
+        };
+        
+        let increment_opt = match RoundingIncrement::try_new(increment) {
+            Ok(i) => Some(i),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let mut options = temporal_rs::options::DifferenceSettings::default();
+        options.largest_unit = largest;
+        options.smallest_unit = smallest;
+        options.rounding_mode = mode;
+        options.increment = increment_opt;
+
+        match one_time.since(&two_time, options) {
+            Ok(d) => env
+                .new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeRound()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeRound(
+        mut env: JNIEnv,
+        _class: JClass,
+        time_str: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeRound");
+        let time = match parse_plain_time(&mut env, &time_str, "plain time") {
+            Some(t) => t,
+            None => return ptr::null_mut(),
+        };
+
+        let unit = if !smallest_unit.is_null() {
+            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => u,
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => {
+                    throw_type_error(&mut env, "smallestUnit is required");
+                    return ptr::null_mut();
+                }
+            }
+        } else {
+            throw_type_error(&mut env, "smallestUnit is required");
+            return ptr::null_mut();
+        };
+
+        let mode = if !rounding_mode.is_null() {
+            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
+            match s {
+                Some(s) => match RoundingMode::from_str(&s) {
+                    Ok(m) => m,
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => RoundingMode::HalfExpand,
+            }
+        } else {
+            RoundingMode::HalfExpand
+        };
+
+        let increment = if rounding_increment > 0 {
+            rounding_increment as u32
+        } else {
+            1
+        };
+        
+        let increment_opt = match RoundingIncrement::try_new(increment) {
+            Ok(i) => i,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        match Instant::try_new(ns) {
-            Ok(instant) => {
-                let provider = &*COMPILED_TZ_PROVIDER;
-                match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env
-                        .new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
+        let mut options = RoundingOptions::default();
+        options.smallest_unit = Some(unit);
+        options.rounding_mode = Some(mode);
+        options.increment = Some(increment_opt);
+
+        match time.round(options) {
+            Ok(t) => match t.to_ixdtf_string(ToStringRoundingOptions::default()) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to round: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// Parses a PlainDate string, throwing RangeError if invalid
+    fn parse_plain_date(env: &mut JNIEnv, s: &JString, name: &str) -> Option<PlainDate> {
+        let s_str = parse_jstring(env, s, name)?;
+        super::stats::record_parse();
+        match plain_date_from_str(&s_str) {
+            Ok(d) => Some(d),
+            Err(e) => {
+                throw_range_error(env, &format!("Invalid plain date '{}': {}", s_str, e));
+                None
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateFromString");
+        let date = match parse_plain_date(&mut env, &s, "plain date string") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+        env.new_string(date.to_ixdtf_string(DisplayCalendar::Auto))
+            .map(|js| js.into_raw())
+            .unwrap_or_else(|_| {
+                throw_range_error(&mut env, "Failed to create result string");
+                ptr::null_mut()
+            })
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateFromComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateFromComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        year: jint,
+        month: jint,
+        day: jint,
+        calendar_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateFromComponents");
+        let calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            Calendar::default()
+        };
+
+        match PlainDate::new(year, month as u8, day as u8, calendar) {
+            Ok(date) => env
+                .new_string(date.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or_else(|_| {
+                    throw_range_error(&mut env, "Failed to create result string");
+                    ptr::null_mut()
+                }),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain date components: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateGetAllComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateGetAllComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateGetAllComponents");
+        let date = match parse_plain_date(&mut env, &s, "plain date string") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+
+        let components: [i64; 12] = [
+            date.year() as i64,
+            date.month() as i64,
+            date.day() as i64,
+            date.day_of_week() as i64,
+            date.day_of_year() as i64,
+            date.week_of_year().unwrap_or(0) as i64,
+            date.year_of_week().unwrap_or(0) as i64,
+            date.days_in_week() as i64,
+            date.days_in_month() as i64,
+            date.days_in_year() as i64,
+            date.months_in_year() as i64,
+            if date.in_leap_year() { 1 } else { 0 },
+        ];
+
+        match env.new_long_array(12) {
+            Ok(arr) => {
+                if env.set_long_array_region(&arr, 0, &components).is_err() {
+                    throw_range_error(&mut env, "Failed to set array elements");
+                    return ptr::null_mut();
+                }
+                arr.into_raw()
+            }
+            Err(_) => {
+                throw_range_error(&mut env, "Failed to create result array");
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateGetMonthCode()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateGetMonthCode(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateGetMonthCode");
+        let date = match parse_plain_date(&mut env, &s, "plain date string") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+        env.new_string(date.month_code().as_str())
+            .map(|js| js.into_raw())
+            .unwrap_or_else(|_| {
+                throw_range_error(&mut env, "Failed to create result string");
+                ptr::null_mut()
+            })
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateGetCalendar()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateGetCalendar(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateGetCalendar");
+        let date = match parse_plain_date(&mut env, &s, "plain date string") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+        env.new_string(date.calendar().identifier())
+            .map(|js| js.into_raw())
+            .unwrap_or_else(|_| {
+                throw_range_error(&mut env, "Failed to create result string");
+                ptr::null_mut()
+            })
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateAdd()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateAdd(
+        mut env: JNIEnv,
+        _class: JClass,
+        date_str: JString,
+        duration_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateAdd");
+        let date = match parse_plain_date(&mut env, &date_str, "plain date") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+
+        match date.add(&duration, None) {
+            Ok(result) => env
+                .new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or_else(|_| {
+                    throw_range_error(&mut env, "Failed to create result string");
+                    ptr::null_mut()
+                }),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateSubtract()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateSubtract(
+        mut env: JNIEnv,
+        _class: JClass,
+        date_str: JString,
+        duration_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateSubtract");
+        let date = match parse_plain_date(&mut env, &date_str, "plain date") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+
+        match date.subtract(&duration, None) {
+            Ok(result) => env
+                .new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or_else(|_| {
+                    throw_range_error(&mut env, "Failed to create result string");
+                    ptr::null_mut()
+                }),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid epoch nanoseconds: {}", e));
+                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantEpochMilliseconds()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateCompare()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantEpochMilliseconds(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateCompare(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
+        a: JString,
+        b: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateCompare");
+        let date_a = match parse_plain_date(&mut env, &a, "first plain date") {
+            Some(d) => d,
+            None => return 0,
+        };
+        let date_b = match parse_plain_date(&mut env, &b, "second plain date") {
+            Some(d) => d,
+            None => return 0,
+        };
+
+        // Fallback to string comparison for now
+        let s_a = date_a.to_ixdtf_string(DisplayCalendar::Never);
+        let s_b = date_b.to_ixdtf_string(DisplayCalendar::Never);
+
+        s_a.cmp(&s_b) as jint
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateWith()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateWith(
+        mut env: JNIEnv,
+        _class: JClass,
+        date_str: JString,
+        year: jint,
+        month: jint,
+        day: jint,
+        calendar_id: JString,
     ) -> jstring {
-        let instant = match parse_instant(&mut env, &s, "instant") {
-            Some(i) => i,
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateWith");
+        let date = match parse_plain_date(&mut env, &date_str, "plain date") {
+            Some(d) => d,
             None => return ptr::null_mut(),
         };
-        let ms = instant.epoch_milliseconds();
-        env.new_string(ms.to_string())
-            .map(|js| js.into_raw())
-            .unwrap_or(ptr::null_mut())
+
+        let new_year = if year == i32::MIN { date.year() } else { year };
+        let new_month = if month == i32::MIN { date.month() } else { month as u8 };
+        let new_day = if day == i32::MIN { date.day() } else { day as u8 };
+
+        let new_calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            date.calendar().clone()
+        };
+
+        match PlainDate::new(new_year, new_month, new_day, new_calendar) {
+            Ok(new_date) => env
+                .new_string(new_date.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or_else(|_| {
+                    throw_range_error(&mut env, "Failed to create result string");
+                    ptr::null_mut()
+                }),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid date components: {}", e));
+                ptr::null_mut()
+            }
+        }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantEpochNanoseconds()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateUntil()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantEpochNanoseconds(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateUntil(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
+        one: JString,
+        two: JString,
     ) -> jstring {
-        let instant = match parse_instant(&mut env, &s, "instant") {
-            Some(i) => i,
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateUntil");
+        let d1 = match parse_plain_date(&mut env, &one, "first plain date") {
+            Some(d) => d,
             None => return ptr::null_mut(),
         };
-        let ns = instant.epoch_nanoseconds();
-        env.new_string(ns.0.to_string())
-            .map(|js| js.into_raw())
-            .unwrap_or(ptr::null_mut())
+        let d2 = match parse_plain_date(&mut env, &two, "second plain date") {
+            Some(d) => d,
+            None => return ptr::null_mut(),
+        };
+
+        match d1.until(&d2, Default::default()) {
+            Ok(d) => env
+                .new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or_else(|_| {
+                    throw_range_error(&mut env, "Failed to create result string");
+                    ptr::null_mut()
+                }),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute until: {}", e));
+                ptr::null_mut()
+            }
+        }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantAdd()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateSince()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantAdd(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateSince(
         mut env: JNIEnv,
         _class: JClass,
-        instant_str: JString,
-        duration_str: JString,
+        one: JString,
+        two: JString,
     ) -> jstring {
-        let instant = match parse_instant(&mut env, &instant_str, "instant") {
-            Some(i) => i,
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateSince");
+        let d1 = match parse_plain_date(&mut env, &one, "first plain date") {
+            Some(d) => d,
             None => return ptr::null_mut(),
         };
-        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+        let d2 = match parse_plain_date(&mut env, &two, "second plain date") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
-        
-        match instant.add(&duration) {
-            Ok(result) => {
-                let provider = &*COMPILED_TZ_PROVIDER;
-                match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env
-                        .new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
+
+        match d1.since(&d2, Default::default()) {
+            Ok(d) => env
+                .new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or_else(|_| {
+                    throw_range_error(&mut env, "Failed to create result string");
+                    ptr::null_mut()
+                }),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute since: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeFromString");
+        let s_str = parse_jstring(&mut env, &s, "plain date time string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        match PlainDateTime::from_str(&s_val) {
+            Ok(dt) => match dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain date time '{}': {}", s_val, e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeFromComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeFromComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        year: jint,
+        month: jint,
+        day: jint,
+        hour: jint,
+        minute: jint,
+        second: jint,
+        millisecond: jint,
+        microsecond: jint,
+        nanosecond: jint,
+        calendar_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeFromComponents");
+        let calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
                     Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
                     }
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            Calendar::default()
+        };
+
+        match PlainDateTime::new(
+            year,
+            month as u8,
+            day as u8,
+            hour as u8,
+            minute as u8,
+            second as u8,
+            millisecond as u16,
+            microsecond as u16,
+            nanosecond as u16,
+            calendar
+        ) {
+            Ok(dt) => match dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
+                    ptr::null_mut()
                 }
             },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain date time components: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantSubtract()`
-
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeGetAllComponents()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantSubtract(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeGetAllComponents(
         mut env: JNIEnv,
         _class: JClass,
-        instant_str: JString,
-        duration_str: JString,
-    ) -> jstring {
-        let instant = match parse_instant(&mut env, &instant_str, "instant") {
-            Some(i) => i,
-            None => return ptr::null_mut(),
-        };
-        let duration = match parse_duration(&mut env, &duration_str, "duration") {
-            Some(d) => d,
+        s: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeGetAllComponents");
+        let s_str = parse_jstring(&mut env, &s, "plain date time string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
         
-        match instant.subtract(&duration) {
-            Ok(result) => {
-                let provider = &*COMPILED_TZ_PROVIDER;
-                match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env
-                        .new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
+        let dt = match PlainDateTime::from_str(&s_val) {
+            Ok(d) => d,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let components: [i64; 18] = [
+            dt.year() as i64,
+            dt.month() as i64,
+            dt.day() as i64,
+            dt.day_of_week() as i64,
+            dt.day_of_year() as i64,
+            dt.week_of_year().unwrap_or(0) as i64,
+            dt.year_of_week().unwrap_or(0) as i64,
+            dt.days_in_week() as i64,
+            dt.days_in_month() as i64,
+            dt.days_in_year() as i64,
+            dt.months_in_year() as i64,
+            if dt.in_leap_year() { 1 } else { 0 },
+            dt.hour() as i64,
+            dt.minute() as i64,
+            dt.second() as i64,
+            dt.millisecond() as i64,
+            dt.microsecond() as i64,
+            dt.nanosecond() as i64,
+        ];
+
+        match env.new_long_array(18) {
+            Ok(arr) => {
+                if env.set_long_array_region(&arr, 0, &components).is_err() {
+                    throw_range_error(&mut env, "Failed to set array elements");
+                    return ptr::null_mut();
+                }
+                arr.into_raw()
+            }
+            Err(_) => {
+                throw_range_error(&mut env, "Failed to create result array");
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantCompare()`
-
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeGetMonthCode()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantCompare(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeGetMonthCode(
         mut env: JNIEnv,
         _class: JClass,
-        a: JString,
-        b: JString,
-    ) -> jint {
-        let instant_a = match parse_instant(&mut env, &a, "first instant") {
-            Some(i) => i,
-            None => return 0,
-        };
-        let instant_b = match parse_instant(&mut env, &b, "second instant") {
-            Some(i) => i,
-            None => return 0,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeGetMonthCode");
+        let s_str = parse_jstring(&mut env, &s, "plain date time string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-        
-        instant_a.cmp(&instant_b) as jint
+        match PlainDateTime::from_str(&s_val) {
+            Ok(dt) => env.new_string(dt.month_code().as_str())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                ptr::null_mut()
+            }
+        }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantUntil()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeGetCalendar()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantUntil(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeGetCalendar(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
-        largest_unit: JString,
-        smallest_unit: JString,
-        rounding_increment: jlong,
-        rounding_mode: JString,
+        s: JString,
     ) -> jstring {
-        let one_inst = match parse_instant(&mut env, &one, "first instant") {
-            Some(i) => i,
-            None => return ptr::null_mut(),
-        };
-        let two_inst = match parse_instant(&mut env, &two, "second instant") {
-            Some(i) => i,
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeGetCalendar");
+        let s_str = parse_jstring(&mut env, &s, "plain date time string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        let largest = if !largest_unit.is_null() {
-            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None, // null passed
-            }
-        } else {
-            None
-        };
-
-        let smallest = if !smallest_unit.is_null() {
-            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
-            }
-        } else {
-            None
-        };
-
-        let mode = if !rounding_mode.is_null() {
-            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
-            match s {
-                Some(s) => match RoundingMode::from_str(&s) {
-                    Ok(m) => Some(m),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
-            }
-        } else {
-            None
-        };
-
-        let increment = if rounding_increment > 0 {
-            rounding_increment as u32
-        } else {
-            1
-        };
-        
-        let increment_opt = match RoundingIncrement::try_new(increment) {
-            Ok(i) => Some(i),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
-                return ptr::null_mut();
-            }
-        };
-
-        let mut options = temporal_rs::options::DifferenceSettings::default();
-        options.largest_unit = largest;
-        options.smallest_unit = smallest;
-        options.rounding_mode = mode;
-        options.increment = increment_opt;
-
-        match one_inst.until(&two_inst, options) {
-            Ok(d) => env
-                .new_string(d.to_string())
+        match PlainDateTime::from_str(&s_val) {
+            Ok(dt) => env.new_string(dt.calendar().identifier())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantSince()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeAdd()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantSince(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeAdd(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
-        largest_unit: JString,
-        smallest_unit: JString,
-        rounding_increment: jlong,
-        rounding_mode: JString,
+        dt_str: JString,
+        duration_str: JString,
     ) -> jstring {
-        let one_inst = match parse_instant(&mut env, &one, "first instant") {
-            Some(i) => i,
-            None => return ptr::null_mut(),
-        };
-        let two_inst = match parse_instant(&mut env, &two, "second instant") {
-            Some(i) => i,
-            None => return ptr::null_mut(),
-        };
-
-        let largest = if !largest_unit.is_null() {
-            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
-            }
-        } else {
-            None
-        };
-
-        let smallest = if !smallest_unit.is_null() {
-            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
-            }
-        } else {
-            None
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeAdd");
+        let dt_s = parse_jstring(&mut env, &dt_str, "plain date time");
+        let dt_val = match dt_s {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-
-        let mode = if !rounding_mode.is_null() {
-            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
-            match s {
-                Some(s) => match RoundingMode::from_str(&s) {
-                    Ok(m) => Some(m),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
+        let dt = match PlainDateTime::from_str(&dt_val) {
+            Ok(d) => d,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                return ptr::null_mut();
             }
-        } else {
-            None
         };
 
-        let increment = if rounding_increment > 0 {
-            rounding_increment as u32
-        } else {
-            1
+        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
+        let dur_val = match dur_s {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-        
-        let increment_opt = match RoundingIncrement::try_new(increment) {
-            Ok(i) => Some(i),
+        let duration = match Duration::from_str(&dur_val) {
+            Ok(d) => d,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        let mut options = temporal_rs::options::DifferenceSettings::default();
-        options.largest_unit = largest;
-        options.smallest_unit = smallest;
-        options.rounding_mode = mode;
-        options.increment = increment_opt;
-
-        match one_inst.since(&two_inst, options) {
-            Ok(d) => env
-                .new_string(d.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        match dt.add(&duration, None) {
+            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
+                    ptr::null_mut()
+                }
+            },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantRound()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeSubtract()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantRound(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeSubtract(
         mut env: JNIEnv,
         _class: JClass,
-        instant_str: JString,
-        smallest_unit: JString,
-        rounding_increment: jlong,
-        rounding_mode: JString,
+        dt_str: JString,
+        duration_str: JString,
     ) -> jstring {
-        let instant = match parse_instant(&mut env, &instant_str, "instant") {
-            Some(i) => i,
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeSubtract");
+        let dt_s = parse_jstring(&mut env, &dt_str, "plain date time");
+        let dt_val = match dt_s {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        let unit = if !smallest_unit.is_null() {
-            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => u,
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => {
-                    throw_type_error(&mut env, "smallestUnit is required");
-                    return ptr::null_mut();
-                }
-            }
-        } else {
-            throw_type_error(&mut env, "smallestUnit is required");
-            return ptr::null_mut();
-        };
-
-        let mode = if !rounding_mode.is_null() {
-            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
-            match s {
-                Some(s) => match RoundingMode::from_str(&s) {
-                    Ok(m) => m,
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => RoundingMode::HalfExpand,
+        let dt = match PlainDateTime::from_str(&dt_val) {
+            Ok(d) => d,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                return ptr::null_mut();
             }
-        } else {
-            RoundingMode::HalfExpand
         };
 
-        let increment = if rounding_increment > 0 {
-            rounding_increment as u32
-        } else {
-            1
+        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
+        let dur_val = match dur_s {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-        
-        let increment_opt = match RoundingIncrement::try_new(increment) {
-            Ok(i) => i,
+        let duration = match Duration::from_str(&dur_val) {
+            Ok(d) => d,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        let mut options = RoundingOptions::default();
-        options.smallest_unit = Some(unit);
-        options.rounding_mode = Some(mode);
-        options.increment = Some(increment_opt);
-
-        match instant.round(options) {
-            Ok(result) => {
-                let provider = &*COMPILED_TZ_PROVIDER;
-                match result.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env
-                        .new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
+        match dt.subtract(&duration, None) {
+            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
+                    ptr::null_mut()
                 }
             },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to round: {}", e));
+                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.instantToZonedDateTime()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeCompare()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_instantToZonedDateTime(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeCompare(
         mut env: JNIEnv,
         _class: JClass,
-        instant_str: JString,
+        a: JString,
+        b: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeCompare");
+        let a_str = parse_jstring(&mut env, &a, "first plain date time");
+        let a_val = match a_str {
+            Some(s) => s,
+            None => return 0,
+        };
+        let dt_a = match PlainDateTime::from_str(&a_val) {
+            Ok(d) => d,
+            Err(_) => return 0,
+        };
+
+        let b_str = parse_jstring(&mut env, &b, "second plain date time");
+        let b_val = match b_str {
+            Some(s) => s,
+            None => return 0,
+        };
+        let dt_b = match PlainDateTime::from_str(&b_val) {
+            Ok(d) => d,
+            Err(_) => return 0,
+        };
+
+        dt_a.compare_iso(&dt_b) as jint
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeWith()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeWith(
+        mut env: JNIEnv,
+        _class: JClass,
+        dt_str: JString,
+        year: jint,
+        month: jint,
+        day: jint,
+        hour: jint,
+        minute: jint,
+        second: jint,
+        millisecond: jint,
+        microsecond: jint,
+        nanosecond: jint,
         calendar_id: JString,
-        time_zone_id: JString,
     ) -> jstring {
-        let instant = match parse_instant(&mut env, &instant_str, "instant") {
-            Some(i) => i,
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeWith");
+        let s_str = parse_jstring(&mut env, &dt_str, "plain date time");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        let calendar = if !calendar_id.is_null() {
-            let s = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match s {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => Calendar::default(),
+        let dt = match PlainDateTime::from_str(&s_val) {
+            Ok(d) => d,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                return ptr::null_mut();
             }
-        } else {
-            Calendar::default()
         };
 
-        let tz_str = if !time_zone_id.is_null() {
-            parse_jstring(&mut env, &time_zone_id, "timezone id")
-        } else {
-            throw_type_error(&mut env, "Timezone ID is required");
-            return ptr::null_mut();
-        };
+        let new_year = if year == i32::MIN { dt.year() } else { year };
+        let new_month = if month == i32::MIN { dt.month() } else { month as u8 };
+        let new_day = if day == i32::MIN { dt.day() } else { day as u8 };
+        
+        let new_hour = if hour == i32::MIN { dt.hour() } else { hour as u8 };
+        let new_minute = if minute == i32::MIN { dt.minute() } else { minute as u8 };
+        let new_second = if second == i32::MIN { dt.second() } else { second as u8 };
+        let new_millisecond = if millisecond == i32::MIN { dt.millisecond() } else { millisecond as u16 };
+        let new_microsecond = if microsecond == i32::MIN { dt.microsecond() } else { microsecond as u16 };
+        let new_nanosecond = if nanosecond == i32::MIN { dt.nanosecond() } else { nanosecond as u16 };
 
-        let tz = match tz_str {
-            Some(s) => match TimeZone::try_from_str(&s) {
-                Ok(t) => t,
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                    return ptr::null_mut();
-                }
-            },
-            None => {
-                throw_type_error(&mut env, "Timezone ID is required");
-                return ptr::null_mut();
+        let new_calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => return ptr::null_mut(),
             }
+        } else {
+            dt.calendar().clone()
         };
-        
-        match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, calendar) {
-            Ok(zdt) => match zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-                Ok(s) => env
+
+        match PlainDateTime::new(
+            new_year, new_month, new_day,
+            new_hour, new_minute, new_second,
+            new_millisecond, new_microsecond, new_nanosecond,
+            new_calendar
+        ) {
+             Ok(new_dt) => match new_dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
+                 Ok(s) => env
                     .new_string(s)
                     .map(|js| js.into_raw())
                     .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
-                    ptr::null_mut()
-                }
-            },
+                 Err(e) => {
+                     throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
+                     ptr::null_mut()
+                 }
+             },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to convert to zoned date time: {}", e));
+                throw_range_error(&mut env, &format!("Invalid date components: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.nowPlainDateTimeISO()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeUntil()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_nowPlainDateTimeISO(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeUntil(
         mut env: JNIEnv,
         _class: JClass,
-        tz_id: JString,
+        one: JString,
+        two: JString,
     ) -> jstring {
-        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
-        let tz_val = match tz_str {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeUntil");
+        let one_str = parse_jstring(&mut env, &one, "first plain date time");
+        let one_val = match one_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        
-        match get_now_plain_date_time_string(&tz_val) {
-            Ok(s) => env
-                .new_string(s)
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get plain date time: {}", e));
-                ptr::null_mut()
-            }
-        }
-    }
+        let dt1 = match PlainDateTime::from_str(&one_val) {
+            Ok(d) => d,
+            Err(_) => return ptr::null_mut(),
+        };
 
-    /// JNI function for `com.temporal.TemporalNative.nowPlainDateISO()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_nowPlainDateISO(
-        mut env: JNIEnv,
-        _class: JClass,
-        tz_id: JString,
-    ) -> jstring {
-        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
-        let tz_val = match tz_str {
+        let two_str = parse_jstring(&mut env, &two, "second plain date time");
+        let two_val = match two_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        
-        match get_now_plain_date_string(&tz_val) {
-            Ok(s) => env
-                .new_string(s)
+        let dt2 = match PlainDateTime::from_str(&two_val) {
+            Ok(d) => d,
+            Err(_) => return ptr::null_mut(),
+        };
+
+        match dt1.until(&dt2, Default::default()) {
+            Ok(d) => env
+                .new_string(d.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get plain date: {}", e));
+                throw_range_error(&mut env, &format!("Failed to compute until: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.nowPlainTimeISO()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeSince()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_nowPlainTimeISO(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeSince(
         mut env: JNIEnv,
         _class: JClass,
-        tz_id: JString,
+        one: JString,
+        two: JString,
     ) -> jstring {
-        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
-        let tz_val = match tz_str {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeSince");
+        let one_str = parse_jstring(&mut env, &one, "first plain date time");
+        let one_val = match one_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        
-        match get_now_plain_time_string(&tz_val) {
-            Ok(s) => env
-                .new_string(s)
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get plain time: {}", e));
-                ptr::null_mut()
-            }
-        }
-    }
+        let dt1 = match PlainDateTime::from_str(&one_val) {
+            Ok(d) => d,
+            Err(_) => return ptr::null_mut(),
+        };
 
-    /// JNI function for `com.temporal.TemporalNative.nowZonedDateTimeISO()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_nowZonedDateTimeISO(
-        mut env: JNIEnv,
-        _class: JClass,
-        tz_id: JString,
-    ) -> jstring {
-        let tz_str = parse_jstring(&mut env, &tz_id, "timezone id");
-        let tz_val = match tz_str {
+        let two_str = parse_jstring(&mut env, &two, "second plain date time");
+        let two_val = match two_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        
-        match get_now_zoned_date_time_string(&tz_val) {
-            Ok(s) => env
-                .new_string(s)
+        let dt2 = match PlainDateTime::from_str(&two_val) {
+            Ok(d) => d,
+            Err(_) => return ptr::null_mut(),
+        };
+
+        match dt1.since(&dt2, Default::default()) {
+            Ok(d) => env
+                .new_string(d.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get zoned date time: {}", e));
+                throw_range_error(&mut env, &format!("Failed to compute since: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// Parses a PlainTime string, throwing RangeError if invalid
-    fn parse_plain_time(env: &mut JNIEnv, s: &JString, name: &str) -> Option<PlainTime> {
-        let s_str = parse_jstring(env, s, name)?;
-        match PlainTime::from_str(&s_str) {
-            Ok(t) => Some(t),
-            Err(e) => {
-                throw_range_error(env, &format!("Invalid plain time '{}': {}", s_str, e));
-                None
-            }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainTimeFromString()`
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthFromString()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeFromString(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthFromString(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
     ) -> jstring {
-        let time = match parse_plain_time(&mut env, &s, "plain time string") {
-            Some(t) => t,
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthFromString");
+        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-        match time.to_ixdtf_string(ToStringRoundingOptions::default()) {
-            Ok(s) => env.new_string(s)
+        match PlainYearMonth::from_str(&s_val) {
+            Ok(ym) => env.new_string(ym.to_ixdtf_string(DisplayCalendar::Auto))
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain year month '{}': {}", s_val, e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeFromComponents()`
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthFromComponents()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeFromComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthFromComponents(
         mut env: JNIEnv,
         _class: JClass,
-        hour: jint,
-        minute: jint,
-        second: jint,
-        millisecond: jint,
-        microsecond: jint,
-        nanosecond: jint,
+        year: jint,
+        month: jint,
+        calendar_id: JString,
+        _reference_day: jint,
     ) -> jstring {
-        // Validate ranges before casting to narrower types
-        if hour < 0 || hour > 23 {
-            throw_range_error(&mut env, &format!("Invalid hour: {} (must be 0-23)", hour));
-            return ptr::null_mut();
-        }
-        if minute < 0 || minute > 59 {
-            throw_range_error(&mut env, &format!("Invalid minute: {} (must be 0-59)", minute));
-            return ptr::null_mut();
-        }
-        if second < 0 || second > 59 {
-            throw_range_error(&mut env, &format!("Invalid second: {} (must be 0-59)", second));
-            return ptr::null_mut();
-        }
-        if millisecond < 0 || millisecond > 999 {
-            throw_range_error(&mut env, &format!("Invalid millisecond: {} (must be 0-999)", millisecond));
-            return ptr::null_mut();
-        }
-        if microsecond < 0 || microsecond > 999 {
-            throw_range_error(&mut env, &format!("Invalid microsecond: {} (must be 0-999)", microsecond));
-            return ptr::null_mut();
-        }
-        if nanosecond < 0 || nanosecond > 999 {
-            throw_range_error(&mut env, &format!("Invalid nanosecond: {} (must be 0-999)", nanosecond));
-            return ptr::null_mut();
-        }
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthFromComponents");
+        let calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            Calendar::default()
+        };
 
-        match PlainTime::new(
-            hour as u8,
-            minute as u8,
-            second as u8,
-            millisecond as u16,
-            microsecond as u16,
-            nanosecond as u16
-        ) {
-            Ok(time) => match time.to_ixdtf_string(ToStringRoundingOptions::default()) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or_else(|_| {
-                        throw_range_error(&mut env, "Failed to create result string");
-                        ptr::null_mut()
-                    }),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
-                    ptr::null_mut()
-                }
-            },
+        match PlainYearMonth::new(year, month as u8, None, calendar) {
+            Ok(ym) => env.new_string(ym.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain time components: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain year month components: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeGetAllComponents()`
-    /// Returns: [hour, minute, second, millisecond, microsecond, nanosecond]
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthGetAllComponents()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeGetAllComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthGetAllComponents(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
-    ) -> jlongArray {
-        let time = match parse_plain_time(&mut env, &s, "plain time string") {
-            Some(t) => t,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthGetAllComponents");
+        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
+        
+        let ym: PlainYearMonth = match PlainYearMonth::from_str(&s_val) {
+            Ok(y) => y,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                return ptr::null_mut();
+            }
+        };
 
-        let components: [i64; 6] = [
-            time.hour() as i64,
-            time.minute() as i64,
-            time.second() as i64,
-            time.millisecond() as i64,
-            time.microsecond() as i64,
-            time.nanosecond() as i64,
+        let components: [i64; 8] = [
+            ym.year() as i64,
+            ym.month() as i64,
+            0, // PlainYearMonth does not have a day
+            ym.days_in_month() as i64,
+            ym.days_in_year() as i64,
+            ym.months_in_year() as i64,
+            if ym.in_leap_year() { 1 } else { 0 },
+            ym.era_year().unwrap_or(0) as i64,
         ];
 
-        match env.new_long_array(6) {
+        match env.new_long_array(8) {
             Ok(arr) => {
                 if env.set_long_array_region(&arr, 0, &components).is_err() {
                     throw_range_error(&mut env, "Failed to set array elements");
@@ -4301,34 +11159,93 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeAdd()`
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthGetMonthCode()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeAdd(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthGetMonthCode(
         mut env: JNIEnv,
         _class: JClass,
-        time_str: JString,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthGetMonthCode");
+        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        match PlainYearMonth::from_str(&s_val) {
+            Ok(ym) => env.new_string(ym.month_code().as_str())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthGetCalendar()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthGetCalendar(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthGetCalendar");
+        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        match PlainYearMonth::from_str(&s_val) {
+            Ok(ym) => env.new_string(ym.calendar().identifier())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthAdd()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthAdd(
+        mut env: JNIEnv,
+        _class: JClass,
+        ym_str: JString,
         duration_str: JString,
     ) -> jstring {
-        let time = match parse_plain_time(&mut env, &time_str, "plain time") {
-            Some(t) => t,
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthAdd");
+        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
+        let ym_val = match ym_s {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let duration = match parse_duration(&mut env, &duration_str, "duration") {
-            Some(d) => d,
+        let ym = match PlainYearMonth::from_str(&ym_val) {
+            Ok(y) => y,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
+        let dur_val = match dur_s {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
+        let duration = match Duration::from_str(&dur_val) {
+            Ok(d) => d,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
+                return ptr::null_mut();
+            }
+        };
 
-        match time.add(&duration) {
-            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default()) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
-                    ptr::null_mut()
-                }
-            },
+        match ym.add(&duration, Overflow::Reject) {
+            Ok(result) => env.new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
             Err(e) => {
                 throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
                 ptr::null_mut()
@@ -4336,34 +11253,45 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeSubtract()`
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthSubtract()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeSubtract(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthSubtract(
         mut env: JNIEnv,
         _class: JClass,
-        time_str: JString,
+        ym_str: JString,
         duration_str: JString,
     ) -> jstring {
-        let time = match parse_plain_time(&mut env, &time_str, "plain time") {
-            Some(t) => t,
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthSubtract");
+        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
+        let ym_val = match ym_s {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let duration = match parse_duration(&mut env, &duration_str, "duration") {
-            Some(d) => d,
+        let ym = match PlainYearMonth::from_str(&ym_val) {
+            Ok(y) => y,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
+        let dur_val = match dur_s {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
+        let duration = match Duration::from_str(&dur_val) {
+            Ok(d) => d,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
+                return ptr::null_mut();
+            }
+        };
 
-        match time.subtract(&duration) {
-            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default()) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
-                    ptr::null_mut()
-                }
-            },
+        match ym.subtract(&duration, Overflow::Reject) {
+            Ok(result) => env.new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
             Err(e) => {
                 throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
                 ptr::null_mut()
@@ -4371,340 +11299,446 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeCompare()`
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthCompare()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthCompare(
+        mut env: JNIEnv,
+        _class: JClass,
+        a: JString,
+        b: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthCompare");
+        let a_str = parse_jstring(&mut env, &a, "first plain year month");
+        let a_val = match a_str {
+            Some(s) => s,
+            None => return 0,
+        };
+        let ym_a: PlainYearMonth = match PlainYearMonth::from_str(&a_val) {
+            Ok(y) => y,
+            Err(_) => return 0,
+        };
+
+        let b_str = parse_jstring(&mut env, &b, "second plain year month");
+        let b_val = match b_str {
+            Some(s) => s,
+            None => return 0,
+        };
+        let ym_b: PlainYearMonth = match PlainYearMonth::from_str(&b_val) {
+            Ok(y) => y,
+            Err(_) => return 0,
+        };
+
+        // Fallback to string comparison for now
+        let s_a = ym_a.to_ixdtf_string(DisplayCalendar::Never);
+        let s_b = ym_b.to_ixdtf_string(DisplayCalendar::Never);
+
+        s_a.cmp(&s_b) as jint
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthWith()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthWith(
+        mut env: JNIEnv,
+        _class: JClass,
+        ym_str: JString,
+        year: jint,
+        month: jint,
+        calendar_id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthWith");
+        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
+        let ym_val = match ym_s {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        let ym: PlainYearMonth = match PlainYearMonth::from_str(&ym_val) {
+            Ok(y) => y,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let new_year = if year == i32::MIN { ym.year() } else { year };
+        let new_month = if month == i32::MIN { ym.month() } else { month as u8 };
+
+        let new_calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            ym.calendar().clone()
+        };
+
+        match PlainYearMonth::new(new_year, new_month, None, new_calendar) {
+            Ok(new_ym) => env.new_string(new_ym.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid components: {}", e));
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthUntil()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeCompare(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthUntil(
         mut env: JNIEnv,
         _class: JClass,
-        a: JString,
-        b: JString,
-    ) -> jint {
-        let time_a = match parse_plain_time(&mut env, &a, "first plain time") {
-            Some(t) => t,
-            None => return 0,
+        one: JString,
+        two: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthUntil");
+        let one_str = parse_jstring(&mut env, &one, "first plain year month");
+        let one_val = match one_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-        let time_b = match parse_plain_time(&mut env, &b, "second plain time") {
-            Some(t) => t,
-            None => return 0,
+        let ym1: PlainYearMonth = match PlainYearMonth::from_str(&one_val) {
+            Ok(y) => y,
+            Err(_) => return ptr::null_mut(),
         };
 
-        time_a.cmp(&time_b) as jint
+        let two_str = parse_jstring(&mut env, &two, "second plain year month");
+        let two_val = match two_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        let ym2: PlainYearMonth = match PlainYearMonth::from_str(&two_val) {
+            Ok(y) => y,
+            Err(_) => return ptr::null_mut(),
+        };
+
+        match ym1.until(&ym2, Default::default()) {
+            Ok(d) => env.new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute until: {}", e));
+                ptr::null_mut()
+            }
+        }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeUntil()`
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthSince()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeUntil(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthSince(
         mut env: JNIEnv,
         _class: JClass,
         one: JString,
         two: JString,
-        largest_unit: JString,
-        smallest_unit: JString,
-        rounding_increment: jlong,
-        rounding_mode: JString,
     ) -> jstring {
-        let one_time = match parse_plain_time(&mut env, &one, "first plain time") {
-            Some(t) => t,
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthSince");
+        let one_str = parse_jstring(&mut env, &one, "first plain year month");
+        let one_val = match one_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let two_time = match parse_plain_time(&mut env, &two, "second plain time") {
-            Some(t) => t,
-            None => return ptr::null_mut(),
+        let ym1: PlainYearMonth = match PlainYearMonth::from_str(&one_val) {
+            Ok(y) => y,
+            Err(_) => return ptr::null_mut(),
         };
 
-        let largest = if !largest_unit.is_null() {
-            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
-            }
-        } else {
-            None
+        let two_str = parse_jstring(&mut env, &two, "second plain year month");
+        let two_val = match two_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-
-        let smallest = if !smallest_unit.is_null() {
-            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
-            }
-        } else {
-            None
+        let ym2: PlainYearMonth = match PlainYearMonth::from_str(&two_val) {
+            Ok(y) => y,
+            Err(_) => return ptr::null_mut(),
         };
 
-        let mode = if !rounding_mode.is_null() {
-            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
-            match s {
-                Some(s) => match RoundingMode::from_str(&s) {
-                    Ok(m) => Some(m),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
+        match ym1.since(&ym2, Default::default()) {
+            Ok(d) => env.new_string(d.to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to compute since: {}", e));
+                ptr::null_mut()
             }
-        } else {
-            None
-        };
+        }
+    }
 
-        let increment = if rounding_increment > 0 {
-            rounding_increment as u32
-        } else {
-            1
+    /// JNI function for `com.temporal.TemporalNative.plainYearMonthToPlainDate()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthToPlainDate(
+        mut env: JNIEnv,
+        _class: JClass,
+        ym_str: JString,
+        day: jint,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainYearMonthToPlainDate");
+        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
+        let ym_val = match ym_s {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-        
-        let increment_opt = match RoundingIncrement::try_new(increment) {
-            Ok(i) => Some(i),
+        let ym: PlainYearMonth = match PlainYearMonth::from_str(&ym_val) {
+            Ok(y) => y,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        let mut options = temporal_rs::options::DifferenceSettings::default();
-        options.largest_unit = largest;
-        options.smallest_unit = smallest;
-        options.rounding_mode = mode;
-        options.increment = increment_opt;
-
-        match one_time.until(&two_time, options) {
-            Ok(d) => env
-                .new_string(d.to_string())
+        match PlainDate::new(ym.year(), ym.month(), day as u8, ym.calendar().clone()) {
+            Ok(d) => env.new_string(d.to_ixdtf_string(DisplayCalendar::Auto))
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                throw_range_error(&mut env, &format!("Failed to convert to plain date: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeSince()`
+    /// JNI function for `com.temporal.TemporalNative.plainMonthDayFromString()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeSince(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayFromString(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
-        largest_unit: JString,
-        smallest_unit: JString,
-        rounding_increment: jlong,
-        rounding_mode: JString,
+        s: JString,
     ) -> jstring {
-        let one_time = match parse_plain_time(&mut env, &one, "first plain time") {
-            Some(t) => t,
-            None => return ptr::null_mut(),
-        };
-        let two_time = match parse_plain_time(&mut env, &two, "second plain time") {
-            Some(t) => t,
+        stats_scope!("Java_com_temporal_TemporalNative_plainMonthDayFromString");
+        let s_str = parse_jstring(&mut env, &s, "plain month day string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        let largest = if !largest_unit.is_null() {
-            let s = parse_jstring(&mut env, &largest_unit, "largest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid largest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
+        match PlainMonthDay::from_str(&s_val) {
+            Ok(md) => env.new_string(md.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain month day '{}': {}", s_val, e));
+                ptr::null_mut()
             }
-        } else {
-            None
-        };
+        }
+    }
 
-        let smallest = if !smallest_unit.is_null() {
-            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => Some(u),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+    /// JNI function for `com.temporal.TemporalNative.plainMonthDayFromComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayFromComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        month: jint,
+        day: jint,
+        calendar_id: JString,
+        _reference_year: jint,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainMonthDayFromComponents");
+        let calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
                         return ptr::null_mut();
                     }
                 },
-                None => None,
+                None => return ptr::null_mut(),
             }
         } else {
-            None
+            Calendar::default()
         };
 
-        let mode = if !rounding_mode.is_null() {
-            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
-            match s {
-                Some(s) => match RoundingMode::from_str(&s) {
-                    Ok(m) => Some(m),
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => None,
+        match PlainMonthDay::new_with_overflow(month as u8, day as u8, calendar, Overflow::Reject, None) {
+            Ok(md) => env.new_string(md.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain month day components: {}", e));
+                ptr::null_mut()
             }
-        } else {
-            None
-        };
+        }
+    }
 
-        let increment = if rounding_increment > 0 {
-            rounding_increment as u32
-        } else {
-            1
+    /// JNI function for `com.temporal.TemporalNative.plainMonthDayGetAllComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayGetAllComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainMonthDayGetAllComponents");
+        let s_str = parse_jstring(&mut env, &s, "plain month day string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
         
-        let increment_opt = match RoundingIncrement::try_new(increment) {
-            Ok(i) => Some(i),
+        let md = match PlainMonthDay::from_str(&s_val) {
+            Ok(m) => m,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        let mut options = temporal_rs::options::DifferenceSettings::default();
-        options.largest_unit = largest;
-        options.smallest_unit = smallest;
-        options.rounding_mode = mode;
-        options.increment = increment_opt;
+        let components: [i64; 2] = [
+            md.calendar().month(&md.iso) as i64,
+            md.day() as i64,
+        ];
 
-        match one_time.since(&two_time, options) {
-            Ok(d) => env
-                .new_string(d.to_string())
+        match env.new_long_array(2) {
+            Ok(arr) => {
+                if env.set_long_array_region(&arr, 0, &components).is_err() {
+                    throw_range_error(&mut env, "Failed to set array elements");
+                    return ptr::null_mut();
+                }
+                arr.into_raw()
+            }
+            Err(_) => {
+                throw_range_error(&mut env, "Failed to create result array");
+                ptr::null_mut()
+            }
+        }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainMonthDayGetMonthCode()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayGetMonthCode(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainMonthDayGetMonthCode");
+        let s_str = parse_jstring(&mut env, &s, "plain month day string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        match PlainMonthDay::from_str(&s_val) {
+            Ok(md) => env.new_string(md.month_code().as_str())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute difference: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainTimeRound()`
+    /// JNI function for `com.temporal.TemporalNative.plainMonthDayGetCalendar()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeRound(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayGetCalendar(
         mut env: JNIEnv,
         _class: JClass,
-        time_str: JString,
-        smallest_unit: JString,
-        rounding_increment: jlong,
-        rounding_mode: JString,
+        s: JString,
     ) -> jstring {
-        let time = match parse_plain_time(&mut env, &time_str, "plain time") {
-            Some(t) => t,
+        stats_scope!("Java_com_temporal_TemporalNative_plainMonthDayGetCalendar");
+        let s_str = parse_jstring(&mut env, &s, "plain month day string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        let unit = if !smallest_unit.is_null() {
-            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => u,
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => {
-                    throw_type_error(&mut env, "smallestUnit is required");
-                    return ptr::null_mut();
-                }
-            }
-        } else {
-            throw_type_error(&mut env, "smallestUnit is required");
-            return ptr::null_mut();
-        };
-
-        let mode = if !rounding_mode.is_null() {
-            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
-            match s {
-                Some(s) => match RoundingMode::from_str(&s) {
-                    Ok(m) => m,
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => RoundingMode::HalfExpand,
+        match PlainMonthDay::from_str(&s_val) {
+            Ok(md) => env.new_string(md.calendar().identifier())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
+                ptr::null_mut()
             }
-        } else {
-            RoundingMode::HalfExpand
-        };
+        }
+    }
 
-        let increment = if rounding_increment > 0 {
-            rounding_increment as u32
-        } else {
-            1
+    /// JNI function for `com.temporal.TemporalNative.plainMonthDayToPlainDate()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayToPlainDate(
+        mut env: JNIEnv,
+        _class: JClass,
+        md_str: JString,
+        year: jint,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainMonthDayToPlainDate");
+        let md_s = parse_jstring(&mut env, &md_str, "plain month day");
+        let md_val = match md_s {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-        
-        let increment_opt = match RoundingIncrement::try_new(increment) {
-            Ok(i) => i,
+        let md = match PlainMonthDay::from_str(&md_val) {
+            Ok(m) => m,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        let mut options = RoundingOptions::default();
-        options.smallest_unit = Some(unit);
-        options.rounding_mode = Some(mode);
-        options.increment = Some(increment_opt);
-
-        match time.round(options) {
-            Ok(t) => match t.to_ixdtf_string(ToStringRoundingOptions::default()) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
-                    ptr::null_mut()
-                }
-            },
+        match PlainDate::new(year, md.calendar().month(&md.iso), md.day(), md.calendar().clone()) {
+            Ok(d) => env.new_string(d.to_ixdtf_string(DisplayCalendar::Auto))
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to round: {}", e));
+                throw_range_error(&mut env, &format!("Failed to convert to plain date: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// Parses a PlainDate string, throwing RangeError if invalid
-    fn parse_plain_date(env: &mut JNIEnv, s: &JString, name: &str) -> Option<PlainDate> {
-        let s_str = parse_jstring(env, s, name)?;
-        match PlainDate::from_str(&s_str) {
-            Ok(d) => Some(d),
+    /// JNI function for `com.temporal.TemporalNative.calendarFrom()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_calendarFrom(
+        mut env: JNIEnv,
+        _class: JClass,
+        id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_calendarFrom");
+        let id_str = parse_jstring(&mut env, &id, "calendar identifier");
+        let id_val = match id_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
+        };
+        
+        match Calendar::from_str(&id_val) {
+            Ok(calendar) => env
+                .new_string(calendar.identifier().to_string())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(env, &format!("Invalid plain date '{}': {}", s_str, e));
-                None
+                throw_range_error(&mut env, &format!("Invalid calendar identifier '{}': {}", id_val, e));
+                ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateFromString()`
+    /// JNI function for `com.temporal.TemporalNative.calendarId()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateFromString(
+    pub extern "system" fn Java_com_temporal_TemporalNative_calendarId(
+        env: JNIEnv,
+        _class: JClass,
+        id: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_calendarId");
+        // Just reusing calendarFrom logic since ID access is basically normalization
+        Java_com_temporal_TemporalNative_calendarFrom(env, _class, id)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.durationFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationFromString(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
+        input: JString,
     ) -> jstring {
-        let date = match parse_plain_date(&mut env, &s, "plain date string") {
+        stats_scope!("Java_com_temporal_TemporalNative_durationFromString");
+        let duration = match parse_duration(&mut env, &input, "duration string") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
-        env.new_string(date.to_ixdtf_string(DisplayCalendar::Auto))
+
+        env.new_string(duration.to_string())
             .map(|js| js.into_raw())
             .unwrap_or_else(|_| {
                 throw_range_error(&mut env, "Failed to create result string");
@@ -4712,72 +11746,88 @@ mod android {
             })
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateFromComponents()`
+    /// JNI function for `com.temporal.TemporalNative.durationFromComponents()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateFromComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationFromComponents(
         mut env: JNIEnv,
         _class: JClass,
-        year: jint,
-        month: jint,
-        day: jint,
-        calendar_id: JString,
+        years: jlong,
+        months: jlong,
+        weeks: jlong,
+        days: jlong,
+        hours: jlong,
+        minutes: jlong,
+        seconds: jlong,
+        milliseconds: jlong,
+        microseconds: jlong,
+        nanoseconds: jlong,
     ) -> jstring {
-        let calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            Calendar::default()
-        };
+        stats_scope!("Java_com_temporal_TemporalNative_durationFromComponents");
+        // Check for mixed signs
+        let values = [years, months, weeks, days, hours, minutes, seconds, milliseconds, microseconds, nanoseconds];
+        let non_zero: Vec<i64> = values.iter().copied().filter(|&v| v != 0).collect();
 
-        match PlainDate::new(year, month as u8, day as u8, calendar) {
-            Ok(date) => env
-                .new_string(date.to_ixdtf_string(DisplayCalendar::Auto))
+        if !non_zero.is_empty() {
+            let first_sign = non_zero[0].signum();
+            if !non_zero.iter().all(|&v| v.signum() == first_sign) {
+                throw_range_error(&mut env, "All non-zero duration values must have the same sign");
+                return ptr::null_mut();
+            }
+        }
+
+        match Duration::new(
+            years,
+            months,
+            weeks,
+            days,
+            hours,
+            minutes,
+            seconds,
+            milliseconds,
+            microseconds as i128,
+            nanoseconds as i128,
+        ) {
+            Ok(duration) => env
+                .new_string(duration.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or_else(|_| {
                     throw_range_error(&mut env, "Failed to create result string");
                     ptr::null_mut()
                 }),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date components: {}", e));
+                throw_range_error(&mut env, &format!("Invalid duration components: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateGetAllComponents()`
+    /// JNI function for `com.temporal.TemporalNative.durationGetAllComponents()`
+    /// Returns a long array: [years, months, weeks, days, hours, minutes, seconds, milliseconds, microseconds, nanoseconds, sign, blank]
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateGetAllComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationGetAllComponents(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
+        duration_str: JString,
     ) -> jlongArray {
-        let date = match parse_plain_date(&mut env, &s, "plain date string") {
+        stats_scope!("Java_com_temporal_TemporalNative_durationGetAllComponents");
+        let duration = match parse_duration(&mut env, &duration_str, "duration string") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
 
         let components: [i64; 12] = [
-            date.year() as i64,
-            date.month() as i64,
-            date.day() as i64,
-            date.day_of_week() as i64,
-            date.day_of_year() as i64,
-            date.week_of_year().unwrap_or(0) as i64,
-            date.year_of_week().unwrap_or(0) as i64,
-            date.days_in_week() as i64,
-            date.days_in_month() as i64,
-            date.days_in_year() as i64,
-            date.months_in_year() as i64,
-            if date.in_leap_year() { 1 } else { 0 },
+            duration.years(),
+            duration.months(),
+            duration.weeks(),
+            duration.days(),
+            duration.hours(),
+            duration.minutes(),
+            duration.seconds(),
+            duration.milliseconds(),
+            duration.microseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64,
+            duration.nanoseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64,
+            duration.sign() as i64,
+            if duration.is_zero() { 1 } else { 0 },
         ];
 
         match env.new_long_array(12) {
@@ -4795,582 +11845,728 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateGetMonthCode()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateGetMonthCode(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let date = match parse_plain_date(&mut env, &s, "plain date string") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
-        };
-        env.new_string(date.month_code().as_str())
-            .map(|js| js.into_raw())
-            .unwrap_or_else(|_| {
-                throw_range_error(&mut env, "Failed to create result string");
-                ptr::null_mut()
-            })
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainDateGetCalendar()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateGetCalendar(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let date = match parse_plain_date(&mut env, &s, "plain date string") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
-        };
-        env.new_string(date.calendar().identifier())
-            .map(|js| js.into_raw())
-            .unwrap_or_else(|_| {
-                throw_range_error(&mut env, "Failed to create result string");
-                ptr::null_mut()
-            })
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainDateAdd()`
+    /// JNI function for `com.temporal.TemporalNative.durationAdd()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateAdd(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationAdd(
         mut env: JNIEnv,
         _class: JClass,
-        date_str: JString,
-        duration_str: JString,
+        a: JString,
+        b: JString,
     ) -> jstring {
-        let date = match parse_plain_date(&mut env, &date_str, "plain date") {
+        stats_scope!("Java_com_temporal_TemporalNative_durationAdd");
+        let duration_a = match parse_duration(&mut env, &a, "first duration") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
-        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+        let duration_b = match parse_duration(&mut env, &b, "second duration") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
 
-        match date.add(&duration, None) {
+        match duration_a.add(&duration_b) {
             Ok(result) => env
-                .new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
+                .new_string(result.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or_else(|_| {
                     throw_range_error(&mut env, "Failed to create result string");
                     ptr::null_mut()
                 }),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
+                throw_range_error(&mut env, &format!("Failed to add durations: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateSubtract()`
+    /// JNI function for `com.temporal.TemporalNative.durationSubtract()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateSubtract(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationSubtract(
         mut env: JNIEnv,
         _class: JClass,
-        date_str: JString,
-        duration_str: JString,
+        a: JString,
+        b: JString,
     ) -> jstring {
-        let date = match parse_plain_date(&mut env, &date_str, "plain date") {
+        stats_scope!("Java_com_temporal_TemporalNative_durationSubtract");
+        let duration_a = match parse_duration(&mut env, &a, "first duration") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
-        let duration = match parse_duration(&mut env, &duration_str, "duration") {
+        let duration_b = match parse_duration(&mut env, &b, "second duration") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
 
-        match date.subtract(&duration, None) {
+        match duration_a.subtract(&duration_b) {
             Ok(result) => env
-                .new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
+                .new_string(result.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or_else(|_| {
                     throw_range_error(&mut env, "Failed to create result string");
                     ptr::null_mut()
                 }),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
+                throw_range_error(&mut env, &format!("Failed to subtract durations: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateCompare()`
+    /// JNI function for `com.temporal.TemporalNative.durationNegated()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateCompare(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationNegated(
         mut env: JNIEnv,
         _class: JClass,
-        a: JString,
-        b: JString,
-    ) -> jint {
-        let date_a = match parse_plain_date(&mut env, &a, "first plain date") {
-            Some(d) => d,
-            None => return 0,
-        };
-        let date_b = match parse_plain_date(&mut env, &b, "second plain date") {
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_durationNegated");
+        let duration = match parse_duration(&mut env, &s, "duration") {
             Some(d) => d,
-            None => return 0,
+            None => return ptr::null_mut(),
         };
 
-        // Fallback to string comparison for now
-        let s_a = date_a.to_ixdtf_string(DisplayCalendar::Never);
-        let s_b = date_b.to_ixdtf_string(DisplayCalendar::Never);
-
-        s_a.cmp(&s_b) as jint
+        env.new_string(duration.negated().to_string())
+            .map(|js| js.into_raw())
+            .unwrap_or_else(|_| {
+                throw_range_error(&mut env, "Failed to create result string");
+                ptr::null_mut()
+            })
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateWith()`
+    /// JNI function for `com.temporal.TemporalNative.durationAbs()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateWith(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationAbs(
         mut env: JNIEnv,
         _class: JClass,
-        date_str: JString,
-        year: jint,
-        month: jint,
-        day: jint,
-        calendar_id: JString,
+        s: JString,
     ) -> jstring {
-        let date = match parse_plain_date(&mut env, &date_str, "plain date") {
+        stats_scope!("Java_com_temporal_TemporalNative_durationAbs");
+        let duration = match parse_duration(&mut env, &s, "duration") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
 
-        let new_year = if year == i32::MIN { date.year() } else { year };
-        let new_month = if month == i32::MIN { date.month() } else { month as u8 };
-        let new_day = if day == i32::MIN { date.day() } else { day as u8 };
-
-        let new_calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            date.calendar().clone()
-        };
-
-        match PlainDate::new(new_year, new_month, new_day, new_calendar) {
-            Ok(new_date) => env
-                .new_string(new_date.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or_else(|_| {
-                    throw_range_error(&mut env, "Failed to create result string");
-                    ptr::null_mut()
-                }),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid date components: {}", e));
+        env.new_string(duration.abs().to_string())
+            .map(|js| js.into_raw())
+            .unwrap_or_else(|_| {
+                throw_range_error(&mut env, "Failed to create result string");
                 ptr::null_mut()
-            }
-        }
+            })
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateUntil()`
+    /// JNI function for `com.temporal.TemporalNative.durationCompare()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateUntil(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationCompare(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
-    ) -> jstring {
-        let d1 = match parse_plain_date(&mut env, &one, "first plain date") {
+        a: JString,
+        b: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_durationCompare");
+        let duration_a = match parse_duration(&mut env, &a, "first duration") {
             Some(d) => d,
-            None => return ptr::null_mut(),
+            None => return 0,
         };
-        let d2 = match parse_plain_date(&mut env, &two, "second plain date") {
+        let duration_b = match parse_duration(&mut env, &b, "second duration") {
             Some(d) => d,
-            None => return ptr::null_mut(),
+            None => return 0,
         };
 
-        match d1.until(&d2, Default::default()) {
-            Ok(d) => env
-                .new_string(d.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or_else(|_| {
-                    throw_range_error(&mut env, "Failed to create result string");
-                    ptr::null_mut()
-                }),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute until: {}", e));
-                ptr::null_mut()
-            }
+        // Check if durations have calendar units
+        let has_calendar_a = duration_a.years() != 0 || duration_a.months() != 0 || duration_a.weeks() != 0;
+        let has_calendar_b = duration_b.years() != 0 || duration_b.months() != 0 || duration_b.weeks() != 0;
+
+        if has_calendar_a || has_calendar_b {
+            throw_range_error(&mut env, "Comparing durations with years, months, or weeks requires a relativeTo option (not yet supported)");
+            return 0;
         }
+
+        // For time-only durations, compare by total nanoseconds
+        let total_a = duration_a.days() as i128 * 86_400_000_000_000
+            + duration_a.hours() as i128 * 3_600_000_000_000
+            + duration_a.minutes() as i128 * 60_000_000_000
+            + duration_a.seconds() as i128 * 1_000_000_000
+            + duration_a.milliseconds() as i128 * 1_000_000
+            + duration_a.microseconds() * 1_000
+            + duration_a.nanoseconds();
+
+        let total_b = duration_b.days() as i128 * 86_400_000_000_000
+            + duration_b.hours() as i128 * 3_600_000_000_000
+            + duration_b.minutes() as i128 * 60_000_000_000
+            + duration_b.seconds() as i128 * 1_000_000_000
+            + duration_b.milliseconds() as i128 * 1_000_000
+            + duration_b.microseconds() * 1_000
+            + duration_b.nanoseconds();
+
+        total_a.cmp(&total_b) as jint
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateSince()`
+    /// Sentinel value for "unchanged" component in durationWith.
+    /// Matches JavaScript's Number.MIN_SAFE_INTEGER (-(2^53 - 1)).
+    const UNCHANGED_SENTINEL: i64 = -9007199254740991;
+
+    /// JNI function for `com.temporal.TemporalNative.durationWith()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateSince(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationWith(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
+        original: JString,
+        years: jlong,
+        months: jlong,
+        weeks: jlong,
+        days: jlong,
+        hours: jlong,
+        minutes: jlong,
+        seconds: jlong,
+        milliseconds: jlong,
+        microseconds: jlong,
+        nanoseconds: jlong,
     ) -> jstring {
-        let d1 = match parse_plain_date(&mut env, &one, "first plain date") {
+        stats_scope!("Java_com_temporal_TemporalNative_durationWith");
+        let duration = match parse_duration(&mut env, &original, "duration") {
             Some(d) => d,
             None => return ptr::null_mut(),
         };
-        let d2 = match parse_plain_date(&mut env, &two, "second plain date") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
+
+        // Use original values for any component set to UNCHANGED_SENTINEL (sentinel)
+        let new_years = if years == UNCHANGED_SENTINEL { duration.years() } else { years };
+        let new_months = if months == UNCHANGED_SENTINEL { duration.months() } else { months };
+        let new_weeks = if weeks == UNCHANGED_SENTINEL { duration.weeks() } else { weeks };
+        let new_days = if days == UNCHANGED_SENTINEL { duration.days() } else { days };
+        let new_hours = if hours == UNCHANGED_SENTINEL { duration.hours() } else { hours };
+        let new_minutes = if minutes == UNCHANGED_SENTINEL { duration.minutes() } else { minutes };
+        let new_seconds = if seconds == UNCHANGED_SENTINEL { duration.seconds() } else { seconds };
+        let new_milliseconds = if milliseconds == UNCHANGED_SENTINEL { duration.milliseconds() } else { milliseconds };
+        let new_microseconds = if microseconds == UNCHANGED_SENTINEL {
+            duration.microseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64
+        } else {
+            microseconds
+        };
+        let new_nanoseconds = if nanoseconds == UNCHANGED_SENTINEL {
+            duration.nanoseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64
+        } else {
+            nanoseconds
         };
 
-        match d1.since(&d2, Default::default()) {
-            Ok(d) => env
-                .new_string(d.to_string())
+        // Check for mixed signs
+        let values = [new_years, new_months, new_weeks, new_days, new_hours, new_minutes,
+                      new_seconds, new_milliseconds, new_microseconds, new_nanoseconds];
+        let non_zero: Vec<i64> = values.iter().copied().filter(|&v| v != 0).collect();
+
+        if !non_zero.is_empty() {
+            let first_sign = non_zero[0].signum();
+            if !non_zero.iter().all(|&v| v.signum() == first_sign) {
+                throw_range_error(&mut env, "All non-zero duration values must have the same sign");
+                return ptr::null_mut();
+            }
+        }
+
+        match Duration::new(
+            new_years,
+            new_months,
+            new_weeks,
+            new_days,
+            new_hours,
+            new_minutes,
+            new_seconds,
+            new_milliseconds,
+            new_microseconds as i128,
+            new_nanoseconds as i128,
+        ) {
+            Ok(result) => env
+                .new_string(result.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or_else(|_| {
                     throw_range_error(&mut env, "Failed to create result string");
                     ptr::null_mut()
                 }),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute since: {}", e));
+                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
                 ptr::null_mut()
             }
         }
+
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeFromString()`
+    /// JNI function for `com.temporal.TemporalNative.timeZoneFromString()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeFromString(
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneFromString(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain date time string");
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneFromString");
+        let s_str = parse_jstring(&mut env, &s, "timezone string");
         let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        match PlainDateTime::from_str(&s_val) {
-            Ok(dt) => match dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-                Ok(s) => env
-                    .new_string(s)
+        match resolve_time_zone(&s_val) {
+            Ok(tz) => match tz.identifier() {
+                Ok(id) => env.new_string(id)
                     .map(|js| js.into_raw())
                     .unwrap_or(ptr::null_mut()),
                 Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
+                    throw_range_error(&mut env, &format!("Failed to get timezone id: {}", e));
                     ptr::null_mut()
                 }
             },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time '{}': {}", s_val, e));
+                throw_range_error(&mut env, &format!("Invalid timezone '{}': {}", s_val, e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeFromComponents()`
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetId()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeFromComponents(
-        mut env: JNIEnv,
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetId(
+        env: JNIEnv,
         _class: JClass,
-        year: jint,
-        month: jint,
-        day: jint,
-        hour: jint,
-        minute: jint,
-        second: jint,
-        millisecond: jint,
-        microsecond: jint,
-        nanosecond: jint,
-        calendar_id: JString,
+        s: JString,
     ) -> jstring {
-        let calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            Calendar::default()
-        };
-
-        match PlainDateTime::new(
-            year,
-            month as u8,
-            day as u8,
-            hour as u8,
-            minute as u8,
-            second as u8,
-            millisecond as u16,
-            microsecond as u16,
-            nanosecond as u16,
-            calendar
-        ) {
-            Ok(dt) => match dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time components: {}", e));
-                ptr::null_mut()
-            }
-        }
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetId");
+        Java_com_temporal_TemporalNative_timeZoneFromString(env, _class, s)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeGetAllComponents()`
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetOffsetNanosecondsFor()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeGetAllComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetOffsetNanosecondsFor(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jlongArray {
-        let s_str = parse_jstring(&mut env, &s, "plain date time string");
-        let s_val = match s_str {
+        tz_id: JString,
+        instant_str: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetOffsetNanosecondsFor");
+        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
+        let tz_val = match tz_s {
             Some(s) => s,
-            None => return ptr::null_mut(),
+            None => return 0,
         };
-        
-        let dt = match PlainDateTime::from_str(&s_val) {
-            Ok(d) => d,
+        let tz = match resolve_time_zone(&tz_val) {
+            Ok(t) => t,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
-                return ptr::null_mut();
+                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
+                return 0;
             }
         };
 
-        let components: [i64; 18] = [
-            dt.year() as i64,
-            dt.month() as i64,
-            dt.day() as i64,
-            dt.day_of_week() as i64,
-            dt.day_of_year() as i64,
-            dt.week_of_year().unwrap_or(0) as i64,
-            dt.year_of_week().unwrap_or(0) as i64,
-            dt.days_in_week() as i64,
-            dt.days_in_month() as i64,
-            dt.days_in_year() as i64,
-            dt.months_in_year() as i64,
-            if dt.in_leap_year() { 1 } else { 0 },
-            dt.hour() as i64,
-            dt.minute() as i64,
-            dt.second() as i64,
-            dt.millisecond() as i64,
-            dt.microsecond() as i64,
-            dt.nanosecond() as i64,
-        ];
-
-        match env.new_long_array(18) {
-            Ok(arr) => {
-                if env.set_long_array_region(&arr, 0, &components).is_err() {
-                    throw_range_error(&mut env, "Failed to set array elements");
-                    return ptr::null_mut();
-                }
-                arr.into_raw()
+        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
+        let inst_val = match inst_s {
+            Some(s) => s,
+            None => return 0,
+        };
+        let instant = match instant_from_str(&inst_val) {
+            Ok(i) => i,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
+                return 0;
             }
-            Err(_) => {
-                throw_range_error(&mut env, "Failed to create result array");
-                ptr::null_mut()
+        };
+
+        match time_zone_offset_nanoseconds(&tz, instant.epoch_nanoseconds().0) {
+            Ok(offset) => offset as jlong,
+            Err(e) => {
+                throw_ffi_error(&mut env, e.error_type, e.error_message);
+                0
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeGetMonthCode()`
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetOffsetStringFor()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeGetMonthCode(
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetOffsetStringFor(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
+        tz_id: JString,
+        instant_str: JString,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain date time string");
-        let s_val = match s_str {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetOffsetStringFor");
+        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
+        let tz_val = match tz_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        match PlainDateTime::from_str(&s_val) {
-            Ok(dt) => env.new_string(dt.month_code().as_str())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        let tz = match resolve_time_zone(&tz_val) {
+            Ok(t) => t,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
-                ptr::null_mut()
-            }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeGetCalendar()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeGetCalendar(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain date time string");
-        let s_val = match s_str {
+                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
+        let inst_val = match inst_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        match PlainDateTime::from_str(&s_val) {
-            Ok(dt) => env.new_string(dt.calendar().identifier())
+        let instant = match instant_from_str(&inst_val) {
+            Ok(i) => i,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
+                return ptr::null_mut();
+            }
+        };
+
+        match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, Calendar::default()) {
+            Ok(zdt) => env.new_string(zdt.offset().to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                throw_range_error(&mut env, &format!("Failed to get offset string: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeAdd()`
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetPlainDateTimeFor()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeAdd(
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetPlainDateTimeFor(
         mut env: JNIEnv,
         _class: JClass,
-        dt_str: JString,
-        duration_str: JString,
+        tz_id: JString,
+        instant_str: JString,
+        calendar_id: JString,
     ) -> jstring {
-        let dt_s = parse_jstring(&mut env, &dt_str, "plain date time");
-        let dt_val = match dt_s {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetPlainDateTimeFor");
+        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
+        let tz_val = match tz_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let dt = match PlainDateTime::from_str(&dt_val) {
-            Ok(d) => d,
+        let tz = match resolve_time_zone(&tz_val) {
+            Ok(t) => t,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
-        let dur_val = match dur_s {
+        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
+        let inst_val = match inst_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let duration = match Duration::from_str(&dur_val) {
-            Ok(d) => d,
+        let instant = match instant_from_str(&inst_val) {
+            Ok(i) => i,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
+                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        match dt.add(&duration, None) {
-            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
-                    ptr::null_mut()
+        let calendar = if !calendar_id.is_null() {
+            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
+            match id_str {
+                Some(s) => match Calendar::from_str(&s) {
+                    Ok(c) => c,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            Calendar::default()
+        };
+
+        match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, calendar) {
+            Ok(zdt) => {
+                let dt = zdt.to_plain_date_time();
+                match dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
+                    Ok(s) => env.new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
+                        ptr::null_mut()
+                    }
                 }
             },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
+                throw_range_error(&mut env, &format!("Failed to get plain date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeSubtract()`
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetInstantFor()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeSubtract(
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetInstantFor(
         mut env: JNIEnv,
         _class: JClass,
+        tz_id: JString,
         dt_str: JString,
-        duration_str: JString,
+        disambiguation: JString,
     ) -> jstring {
-        let dt_s = parse_jstring(&mut env, &dt_str, "plain date time");
-        let dt_val = match dt_s {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetInstantFor");
+        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
+        let tz_val = match tz_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let dt = match PlainDateTime::from_str(&dt_val) {
-            Ok(d) => d,
+        let tz = match resolve_time_zone(&tz_val) {
+            Ok(t) => t,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
+                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
-        let dur_val = match dur_s {
+        let dt_s = parse_jstring(&mut env, &dt_str, "plain date time");
+        let dt_val = match dt_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let duration = match Duration::from_str(&dur_val) {
+        let dt = match PlainDateTime::from_str(&dt_val) {
             Ok(d) => d,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
+                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        match dt.subtract(&duration, None) {
-            Ok(result) => match result.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
-                    ptr::null_mut()
+        // Disambiguation handling... assumes Compatible default or parse string
+        let disambig_enum = if !disambiguation.is_null() {
+            match parse_jstring(&mut env, &disambiguation, "disambiguation") {
+                Some(s) => match s.as_str() {
+                    "compatible" => Disambiguation::Compatible,
+                    "earlier" => Disambiguation::Earlier,
+                    "later" => Disambiguation::Later,
+                    "reject" => Disambiguation::Reject,
+                    _ => Disambiguation::Compatible,
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            Disambiguation::Compatible
+        };
+
+        match dt.to_zoned_date_time(tz, disambig_enum) {
+            Ok(zdt) => {
+                let instant = zdt.to_instant();
+                let provider = &*COMPILED_TZ_PROVIDER;
+                match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+                    Ok(s) => env.new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                        ptr::null_mut()
+                    }
                 }
             },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
+                throw_range_error(&mut env, &format!("Failed to get instant: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeCompare()`
+    /// Calls a transition query, mapping "no transition" to a null string.
+    fn transition_to_jstring(
+        env: &mut JNIEnv,
+        tz_id: &JString,
+        instant_str: &JString,
+        query: extern "C" fn(*const c_char, *const c_char) -> TemporalResult,
+    ) -> jstring {
+        let (Ok(tz), Ok(instant)) = (
+            optional_cstring(env, tz_id, "timezone"),
+            optional_cstring(env, instant_str, "instant"),
+        ) else {
+            return ptr::null_mut();
+        };
+        let mut result = query(cstring_ptr(&tz), cstring_ptr(&instant));
+        if result.error_type == TemporalErrorType::None as i32
+            && (result.value.is_null() || unsafe { *result.value } == 0)
+        {
+            unsafe { temporal_free_result(&mut result) };
+            return ptr::null_mut();
+        }
+        temporal_result_to_jstring(env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetNextTransition()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeCompare(
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetNextTransition(
         mut env: JNIEnv,
         _class: JClass,
-        a: JString,
-        b: JString,
-    ) -> jint {
-        let a_str = parse_jstring(&mut env, &a, "first plain date time");
-        let a_val = match a_str {
-            Some(s) => s,
-            None => return 0,
+        tz_id: JString,
+        instant_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetNextTransition");
+        transition_to_jstring(&mut env, &tz_id, &instant_str, temporal_time_zone_get_next_transition)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetPreviousTransition()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetPreviousTransition(
+        mut env: JNIEnv,
+        _class: JClass,
+        tz_id: JString,
+        instant_str: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetPreviousTransition");
+        transition_to_jstring(&mut env, &tz_id, &instant_str, temporal_time_zone_get_previous_transition)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetTransitions()`
+    ///
+    /// Returns flat (seconds, nanoseconds) pairs of at most `cap` transitions.
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetTransitions(
+        mut env: JNIEnv,
+        _class: JClass,
+        tz_id: JString,
+        start_seconds: jlong,
+        start_nanoseconds: jint,
+        end_seconds: jlong,
+        end_nanoseconds: jint,
+        cap: jint,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetTransitions");
+        let Ok(tz) = optional_cstring(&mut env, &tz_id, "timezone") else {
+            return ptr::null_mut();
         };
-        let dt_a = match PlainDateTime::from_str(&a_val) {
-            Ok(d) => d,
-            Err(_) => return 0,
+        let mut out = vec![TemporalEpochNanoseconds::default(); cap.clamp(0, MAX_TRANSITION_COUNT) as usize];
+        let result = temporal_time_zone_get_transitions(
+            cstring_ptr(&tz),
+            epoch_arg(start_seconds, start_nanoseconds),
+            epoch_arg(end_seconds, end_nanoseconds),
+            out.as_mut_ptr(),
+            cap,
+        );
+        let count = result.count as usize;
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
+        }
+        let flat: Vec<i64> = out[..count].iter().flat_map(|e| [e.seconds, e.nanoseconds as i64]).collect();
+        to_jlong_array(&mut env, &flat)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.setBatchThreads()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_setBatchThreads(
+        mut env: JNIEnv,
+        _class: JClass,
+        threads: jint,
+    ) {
+        stats_scope!("Java_com_temporal_TemporalNative_setBatchThreads");
+        let status = temporal_set_batch_threads(threads);
+        check_status(&mut env, status);
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.getBatchThreads()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_getBatchThreads(_env: JNIEnv, _class: JClass) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_getBatchThreads");
+        temporal_get_batch_threads()
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.timeZoneCacheStats()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneCacheStats(
+        mut env: JNIEnv,
+        _class: JClass,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneCacheStats");
+        let stats = temporal_time_zone_cache_stats();
+        to_jlong_array(&mut env, &[stats.hits as i64, stats.misses as i64, stats.size as i64])
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.timeZoneCacheClear()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneCacheClear(_env: JNIEnv, _class: JClass) {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneCacheClear");
+        temporal_time_zone_cache_clear();
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.validate()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_validate(
+        mut env: JNIEnv,
+        _class: JClass,
+        kind: jint,
+        s: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_validate");
+        if s.is_null() {
+            return temporal_validate(kind, ptr::null());
+        }
+        // Converted by hand rather than with parse_jstring, which throws
+        let value: String = match env.get_string(&s) {
+            Ok(js) => js.into(),
+            Err(_) => return TemporalErrorType::TypeError as jint,
         };
+        match CString::new(value) {
+            Ok(c) => temporal_validate(kind, c.as_ptr()),
+            // No Temporal string contains a NUL
+            Err(_) => TemporalErrorType::RangeError as jint,
+        }
+    }
 
-        let b_str = parse_jstring(&mut env, &b, "second plain date time");
-        let b_val = match b_str {
+    /// JNI function for `com.temporal.TemporalNative.lastErrorMessage()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_lastErrorMessage(
+        mut env: JNIEnv,
+        _class: JClass,
+    ) -> jstring {
+        let message = temporal_last_error_message();
+        if message.is_null() {
+            return ptr::null_mut();
+        }
+        let message = unsafe { CStr::from_ptr(message) }.to_string_lossy();
+        env.new_string(message).map(|js| js.into_raw()).unwrap_or(ptr::null_mut())
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.getStats()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_getStats(mut env: JNIEnv, _class: JClass) -> jstring {
+        temporal_result_to_jstring(&mut env, temporal_stats_to_json())
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.resetStats()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_resetStats(_env: JNIEnv, _class: JClass) {
+        temporal_stats_reset();
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeFromString");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
+        let s_val = match s_str {
             Some(s) => s,
-            None => return 0,
-        };
-        let dt_b = match PlainDateTime::from_str(&b_val) {
-            Ok(d) => d,
-            Err(_) => return 0,
+            None => return ptr::null_mut(),
         };
-
-        dt_a.compare_iso(&dt_b) as jint
+        
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(zdt) => match zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+                Ok(s) => env.new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid zoned date time '{}': {}", s_val, e));
+                ptr::null_mut()
+            }
+        }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeWith()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeFromComponents()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeWith(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeFromComponents(
         mut env: JNIEnv,
         _class: JClass,
-        dt_str: JString,
         year: jint,
         month: jint,
         day: jint,
@@ -5381,32 +12577,11 @@ mod android {
         microsecond: jint,
         nanosecond: jint,
         calendar_id: JString,
+        time_zone_id: JString,
+        offset_nanoseconds: jlong,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &dt_str, "plain date time");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let dt = match PlainDateTime::from_str(&s_val) {
-            Ok(d) => d,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
-                return ptr::null_mut();
-            }
-        };
-
-        let new_year = if year == i32::MIN { dt.year() } else { year };
-        let new_month = if month == i32::MIN { dt.month() } else { month as u8 };
-        let new_day = if day == i32::MIN { dt.day() } else { day as u8 };
-        
-        let new_hour = if hour == i32::MIN { dt.hour() } else { hour as u8 };
-        let new_minute = if minute == i32::MIN { dt.minute() } else { minute as u8 };
-        let new_second = if second == i32::MIN { dt.second() } else { second as u8 };
-        let new_millisecond = if millisecond == i32::MIN { dt.millisecond() } else { millisecond as u16 };
-        let new_microsecond = if microsecond == i32::MIN { dt.microsecond() } else { microsecond as u16 };
-        let new_nanosecond = if nanosecond == i32::MIN { dt.nanosecond() } else { nanosecond as u16 };
-
-        let new_calendar = if !calendar_id.is_null() {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeFromComponents");
+        let calendar = if !calendar_id.is_null() {
             let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
             match id_str {
                 Some(s) => match Calendar::from_str(&s) {
@@ -5419,282 +12594,262 @@ mod android {
                 None => return ptr::null_mut(),
             }
         } else {
-            dt.calendar().clone()
+            Calendar::default()
         };
 
-        match PlainDateTime::new(
-            new_year, new_month, new_day,
-            new_hour, new_minute, new_second,
-            new_millisecond, new_microsecond, new_nanosecond,
-            new_calendar
+        let pdt = match PlainDateTime::new(
+            year, month as u8, day as u8, 
+            hour as u8, minute as u8, second as u8, 
+            millisecond as u16, microsecond as u16, nanosecond as u16, 
+            calendar
         ) {
-             Ok(new_dt) => match new_dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-                 Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                 Err(e) => {
-                     throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
-                     ptr::null_mut()
-                 }
-             },
+            Ok(d) => d,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid date components: {}", e));
-                ptr::null_mut()
+                throw_range_error(&mut env, &format!("Invalid components: {}", e));
+                return ptr::null_mut();
             }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeUntil()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeUntil(
-        mut env: JNIEnv,
-        _class: JClass,
-        one: JString,
-        two: JString,
-    ) -> jstring {
-        let one_str = parse_jstring(&mut env, &one, "first plain date time");
-        let one_val = match one_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let dt1 = match PlainDateTime::from_str(&one_val) {
-            Ok(d) => d,
-            Err(_) => return ptr::null_mut(),
         };
 
-        let two_str = parse_jstring(&mut env, &two, "second plain date time");
-        let two_val = match two_str {
+        let tz_s = parse_jstring(&mut env, &time_zone_id, "timezone id");
+        let tz_val = match tz_s {
             Some(s) => s,
-            None => return ptr::null_mut(),
+            None => {
+                throw_type_error(&mut env, "Timezone ID is required");
+                return ptr::null_mut();
+            }
         };
-        let dt2 = match PlainDateTime::from_str(&two_val) {
-            Ok(d) => d,
-            Err(_) => return ptr::null_mut(),
+
+        let tz = match resolve_time_zone(&tz_val) {
+            Ok(t) => t,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
+                return ptr::null_mut();
+            }
         };
 
-        match dt1.until(&dt2, Default::default()) {
-            Ok(d) => env
-                .new_string(d.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        match pdt.to_zoned_date_time(tz, Disambiguation::Compatible) {
+            Ok(zdt) => match zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+                Ok(s) => env.new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
+                    ptr::null_mut()
+                }
+            },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute until: {}", e));
+                throw_range_error(&mut env, &format!("Failed to create zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainDateTimeSince()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetAllComponents()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeSince(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetAllComponents(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
-    ) -> jstring {
-        let one_str = parse_jstring(&mut env, &one, "first plain date time");
-        let one_val = match one_str {
+        s: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeGetAllComponents");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
+        let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let dt1 = match PlainDateTime::from_str(&one_val) {
-            Ok(d) => d,
-            Err(_) => return ptr::null_mut(),
+        
+        // Use default provider
+        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
+                return ptr::null_mut();
+            }
         };
 
-        let two_str = parse_jstring(&mut env, &two, "second plain date time");
-        let two_val = match two_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let dt2 = match PlainDateTime::from_str(&two_val) {
-            Ok(d) => d,
-            Err(_) => return ptr::null_mut(),
-        };
+        let components: [i64; 19] = [
+            zdt.year() as i64,
+            zdt.month() as i64,
+            zdt.day() as i64,
+            zdt.day_of_week() as i64,
+            zdt.day_of_year() as i64,
+            zdt.week_of_year().unwrap_or(0) as i64,
+            zdt.year_of_week().unwrap_or(0) as i64,
+            zdt.days_in_week() as i64,
+            zdt.days_in_month() as i64,
+            zdt.days_in_year() as i64,
+            zdt.months_in_year() as i64,
+            if zdt.in_leap_year() { 1 } else { 0 },
+            zdt.hour() as i64,
+            zdt.minute() as i64,
+            zdt.second() as i64,
+            zdt.millisecond() as i64,
+            zdt.microsecond() as i64,
+            zdt.nanosecond() as i64,
+            zdt.offset_nanoseconds() as i64,
+        ];
 
-        match dt1.since(&dt2, Default::default()) {
-            Ok(d) => env
-                .new_string(d.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute since: {}", e));
+        match env.new_long_array(19) {
+            Ok(arr) => {
+                if env.set_long_array_region(&arr, 0, &components).is_err() {
+                    throw_range_error(&mut env, "Failed to set array elements");
+                    return ptr::null_mut();
+                }
+                arr.into_raw()
+            }
+            Err(_) => {
+                throw_range_error(&mut env, "Failed to create result array");
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthFromString()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeEpochMilliseconds()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthFromString(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeEpochMilliseconds(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeEpochMilliseconds");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
         let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        match PlainYearMonth::from_str(&s_val) {
-            Ok(ym) => env.new_string(ym.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month '{}': {}", s_val, e));
-                ptr::null_mut()
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
+                return ptr::null_mut();
             }
-        }
+        };
+        env.new_string(zdt.epoch_milliseconds().to_string())
+            .map(|js| js.into_raw())
+            .unwrap_or(ptr::null_mut())
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthFromComponents()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeEpochNanoseconds()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthFromComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeEpochNanoseconds(
         mut env: JNIEnv,
         _class: JClass,
-        year: jint,
-        month: jint,
-        calendar_id: JString,
-        _reference_day: jint,
+        s: JString,
     ) -> jstring {
-        let calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            Calendar::default()
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeEpochNanoseconds");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
+        let s_val = match s_str {
+            Some(s) => s,
+            None => return ptr::null_mut(),
         };
-
-        match PlainYearMonth::new(year, month as u8, None, calendar) {
-            Ok(ym) => env.new_string(ym.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month components: {}", e));
-                ptr::null_mut()
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
+                return ptr::null_mut();
             }
-        }
+        };
+        env.new_string(zdt.epoch_nanoseconds().0.to_string())
+            .map(|js| js.into_raw())
+            .unwrap_or(ptr::null_mut())
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthGetAllComponents()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetCalendar()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthGetAllComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetCalendar(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
-    ) -> jlongArray {
-        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeGetCalendar");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
         let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        
-        let ym: PlainYearMonth = match PlainYearMonth::from_str(&s_val) {
-            Ok(y) => y,
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => env.new_string(z.calendar().identifier())
+                .map(|js| js.into_raw())
+                .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
-                return ptr::null_mut();
-            }
-        };
-
-        let components: [i64; 8] = [
-            ym.year() as i64,
-            ym.month() as i64,
-            0, // PlainYearMonth does not have a day
-            ym.days_in_month() as i64,
-            ym.days_in_year() as i64,
-            ym.months_in_year() as i64,
-            if ym.in_leap_year() { 1 } else { 0 },
-            ym.era_year().unwrap_or(0) as i64,
-        ];
-
-        match env.new_long_array(8) {
-            Ok(arr) => {
-                if env.set_long_array_region(&arr, 0, &components).is_err() {
-                    throw_range_error(&mut env, "Failed to set array elements");
-                    return ptr::null_mut();
-                }
-                arr.into_raw()
-            }
-            Err(_) => {
-                throw_range_error(&mut env, "Failed to create result array");
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthGetMonthCode()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetTimeZone()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthGetMonthCode(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetTimeZone(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeGetTimeZone");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
         let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        match PlainYearMonth::from_str(&s_val) {
-            Ok(ym) => env.new_string(ym.month_code().as_str())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => match z.time_zone().identifier() {
+                Ok(id) => env.new_string(id)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to get identifier: {}", e));
+                    ptr::null_mut()
+                }
+            },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthGetCalendar()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetOffset()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthGetCalendar(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetOffset(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain year month string");
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeGetOffset");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
         let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        match PlainYearMonth::from_str(&s_val) {
-            Ok(ym) => env.new_string(ym.calendar().identifier())
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => env.new_string(z.offset().to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthAdd()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeAdd()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthAdd(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeAdd(
         mut env: JNIEnv,
         _class: JClass,
-        ym_str: JString,
+        zdt_str: JString,
         duration_str: JString,
     ) -> jstring {
-        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
-        let ym_val = match ym_s {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeAdd");
+        let zdt_s = parse_jstring(&mut env, &zdt_str, "zoned date time");
+        let zdt_val = match zdt_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym = match PlainYearMonth::from_str(&ym_val) {
-            Ok(y) => y,
+        let zdt = match ZonedDateTime::from_utf8(zdt_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 return ptr::null_mut();
             }
         };
@@ -5712,10 +12867,16 @@ mod android {
             }
         };
 
-        match ym.add(&duration, Overflow::Reject) {
-            Ok(result) => env.new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        match zdt.add(&duration, Some(Overflow::Reject)) {
+            Ok(result) => match result.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+                Ok(s) => env.new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
+                    ptr::null_mut()
+                }
+            },
             Err(e) => {
                 throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
                 ptr::null_mut()
@@ -5723,23 +12884,24 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthSubtract()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeSubtract()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthSubtract(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeSubtract(
         mut env: JNIEnv,
         _class: JClass,
-        ym_str: JString,
+        zdt_str: JString,
         duration_str: JString,
     ) -> jstring {
-        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
-        let ym_val = match ym_s {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeSubtract");
+        let zdt_s = parse_jstring(&mut env, &zdt_str, "zoned date time");
+        let zdt_val = match zdt_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym = match PlainYearMonth::from_str(&ym_val) {
-            Ok(y) => y,
+        let zdt = match ZonedDateTime::from_utf8(zdt_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 return ptr::null_mut();
             }
         };
@@ -5757,10 +12919,16 @@ mod android {
             }
         };
 
-        match ym.subtract(&duration, Overflow::Reject) {
-            Ok(result) => env.new_string(result.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        match zdt.subtract(&duration, Some(Overflow::Reject)) {
+            Ok(result) => match result.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+                Ok(s) => env.new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
+                    ptr::null_mut()
+                }
+            },
             Err(e) => {
                 throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
                 ptr::null_mut()
@@ -5768,66 +12936,83 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthCompare()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeCompare()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthCompare(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeCompare(
         mut env: JNIEnv,
         _class: JClass,
         a: JString,
         b: JString,
     ) -> jint {
-        let a_str = parse_jstring(&mut env, &a, "first plain year month");
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeCompare");
+        let a_str = parse_jstring(&mut env, &a, "first zoned date time");
         let a_val = match a_str {
             Some(s) => s,
             None => return 0,
         };
-        let ym_a: PlainYearMonth = match PlainYearMonth::from_str(&a_val) {
-            Ok(y) => y,
+        let zdt_a = match ZonedDateTime::from_utf8(a_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(_) => return 0,
         };
 
-        let b_str = parse_jstring(&mut env, &b, "second plain year month");
+        let b_str = parse_jstring(&mut env, &b, "second zoned date time");
         let b_val = match b_str {
             Some(s) => s,
             None => return 0,
         };
-        let ym_b: PlainYearMonth = match PlainYearMonth::from_str(&b_val) {
-            Ok(y) => y,
+        let zdt_b = match ZonedDateTime::from_utf8(b_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(_) => return 0,
         };
 
-        // Fallback to string comparison for now
-        let s_a = ym_a.to_ixdtf_string(DisplayCalendar::Never);
-        let s_b = ym_b.to_ixdtf_string(DisplayCalendar::Never);
-
-        s_a.cmp(&s_b) as jint
+        zdt_a.epoch_nanoseconds().0.cmp(&zdt_b.epoch_nanoseconds().0) as jint
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthWith()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeWith()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthWith(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeWith(
         mut env: JNIEnv,
         _class: JClass,
-        ym_str: JString,
+        zdt_str: JString,
         year: jint,
         month: jint,
+        day: jint,
+        hour: jint,
+        minute: jint,
+        second: jint,
+        millisecond: jint,
+        microsecond: jint,
+        nanosecond: jint,
+        _offset_ns: jlong,
         calendar_id: JString,
+        time_zone_id: JString,
     ) -> jstring {
-        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
-        let ym_val = match ym_s {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeWith");
+        let zdt_s = parse_jstring(&mut env, &zdt_str, "zoned date time");
+        let zdt_val = match zdt_s {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym: PlainYearMonth = match PlainYearMonth::from_str(&ym_val) {
-            Ok(y) => y,
+        let zdt = match ZonedDateTime::from_utf8(zdt_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 return ptr::null_mut();
             }
         };
-
-        let new_year = if year == i32::MIN { ym.year() } else { year };
-        let new_month = if month == i32::MIN { ym.month() } else { month as u8 };
+        
+        let current_pdt = zdt.to_plain_date_time();
+    
+        let new_year = if year == i32::MIN { current_pdt.year() } else { year };
+        let new_month = if month == i32::MIN { current_pdt.month() } else { month as u8 };
+        let new_day = if day == i32::MIN { current_pdt.day() } else { day as u8 };
+        
+        let new_hour = if hour == i32::MIN { current_pdt.hour() } else { hour as u8 };
+        let new_minute = if minute == i32::MIN { current_pdt.minute() } else { minute as u8 };
+        let new_second = if second == i32::MIN { current_pdt.second() } else { second as u8 };
+        let new_millisecond = if millisecond == i32::MIN { current_pdt.millisecond() } else { millisecond as u16 };
+        let new_microsecond = if microsecond == i32::MIN { current_pdt.microsecond() } else { microsecond as u16 };
+        let new_nanosecond = if nanosecond == i32::MIN { current_pdt.nanosecond() } else { nanosecond as u16 };
 
         let new_calendar = if !calendar_id.is_null() {
             let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
@@ -5842,49 +13027,85 @@ mod android {
                 None => return ptr::null_mut(),
             }
         } else {
-            ym.calendar().clone()
+            zdt.calendar().clone()
+        };
+        
+        let new_timezone = if !time_zone_id.is_null() {
+            let id_str = parse_jstring(&mut env, &time_zone_id, "timezone id");
+            match id_str {
+                Some(s) => match resolve_time_zone(&s) {
+                    Ok(t) => t,
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
+                        return ptr::null_mut();
+                    }
+                },
+                None => return ptr::null_mut(),
+            }
+        } else {
+            zdt.time_zone().clone()
         };
 
-        match PlainYearMonth::new(new_year, new_month, None, new_calendar) {
-            Ok(new_ym) => env.new_string(new_ym.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        let pdt = match PlainDateTime::new(
+            new_year, new_month, new_day, 
+            new_hour, new_minute, new_second, 
+            new_millisecond, new_microsecond, new_nanosecond, 
+            new_calendar
+        ) {
+            Ok(d) => d,
             Err(e) => {
                 throw_range_error(&mut env, &format!("Invalid components: {}", e));
+                return ptr::null_mut();
+            }
+        };
+        
+        match pdt.to_zoned_date_time(new_timezone, Disambiguation::Compatible) {
+            Ok(new_zdt) => match new_zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+                Ok(s) => env.new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format: {}", e));
+                    ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Failed to create zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthUntil()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeUntil()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthUntil(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeUntil(
         mut env: JNIEnv,
         _class: JClass,
         one: JString,
         two: JString,
     ) -> jstring {
-        let one_str = parse_jstring(&mut env, &one, "first plain year month");
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeUntil");
+        let one_str = parse_jstring(&mut env, &one, "first zoned date time");
         let one_val = match one_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym1: PlainYearMonth = match PlainYearMonth::from_str(&one_val) {
-            Ok(y) => y,
+        let zdt1 = match ZonedDateTime::from_utf8(one_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(_) => return ptr::null_mut(),
         };
 
-        let two_str = parse_jstring(&mut env, &two, "second plain year month");
+        let two_str = parse_jstring(&mut env, &two, "second zoned date time");
         let two_val = match two_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym2: PlainYearMonth = match PlainYearMonth::from_str(&two_val) {
-            Ok(y) => y,
+        let zdt2 = match ZonedDateTime::from_utf8(two_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(_) => return ptr::null_mut(),
         };
 
-        match ym1.until(&ym2, Default::default()) {
+        match zdt1.until(&zdt2, Default::default()) {
             Ok(d) => env.new_string(d.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
@@ -5895,35 +13116,36 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthSince()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeSince()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthSince(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeSince(
         mut env: JNIEnv,
         _class: JClass,
         one: JString,
         two: JString,
     ) -> jstring {
-        let one_str = parse_jstring(&mut env, &one, "first plain year month");
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeSince");
+        let one_str = parse_jstring(&mut env, &one, "first zoned date time");
         let one_val = match one_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym1: PlainYearMonth = match PlainYearMonth::from_str(&one_val) {
-            Ok(y) => y,
+        let zdt1 = match ZonedDateTime::from_utf8(one_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(_) => return ptr::null_mut(),
         };
 
-        let two_str = parse_jstring(&mut env, &two, "second plain year month");
+        let two_str = parse_jstring(&mut env, &two, "second zoned date time");
         let two_val = match two_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym2: PlainYearMonth = match PlainYearMonth::from_str(&two_val) {
-            Ok(y) => y,
+        let zdt2 = match ZonedDateTime::from_utf8(two_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
             Err(_) => return ptr::null_mut(),
         };
 
-        match ym1.since(&ym2, Default::default()) {
+        match zdt1.since(&zdt2, Default::default()) {
             Ok(d) => env.new_string(d.to_string())
                 .map(|js| js.into_raw())
                 .unwrap_or(ptr::null_mut()),
@@ -5934,1831 +13156,2070 @@ mod android {
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.plainYearMonthToPlainDate()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeRound()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainYearMonthToPlainDate(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeRound(
         mut env: JNIEnv,
         _class: JClass,
-        ym_str: JString,
-        day: jint,
+        zdt_str: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
     ) -> jstring {
-        let ym_s = parse_jstring(&mut env, &ym_str, "plain year month");
-        let ym_val = match ym_s {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeRound");
+        let s_str = parse_jstring(&mut env, &zdt_str, "zoned date time");
+        let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        let ym: PlainYearMonth = match PlainYearMonth::from_str(&ym_val) {
-            Ok(y) => y,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain year month: {}", e));
-                return ptr::null_mut();
-            }
+        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(z) => z,
+            Err(_) => return ptr::null_mut(),
         };
 
-        match PlainDate::new(ym.year(), ym.month(), day as u8, ym.calendar().clone()) {
-            Ok(d) => env.new_string(d.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to convert to plain date: {}", e));
-                ptr::null_mut()
+        let unit = if !smallest_unit.is_null() {
+            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
+            match s {
+                Some(s) => match Unit::from_str(&s) {
+                    Ok(u) => u,
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
+                        return ptr::null_mut();
+                    }
+                },
+                None => {
+                    throw_type_error(&mut env, "smallestUnit is required");
+                    return ptr::null_mut();
+                }
             }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainMonthDayFromString()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayFromString(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain month day string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        } else {
+            throw_type_error(&mut env, "smallestUnit is required");
+            return ptr::null_mut();
         };
-        match PlainMonthDay::from_str(&s_val) {
-            Ok(md) => env.new_string(md.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain month day '{}': {}", s_val, e));
-                ptr::null_mut()
-            }
-        }
-    }
 
-    /// JNI function for `com.temporal.TemporalNative.plainMonthDayFromComponents()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayFromComponents(
-        mut env: JNIEnv,
-        _class: JClass,
-        month: jint,
-        day: jint,
-        calendar_id: JString,
-        _reference_year: jint,
-    ) -> jstring {
-        let calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
+        let mode = if !rounding_mode.is_null() {
+            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
+            match s {
+                Some(s) => match RoundingMode::from_str(&s) {
+                    Ok(m) => m,
+                    Err(_) => {
+                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
                         return ptr::null_mut();
                     }
                 },
-                None => return ptr::null_mut(),
+                None => RoundingMode::HalfExpand,
             }
         } else {
-            Calendar::default()
+            RoundingMode::HalfExpand
         };
 
-        match PlainMonthDay::new_with_overflow(month as u8, day as u8, calendar, Overflow::Reject, None) {
-            Ok(md) => env.new_string(md.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain month day components: {}", e));
-                ptr::null_mut()
-            }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainMonthDayGetAllComponents()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayGetAllComponents(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jlongArray {
-        let s_str = parse_jstring(&mut env, &s, "plain month day string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        let increment = if rounding_increment > 0 {
+            rounding_increment as u32
+        } else {
+            1
         };
         
-        let md = match PlainMonthDay::from_str(&s_val) {
-            Ok(m) => m,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
-                return ptr::null_mut();
-            }
-        };
-
-        let components: [i64; 2] = [
-            md.calendar().month(&md.iso) as i64,
-            md.day() as i64,
-        ];
-
-        match env.new_long_array(2) {
-            Ok(arr) => {
-                if env.set_long_array_region(&arr, 0, &components).is_err() {
-                    throw_range_error(&mut env, "Failed to set array elements");
-                    return ptr::null_mut();
-                }
-                arr.into_raw()
-            }
-            Err(_) => {
-                throw_range_error(&mut env, "Failed to create result array");
-                ptr::null_mut()
-            }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainMonthDayGetMonthCode()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayGetMonthCode(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain month day string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        match PlainMonthDay::from_str(&s_val) {
-            Ok(md) => env.new_string(md.month_code().as_str())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
-                ptr::null_mut()
-            }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainMonthDayGetCalendar()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayGetCalendar(
-        mut env: JNIEnv,
-        _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "plain month day string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        match PlainMonthDay::from_str(&s_val) {
-            Ok(md) => env.new_string(md.calendar().identifier())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
-                ptr::null_mut()
-            }
-        }
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.plainMonthDayToPlainDate()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_plainMonthDayToPlainDate(
-        mut env: JNIEnv,
-        _class: JClass,
-        md_str: JString,
-        year: jint,
-    ) -> jstring {
-        let md_s = parse_jstring(&mut env, &md_str, "plain month day");
-        let md_val = match md_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let md = match PlainMonthDay::from_str(&md_val) {
-            Ok(m) => m,
+        let increment_opt = match RoundingIncrement::try_new(increment) {
+            Ok(i) => i,
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain month day: {}", e));
+                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
                 return ptr::null_mut();
             }
         };
 
-        match PlainDate::new(year, md.calendar().month(&md.iso), md.day(), md.calendar().clone()) {
-            Ok(d) => env.new_string(d.to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        let mut options = RoundingOptions::default();
+        options.smallest_unit = Some(unit);
+        options.rounding_mode = Some(mode);
+        options.increment = Some(increment_opt);
+
+        match zdt.round(options) {
+            Ok(result) => match result.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
+                Ok(s) => env
+                    .new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
+                    ptr::null_mut()
+                }
+            },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to convert to plain date: {}", e));
+                throw_range_error(&mut env, &format!("Failed to round: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.calendarFrom()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToInstant()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_calendarFrom(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToInstant(
         mut env: JNIEnv,
         _class: JClass,
-        id: JString,
+        s: JString,
     ) -> jstring {
-        let id_str = parse_jstring(&mut env, &id, "calendar identifier");
-        let id_val = match id_str {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeToInstant");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
+        let s_val = match s_str {
             Some(s) => s,
             None => return ptr::null_mut(),
         };
-        
-        match Calendar::from_str(&id_val) {
-            Ok(calendar) => env
-                .new_string(calendar.identifier().to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(zdt) => {
+                let provider = &*COMPILED_TZ_PROVIDER;
+                match zdt.to_instant().to_ixdtf_string_with_provider(None, Default::default(), &provider) {
+                    Ok(s) => env.new_string(s)
+                        .map(|js| js.into_raw())
+                        .unwrap_or(ptr::null_mut()),
+                    Err(e) => {
+                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
+                        ptr::null_mut()
+                    }
+                }
+            },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid calendar identifier '{}': {}", id_val, e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.calendarId()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_calendarId(
-        env: JNIEnv,
-        _class: JClass,
-        id: JString,
-    ) -> jstring {
-        // Just reusing calendarFrom logic since ID access is basically normalization
-        Java_com_temporal_TemporalNative_calendarFrom(env, _class, id)
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.durationFromString()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToPlainDate()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationFromString(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToPlainDate(
         mut env: JNIEnv,
         _class: JClass,
-        input: JString,
+        s: JString,
     ) -> jstring {
-        let duration = match parse_duration(&mut env, &input, "duration string") {
-            Some(d) => d,
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeToPlainDate");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        env.new_string(duration.to_string())
-            .map(|js| js.into_raw())
-            .unwrap_or_else(|_| {
-                throw_range_error(&mut env, "Failed to create result string");
-                ptr::null_mut()
-            })
-    }
-
-    /// JNI function for `com.temporal.TemporalNative.durationFromComponents()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationFromComponents(
-        mut env: JNIEnv,
-        _class: JClass,
-        years: jlong,
-        months: jlong,
-        weeks: jlong,
-        days: jlong,
-        hours: jlong,
-        minutes: jlong,
-        seconds: jlong,
-        milliseconds: jlong,
-        microseconds: jlong,
-        nanoseconds: jlong,
-    ) -> jstring {
-        // Check for mixed signs
-        let values = [years, months, weeks, days, hours, minutes, seconds, milliseconds, microseconds, nanoseconds];
-        let non_zero: Vec<i64> = values.iter().copied().filter(|&v| v != 0).collect();
-
-        if !non_zero.is_empty() {
-            let first_sign = non_zero[0].signum();
-            if !non_zero.iter().all(|&v| v.signum() == first_sign) {
-                throw_range_error(&mut env, "All non-zero duration values must have the same sign");
-                return ptr::null_mut();
-            }
-        }
-
-        match Duration::new(
-            years,
-            months,
-            weeks,
-            days,
-            hours,
-            minutes,
-            seconds,
-            milliseconds,
-            microseconds as i128,
-            nanoseconds as i128,
-        ) {
-            Ok(duration) => env
-                .new_string(duration.to_string())
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(zdt) => env.new_string(zdt.to_plain_date().to_ixdtf_string(DisplayCalendar::Auto))
                 .map(|js| js.into_raw())
-                .unwrap_or_else(|_| {
-                    throw_range_error(&mut env, "Failed to create result string");
-                    ptr::null_mut()
-                }),
+                .unwrap_or(ptr::null_mut()),
             Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid duration components: {}", e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.durationGetAllComponents()`
-    /// Returns a long array: [years, months, weeks, days, hours, minutes, seconds, milliseconds, microseconds, nanoseconds, sign, blank]
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToPlainTime()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationGetAllComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToPlainTime(
         mut env: JNIEnv,
         _class: JClass,
-        duration_str: JString,
-    ) -> jlongArray {
-        let duration = match parse_duration(&mut env, &duration_str, "duration string") {
-            Some(d) => d,
+        s: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeToPlainTime");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        let components: [i64; 12] = [
-            duration.years(),
-            duration.months(),
-            duration.weeks(),
-            duration.days(),
-            duration.hours(),
-            duration.minutes(),
-            duration.seconds(),
-            duration.milliseconds(),
-            duration.microseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64,
-            duration.nanoseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64,
-            duration.sign() as i64,
-            if duration.is_zero() { 1 } else { 0 },
-        ];
-
-        match env.new_long_array(12) {
-            Ok(arr) => {
-                if env.set_long_array_region(&arr, 0, &components).is_err() {
-                    throw_range_error(&mut env, "Failed to set array elements");
-                    return ptr::null_mut();
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(zdt) => match zdt.to_plain_time().to_ixdtf_string(ToStringRoundingOptions::default()) {
+                Ok(s) => env.new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
+                    ptr::null_mut()
                 }
-                arr.into_raw()
-            }
-            Err(_) => {
-                throw_range_error(&mut env, "Failed to create result array");
+            },
+            Err(e) => {
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.durationAdd()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToPlainDateTime()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationAdd(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToPlainDateTime(
         mut env: JNIEnv,
         _class: JClass,
-        a: JString,
-        b: JString,
+        s: JString,
     ) -> jstring {
-        let duration_a = match parse_duration(&mut env, &a, "first duration") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
-        };
-        let duration_b = match parse_duration(&mut env, &b, "second duration") {
-            Some(d) => d,
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeToPlainDateTime");
+        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
+        let s_val = match s_str {
+            Some(s) => s,
             None => return ptr::null_mut(),
         };
-
-        match duration_a.add(&duration_b) {
-            Ok(result) => env
-                .new_string(result.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or_else(|_| {
-                    throw_range_error(&mut env, "Failed to create result string");
+        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
+            Ok(zdt) => match zdt.to_plain_date_time().to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
+                Ok(s) => env.new_string(s)
+                    .map(|js| js.into_raw())
+                    .unwrap_or(ptr::null_mut()),
+                Err(e) => {
+                    throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
                     ptr::null_mut()
-                }),
+                }
+            },
             Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to add durations: {}", e));
+                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.durationSubtract()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationSubtract(
-        mut env: JNIEnv,
-        _class: JClass,
-        a: JString,
-        b: JString,
-    ) -> jstring {
-        let duration_a = match parse_duration(&mut env, &a, "first duration") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
+    // ========================================================================
+    // Handle API
+    // ========================================================================
+
+    /// Throws the error carried by an FFI result and frees its message
+    fn throw_ffi_error(env: &mut JNIEnv, error_type: i32, error_message: *mut c_char) {
+        let message = if error_message.is_null() {
+            "Unknown error".to_string()
+        } else {
+            unsafe { CString::from_raw(error_message) }.to_string_lossy().into_owned()
         };
-        let duration_b = match parse_duration(&mut env, &b, "second duration") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
+        if error_type == TemporalErrorType::TypeError as i32 {
+            throw_type_error(env, &message);
+        } else {
+            throw_range_error(env, &message);
+        }
+    }
+
+    /// Converts a HandleResult into a jlong handle, throwing on error
+    fn handle_result_to_jlong(env: &mut JNIEnv, result: HandleResult) -> jlong {
+        if result.error_type != TemporalErrorType::None as i32 {
+            throw_ffi_error(env, result.error_type, result.error_message);
+            return 0;
+        }
+        result.handle as jlong
+    }
+
+    /// Converts a TemporalResult into a Java string, throwing on error
+    fn temporal_result_to_jstring(env: &mut JNIEnv, mut result: TemporalResult) -> jstring {
+        if result.error_type != TemporalErrorType::None as i32 {
+            throw_ffi_error(env, result.error_type, result.error_message);
+            result.error_message = ptr::null_mut();
+            unsafe { temporal_free_result(&mut result) };
+            return ptr::null_mut();
+        }
+        let value = if result.value.is_null() {
+            String::new()
+        } else {
+            unsafe { CStr::from_ptr(result.value) }.to_string_lossy().into_owned()
         };
+        unsafe { temporal_free_result(&mut result) };
+        env.new_string(value)
+            .map(|js| js.into_raw())
+            .unwrap_or(ptr::null_mut())
+    }
+
+    /// Converts a nullable Java string into an owned C string; Ok(None) for null
+    fn optional_cstring(env: &mut JNIEnv, s: &JString, name: &str) -> Result<Option<CString>, ()> {
+        if s.is_null() {
+            return Ok(None);
+        }
+        let value = parse_jstring(env, s, name).ok_or(())?;
+        match CString::new(value) {
+            Ok(c) => Ok(Some(c)),
+            Err(_) => {
+                throw_type_error(env, &format!("Invalid {}", name));
+                Err(())
+            }
+        }
+    }
 
-        match duration_a.subtract(&duration_b) {
-            Ok(result) => env
-                .new_string(result.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or_else(|_| {
-                    throw_range_error(&mut env, "Failed to create result string");
-                    ptr::null_mut()
-                }),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to subtract durations: {}", e));
+    fn cstring_ptr(s: &Option<CString>) -> *const c_char {
+        s.as_ref().map(|c| c.as_ptr()).unwrap_or(ptr::null())
+    }
+
+    /// Creates a Java long array, throwing on failure
+    fn to_jlong_array(env: &mut JNIEnv, values: &[i64]) -> jlongArray {
+        match env.new_long_array(values.len() as i32) {
+            Ok(arr) => {
+                if env.set_long_array_region(&arr, 0, values).is_err() {
+                    throw_range_error(env, "Failed to set array elements");
+                    return ptr::null_mut();
+                }
+                arr.into_raw()
+            }
+            Err(_) => {
+                throw_range_error(env, "Failed to create result array");
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.durationNegated()`
+    /// JNI function for `com.temporal.TemporalNative.handleRelease()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationNegated(
+    pub extern "system" fn Java_com_temporal_TemporalNative_handleRelease(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let duration = match parse_duration(&mut env, &s, "duration") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
-        };
-
-        env.new_string(duration.negated().to_string())
-            .map(|js| js.into_raw())
-            .unwrap_or_else(|_| {
-                throw_range_error(&mut env, "Failed to create result string");
-                ptr::null_mut()
-            })
+        handle: jlong,
+    ) {
+        stats_scope!("Java_com_temporal_TemporalNative_handleRelease");
+        check_status(&mut env, unsafe { temporal_handle_release(handle as *mut TemporalHandle) });
     }
 
-    /// JNI function for `com.temporal.TemporalNative.durationAbs()`
+    /// JNI function for `com.temporal.TemporalNative.handleToString()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationAbs(
+    pub extern "system" fn Java_com_temporal_TemporalNative_handleToString(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
+        handle: jlong,
     ) -> jstring {
-        let duration = match parse_duration(&mut env, &s, "duration") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
-        };
-
-        env.new_string(duration.abs().to_string())
-            .map(|js| js.into_raw())
-            .unwrap_or_else(|_| {
-                throw_range_error(&mut env, "Failed to create result string");
-                ptr::null_mut()
-            })
+        stats_scope!("Java_com_temporal_TemporalNative_handleToString");
+        let result = temporal_handle_to_string(handle as *const TemporalHandle);
+        temporal_result_to_jstring(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.durationCompare()`
+    /// JNI function for `com.temporal.TemporalNative.handleCompare()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationCompare(
+    pub extern "system" fn Java_com_temporal_TemporalNative_handleCompare(
         mut env: JNIEnv,
         _class: JClass,
-        a: JString,
-        b: JString,
+        a: jlong,
+        b: jlong,
     ) -> jint {
-        let duration_a = match parse_duration(&mut env, &a, "first duration") {
-            Some(d) => d,
-            None => return 0,
-        };
-        let duration_b = match parse_duration(&mut env, &b, "second duration") {
-            Some(d) => d,
-            None => return 0,
-        };
-
-        // Check if durations have calendar units
-        let has_calendar_a = duration_a.years() != 0 || duration_a.months() != 0 || duration_a.weeks() != 0;
-        let has_calendar_b = duration_b.years() != 0 || duration_b.months() != 0 || duration_b.weeks() != 0;
-
-        if has_calendar_a || has_calendar_b {
-            throw_range_error(&mut env, "Comparing durations with years, months, or weeks requires a relativeTo option (not yet supported)");
+        stats_scope!("Java_com_temporal_TemporalNative_handleCompare");
+        let result = temporal_handle_compare(a as *const TemporalHandle, b as *const TemporalHandle);
+        if result.error_type != TemporalErrorType::None as i32 {
+            throw_ffi_error(&mut env, result.error_type, result.error_message);
             return 0;
         }
+        result.value
+    }
 
-        // For time-only durations, compare by total nanoseconds
-        let total_a = duration_a.days() as i128 * 86_400_000_000_000
-            + duration_a.hours() as i128 * 3_600_000_000_000
-            + duration_a.minutes() as i128 * 60_000_000_000
-            + duration_a.seconds() as i128 * 1_000_000_000
-            + duration_a.milliseconds() as i128 * 1_000_000
-            + duration_a.microseconds() * 1_000
-            + duration_a.nanoseconds();
+    /// Shared body of the `*HandleFromString` JNI functions
+    fn handle_from_jstring(
+        env: &mut JNIEnv,
+        s: &JString,
+        name: &str,
+        parse: extern "C" fn(*const c_char) -> HandleResult,
+    ) -> jlong {
+        let value = match optional_cstring(env, s, name) {
+            Ok(Some(c)) => c,
+            Ok(None) => {
+                throw_type_error(env, &format!("{} cannot be null", name));
+                return 0;
+            }
+            Err(()) => return 0,
+        };
+        let result = parse(value.as_ptr());
+        handle_result_to_jlong(env, result)
+    }
 
-        let total_b = duration_b.days() as i128 * 86_400_000_000_000
-            + duration_b.hours() as i128 * 3_600_000_000_000
-            + duration_b.minutes() as i128 * 60_000_000_000
-            + duration_b.seconds() as i128 * 1_000_000_000
-            + duration_b.milliseconds() as i128 * 1_000_000
-            + duration_b.microseconds() * 1_000
-            + duration_b.nanoseconds();
+    /// JNI function for `com.temporal.TemporalNative.instantHandleFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantHandleFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_instantHandleFromString");
+        handle_from_jstring(&mut env, &s, "instant string", temporal_instant_handle_from_string)
+    }
 
-        total_a.cmp(&total_b) as jint
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeHandleFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeHandleFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeHandleFromString");
+        handle_from_jstring(&mut env, &s, "plain date time string", temporal_plain_date_time_handle_from_string)
     }
 
-    /// Sentinel value for "unchanged" component in durationWith.
-    /// Matches JavaScript's Number.MIN_SAFE_INTEGER (-(2^53 - 1)).
-    const UNCHANGED_SENTINEL: i64 = -9007199254740991;
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeHandleFromString()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeHandleFromString(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeHandleFromString");
+        handle_from_jstring(&mut env, &s, "zoned date time string", temporal_zoned_date_time_handle_from_string)
+    }
 
-    /// JNI function for `com.temporal.TemporalNative.durationWith()`
+    /// JNI function for `com.temporal.TemporalNative.durationHandleFromString()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_durationWith(
+    pub extern "system" fn Java_com_temporal_TemporalNative_durationHandleFromString(
         mut env: JNIEnv,
         _class: JClass,
-        original: JString,
-        years: jlong,
-        months: jlong,
-        weeks: jlong,
-        days: jlong,
-        hours: jlong,
-        minutes: jlong,
-        seconds: jlong,
-        milliseconds: jlong,
-        microseconds: jlong,
-        nanoseconds: jlong,
-    ) -> jstring {
-        let duration = match parse_duration(&mut env, &original, "duration") {
-            Some(d) => d,
-            None => return ptr::null_mut(),
-        };
+        s: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_durationHandleFromString");
+        handle_from_jstring(&mut env, &s, "duration string", temporal_duration_handle_from_string)
+    }
 
-        // Use original values for any component set to UNCHANGED_SENTINEL (sentinel)
-        let new_years = if years == UNCHANGED_SENTINEL { duration.years() } else { years };
-        let new_months = if months == UNCHANGED_SENTINEL { duration.months() } else { months };
-        let new_weeks = if weeks == UNCHANGED_SENTINEL { duration.weeks() } else { weeks };
-        let new_days = if days == UNCHANGED_SENTINEL { duration.days() } else { days };
-        let new_hours = if hours == UNCHANGED_SENTINEL { duration.hours() } else { hours };
-        let new_minutes = if minutes == UNCHANGED_SENTINEL { duration.minutes() } else { minutes };
-        let new_seconds = if seconds == UNCHANGED_SENTINEL { duration.seconds() } else { seconds };
-        let new_milliseconds = if milliseconds == UNCHANGED_SENTINEL { duration.milliseconds() } else { milliseconds };
-        let new_microseconds = if microseconds == UNCHANGED_SENTINEL {
-            duration.microseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64
-        } else {
-            microseconds
-        };
-        let new_nanoseconds = if nanoseconds == UNCHANGED_SENTINEL {
-            duration.nanoseconds().clamp(i64::MIN as i128, i64::MAX as i128) as i64
-        } else {
-            nanoseconds
-        };
+    /// JNI function for `com.temporal.TemporalNative.instantHandleAdd()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantHandleAdd(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+        duration: jlong,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_instantHandleAdd");
+        let result = temporal_instant_handle_add(handle as *const TemporalHandle, duration as *const TemporalHandle);
+        handle_result_to_jlong(&mut env, result)
+    }
 
-        // Check for mixed signs
-        let values = [new_years, new_months, new_weeks, new_days, new_hours, new_minutes,
-                      new_seconds, new_milliseconds, new_microseconds, new_nanoseconds];
-        let non_zero: Vec<i64> = values.iter().copied().filter(|&v| v != 0).collect();
+    /// JNI function for `com.temporal.TemporalNative.instantHandleSubtract()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantHandleSubtract(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+        duration: jlong,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_instantHandleSubtract");
+        let result = temporal_instant_handle_subtract(handle as *const TemporalHandle, duration as *const TemporalHandle);
+        handle_result_to_jlong(&mut env, result)
+    }
 
-        if !non_zero.is_empty() {
-            let first_sign = non_zero[0].signum();
-            if !non_zero.iter().all(|&v| v.signum() == first_sign) {
-                throw_range_error(&mut env, "All non-zero duration values must have the same sign");
-                return ptr::null_mut();
-            }
-        }
+    /// JNI function for `com.temporal.TemporalNative.instantHandleRound()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantHandleRound(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_instantHandleRound");
+        let unit = match optional_cstring(&mut env, &smallest_unit, "smallest unit") {
+            Ok(u) => u,
+            Err(()) => return 0,
+        };
+        let mode = match optional_cstring(&mut env, &rounding_mode, "rounding mode") {
+            Ok(m) => m,
+            Err(()) => return 0,
+        };
+        let result = temporal_instant_handle_round(
+            handle as *const TemporalHandle,
+            cstring_ptr(&unit),
+            rounding_increment,
+            cstring_ptr(&mode),
+        );
+        handle_result_to_jlong(&mut env, result)
+    }
 
-        match Duration::new(
-            new_years,
-            new_months,
-            new_weeks,
-            new_days,
-            new_hours,
-            new_minutes,
-            new_seconds,
-            new_milliseconds,
-            new_microseconds as i128,
-            new_nanoseconds as i128,
-        ) {
-            Ok(result) => env
-                .new_string(result.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or_else(|_| {
-                    throw_range_error(&mut env, "Failed to create result string");
-                    ptr::null_mut()
-                }),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
-                ptr::null_mut()
-            }
-        }
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeHandleAdd()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeHandleAdd(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+        duration: jlong,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeHandleAdd");
+        let result = temporal_plain_date_time_handle_add(handle as *const TemporalHandle, duration as *const TemporalHandle);
+        handle_result_to_jlong(&mut env, result)
+    }
 
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeHandleSubtract()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeHandleSubtract(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+        duration: jlong,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeHandleSubtract");
+        let result = temporal_plain_date_time_handle_subtract(handle as *const TemporalHandle, duration as *const TemporalHandle);
+        handle_result_to_jlong(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneFromString()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeHandleWith()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneFromString(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeHandleWith(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "timezone string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        match TimeZone::try_from_str(&s_val) {
-            Ok(tz) => match tz.identifier() {
-                Ok(id) => env.new_string(id)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to get timezone id: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone '{}': {}", s_val, e));
-                ptr::null_mut()
-            }
+        handle: jlong,
+        year: jint,
+        month: jint,
+        day: jint,
+        hour: jint,
+        minute: jint,
+        second: jint,
+        millisecond: jint,
+        microsecond: jint,
+        nanosecond: jint,
+        calendar_id: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeHandleWith");
+        let calendar = match optional_cstring(&mut env, &calendar_id, "calendar id") {
+            Ok(c) => c,
+            Err(()) => return 0,
+        };
+        let result = temporal_plain_date_time_handle_with(
+            handle as *const TemporalHandle,
+            year, month, day,
+            hour, minute, second,
+            millisecond, microsecond, nanosecond,
+            cstring_ptr(&calendar),
+        );
+        handle_result_to_jlong(&mut env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeHandleGetAllComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeHandleGetAllComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeHandleGetAllComponents");
+        let mut c = PlainDateTimeComponents::default();
+        temporal_plain_date_time_handle_get_components(handle as *const TemporalHandle, &mut c);
+        if c.is_valid == 0 {
+            throw_type_error(&mut env, "Handle is not a PlainDateTime");
+            return ptr::null_mut();
         }
+        let components: [i64; 18] = [
+            c.year as i64,
+            c.month as i64,
+            c.day as i64,
+            c.day_of_week as i64,
+            c.day_of_year as i64,
+            c.week_of_year as i64,
+            c.year_of_week as i64,
+            c.days_in_week as i64,
+            c.days_in_month as i64,
+            c.days_in_year as i64,
+            c.months_in_year as i64,
+            c.in_leap_year as i64,
+            c.hour as i64,
+            c.minute as i64,
+            c.second as i64,
+            c.millisecond as i64,
+            c.microsecond as i64,
+            c.nanosecond as i64,
+        ];
+        to_jlong_array(&mut env, &components)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneGetId()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeHandleAdd()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetId(
-        env: JNIEnv,
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeHandleAdd(
+        mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        Java_com_temporal_TemporalNative_timeZoneFromString(env, _class, s)
+        handle: jlong,
+        duration: jlong,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeHandleAdd");
+        let result = temporal_zoned_date_time_handle_add(handle as *const TemporalHandle, duration as *const TemporalHandle);
+        handle_result_to_jlong(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneGetOffsetNanosecondsFor()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeHandleSubtract()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetOffsetNanosecondsFor(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeHandleSubtract(
         mut env: JNIEnv,
         _class: JClass,
-        tz_id: JString,
-        instant_str: JString,
+        handle: jlong,
+        duration: jlong,
     ) -> jlong {
-        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
-        let tz_val = match tz_s {
-            Some(s) => s,
-            None => return 0,
-        };
-        let tz = match TimeZone::try_from_str(&tz_val) {
-            Ok(t) => t,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                return 0;
-            }
-        };
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeHandleSubtract");
+        let result = temporal_zoned_date_time_handle_subtract(handle as *const TemporalHandle, duration as *const TemporalHandle);
+        handle_result_to_jlong(&mut env, result)
+    }
 
-        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
-        let inst_val = match inst_s {
-            Some(s) => s,
-            None => return 0,
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeHandleRound()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeHandleRound(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeHandleRound");
+        let unit = match optional_cstring(&mut env, &smallest_unit, "smallest unit") {
+            Ok(u) => u,
+            Err(()) => return 0,
         };
-        let instant = match Instant::from_str(&inst_val) {
-            Ok(i) => i,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
-                return 0;
-            }
+        let mode = match optional_cstring(&mut env, &rounding_mode, "rounding mode") {
+            Ok(m) => m,
+            Err(()) => return 0,
         };
-
-        match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, Calendar::default()) {
-            Ok(zdt) => zdt.offset_nanoseconds() as jlong,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get offset: {}", e));
-                0
-            }
-        }
+        let result = temporal_zoned_date_time_handle_round(
+            handle as *const TemporalHandle,
+            cstring_ptr(&unit),
+            rounding_increment,
+            cstring_ptr(&mode),
+        );
+        handle_result_to_jlong(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneGetOffsetStringFor()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeHandleWith()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetOffsetStringFor(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeHandleWith(
         mut env: JNIEnv,
         _class: JClass,
-        tz_id: JString,
-        instant_str: JString,
-    ) -> jstring {
-        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
-        let tz_val = match tz_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        handle: jlong,
+        year: jint,
+        month: jint,
+        day: jint,
+        hour: jint,
+        minute: jint,
+        second: jint,
+        millisecond: jint,
+        microsecond: jint,
+        nanosecond: jint,
+        calendar_id: JString,
+        time_zone_id: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeHandleWith");
+        let calendar = match optional_cstring(&mut env, &calendar_id, "calendar id") {
+            Ok(c) => c,
+            Err(()) => return 0,
         };
-        let tz = match TimeZone::try_from_str(&tz_val) {
+        let time_zone = match optional_cstring(&mut env, &time_zone_id, "timezone id") {
             Ok(t) => t,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                return ptr::null_mut();
-            }
-        };
+            Err(()) => return 0,
+        };
+        let result = temporal_zoned_date_time_handle_with(
+            handle as *const TemporalHandle,
+            year, month, day,
+            hour, minute, second,
+            millisecond, microsecond, nanosecond,
+            cstring_ptr(&calendar),
+            cstring_ptr(&time_zone),
+        );
+        handle_result_to_jlong(&mut env, result)
+    }
 
-        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
-        let inst_val = match inst_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let instant = match Instant::from_str(&inst_val) {
-            Ok(i) => i,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
-                return ptr::null_mut();
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeHandleGetAllComponents()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeHandleGetAllComponents(
+        mut env: JNIEnv,
+        _class: JClass,
+        handle: jlong,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeHandleGetAllComponents");
+        let mut c = ZonedDateTimeComponents::default();
+        temporal_zoned_date_time_handle_get_components(handle as *const TemporalHandle, &mut c);
+        if c.is_valid == 0 {
+            throw_type_error(&mut env, "Handle is not a ZonedDateTime");
+            return ptr::null_mut();
+        }
+        let components: [i64; 19] = [
+            c.year as i64,
+            c.month as i64,
+            c.day as i64,
+            c.day_of_week as i64,
+            c.day_of_year as i64,
+            c.week_of_year as i64,
+            c.year_of_week as i64,
+            c.days_in_week as i64,
+            c.days_in_month as i64,
+            c.days_in_year as i64,
+            c.months_in_year as i64,
+            c.in_leap_year as i64,
+            c.hour as i64,
+            c.minute as i64,
+            c.second as i64,
+            c.millisecond as i64,
+            c.microsecond as i64,
+            c.nanosecond as i64,
+            c.offset_nanoseconds,
+        ];
+        to_jlong_array(&mut env, &components)
+    }
+
+    // ========================================================================
+    // Batch API
+    // ========================================================================
+
+    /// Converts a Java String[] into owned C strings, throwing on null elements
+    fn jstring_array_to_cstrings(env: &mut JNIEnv, array: &JObjectArray, name: &str) -> Option<Vec<CString>> {
+        if array.is_null() {
+            throw_type_error(env, &format!("{} cannot be null", name));
+            return None;
+        }
+        let len = match env.get_array_length(array) {
+            Ok(l) => l,
+            Err(_) => {
+                throw_type_error(env, &format!("Invalid {}", name));
+                return None;
             }
         };
+        let mut strings = Vec::with_capacity(len as usize);
+        for i in 0..len {
+            let element = match env.get_object_array_element(array, i) {
+                Ok(e) => JString::from(e),
+                Err(_) => {
+                    throw_type_error(env, &format!("Invalid {}", name));
+                    return None;
+                }
+            };
+            let value = parse_jstring(env, &element, name);
+            // Release each element eagerly; inputs can be far larger than the local reference table
+            let _ = env.delete_local_ref(element);
+            match value.map(CString::new) {
+                Some(Ok(c)) => strings.push(c),
+                Some(Err(_)) => {
+                    throw_type_error(env, &format!("Invalid {}", name));
+                    return None;
+                }
+                None => return None,
+            }
+        }
+        Some(strings)
+    }
 
-        match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, Calendar::default()) {
-            Ok(zdt) => env.new_string(zdt.offset().to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get offset string: {}", e));
+    fn cstring_ptrs(strings: &[CString]) -> Vec<*const c_char> {
+        strings.iter().map(|s| s.as_ptr()).collect()
+    }
+
+    /// Throws if a BatchResult carries an error; returns whether it succeeded
+    fn check_batch_result(env: &mut JNIEnv, result: BatchResult) -> bool {
+        if result.error_type != TemporalErrorType::None as i32 {
+            throw_ffi_error(env, result.error_type, result.error_message);
+            return false;
+        }
+        true
+    }
+
+    /// Creates a Java int array, throwing on failure
+    fn to_jint_array(env: &mut JNIEnv, values: &[i32]) -> jintArray {
+        match env.new_int_array(values.len() as i32) {
+            Ok(arr) => {
+                if env.set_int_array_region(&arr, 0, values).is_err() {
+                    throw_range_error(env, "Failed to set array elements");
+                    return ptr::null_mut();
+                }
+                arr.into_raw()
+            }
+            Err(_) => {
+                throw_range_error(env, "Failed to create result array");
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneGetPlainDateTimeFor()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetPlainDateTimeFor(
-        mut env: JNIEnv,
-        _class: JClass,
-        tz_id: JString,
-        instant_str: JString,
-        calendar_id: JString,
-    ) -> jstring {
-        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
-        let tz_val = match tz_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+    /// Shared body of the `*ParseMany` JNI functions; returns [seconds, nanoseconds] pairs
+    fn parse_many_to_jlong_array(
+        env: &mut JNIEnv,
+        strings: &JObjectArray,
+        parse: extern "C" fn(*const *const c_char, i32, *mut TemporalEpochNanoseconds) -> BatchResult,
+    ) -> jlongArray {
+        let Some(strings) = jstring_array_to_cstrings(env, strings, "strings") else {
+            return ptr::null_mut();
         };
-        let tz = match TimeZone::try_from_str(&tz_val) {
-            Ok(t) => t,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                return ptr::null_mut();
-            }
+        let ptrs = cstring_ptrs(&strings);
+        let mut out = vec![TemporalEpochNanoseconds::default(); ptrs.len()];
+        if !check_batch_result(env, parse(ptrs.as_ptr(), ptrs.len() as i32, out.as_mut_ptr())) {
+            return ptr::null_mut();
+        }
+        let flat: Vec<i64> = out.iter().flat_map(|e| [e.seconds, e.nanoseconds as i64]).collect();
+        to_jlong_array(env, &flat)
+    }
+
+    /// Shared body of the `*Sort` JNI functions; returns the sort permutation
+    fn sort_to_jint_array(
+        env: &mut JNIEnv,
+        strings: &JObjectArray,
+        sort: extern "C" fn(*const *const c_char, i32, *mut i32) -> BatchResult,
+    ) -> jintArray {
+        let Some(strings) = jstring_array_to_cstrings(env, strings, "strings") else {
+            return ptr::null_mut();
         };
+        let ptrs = cstring_ptrs(&strings);
+        let mut out = vec![0i32; ptrs.len()];
+        if !check_batch_result(env, sort(ptrs.as_ptr(), ptrs.len() as i32, out.as_mut_ptr())) {
+            return ptr::null_mut();
+        }
+        to_jint_array(env, &out)
+    }
 
-        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
-        let inst_val = match inst_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+    /// Shared body of the `*CompareMany` JNI functions
+    fn compare_many_to_jint_array(
+        env: &mut JNIEnv,
+        a: &JObjectArray,
+        b: &JObjectArray,
+        compare: extern "C" fn(*const *const c_char, *const *const c_char, i32, *mut i8) -> BatchResult,
+    ) -> jintArray {
+        let Some(a) = jstring_array_to_cstrings(env, a, "first array") else {
+            return ptr::null_mut();
         };
-        let instant = match Instant::from_str(&inst_val) {
-            Ok(i) => i,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
-                return ptr::null_mut();
-            }
+        let Some(b) = jstring_array_to_cstrings(env, b, "second array") else {
+            return ptr::null_mut();
         };
+        if a.len() != b.len() {
+            throw_range_error(env, "Arrays must have the same length");
+            return ptr::null_mut();
+        }
+        let (ptrs_a, ptrs_b) = (cstring_ptrs(&a), cstring_ptrs(&b));
+        let mut out = vec![0i8; a.len()];
+        if !check_batch_result(env, compare(ptrs_a.as_ptr(), ptrs_b.as_ptr(), a.len() as i32, out.as_mut_ptr())) {
+            return ptr::null_mut();
+        }
+        let widened: Vec<i32> = out.iter().map(|&v| v as i32).collect();
+        to_jint_array(env, &widened)
+    }
 
-        let calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            Calendar::default()
-        };
+    /// JNI function for `com.temporal.TemporalNative.instantParseMany()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantParseMany(
+        mut env: JNIEnv,
+        _class: JClass,
+        strings: JObjectArray,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantParseMany");
+        parse_many_to_jlong_array(&mut env, &strings, temporal_instant_parse_many)
+    }
 
-        match ZonedDateTime::try_new(instant.epoch_nanoseconds().0, tz, calendar) {
-            Ok(zdt) => {
-                let dt = zdt.to_plain_date_time();
-                match dt.to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-                    Ok(s) => env.new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get plain date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+    /// JNI function for `com.temporal.TemporalNative.instantSort()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantSort(
+        mut env: JNIEnv,
+        _class: JClass,
+        strings: JObjectArray,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantSort");
+        sort_to_jint_array(&mut env, &strings, temporal_instant_sort)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneGetInstantFor()`
+    /// JNI function for `com.temporal.TemporalNative.instantCompareMany()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetInstantFor(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantCompareMany(
         mut env: JNIEnv,
         _class: JClass,
-        tz_id: JString,
-        dt_str: JString,
-        disambiguation: JString,
-    ) -> jstring {
-        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
-        let tz_val = match tz_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let tz = match TimeZone::try_from_str(&tz_val) {
-            Ok(t) => t,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                return ptr::null_mut();
-            }
-        };
+        a: JObjectArray,
+        b: JObjectArray,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantCompareMany");
+        compare_many_to_jint_array(&mut env, &a, &b, temporal_instant_compare_many)
+    }
 
-        let dt_s = parse_jstring(&mut env, &dt_str, "plain date time");
-        let dt_val = match dt_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let dt = match PlainDateTime::from_str(&dt_val) {
-            Ok(d) => d,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid plain date time: {}", e));
-                return ptr::null_mut();
-            }
-        };
+    /// JNI function for `com.temporal.TemporalNative.plainDateSort()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateSort(
+        mut env: JNIEnv,
+        _class: JClass,
+        strings: JObjectArray,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateSort");
+        sort_to_jint_array(&mut env, &strings, temporal_plain_date_sort)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateCompareMany()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateCompareMany(
+        mut env: JNIEnv,
+        _class: JClass,
+        a: JObjectArray,
+        b: JObjectArray,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateCompareMany");
+        compare_many_to_jint_array(&mut env, &a, &b, temporal_plain_date_compare_many)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeParseMany()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeParseMany(
+        mut env: JNIEnv,
+        _class: JClass,
+        strings: JObjectArray,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeParseMany");
+        parse_many_to_jlong_array(&mut env, &strings, temporal_zoned_date_time_parse_many)
+    }
 
-        // Disambiguation handling... assumes Compatible default or parse string
-        let disambig_enum = if !disambiguation.is_null() {
-            match parse_jstring(&mut env, &disambiguation, "disambiguation") {
-                Some(s) => match s.as_str() {
-                    "compatible" => Disambiguation::Compatible,
-                    "earlier" => Disambiguation::Earlier,
-                    "later" => Disambiguation::Later,
-                    "reject" => Disambiguation::Reject,
-                    _ => Disambiguation::Compatible,
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            Disambiguation::Compatible
-        };
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeSort()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeSort(
+        mut env: JNIEnv,
+        _class: JClass,
+        strings: JObjectArray,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeSort");
+        sort_to_jint_array(&mut env, &strings, temporal_zoned_date_time_sort)
+    }
 
-        match dt.to_zoned_date_time(tz, disambig_enum) {
-            Ok(zdt) => {
-                let instant = zdt.to_instant();
-                let provider = &*COMPILED_TZ_PROVIDER;
-                match instant.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env.new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get instant: {}", e));
-                ptr::null_mut()
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeCompareMany()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeCompareMany(
+        mut env: JNIEnv,
+        _class: JClass,
+        a: JObjectArray,
+        b: JObjectArray,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeCompareMany");
+        compare_many_to_jint_array(&mut env, &a, &b, temporal_zoned_date_time_compare_many)
+    }
+
+    /// Reads flat [seconds, nanoseconds] pairs, throwing on odd lengths
+    fn jlong_epoch_pairs(env: &mut JNIEnv, pairs: &JLongArray) -> Option<Vec<TemporalEpochNanoseconds>> {
+        let len = match env.get_array_length(pairs) {
+            Ok(l) => l as usize,
+            Err(_) => {
+                throw_type_error(env, "Invalid epoch nanoseconds");
+                return None;
             }
+        };
+        if len % 2 != 0 {
+            throw_range_error(env, "Epoch nanoseconds must be [seconds, nanoseconds] pairs");
+            return None;
         }
+        let mut flat = vec![0i64; len];
+        if env.get_long_array_region(pairs, 0, &mut flat).is_err() {
+            throw_type_error(env, "Invalid epoch nanoseconds");
+            return None;
+        }
+        Some(
+            flat.chunks_exact(2)
+                .map(|p| TemporalEpochNanoseconds { seconds: p[0], nanoseconds: p[1] as i32 })
+                .collect(),
+        )
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneGetNextTransition()`
+    /// JNI function for `com.temporal.TemporalNative.timeZoneGetPlainDateTimesForMany()`
+    ///
+    /// Takes flat [seconds, nanoseconds] pairs and returns the column-major
+    /// wall-clock fields.
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetNextTransition(
+    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetPlainDateTimesForMany(
         mut env: JNIEnv,
         _class: JClass,
         tz_id: JString,
-        instant_str: JString,
-    ) -> jstring {
-        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
-        let tz_val = match tz_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let tz = match TimeZone::try_from_str(&tz_val) {
-            Ok(t) => t,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                return ptr::null_mut();
-            }
-        };
-
-        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
-        let inst_val = match inst_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        epoch_pairs: JLongArray,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_timeZoneGetPlainDateTimesForMany");
+        let Some(tz) = parse_jstring(&mut env, &tz_id, "timezone") else {
+            return ptr::null_mut();
         };
-        let instant = match Instant::from_str(&inst_val) {
-            Ok(i) => i,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
-                return ptr::null_mut();
-            }
+        let Ok(tz) = CString::new(tz) else {
+            throw_type_error(&mut env, "Invalid timezone");
+            return ptr::null_mut();
         };
-
-        let provider = &*COMPILED_TZ_PROVIDER;
-        
-        let result = match tz {
-            TimeZone::IanaIdentifier(id) => {
-                provider.get_time_zone_transition(id, instant.as_i128(), TransitionDirection::Next)
-            }
-            TimeZone::UtcOffset(_) => Ok(None),
+        let Some(epochs) = jlong_epoch_pairs(&mut env, &epoch_pairs) else {
+            return ptr::null_mut();
         };
 
-        match result {
-            Ok(Some(ns)) => {
-                let instant_next = match Instant::try_new(ns.0) {
-                    Ok(i) => i,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid instant: {}", e));
-                        return ptr::null_mut();
-                    }
-                };
-                match instant_next.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env.new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
-            Ok(None) => ptr::null_mut(),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get next transition: {:?}", e));
-                ptr::null_mut()
-            }
+        let mut out = vec![0i32; epochs.len() * PLAIN_DATE_TIME_COLUMN_COUNT];
+        let result = temporal_time_zone_get_plain_date_times_for_many(
+            tz.as_ptr(),
+            epochs.as_ptr(),
+            epochs.len() as i32,
+            out.as_mut_ptr(),
+        );
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
         }
+        to_jint_array(&mut env, &out)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.timeZoneGetPreviousTransition()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeExpandRecurrence()`
+    ///
+    /// Returns flat [seconds, nanoseconds] pairs. Called from the module's
+    /// worker pool, never from the JS thread.
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_timeZoneGetPreviousTransition(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeExpandRecurrence(
         mut env: JNIEnv,
         _class: JClass,
+        start: JString,
+        duration: JString,
+        count: jint,
         tz_id: JString,
-        instant_str: JString,
-    ) -> jstring {
-        let tz_s = parse_jstring(&mut env, &tz_id, "timezone");
-        let tz_val = match tz_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let tz = match TimeZone::try_from_str(&tz_val) {
-            Ok(t) => t,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                return ptr::null_mut();
-            }
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeExpandRecurrence");
+        let Some(start) = parse_jstring(&mut env, &start, "start") else {
+            return ptr::null_mut();
         };
-
-        let inst_s = parse_jstring(&mut env, &instant_str, "instant");
-        let inst_val = match inst_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        let Some(duration) = parse_jstring(&mut env, &duration, "duration") else {
+            return ptr::null_mut();
         };
-        let instant = match Instant::from_str(&inst_val) {
-            Ok(i) => i,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid instant: {}", e));
-                return ptr::null_mut();
-            }
+        let Some(tz) = parse_jstring(&mut env, &tz_id, "timezone") else {
+            return ptr::null_mut();
         };
-
-        let provider = &*COMPILED_TZ_PROVIDER;
-        
-        let result = match tz {
-            TimeZone::IanaIdentifier(id) => {
-                provider.get_time_zone_transition(id, instant.as_i128(), TransitionDirection::Previous)
-            }
-            TimeZone::UtcOffset(_) => Ok(None),
+        let (Ok(start), Ok(duration), Ok(tz)) = (CString::new(start), CString::new(duration), CString::new(tz)) else {
+            throw_type_error(&mut env, "Arguments cannot contain NUL bytes");
+            return ptr::null_mut();
         };
 
-        match result {
-            Ok(Some(ns)) => {
-                let instant_prev = match Instant::try_new(ns.0) {
-                    Ok(i) => i,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid instant: {}", e));
-                        return ptr::null_mut();
-                    }
-                };
-                match instant_prev.to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env.new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
-            Ok(None) => ptr::null_mut(),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to get previous transition: {:?}", e));
-                ptr::null_mut()
-            }
+        let mut out = vec![TemporalEpochNanoseconds::default(); count.clamp(0, MAX_RECURRENCE_COUNT) as usize];
+        let result = temporal_zoned_date_time_expand_recurrence(
+            start.as_ptr(),
+            duration.as_ptr(),
+            count,
+            tz.as_ptr(),
+            out.as_mut_ptr(),
+        );
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
         }
+        let flat: Vec<i64> = out.iter().flat_map(|e| [e.seconds, e.nanoseconds as i64]).collect();
+        to_jlong_array(&mut env, &flat)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeFromString()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeRangeNew()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeFromString(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeRangeNew(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        start: JString,
+        step: JString,
+        end: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeRangeNew");
+        let (Ok(start), Ok(step), Ok(end)) = (
+            optional_cstring(&mut env, &start, "start"),
+            optional_cstring(&mut env, &step, "step"),
+            optional_cstring(&mut env, &end, "end"),
+        ) else {
+            return 0;
         };
-        
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(zdt) => match zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-                Ok(s) => env.new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time '{}': {}", s_val, e));
-                ptr::null_mut()
-            }
-        }
+        let result = temporal_zoned_date_time_range_new(cstring_ptr(&start), cstring_ptr(&step), cstring_ptr(&end));
+        handle_result_to_jlong(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeFromComponents()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeRangeNextBatch()`
+    ///
+    /// Returns flat (seconds, nanoseconds) pairs; an empty array means the
+    /// range is exhausted.
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeFromComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeRangeNextBatch(
         mut env: JNIEnv,
         _class: JClass,
-        year: jint,
-        month: jint,
-        day: jint,
-        hour: jint,
-        minute: jint,
-        second: jint,
-        millisecond: jint,
-        microsecond: jint,
-        nanosecond: jint,
-        calendar_id: JString,
-        time_zone_id: JString,
-        offset_nanoseconds: jlong,
-    ) -> jstring {
-        let calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            Calendar::default()
-        };
-
-        let pdt = match PlainDateTime::new(
-            year, month as u8, day as u8, 
-            hour as u8, minute as u8, second as u8, 
-            millisecond as u16, microsecond as u16, nanosecond as u16, 
-            calendar
-        ) {
-            Ok(d) => d,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid components: {}", e));
-                return ptr::null_mut();
-            }
-        };
+        range: jlong,
+        n: jint,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeRangeNextBatch");
+        let mut out = vec![TemporalEpochNanoseconds::default(); n.clamp(0, MAX_RECURRENCE_COUNT) as usize];
+        let result = temporal_zoned_date_time_range_next_batch(range as *mut TemporalHandle, out.as_mut_ptr(), n);
+        let count = result.count as usize;
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
+        }
+        let flat: Vec<i64> = out[..count].iter().flat_map(|e| [e.seconds, e.nanoseconds as i64]).collect();
+        to_jlong_array(&mut env, &flat)
+    }
 
-        let tz_s = parse_jstring(&mut env, &time_zone_id, "timezone id");
-        let tz_val = match tz_s {
-            Some(s) => s,
-            None => {
-                throw_type_error(&mut env, "Timezone ID is required");
-                return ptr::null_mut();
-            }
-        };
+    // ========================================================================
+    // Columns
+    // ========================================================================
 
-        let tz = match TimeZone::try_from_str(&tz_val) {
-            Ok(t) => t,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                return ptr::null_mut();
-            }
-        };
+    /// Length of a column, throwing if it isn't one
+    fn column_length(env: &mut JNIEnv, column: jlong) -> Option<i32> {
+        let mut len = 0;
+        check_status(env, temporal_column_length(column as *const TemporalHandle, &mut len)).then_some(len)
+    }
 
-        match pdt.to_zoned_date_time(tz, Disambiguation::Compatible) {
-            Ok(zdt) => match zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-                Ok(s) => env.new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to create zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+    /// JNI function for `com.temporal.TemporalNative.instantColumnFromEpochNanoseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantColumnFromEpochNanoseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+        epoch_pairs: JLongArray,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_instantColumnFromEpochNanoseconds");
+        let Some(epochs) = jlong_epoch_pairs(&mut env, &epoch_pairs) else {
+            return 0;
+        };
+        let result = temporal_instant_column_from_epoch_nanoseconds(epochs.as_ptr(), epochs.len() as i32);
+        handle_result_to_jlong(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetAllComponents()`
+    /// JNI function for `com.temporal.TemporalNative.instantColumnFromStrings()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetAllComponents(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantColumnFromStrings(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jlongArray {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        strings: JObjectArray,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_instantColumnFromStrings");
+        let Some(strings) = jstring_array_to_cstrings(&mut env, &strings, "strings") else {
+            return 0;
         };
-        
-        // Use default provider
-        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                return ptr::null_mut();
-            }
+        let ptrs = cstring_ptrs(&strings);
+        let result = temporal_instant_column_from_strings(ptrs.as_ptr(), ptrs.len() as i32);
+        handle_result_to_jlong(&mut env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainDateColumnFromStrings()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateColumnFromStrings(
+        mut env: JNIEnv,
+        _class: JClass,
+        strings: JObjectArray,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateColumnFromStrings");
+        let Some(strings) = jstring_array_to_cstrings(&mut env, &strings, "strings") else {
+            return 0;
         };
+        let ptrs = cstring_ptrs(&strings);
+        let result = temporal_plain_date_column_from_strings(ptrs.as_ptr(), ptrs.len() as i32);
+        handle_result_to_jlong(&mut env, result)
+    }
 
-        let components: [i64; 19] = [
-            zdt.year() as i64,
-            zdt.month() as i64,
-            zdt.day() as i64,
-            zdt.day_of_week() as i64,
-            zdt.day_of_year() as i64,
-            zdt.week_of_year().unwrap_or(0) as i64,
-            zdt.year_of_week().unwrap_or(0) as i64,
-            zdt.days_in_week() as i64,
-            zdt.days_in_month() as i64,
-            zdt.days_in_year() as i64,
-            zdt.months_in_year() as i64,
-            if zdt.in_leap_year() { 1 } else { 0 },
-            zdt.hour() as i64,
-            zdt.minute() as i64,
-            zdt.second() as i64,
-            zdt.millisecond() as i64,
-            zdt.microsecond() as i64,
-            zdt.nanosecond() as i64,
-            zdt.offset_nanoseconds() as i64,
-        ];
+    /// JNI function for `com.temporal.TemporalNative.columnLength()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_columnLength(
+        mut env: JNIEnv,
+        _class: JClass,
+        column: jlong,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_columnLength");
+        column_length(&mut env, column).unwrap_or(0)
+    }
 
-        match env.new_long_array(19) {
-            Ok(arr) => {
-                if env.set_long_array_region(&arr, 0, &components).is_err() {
-                    throw_range_error(&mut env, "Failed to set array elements");
-                    return ptr::null_mut();
-                }
-                arr.into_raw()
-            }
-            Err(_) => {
-                throw_range_error(&mut env, "Failed to create result array");
-                ptr::null_mut()
-            }
-        }
+    /// JNI function for `com.temporal.TemporalNative.columnSlice()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_columnSlice(
+        mut env: JNIEnv,
+        _class: JClass,
+        column: jlong,
+        start: jint,
+        end: jint,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_columnSlice");
+        let result = temporal_column_slice(column as *const TemporalHandle, start, end);
+        handle_result_to_jlong(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeEpochMilliseconds()`
+    /// JNI function for `com.temporal.TemporalNative.instantColumnLowerBound()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeEpochMilliseconds(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantColumnLowerBound(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                return ptr::null_mut();
-            }
+        column: jlong,
+        seconds: jlong,
+        nanoseconds: jint,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_instantColumnLowerBound");
+        let mut index = 0;
+        let status = temporal_instant_column_lower_bound(
+            column as *const TemporalHandle,
+            epoch_arg(seconds, nanoseconds),
+            &mut index,
+        );
+        check_status(&mut env, status);
+        index
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantColumnRangeCount()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantColumnRangeCount(
+        mut env: JNIEnv,
+        _class: JClass,
+        column: jlong,
+        start_seconds: jlong,
+        start_nanoseconds: jint,
+        end_seconds: jlong,
+        end_nanoseconds: jint,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_instantColumnRangeCount");
+        let mut count = 0;
+        let status = temporal_instant_column_range_count(
+            column as *const TemporalHandle,
+            epoch_arg(start_seconds, start_nanoseconds),
+            epoch_arg(end_seconds, end_nanoseconds),
+            &mut count,
+        );
+        check_status(&mut env, status);
+        count
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantColumnRead()`
+    ///
+    /// Returns flat [seconds, nanoseconds] pairs.
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantColumnRead(
+        mut env: JNIEnv,
+        _class: JClass,
+        column: jlong,
+        start: jint,
+        count: jint,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantColumnRead");
+        let Some(len) = column_length(&mut env, column) else {
+            return ptr::null_mut();
         };
-        env.new_string(zdt.epoch_milliseconds().to_string())
-            .map(|js| js.into_raw())
-            .unwrap_or(ptr::null_mut())
+        let n = count.clamp(0, (len - start.max(0)).max(0));
+        let mut out = vec![TemporalEpochNanoseconds::default(); n as usize];
+        let result = temporal_instant_column_read(column as *const TemporalHandle, start, n, out.as_mut_ptr());
+        let written = result.count as usize;
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
+        }
+        let flat: Vec<i64> = out[..written].iter().flat_map(|e| [e.seconds, e.nanoseconds as i64]).collect();
+        to_jlong_array(&mut env, &flat)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeEpochNanoseconds()`
+    /// JNI function for `com.temporal.TemporalNative.instantColumnBucketBy()`
+    ///
+    /// Returns flat [start seconds, start nanoseconds, count] triples.
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeEpochNanoseconds(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantColumnBucketBy(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        column: jlong,
+        unit: JString,
+        tz_id: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantColumnBucketBy");
+        let (Ok(unit), Ok(tz)) = (optional_cstring(&mut env, &unit, "unit"), optional_cstring(&mut env, &tz_id, "timezone"))
+        else {
+            return ptr::null_mut();
         };
-        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                return ptr::null_mut();
-            }
+        let Some(len) = column_length(&mut env, column) else {
+            return ptr::null_mut();
         };
-        env.new_string(zdt.epoch_nanoseconds().0.to_string())
-            .map(|js| js.into_raw())
-            .unwrap_or(ptr::null_mut())
+        let mut starts = vec![TemporalEpochNanoseconds::default(); len as usize];
+        let mut counts = vec![0i32; len as usize];
+        let result = temporal_instant_column_bucket_by(
+            column as *const TemporalHandle,
+            cstring_ptr(&unit),
+            cstring_ptr(&tz),
+            starts.as_mut_ptr(),
+            counts.as_mut_ptr(),
+            len,
+        );
+        let written = result.count as usize;
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
+        }
+        let flat: Vec<i64> = starts[..written]
+            .iter()
+            .zip(&counts)
+            .flat_map(|(e, &n)| [e.seconds, e.nanoseconds as i64, n as i64])
+            .collect();
+        to_jlong_array(&mut env, &flat)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetCalendar()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateColumnLowerBound()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetCalendar(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateColumnLowerBound(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        column: jlong,
+        date: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateColumnLowerBound");
+        let Ok(date) = optional_cstring(&mut env, &date, "date") else {
+            return 0;
         };
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => env.new_string(z.calendar().identifier())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+        let mut index = 0;
+        let status = temporal_plain_date_column_lower_bound(column as *const TemporalHandle, cstring_ptr(&date), &mut index);
+        check_status(&mut env, status);
+        index
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetTimeZone()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateColumnRangeCount()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetTimeZone(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateColumnRangeCount(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        column: jlong,
+        start: JString,
+        end: JString,
+    ) -> jint {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateColumnRangeCount");
+        let (Ok(start), Ok(end)) = (optional_cstring(&mut env, &start, "start"), optional_cstring(&mut env, &end, "end"))
+        else {
+            return 0;
         };
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => match z.time_zone().identifier() {
-                Ok(id) => env.new_string(id)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to get identifier: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+        let mut count = 0;
+        let status = temporal_plain_date_column_range_count(
+            column as *const TemporalHandle,
+            cstring_ptr(&start),
+            cstring_ptr(&end),
+            &mut count,
+        );
+        check_status(&mut env, status);
+        count
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeGetOffset()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateColumnRead()`
+    ///
+    /// Returns days since 1970-01-01.
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeGetOffset(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateColumnRead(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        column: jlong,
+        start: jint,
+        count: jint,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateColumnRead");
+        let Some(len) = column_length(&mut env, column) else {
+            return ptr::null_mut();
         };
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => env.new_string(z.offset().to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                ptr::null_mut()
-            }
+        let n = count.clamp(0, (len - start.max(0)).max(0));
+        let mut out = vec![0i32; n as usize];
+        let result = temporal_plain_date_column_read(column as *const TemporalHandle, start, n, out.as_mut_ptr());
+        let written = result.count as usize;
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
         }
+        to_jint_array(&mut env, &out[..written])
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeAdd()`
+    /// JNI function for `com.temporal.TemporalNative.plainDateColumnBucketBy()`
+    ///
+    /// Returns flat [start day, count] pairs.
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeAdd(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateColumnBucketBy(
         mut env: JNIEnv,
         _class: JClass,
-        zdt_str: JString,
-        duration_str: JString,
-    ) -> jstring {
-        let zdt_s = parse_jstring(&mut env, &zdt_str, "zoned date time");
-        let zdt_val = match zdt_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        column: jlong,
+        unit: JString,
+    ) -> jintArray {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateColumnBucketBy");
+        let Ok(unit) = optional_cstring(&mut env, &unit, "unit") else {
+            return ptr::null_mut();
         };
-        let zdt = match ZonedDateTime::from_utf8(zdt_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                return ptr::null_mut();
-            }
+        let Some(len) = column_length(&mut env, column) else {
+            return ptr::null_mut();
         };
+        let mut starts = vec![0i32; len as usize];
+        let mut counts = vec![0i32; len as usize];
+        let result = temporal_plain_date_column_bucket_by(
+            column as *const TemporalHandle,
+            cstring_ptr(&unit),
+            starts.as_mut_ptr(),
+            counts.as_mut_ptr(),
+            len,
+        );
+        let written = result.count as usize;
+        if !check_batch_result(&mut env, result) {
+            return ptr::null_mut();
+        }
+        let flat: Vec<i32> = starts[..written].iter().zip(&counts).flat_map(|(&d, &n)| [d, n]).collect();
+        to_jint_array(&mut env, &flat)
+    }
 
-        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
-        let dur_val = match dur_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let duration = match Duration::from_str(&dur_val) {
-            Ok(d) => d,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
-                return ptr::null_mut();
-            }
+    // ========================================================================
+    // Zoned clocks
+    // ========================================================================
+
+    /// JNI function for `com.temporal.TemporalNative.zonedClockNew()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedClockNew(
+        mut env: JNIEnv,
+        _class: JClass,
+        tz_id: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedClockNew");
+        let Ok(tz) = optional_cstring(&mut env, &tz_id, "timezone") else {
+            return 0;
         };
+        let result = temporal_zoned_clock_new(cstring_ptr(&tz));
+        handle_result_to_jlong(&mut env, result)
+    }
 
-        match zdt.add(&duration, Some(Overflow::Reject)) {
-            Ok(result) => match result.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-                Ok(s) => env.new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to add duration: {}", e));
-                ptr::null_mut()
-            }
+    /// JNI function for `com.temporal.TemporalNative.zonedClockRead()`
+    ///
+    /// Returns [epoch seconds, nanoseconds, offset nanoseconds, year, month,
+    /// day, hour, minute, second, millisecond, microsecond, nanosecond,
+    /// day of week, day of year].
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedClockRead(
+        mut env: JNIEnv,
+        _class: JClass,
+        clock: jlong,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedClockRead");
+        let mut r = ZonedClockReading::default();
+        if !check_status(&mut env, temporal_zoned_clock_read(clock as *mut TemporalHandle, &mut r)) {
+            return ptr::null_mut();
         }
+        let fields = [
+            r.epoch_ns.seconds,
+            r.epoch_ns.nanoseconds as i64,
+            r.offset_nanoseconds,
+            r.year as i64,
+            r.month as i64,
+            r.day as i64,
+            r.hour as i64,
+            r.minute as i64,
+            r.second as i64,
+            r.millisecond as i64,
+            r.microsecond as i64,
+            r.nanosecond as i64,
+            r.day_of_week as i64,
+            r.day_of_year as i64,
+        ];
+        to_jlong_array(&mut env, &fields)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeSubtract()`
-    #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeSubtract(
-        mut env: JNIEnv,
-        _class: JClass,
-        zdt_str: JString,
-        duration_str: JString,
-    ) -> jstring {
-        let zdt_s = parse_jstring(&mut env, &zdt_str, "zoned date time");
-        let zdt_val = match zdt_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let zdt = match ZonedDateTime::from_utf8(zdt_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                return ptr::null_mut();
-            }
-        };
+    // ========================================================================
+    // Instant API (epoch nanoseconds)
+    // ========================================================================
 
-        let dur_s = parse_jstring(&mut env, &duration_str, "duration");
-        let dur_val = match dur_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let duration = match Duration::from_str(&dur_val) {
-            Ok(d) => d,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid duration: {}", e));
-                return ptr::null_mut();
-            }
+    /// Throws the last recorded error if `status` is not `TemporalErrorType::None`
+    fn check_status(env: &mut JNIEnv, status: i32) -> bool {
+        if status == TemporalErrorType::None as i32 {
+            return true;
+        }
+        let message = temporal_last_error_message();
+        let message = if message.is_null() {
+            "Unknown error".to_string()
+        } else {
+            unsafe { CStr::from_ptr(message) }.to_string_lossy().into_owned()
         };
+        if status == TemporalErrorType::TypeError as i32 {
+            throw_type_error(env, &message);
+        } else {
+            throw_range_error(env, &message);
+        }
+        false
+    }
 
-        match zdt.subtract(&duration, Some(Overflow::Reject)) {
-            Ok(result) => match result.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-                Ok(s) => env.new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format result: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to subtract duration: {}", e));
-                ptr::null_mut()
-            }
+    fn epoch_to_jlong_array(env: &mut JNIEnv, status: i32, epoch: TemporalEpochNanoseconds) -> jlongArray {
+        if !check_status(env, status) {
+            return ptr::null_mut();
         }
+        to_jlong_array(env, &[epoch.seconds, epoch.nanoseconds as i64])
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeCompare()`
+    fn epoch_arg(seconds: jlong, nanoseconds: jint) -> TemporalEpochNanoseconds {
+        TemporalEpochNanoseconds { seconds, nanoseconds }
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantParseEpochNanoseconds()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeCompare(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantParseEpochNanoseconds(
         mut env: JNIEnv,
         _class: JClass,
-        a: JString,
-        b: JString,
-    ) -> jint {
-        let a_str = parse_jstring(&mut env, &a, "first zoned date time");
-        let a_val = match a_str {
-            Some(s) => s,
-            None => return 0,
-        };
-        let zdt_a = match ZonedDateTime::from_utf8(a_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(_) => return 0,
-        };
-
-        let b_str = parse_jstring(&mut env, &b, "second zoned date time");
-        let b_val = match b_str {
-            Some(s) => s,
-            None => return 0,
+        s: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantParseEpochNanoseconds");
+        let Some(s) = parse_jstring(&mut env, &s, "instant string") else {
+            return ptr::null_mut();
         };
-        let zdt_b = match ZonedDateTime::from_utf8(b_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(_) => return 0,
+        let Ok(s) = CString::new(s) else {
+            throw_type_error(&mut env, "Invalid instant string");
+            return ptr::null_mut();
         };
+        let mut epoch = TemporalEpochNanoseconds::default();
+        let status = temporal_instant_parse_epoch_nanoseconds(s.as_ptr(), &mut epoch);
+        epoch_to_jlong_array(&mut env, status, epoch)
+    }
 
-        zdt_a.epoch_nanoseconds().0.cmp(&zdt_b.epoch_nanoseconds().0) as jint
+    /// JNI function for `com.temporal.TemporalNative.instantNowEpochNanoseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantNowEpochNanoseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantNowEpochNanoseconds");
+        let mut epoch = TemporalEpochNanoseconds::default();
+        let status = temporal_instant_now_epoch_nanoseconds(&mut epoch);
+        epoch_to_jlong_array(&mut env, status, epoch)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeWith()`
+    /// JNI function for `com.temporal.TemporalNative.instantFormatEpochNanoseconds()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeWith(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantFormatEpochNanoseconds(
         mut env: JNIEnv,
         _class: JClass,
-        zdt_str: JString,
-        year: jint,
-        month: jint,
-        day: jint,
-        hour: jint,
-        minute: jint,
-        second: jint,
-        millisecond: jint,
-        microsecond: jint,
-        nanosecond: jint,
-        _offset_ns: jlong,
-        calendar_id: JString,
-        time_zone_id: JString,
+        seconds: jlong,
+        nanoseconds: jint,
     ) -> jstring {
-        let zdt_s = parse_jstring(&mut env, &zdt_str, "zoned date time");
-        let zdt_val = match zdt_s {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        stats_scope!("Java_com_temporal_TemporalNative_instantFormatEpochNanoseconds");
+        let mut buf = [0 as c_char; 64];
+        let mut len = 0usize;
+        let status = temporal_instant_format_epoch_nanoseconds_into(
+            epoch_arg(seconds, nanoseconds),
+            buf.as_mut_ptr(),
+            buf.len(),
+            &mut len,
+        );
+        if !check_status(&mut env, status) {
+            return ptr::null_mut();
+        }
+        // Instant strings are at most 37 bytes, well within the buffer
+        let value = unsafe { CStr::from_ptr(buf.as_ptr()) }.to_string_lossy().into_owned();
+        env.new_string(value)
+            .map(|js| js.into_raw())
+            .unwrap_or(ptr::null_mut())
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantRoundEpochNanoseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantRoundEpochNanoseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+        seconds: jlong,
+        nanoseconds: jint,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantRoundEpochNanoseconds");
+        let Ok(smallest) = optional_cstring(&mut env, &smallest_unit, "smallest unit") else {
+            return ptr::null_mut();
         };
-        let zdt = match ZonedDateTime::from_utf8(zdt_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                return ptr::null_mut();
-            }
+        let Ok(mode) = optional_cstring(&mut env, &rounding_mode, "rounding mode") else {
+            return ptr::null_mut();
         };
-        
-        let current_pdt = zdt.to_plain_date_time();
-    
-        let new_year = if year == i32::MIN { current_pdt.year() } else { year };
-        let new_month = if month == i32::MIN { current_pdt.month() } else { month as u8 };
-        let new_day = if day == i32::MIN { current_pdt.day() } else { day as u8 };
-        
-        let new_hour = if hour == i32::MIN { current_pdt.hour() } else { hour as u8 };
-        let new_minute = if minute == i32::MIN { current_pdt.minute() } else { minute as u8 };
-        let new_second = if second == i32::MIN { current_pdt.second() } else { second as u8 };
-        let new_millisecond = if millisecond == i32::MIN { current_pdt.millisecond() } else { millisecond as u16 };
-        let new_microsecond = if microsecond == i32::MIN { current_pdt.microsecond() } else { microsecond as u16 };
-        let new_nanosecond = if nanosecond == i32::MIN { current_pdt.nanosecond() } else { nanosecond as u16 };
+        let mut epoch = TemporalEpochNanoseconds::default();
+        let status = temporal_instant_round_epoch_nanoseconds(
+            epoch_arg(seconds, nanoseconds),
+            cstring_ptr(&smallest),
+            rounding_increment,
+            cstring_ptr(&mode),
+            &mut epoch,
+        );
+        epoch_to_jlong_array(&mut env, status, epoch)
+    }
 
-        let new_calendar = if !calendar_id.is_null() {
-            let id_str = parse_jstring(&mut env, &calendar_id, "calendar id");
-            match id_str {
-                Some(s) => match Calendar::from_str(&s) {
-                    Ok(c) => c,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid calendar: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            zdt.calendar().clone()
+    /// Shared body of `instantUntilEpochNanoseconds` / `instantSinceEpochNanoseconds`
+    #[allow(clippy::too_many_arguments)]
+    fn instant_difference_epoch_to_jstring(
+        env: &mut JNIEnv,
+        one: TemporalEpochNanoseconds,
+        two: TemporalEpochNanoseconds,
+        largest_unit: &JString,
+        smallest_unit: &JString,
+        rounding_increment: jlong,
+        rounding_mode: &JString,
+        difference: extern "C" fn(
+            TemporalEpochNanoseconds,
+            TemporalEpochNanoseconds,
+            *const c_char,
+            *const c_char,
+            i64,
+            *const c_char,
+        ) -> TemporalResult,
+    ) -> jstring {
+        let Ok(largest) = optional_cstring(env, largest_unit, "largest unit") else {
+            return ptr::null_mut();
         };
-        
-        let new_timezone = if !time_zone_id.is_null() {
-            let id_str = parse_jstring(&mut env, &time_zone_id, "timezone id");
-            match id_str {
-                Some(s) => match TimeZone::try_from_str(&s) {
-                    Ok(t) => t,
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Invalid timezone: {}", e));
-                        return ptr::null_mut();
-                    }
-                },
-                None => return ptr::null_mut(),
-            }
-        } else {
-            zdt.time_zone().clone()
+        let Ok(smallest) = optional_cstring(env, smallest_unit, "smallest unit") else {
+            return ptr::null_mut();
         };
-
-        let pdt = match PlainDateTime::new(
-            new_year, new_month, new_day, 
-            new_hour, new_minute, new_second, 
-            new_millisecond, new_microsecond, new_nanosecond, 
-            new_calendar
-        ) {
-            Ok(d) => d,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid components: {}", e));
-                return ptr::null_mut();
-            }
+        let Ok(mode) = optional_cstring(env, rounding_mode, "rounding mode") else {
+            return ptr::null_mut();
         };
-        
-        match pdt.to_zoned_date_time(new_timezone, Disambiguation::Compatible) {
-            Ok(new_zdt) => match new_zdt.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-                Ok(s) => env.new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to create zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+        let result = difference(
+            one,
+            two,
+            cstring_ptr(&largest),
+            cstring_ptr(&smallest),
+            rounding_increment,
+            cstring_ptr(&mode),
+        );
+        temporal_result_to_jstring(env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeUntil()`
+    /// JNI function for `com.temporal.TemporalNative.instantUntilEpochNanoseconds()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeUntil(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantUntilEpochNanoseconds(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
+        one_seconds: jlong,
+        one_nanoseconds: jint,
+        two_seconds: jlong,
+        two_nanoseconds: jint,
+        largest_unit: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
     ) -> jstring {
-        let one_str = parse_jstring(&mut env, &one, "first zoned date time");
-        let one_val = match one_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let zdt1 = match ZonedDateTime::from_utf8(one_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(_) => return ptr::null_mut(),
-        };
+        stats_scope!("Java_com_temporal_TemporalNative_instantUntilEpochNanoseconds");
+        instant_difference_epoch_to_jstring(
+            &mut env,
+            epoch_arg(one_seconds, one_nanoseconds),
+            epoch_arg(two_seconds, two_nanoseconds),
+            &largest_unit,
+            &smallest_unit,
+            rounding_increment,
+            &rounding_mode,
+            temporal_instant_until_epoch_nanoseconds,
+        )
+    }
 
-        let two_str = parse_jstring(&mut env, &two, "second zoned date time");
-        let two_val = match two_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+    /// JNI function for `com.temporal.TemporalNative.instantSinceEpochNanoseconds()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantSinceEpochNanoseconds(
+        mut env: JNIEnv,
+        _class: JClass,
+        one_seconds: jlong,
+        one_nanoseconds: jint,
+        two_seconds: jlong,
+        two_nanoseconds: jint,
+        largest_unit: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantSinceEpochNanoseconds");
+        instant_difference_epoch_to_jstring(
+            &mut env,
+            epoch_arg(one_seconds, one_nanoseconds),
+            epoch_arg(two_seconds, two_nanoseconds),
+            &largest_unit,
+            &smallest_unit,
+            rounding_increment,
+            &rounding_mode,
+            temporal_instant_since_epoch_nanoseconds,
+        )
+    }
+
+    // ========================================================================
+    // Binary encoding
+    // ========================================================================
+
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToBytes()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToBytes(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+    ) -> jbyteArray {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeToBytes");
+        let Some(s) = parse_jstring(&mut env, &s, "zoned date time string") else {
+            return ptr::null_mut();
         };
-        let zdt2 = match ZonedDateTime::from_utf8(two_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(_) => return ptr::null_mut(),
+        let Ok(s) = CString::new(s) else {
+            throw_type_error(&mut env, "Invalid zoned date time string");
+            return ptr::null_mut();
         };
-
-        match zdt1.until(&zdt2, Default::default()) {
-            Ok(d) => env.new_string(d.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute until: {}", e));
+        let mut out = [0u8; TEMPORAL_BINARY_SIZE];
+        if !check_status(&mut env, temporal_zoned_date_time_to_bytes(s.as_ptr(), out.as_mut_ptr())) {
+            return ptr::null_mut();
+        }
+        match env.byte_array_from_slice(&out) {
+            Ok(arr) => arr.into_raw(),
+            Err(_) => {
+                throw_range_error(&mut env, "Failed to create result array");
                 ptr::null_mut()
             }
         }
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeSince()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeFromBytes()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeSince(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeFromBytes(
         mut env: JNIEnv,
         _class: JClass,
-        one: JString,
-        two: JString,
+        bytes: JByteArray,
     ) -> jstring {
-        let one_str = parse_jstring(&mut env, &one, "first zoned date time");
-        let one_val = match one_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        let zdt1 = match ZonedDateTime::from_utf8(one_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(_) => return ptr::null_mut(),
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeFromBytes");
+        if bytes.is_null() {
+            throw_type_error(&mut env, "Binary record cannot be null");
+            return ptr::null_mut();
+        }
+        let bytes = match env.convert_byte_array(&bytes) {
+            Ok(b) if b.len() == TEMPORAL_BINARY_SIZE => b,
+            Ok(_) => {
+                throw_range_error(&mut env, &format!("Binary record must be {} bytes", TEMPORAL_BINARY_SIZE));
+                return ptr::null_mut();
+            }
+            Err(_) => {
+                throw_type_error(&mut env, "Invalid binary record");
+                return ptr::null_mut();
+            }
         };
+        temporal_result_to_jstring(&mut env, temporal_zoned_date_time_from_bytes(bytes.as_ptr()))
+    }
 
-        let two_str = parse_jstring(&mut env, &two, "second zoned date time");
-        let two_val = match two_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+    /// JNI function for `com.temporal.TemporalNative.instantToStringWithOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantToStringWithOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+        fractional_second_digits: jint,
+        smallest_unit: JString,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantToStringWithOptions");
+        let (Ok(s), Ok(unit), Ok(mode)) = (
+            optional_cstring(&mut env, &s, "instant string"),
+            optional_cstring(&mut env, &smallest_unit, "smallest unit"),
+            optional_cstring(&mut env, &rounding_mode, "rounding mode"),
+        ) else {
+            return ptr::null_mut();
         };
-        let zdt2 = match ZonedDateTime::from_utf8(two_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(_) => return ptr::null_mut(),
+        let result = temporal_instant_to_string_with_options(
+            cstring_ptr(&s),
+            fractional_second_digits,
+            cstring_ptr(&unit),
+            cstring_ptr(&mode),
+        );
+        temporal_result_to_jstring(&mut env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeToStringWithOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeToStringWithOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+        fractional_second_digits: jint,
+        smallest_unit: JString,
+        rounding_mode: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeToStringWithOptions");
+        let (Ok(s), Ok(unit), Ok(mode)) = (
+            optional_cstring(&mut env, &s, "plain time string"),
+            optional_cstring(&mut env, &smallest_unit, "smallest unit"),
+            optional_cstring(&mut env, &rounding_mode, "rounding mode"),
+        ) else {
+            return ptr::null_mut();
         };
+        let result = temporal_plain_time_to_string_with_options(
+            cstring_ptr(&s),
+            fractional_second_digits,
+            cstring_ptr(&unit),
+            cstring_ptr(&mode),
+        );
+        temporal_result_to_jstring(&mut env, result)
+    }
 
-        match zdt1.since(&zdt2, Default::default()) {
-            Ok(d) => env.new_string(d.to_string())
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to compute since: {}", e));
-                ptr::null_mut()
-            }
-        }
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeToStringWithOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeToStringWithOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+        fractional_second_digits: jint,
+        smallest_unit: JString,
+        rounding_mode: JString,
+        calendar_name: JString,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeToStringWithOptions");
+        let (Ok(s), Ok(unit), Ok(mode), Ok(calendar)) = (
+            optional_cstring(&mut env, &s, "plain date time string"),
+            optional_cstring(&mut env, &smallest_unit, "smallest unit"),
+            optional_cstring(&mut env, &rounding_mode, "rounding mode"),
+            optional_cstring(&mut env, &calendar_name, "calendarName"),
+        ) else {
+            return ptr::null_mut();
+        };
+        let result = temporal_plain_date_time_to_string_with_options(
+            cstring_ptr(&s),
+            fractional_second_digits,
+            cstring_ptr(&unit),
+            cstring_ptr(&mode),
+            cstring_ptr(&calendar),
+        );
+        temporal_result_to_jstring(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeRound()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToStringWithOptions()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeRound(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToStringWithOptions(
         mut env: JNIEnv,
         _class: JClass,
-        zdt_str: JString,
+        s: JString,
+        fractional_second_digits: jint,
         smallest_unit: JString,
-        rounding_increment: jlong,
         rounding_mode: JString,
+        calendar_name: JString,
+        time_zone_name: JString,
+        offset: JString,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &zdt_str, "zoned date time");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeToStringWithOptions");
+        let (Ok(s), Ok(unit), Ok(mode), Ok(calendar), Ok(time_zone), Ok(offset)) = (
+            optional_cstring(&mut env, &s, "zoned date time string"),
+            optional_cstring(&mut env, &smallest_unit, "smallest unit"),
+            optional_cstring(&mut env, &rounding_mode, "rounding mode"),
+            optional_cstring(&mut env, &calendar_name, "calendarName"),
+            optional_cstring(&mut env, &time_zone_name, "timeZoneName"),
+            optional_cstring(&mut env, &offset, "offset"),
+        ) else {
+            return ptr::null_mut();
         };
-        let zdt = match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(z) => z,
-            Err(_) => return ptr::null_mut(),
+        let result = temporal_zoned_date_time_to_string_with_options(
+            cstring_ptr(&s),
+            fractional_second_digits,
+            cstring_ptr(&unit),
+            cstring_ptr(&mode),
+            cstring_ptr(&calendar),
+            cstring_ptr(&time_zone),
+            cstring_ptr(&offset),
+        );
+        temporal_result_to_jstring(&mut env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.toStringOptionsNew()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_toStringOptionsNew(
+        mut env: JNIEnv,
+        _class: JClass,
+        fractional_second_digits: jint,
+        smallest_unit: JString,
+        rounding_mode: JString,
+        calendar_name: JString,
+        time_zone_name: JString,
+        offset: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_toStringOptionsNew");
+        let (Ok(unit), Ok(mode), Ok(calendar), Ok(time_zone), Ok(offset)) = (
+            optional_cstring(&mut env, &smallest_unit, "smallest unit"),
+            optional_cstring(&mut env, &rounding_mode, "rounding mode"),
+            optional_cstring(&mut env, &calendar_name, "calendarName"),
+            optional_cstring(&mut env, &time_zone_name, "timeZoneName"),
+            optional_cstring(&mut env, &offset, "offset"),
+        ) else {
+            return 0;
         };
+        let mut options = 0;
+        let status = temporal_to_string_options_new(
+            fractional_second_digits,
+            cstring_ptr(&unit),
+            cstring_ptr(&mode),
+            cstring_ptr(&calendar),
+            cstring_ptr(&time_zone),
+            cstring_ptr(&offset),
+            &mut options,
+        );
+        check_status(&mut env, status);
+        options as jlong
+    }
 
-        let unit = if !smallest_unit.is_null() {
-            let s = parse_jstring(&mut env, &smallest_unit, "smallest unit");
-            match s {
-                Some(s) => match Unit::from_str(&s) {
-                    Ok(u) => u,
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid smallest unit: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => {
-                    throw_type_error(&mut env, "smallestUnit is required");
-                    return ptr::null_mut();
-                }
-            }
-        } else {
-            throw_type_error(&mut env, "smallestUnit is required");
+    /// JNI function for `com.temporal.TemporalNative.instantToStringWithPackedOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantToStringWithPackedOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+        options: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantToStringWithPackedOptions");
+        let Ok(s) = optional_cstring(&mut env, &s, "instant string") else {
             return ptr::null_mut();
         };
+        let result = temporal_instant_to_string_with_packed_options(cstring_ptr(&s), options as TemporalToStringOptions);
+        temporal_result_to_jstring(&mut env, result)
+    }
 
-        let mode = if !rounding_mode.is_null() {
-            let s = parse_jstring(&mut env, &rounding_mode, "rounding mode");
-            match s {
-                Some(s) => match RoundingMode::from_str(&s) {
-                    Ok(m) => m,
-                    Err(_) => {
-                        throw_range_error(&mut env, &format!("Invalid rounding mode: {}", s));
-                        return ptr::null_mut();
-                    }
-                },
-                None => RoundingMode::HalfExpand,
-            }
-        } else {
-            RoundingMode::HalfExpand
+    /// JNI function for `com.temporal.TemporalNative.plainTimeToStringWithPackedOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeToStringWithPackedOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+        options: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeToStringWithPackedOptions");
+        let Ok(s) = optional_cstring(&mut env, &s, "plain time string") else {
+            return ptr::null_mut();
         };
+        let result = temporal_plain_time_to_string_with_packed_options(cstring_ptr(&s), options as TemporalToStringOptions);
+        temporal_result_to_jstring(&mut env, result)
+    }
 
-        let increment = if rounding_increment > 0 {
-            rounding_increment as u32
-        } else {
-            1
+    /// JNI function for `com.temporal.TemporalNative.plainDateTimeToStringWithPackedOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainDateTimeToStringWithPackedOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+        options: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainDateTimeToStringWithPackedOptions");
+        let Ok(s) = optional_cstring(&mut env, &s, "plain date time string") else {
+            return ptr::null_mut();
         };
-        
-        let increment_opt = match RoundingIncrement::try_new(increment) {
-            Ok(i) => i,
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid rounding increment: {}", e));
-                return ptr::null_mut();
-            }
+        let result = temporal_plain_date_time_to_string_with_packed_options(cstring_ptr(&s), options as TemporalToStringOptions);
+        temporal_result_to_jstring(&mut env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToStringWithPackedOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToStringWithPackedOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        s: JString,
+        options: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeToStringWithPackedOptions");
+        let Ok(s) = optional_cstring(&mut env, &s, "zoned date time string") else {
+            return ptr::null_mut();
         };
+        let result = temporal_zoned_date_time_to_string_with_packed_options(cstring_ptr(&s), options as TemporalToStringOptions);
+        temporal_result_to_jstring(&mut env, result)
+    }
 
-        let mut options = RoundingOptions::default();
-        options.smallest_unit = Some(unit);
-        options.rounding_mode = Some(mode);
-        options.increment = Some(increment_opt);
+    /// JNI function for `com.temporal.TemporalNative.roundingOptionsNew()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_roundingOptionsNew(
+        mut env: JNIEnv,
+        _class: JClass,
+        largest_unit: JString,
+        smallest_unit: JString,
+        rounding_increment: jlong,
+        rounding_mode: JString,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_roundingOptionsNew");
+        let (Ok(largest), Ok(smallest), Ok(mode)) = (
+            optional_cstring(&mut env, &largest_unit, "largest unit"),
+            optional_cstring(&mut env, &smallest_unit, "smallest unit"),
+            optional_cstring(&mut env, &rounding_mode, "rounding mode"),
+        ) else {
+            return 0;
+        };
+        let mut options = 0;
+        let status = temporal_rounding_options_new(
+            cstring_ptr(&largest),
+            cstring_ptr(&smallest),
+            rounding_increment,
+            cstring_ptr(&mode),
+            &mut options,
+        );
+        check_status(&mut env, status);
+        options as jlong
+    }
 
-        match zdt.round(options) {
-            Ok(result) => match result.to_ixdtf_string(DisplayOffset::Auto, DisplayTimeZone::Auto, DisplayCalendar::Auto, ToStringRoundingOptions::default()) {
-                Ok(s) => env
-                    .new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format zoned date time: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Failed to round: {}", e));
-                ptr::null_mut()
-            }
-        }
+    /// JNI function for `com.temporal.TemporalNative.instantUntilEpochNanosecondsWithOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantUntilEpochNanosecondsWithOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        one_seconds: jlong,
+        one_nanoseconds: jint,
+        two_seconds: jlong,
+        two_nanoseconds: jint,
+        options: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_instantUntilEpochNanosecondsWithOptions");
+        let result = temporal_instant_until_epoch_nanoseconds_with_options(
+            epoch_arg(one_seconds, one_nanoseconds),
+            epoch_arg(two_seconds, two_nanoseconds),
+            options as TemporalRoundingOptions,
+        );
+        temporal_result_to_jstring(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToInstant()`
+    /// JNI function for `com.temporal.TemporalNative.instantSinceEpochNanosecondsWithOptions()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToInstant(
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantSinceEpochNanosecondsWithOptions(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
+        one_seconds: jlong,
+        one_nanoseconds: jint,
+        two_seconds: jlong,
+        two_nanoseconds: jint,
+        options: jlong,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        stats_scope!("Java_com_temporal_TemporalNative_instantSinceEpochNanosecondsWithOptions");
+        let result = temporal_instant_since_epoch_nanoseconds_with_options(
+            epoch_arg(one_seconds, one_nanoseconds),
+            epoch_arg(two_seconds, two_nanoseconds),
+            options as TemporalRoundingOptions,
+        );
+        temporal_result_to_jstring(&mut env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.instantRoundEpochNanosecondsWithOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_instantRoundEpochNanosecondsWithOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        seconds: jlong,
+        nanoseconds: jint,
+        options: jlong,
+    ) -> jlongArray {
+        stats_scope!("Java_com_temporal_TemporalNative_instantRoundEpochNanosecondsWithOptions");
+        let mut epoch = TemporalEpochNanoseconds::default();
+        let status = temporal_instant_round_epoch_nanoseconds_with_options(
+            epoch_arg(seconds, nanoseconds),
+            options as TemporalRoundingOptions,
+            &mut epoch,
+        );
+        epoch_to_jlong_array(&mut env, status, epoch)
+    }
+
+    /// Shared body of `plainTimeUntilWithOptions` / `plainTimeSinceWithOptions`
+    fn plain_time_difference_with_options_to_jstring(
+        env: &mut JNIEnv,
+        one: &JString,
+        two: &JString,
+        options: jlong,
+        difference: extern "C" fn(*const c_char, *const c_char, TemporalRoundingOptions) -> TemporalResult,
+    ) -> jstring {
+        let (Ok(one), Ok(two)) =
+            (optional_cstring(env, one, "first plain time"), optional_cstring(env, two, "second plain time"))
+        else {
+            return ptr::null_mut();
         };
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(zdt) => {
-                let provider = &*COMPILED_TZ_PROVIDER;
-                match zdt.to_instant().to_ixdtf_string_with_provider(None, Default::default(), &provider) {
-                    Ok(s) => env.new_string(s)
-                        .map(|js| js.into_raw())
-                        .unwrap_or(ptr::null_mut()),
-                    Err(e) => {
-                        throw_range_error(&mut env, &format!("Failed to format instant: {}", e));
-                        ptr::null_mut()
-                    }
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+        let result = difference(cstring_ptr(&one), cstring_ptr(&two), options as TemporalRoundingOptions);
+        temporal_result_to_jstring(env, result)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeUntilWithOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeUntilWithOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        one: JString,
+        two: JString,
+        options: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeUntilWithOptions");
+        plain_time_difference_with_options_to_jstring(&mut env, &one, &two, options, temporal_plain_time_until_with_options)
+    }
+
+    /// JNI function for `com.temporal.TemporalNative.plainTimeSinceWithOptions()`
+    #[no_mangle]
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeSinceWithOptions(
+        mut env: JNIEnv,
+        _class: JClass,
+        one: JString,
+        two: JString,
+        options: jlong,
+    ) -> jstring {
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeSinceWithOptions");
+        plain_time_difference_with_options_to_jstring(&mut env, &one, &two, options, temporal_plain_time_since_with_options)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToPlainDate()`
+    /// JNI function for `com.temporal.TemporalNative.plainTimeRoundWithOptions()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToPlainDate(
+    pub extern "system" fn Java_com_temporal_TemporalNative_plainTimeRoundWithOptions(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
+        options: jlong,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        stats_scope!("Java_com_temporal_TemporalNative_plainTimeRoundWithOptions");
+        let Ok(s) = optional_cstring(&mut env, &s, "plain time string") else {
+            return ptr::null_mut();
         };
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(zdt) => env.new_string(zdt.to_plain_date().to_ixdtf_string(DisplayCalendar::Auto))
-                .map(|js| js.into_raw())
-                .unwrap_or(ptr::null_mut()),
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+        let result = temporal_plain_time_round_with_options(cstring_ptr(&s), options as TemporalRoundingOptions);
+        temporal_result_to_jstring(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToPlainTime()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeRoundWithOptions()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToPlainTime(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeRoundWithOptions(
         mut env: JNIEnv,
         _class: JClass,
         s: JString,
+        options: jlong,
     ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeRoundWithOptions");
+        let Ok(s) = optional_cstring(&mut env, &s, "zoned date time string") else {
+            return ptr::null_mut();
         };
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(zdt) => match zdt.to_plain_time().to_ixdtf_string(ToStringRoundingOptions::default()) {
-                Ok(s) => env.new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain time: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+        let result = temporal_zoned_date_time_round_with_options(cstring_ptr(&s), options as TemporalRoundingOptions);
+        temporal_result_to_jstring(&mut env, result)
     }
 
-    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeToPlainDateTime()`
+    /// JNI function for `com.temporal.TemporalNative.zonedDateTimeHandleRoundWithOptions()`
     #[no_mangle]
-    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeToPlainDateTime(
+    pub extern "system" fn Java_com_temporal_TemporalNative_zonedDateTimeHandleRoundWithOptions(
         mut env: JNIEnv,
         _class: JClass,
-        s: JString,
-    ) -> jstring {
-        let s_str = parse_jstring(&mut env, &s, "zoned date time string");
-        let s_val = match s_str {
-            Some(s) => s,
-            None => return ptr::null_mut(),
-        };
-        match ZonedDateTime::from_utf8(s_val.as_bytes(), Disambiguation::Compatible, OffsetDisambiguation::Reject) {
-            Ok(zdt) => match zdt.to_plain_date_time().to_ixdtf_string(ToStringRoundingOptions::default(), DisplayCalendar::Auto) {
-                Ok(s) => env.new_string(s)
-                    .map(|js| js.into_raw())
-                    .unwrap_or(ptr::null_mut()),
-                Err(e) => {
-                    throw_range_error(&mut env, &format!("Failed to format plain date time: {}", e));
-                    ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                throw_range_error(&mut env, &format!("Invalid zoned date time: {}", e));
-                ptr::null_mut()
-            }
-        }
+        handle: jlong,
+        options: jlong,
+    ) -> jlong {
+        stats_scope!("Java_com_temporal_TemporalNative_zonedDateTimeHandleRoundWithOptions");
+        let result = temporal_zoned_date_time_handle_round_with_options(
+            handle as *const TemporalHandle,
+            options as TemporalRoundingOptions,
+        );
+        handle_result_to_jlong(&mut env, result)
     }
 }
 
@@ -7949,4 +15410,1201 @@ mod tests {
         assert!(error_msg.contains("not-a-duration"), "Error message should include input: {}", error_msg);
         unsafe { temporal_free_result(&mut { result }) };
     }
+
+    // Helper to extract a handle from HandleResult or panic with error message
+    fn extract_handle(mut result: HandleResult) -> *mut TemporalHandle {
+        if result.error_type != TemporalErrorType::None as i32 {
+            let error_msg = if !result.error_message.is_null() {
+                unsafe { std::ffi::CStr::from_ptr(result.error_message) }
+                    .to_string_lossy()
+                    .to_string()
+            } else {
+                "Unknown error".to_string()
+            };
+            unsafe { temporal_free_handle_result(&mut result) };
+            panic!("HandleResult error: {}", error_msg);
+        }
+        result.handle
+    }
+
+    #[test]
+    fn test_handle_instant_chain() {
+        let s = CString::new("2024-01-15T10:30:45Z").unwrap();
+        let d = CString::new("PT1H30M").unwrap();
+        let instant = extract_handle(temporal_instant_handle_from_string(s.as_ptr()));
+        let duration = extract_handle(temporal_duration_handle_from_string(d.as_ptr()));
+        assert_eq!(temporal_handle_kind(instant), TemporalHandleKind::Instant as i32);
+        assert_eq!(temporal_handle_kind(duration), TemporalHandleKind::Duration as i32);
+
+        let added = extract_handle(temporal_instant_handle_add(instant, duration));
+        let back = extract_handle(temporal_instant_handle_subtract(added, duration));
+
+        assert_eq!(extract_result(temporal_handle_to_string(added)), "2024-01-15T12:00:45Z");
+        assert_eq!(extract_result(temporal_handle_to_string(back)), "2024-01-15T10:30:45Z");
+
+        let cmp = temporal_handle_compare(instant, added);
+        assert_eq!(cmp.error_type, TemporalErrorType::None as i32);
+        assert_eq!(cmp.value, -1);
+
+        unsafe {
+            temporal_handle_release(back);
+            temporal_handle_release(added);
+            temporal_handle_release(duration);
+            temporal_handle_release(instant);
+        }
+    }
+
+    #[test]
+    fn test_handle_plain_date_time_with() {
+        let s = CString::new("2024-01-15T10:30:00").unwrap();
+        let dt = extract_handle(temporal_plain_date_time_handle_from_string(s.as_ptr()));
+        let m = i32::MIN;
+        let changed = extract_handle(temporal_plain_date_time_handle_with(
+            dt, m, 3, m, 8, m, m, m, m, m, ptr::null(),
+        ));
+
+        let mut c = PlainDateTimeComponents::default();
+        temporal_plain_date_time_handle_get_components(changed, &mut c);
+        assert_eq!(c.is_valid, 1);
+        assert_eq!((c.year, c.month, c.day, c.hour, c.minute), (2024, 3, 15, 8, 30));
+
+        unsafe {
+            temporal_handle_release(changed);
+            temporal_handle_release(dt);
+        }
+    }
+
+    #[test]
+    fn test_handle_errors() {
+        // NULL handles are TypeErrors
+        let result = temporal_handle_to_string(ptr::null());
+        assert_eq!(result.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_result(&mut { result }) };
+
+        // Wrong kind is a TypeError
+        let s = CString::new("PT1H").unwrap();
+        let duration = extract_handle(temporal_duration_handle_from_string(s.as_ptr()));
+        let mut result = temporal_instant_handle_add(duration, duration);
+        assert_eq!(result.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_handle_result(&mut result) };
+
+        // Mixed kinds can't be compared
+        let i = CString::new("2024-01-15T10:30:45Z").unwrap();
+        let instant = extract_handle(temporal_instant_handle_from_string(i.as_ptr()));
+        let mut cmp = temporal_handle_compare(instant, duration);
+        assert_eq!(cmp.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_compare_result(&mut cmp) };
+
+        // Invalid strings are RangeErrors
+        let bad = CString::new("not-an-instant").unwrap();
+        let mut result = temporal_instant_handle_from_string(bad.as_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        assert!(result.handle.is_null());
+        unsafe { temporal_free_handle_result(&mut result) };
+
+        // Released and made-up handles are TypeErrors, not dereferenced
+        unsafe {
+            assert_eq!(temporal_handle_release(instant), TemporalErrorType::None as i32);
+            assert_eq!(temporal_handle_release(instant), TemporalErrorType::TypeError as i32);
+        }
+        let mut result = temporal_handle_to_string(instant);
+        assert_eq!(result.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+        let mut cmp = temporal_handle_compare(instant, instant);
+        assert_eq!(cmp.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_compare_result(&mut cmp) };
+        assert_eq!(temporal_handle_kind(instant), 0);
+
+        let mut not_a_handle = 0u64;
+        let fake = &mut not_a_handle as *mut u64 as *mut TemporalHandle;
+        let mut result = temporal_instant_handle_add(fake, duration);
+        assert_eq!(result.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_handle_result(&mut result) };
+        let status = temporal_zoned_clock_read(fake, &mut ZonedClockReading::default());
+        assert_eq!(status, TemporalErrorType::TypeError as i32);
+        assert_eq!(unsafe { temporal_handle_release(fake) }, TemporalErrorType::TypeError as i32);
+        assert_eq!(not_a_handle, 0);
+
+        // A value in use outlives a release of its handle
+        let in_use = duration_handle(duration).unwrap();
+        assert_eq!(unsafe { temporal_handle_release(duration) }, TemporalErrorType::None as i32);
+        assert_eq!(in_use.hours(), 1);
+        let mut result = temporal_handle_to_string(duration);
+        assert_eq!(result.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+    }
+
+    #[test]
+    fn test_batch_instant_parse_many() {
+        let inputs: Vec<CString> = ["1970-01-01T00:00:01.25Z", "1969-12-31T23:59:59.5Z"]
+            .iter()
+            .map(|s| CString::new(*s).unwrap())
+            .collect();
+        let ptrs: Vec<*const c_char> = inputs.iter().map(|s| s.as_ptr()).collect();
+        let mut out = vec![TemporalEpochNanoseconds::default(); ptrs.len()];
+
+        let result = temporal_instant_parse_many(ptrs.as_ptr(), ptrs.len() as i32, out.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(result.count, 2);
+        assert_eq!(out[0], TemporalEpochNanoseconds { seconds: 1, nanoseconds: 250_000_000 });
+        // Pre-epoch values floor the seconds and keep the remainder positive
+        assert_eq!(out[1], TemporalEpochNanoseconds { seconds: -1, nanoseconds: 500_000_000 });
+    }
+
+    #[test]
+    fn test_batch_sort_and_compare() {
+        let inputs: Vec<CString> = [
+            "2024-01-15T10:30:00Z",
+            "2024-01-15T09:30:00Z",
+            "2024-01-15T11:30:00+01:00",
+        ]
+        .iter()
+        .map(|s| CString::new(*s).unwrap())
+        .collect();
+        let ptrs: Vec<*const c_char> = inputs.iter().map(|s| s.as_ptr()).collect();
+
+        // Equal instants keep their input order
+        let mut permutation = vec![0i32; ptrs.len()];
+        let result = temporal_instant_sort(ptrs.as_ptr(), ptrs.len() as i32, permutation.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(permutation, vec![1, 0, 2]);
+
+        let rotated = [ptrs[1], ptrs[2], ptrs[0]];
+        let mut order = vec![0i8; ptrs.len()];
+        let result = temporal_instant_compare_many(ptrs.as_ptr(), rotated.as_ptr(), 3, order.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(order, vec![1, -1, 0]);
+
+        let dates: Vec<CString> = ["2024-03-01", "2023-12-31", "2024-01-15"]
+            .iter()
+            .map(|s| CString::new(*s).unwrap())
+            .collect();
+        let date_ptrs: Vec<*const c_char> = dates.iter().map(|s| s.as_ptr()).collect();
+        let result = temporal_plain_date_sort(date_ptrs.as_ptr(), 3, permutation.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(permutation, vec![1, 2, 0]);
+
+        // Extended and negative years order by date, not by their strings
+        let dates: Vec<CString> = ["+010000-01-01", "-000001-12-31", "9999-12-31", "0000-01-01", "-010000-06-15"]
+            .iter()
+            .map(|s| CString::new(*s).unwrap())
+            .collect();
+        let date_ptrs: Vec<*const c_char> = dates.iter().map(|s| s.as_ptr()).collect();
+        let mut permutation = vec![0i32; dates.len()];
+        let result = temporal_plain_date_sort(date_ptrs.as_ptr(), 5, permutation.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(permutation, vec![4, 1, 3, 2, 0]);
+
+        let rotated = [date_ptrs[1], date_ptrs[2], date_ptrs[3], date_ptrs[4], date_ptrs[0]];
+        let mut order = vec![0i8; dates.len()];
+        let result = temporal_plain_date_compare_many(date_ptrs.as_ptr(), rotated.as_ptr(), 5, order.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(order, vec![1, -1, 1, 1, -1]);
+
+        let zoned: Vec<CString> = [
+            "2024-01-15T10:30:00+01:00[Europe/Paris]",
+            "2024-01-15T10:30:00+00:00[UTC]",
+        ]
+        .iter()
+        .map(|s| CString::new(*s).unwrap())
+        .collect();
+        let zoned_ptrs: Vec<*const c_char> = zoned.iter().map(|s| s.as_ptr()).collect();
+        let result = temporal_zoned_date_time_sort(zoned_ptrs.as_ptr(), 2, permutation.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(&permutation[..2], &[0, 1]);
+    }
+
+    #[test]
+    fn test_batch_errors() {
+        let inputs: Vec<CString> = ["2024-01-15T10:30:00Z", "not-an-instant"]
+            .iter()
+            .map(|s| CString::new(*s).unwrap())
+            .collect();
+        let ptrs: Vec<*const c_char> = inputs.iter().map(|s| s.as_ptr()).collect();
+        let mut out = vec![TemporalEpochNanoseconds::default(); ptrs.len()];
+
+        let mut result = temporal_instant_parse_many(ptrs.as_ptr(), 2, out.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        assert_eq!(result.error_index, 1);
+        let message = unsafe { std::ffi::CStr::from_ptr(result.error_message) }.to_str().unwrap();
+        assert!(message.starts_with("Item 1: "));
+        unsafe { temporal_free_batch_result(&mut result) };
+        assert!(result.error_message.is_null());
+
+        let mut result = temporal_instant_sort(ptr::null(), 2, ptr::null_mut());
+        assert_eq!(result.error_type, TemporalErrorType::TypeError as i32);
+        assert_eq!(result.error_index, -1);
+        unsafe { temporal_free_batch_result(&mut result) };
+
+        // Empty batches succeed without touching the buffers
+        let result = temporal_instant_sort(ptr::null(), 0, ptr::null_mut());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(result.count, 0);
+    }
+
+    #[test]
+    fn test_time_zone_cache() {
+        // Other tests share the cache, so only check deltas for a zone nothing else uses
+        let before = temporal_time_zone_cache_stats();
+        let first = resolve_time_zone("America/Argentina/Ushuaia").unwrap();
+        let second = resolve_time_zone("America/Argentina/Ushuaia").unwrap();
+        assert_eq!(first.identifier().unwrap(), second.identifier().unwrap());
+
+        let after = temporal_time_zone_cache_stats();
+        assert!(after.misses >= before.misses + 1);
+        assert!(after.hits >= before.hits + 1);
+        assert!(after.size >= 1);
+
+        // Failed lookups are not cached
+        assert!(resolve_time_zone("Not/A_Zone").is_err());
+        assert!(resolve_time_zone("Not/A_Zone").is_err());
+        assert!(!time_zone_cache().zones.read().unwrap().contains_key("Not/A_Zone"));
+    }
+
+    #[test]
+    fn test_time_zone_get_plain_date_times_for_many() {
+        let tz = CString::new("Europe/Warsaw").unwrap();
+        let epochs = [
+            // 2020-01-01T00:00:00Z (UTC+1)
+            TemporalEpochNanoseconds { seconds: 1_577_836_800, nanoseconds: 0 },
+            // 2020-07-01T12:34:56.789000001Z (UTC+2)
+            TemporalEpochNanoseconds { seconds: 1_593_606_896, nanoseconds: 789_000_001 },
+        ];
+        let mut out = vec![0i32; epochs.len() * PLAIN_DATE_TIME_COLUMN_COUNT];
+
+        let result = temporal_time_zone_get_plain_date_times_for_many(tz.as_ptr(), epochs.as_ptr(), 2, out.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(result.count, 2);
+        // Column-major: [years..., months..., days..., hours..., ...]
+        assert_eq!(&out[0..2], &[2020, 2020]);
+        assert_eq!(&out[2..4], &[1, 7]);
+        assert_eq!(&out[4..6], &[1, 1]);
+        assert_eq!(&out[6..8], &[1, 14]);
+        assert_eq!(&out[12..14], &[0, 789]);
+        assert_eq!(&out[16..18], &[0, 1]);
+
+        let bad = CString::new("Not/A_Zone").unwrap();
+        let mut result = temporal_time_zone_get_plain_date_times_for_many(bad.as_ptr(), epochs.as_ptr(), 2, out.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_batch_result(&mut result) };
+    }
+
+    #[test]
+    fn test_from_string_with_components() {
+        let s = CString::new("2024-02-29T12:34:56.789").unwrap();
+        let mut c = PlainDateTimeComponents::default();
+        let iso = extract_result(temporal_plain_date_time_from_string_with_components(s.as_ptr(), &mut c));
+        assert_eq!(iso, "2024-02-29T12:34:56.789");
+        assert_eq!(c.is_valid, 1);
+        assert_eq!((c.year, c.month, c.day), (2024, 2, 29));
+        assert_eq!((c.hour, c.minute, c.second, c.millisecond), (12, 34, 56, 789));
+        assert_eq!(c.in_leap_year, 1);
+
+        let s = CString::new("2024-03-10").unwrap();
+        let mut d = PlainDateComponents::default();
+        let iso = extract_result(temporal_plain_date_from_string_with_components(s.as_ptr(), &mut d));
+        assert_eq!(iso, "2024-03-10");
+        assert_eq!((d.year, d.month, d.day, d.is_valid), (2024, 3, 10, 1));
+
+        let s = CString::new("2024-01-15T10:30:00+01:00[Europe/Warsaw]").unwrap();
+        let mut z = ZonedDateTimeComponents::default();
+        let iso = extract_result(temporal_zoned_date_time_from_string_with_components(s.as_ptr(), &mut z));
+        assert_eq!(iso, "2024-01-15T10:30:00+01:00[Europe/Warsaw]");
+        assert_eq!((z.hour, z.minute, z.is_valid), (10, 30, 1));
+        assert_eq!(z.offset_nanoseconds, 3_600_000_000_000);
+
+        // Errors leave the components marked invalid
+        let bad = CString::new("not a time").unwrap();
+        let mut t = PlainTimeComponents { is_valid: 1, ..Default::default() };
+        let mut result = temporal_plain_time_from_string_with_components(bad.as_ptr(), &mut t);
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        assert_eq!(t.is_valid, 0);
+        unsafe { temporal_free_result(&mut result) };
+    }
+
+    #[test]
+    fn test_fast_parse_matches_full_parser() {
+        for s in [
+            "1970-01-01T00:00:00Z",
+            "2024-02-29T23:59:59.999999999Z",
+            "2024-01-15T10:30:45.1Z",
+            "1969-12-31T23:59:59.5Z",
+            "0000-03-01T00:00:00Z",
+            "9999-12-31T23:59:59.123Z",
+        ] {
+            let fast = fast_parse_instant(s).unwrap_or_else(|| panic!("fast path rejected {}", s));
+            let full = Instant::from_str(s).unwrap();
+            assert_eq!(fast.epoch_nanoseconds().0, full.epoch_nanoseconds().0, "{}", s);
+        }
+
+        // Non-canonical or invalid shapes are left to the full parser
+        for s in [
+            "2024-01-15T10:30:45+01:00",
+            "2024-01-15t10:30:45Z",
+            "2024-01-15T10:30:45.Z",
+            "2024-01-15T10:30:60Z",
+            "2024-02-30T00:00:00Z",
+            "2024-01-15T10:30:45.1234567890Z",
+            "2024/01/15T10:30:45Z",
+            "+002024-01-15T10:30:45Z",
+        ] {
+            assert!(fast_parse_instant(s).is_none(), "{}", s);
+        }
+
+        assert_eq!(fast_parse_date(b"2024-02-29"), Some((2024, 2, 29)));
+        assert_eq!(fast_parse_date(b"2023-02-29"), None);
+        assert_eq!(fast_parse_date(b"2024-13-01"), None);
+        let date = plain_date_from_str("2024-03-10").unwrap();
+        assert_eq!((date.year(), date.month(), date.day()), (2024, 3, 10));
+        assert!(plain_date_from_str("2023-02-29").is_err());
+    }
+
+    #[test]
+    fn test_format_into_buffers() {
+        let read = |buf: &[c_char], len: usize| {
+            let bytes: Vec<u8> = buf[..len].iter().map(|&c| c as u8).collect();
+            String::from_utf8(bytes).unwrap()
+        };
+
+        // The fast formatter matches temporal_rs output
+        for s in ["2024-01-15T10:30:45.12Z", "1969-12-31T23:59:59.999999999Z", "1970-01-01T00:00:00Z"] {
+            let instant = Instant::from_str(s).unwrap();
+            let provider = &*COMPILED_TZ_PROVIDER;
+            let expected = instant.to_ixdtf_string_with_provider(None, Default::default(), &provider).unwrap();
+            let fast = format_instant_fast(&instant).unwrap();
+            assert_eq!(fast.as_bytes(), expected.as_bytes());
+        }
+
+        let input = CString::new("2024-01-15T10:30:45.120Z").unwrap();
+        let mut buf = [0 as c_char; 64];
+        let mut len = 0usize;
+        let status = temporal_instant_from_string_into(input.as_ptr(), buf.as_mut_ptr(), buf.len(), &mut len);
+        assert_eq!(status, TemporalErrorType::None as i32);
+        assert_eq!(read(&buf, len), "2024-01-15T10:30:45.12Z");
+        assert_eq!(buf[len], 0);
+
+        // Truncated output still reports the full length
+        let mut small = [0 as c_char; 8];
+        let status = temporal_instant_from_string_into(input.as_ptr(), small.as_mut_ptr(), small.len(), &mut len);
+        assert_eq!(status, TemporalErrorType::None as i32);
+        assert_eq!(len, 23);
+        assert_eq!(read(&small, 7), "2024-01");
+        assert_eq!(small[7], 0);
+
+        let duration = CString::new("PT1H").unwrap();
+        let status = temporal_instant_add_into(input.as_ptr(), duration.as_ptr(), buf.as_mut_ptr(), buf.len(), &mut len);
+        assert_eq!(status, TemporalErrorType::None as i32);
+        assert_eq!(read(&buf, len), "2024-01-15T11:30:45.12Z");
+
+        let bad = CString::new("not an instant").unwrap();
+        let status = temporal_instant_from_string_into(bad.as_ptr(), buf.as_mut_ptr(), buf.len(), &mut len);
+        assert_eq!(status, TemporalErrorType::RangeError as i32);
+        let message = unsafe { std::ffi::CStr::from_ptr(temporal_last_error_message()) };
+        assert!(message.to_str().unwrap().contains("not an instant"));
+    }
+
+    #[test]
+    fn test_epoch_nanoseconds_instants() {
+        let mut epoch = TemporalEpochNanoseconds { seconds: 0, nanoseconds: 0 };
+
+        // Negative instants floor the seconds so the remainder stays positive
+        let input = CString::new("1969-12-31T23:59:59.5Z").unwrap();
+        let status = temporal_instant_parse_epoch_nanoseconds(input.as_ptr(), &mut epoch);
+        assert_eq!(status, TemporalErrorType::None as i32);
+        assert_eq!((epoch.seconds, epoch.nanoseconds), (-1, 500_000_000));
+
+        let mut buf = [0 as c_char; 64];
+        let mut len = 0usize;
+        let status = temporal_instant_format_epoch_nanoseconds_into(epoch, buf.as_mut_ptr(), buf.len(), &mut len);
+        assert_eq!(status, TemporalErrorType::None as i32);
+        let formatted = unsafe { std::ffi::CStr::from_ptr(buf.as_ptr()) };
+        assert_eq!(formatted.to_str().unwrap(), "1969-12-31T23:59:59.5Z");
+
+        let smallest = CString::new("second").unwrap();
+        let mut rounded = TemporalEpochNanoseconds { seconds: 0, nanoseconds: 0 };
+        let status = temporal_instant_round_epoch_nanoseconds(epoch, smallest.as_ptr(), 1, ptr::null(), &mut rounded);
+        assert_eq!(status, TemporalErrorType::None as i32);
+        assert_eq!((rounded.seconds, rounded.nanoseconds), (0, 0));
+
+        let later = TemporalEpochNanoseconds { seconds: 3600, nanoseconds: 0 };
+        let until = extract_result(temporal_instant_until_epoch_nanoseconds(
+            rounded,
+            later,
+            ptr::null(),
+            ptr::null(),
+            1,
+            ptr::null(),
+        ));
+        assert_eq!(until, "PT3600S");
+        let since = extract_result(temporal_instant_since_epoch_nanoseconds(
+            rounded,
+            later,
+            ptr::null(),
+            ptr::null(),
+            1,
+            ptr::null(),
+        ));
+        assert_eq!(since, "-PT3600S");
+
+        // The remainder must be normalized
+        let bad = TemporalEpochNanoseconds { seconds: 0, nanoseconds: 1_000_000_000 };
+        let status = temporal_instant_format_epoch_nanoseconds_into(bad, buf.as_mut_ptr(), buf.len(), &mut len);
+        assert_eq!(status, TemporalErrorType::RangeError as i32);
+
+        let status = temporal_instant_now_epoch_nanoseconds(&mut epoch);
+        assert_eq!(status, TemporalErrorType::None as i32);
+        assert!(epoch.seconds > 1_700_000_000);
+    }
+
+    #[test]
+    fn test_expand_recurrence() {
+        let start = CString::new("2024-01-31T09:00:00").unwrap();
+        let duration = CString::new("P1M").unwrap();
+        let tz = CString::new("UTC").unwrap();
+        let mut out = [TemporalEpochNanoseconds::default(); 3];
+        let result =
+            temporal_zoned_date_time_expand_recurrence(start.as_ptr(), duration.as_ptr(), 3, tz.as_ptr(), out.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(result.count, 3);
+
+        // Occurrences are computed from the start, so Feb 29 doesn't pull March back
+        let expected: Vec<i64> = ["2024-01-31T09:00:00Z", "2024-02-29T09:00:00Z", "2024-03-31T09:00:00Z"]
+            .iter()
+            .map(|s| (Instant::from_str(s).unwrap().epoch_nanoseconds().0 / 1_000_000_000) as i64)
+            .collect();
+        let actual: Vec<i64> = out.iter().map(|e| e.seconds).collect();
+        assert_eq!(actual, expected);
+
+        let mut result =
+            temporal_zoned_date_time_expand_recurrence(start.as_ptr(), duration.as_ptr(), -1, tz.as_ptr(), out.as_mut_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_batch_result(&mut result) };
+    }
+
+    #[test]
+    fn test_zoned_date_time_range() {
+        let start = CString::new("2024-03-09T12:00:00-05:00[America/New_York]").unwrap();
+        let end = CString::new("2024-03-12T12:00:00-04:00[America/New_York]").unwrap();
+        let day = CString::new("P1D").unwrap();
+        let hours = CString::new("PT24H").unwrap();
+        let mut out = [TemporalEpochNanoseconds::default(); 2];
+        let start_s = Instant::from_str("2024-03-09T17:00:00Z").unwrap().epoch_nanoseconds().0 / 1_000_000_000;
+
+        // Calendar steps keep the wall-clock time across the DST change
+        let range = extract_handle(temporal_zoned_date_time_range_new(start.as_ptr(), day.as_ptr(), end.as_ptr()));
+        unsafe {
+            let mut seconds = Vec::new();
+            loop {
+                let result = temporal_zoned_date_time_range_next_batch(range, out.as_mut_ptr(), 2);
+                assert_eq!(result.error_type, TemporalErrorType::None as i32);
+                if result.count == 0 {
+                    break;
+                }
+                seconds.extend(out[..result.count as usize].iter().map(|e| e.seconds as i128 - start_s));
+            }
+            assert_eq!(seconds, vec![0, 86_400 - 3_600, 2 * 86_400 - 3_600]);
+            temporal_handle_release(range);
+        }
+
+        // Exact steps ignore the time zone; no end means unbounded
+        let range = extract_handle(temporal_zoned_date_time_range_new(start.as_ptr(), hours.as_ptr(), ptr::null()));
+        unsafe {
+            let result = temporal_zoned_date_time_range_next_batch(range, out.as_mut_ptr(), 2);
+            assert_eq!(result.count, 2);
+            let result = temporal_zoned_date_time_range_next_batch(range, out.as_mut_ptr(), 2);
+            assert_eq!(result.count, 2);
+            assert_eq!(out[1].seconds as i128 - start_s, 3 * 86_400);
+            temporal_handle_release(range);
+        }
+
+        // Occurrences read through the cached transition window match adding
+        // each step to the start, across a skipped and a repeated 02:30
+        let start = CString::new("2024-03-01T02:30:00+01:00[Europe/Berlin]").unwrap();
+        let step = CString::new("P1DT30M").unwrap();
+        let range = extract_handle(temporal_zoned_date_time_range_new(start.as_ptr(), step.as_ptr(), ptr::null()));
+        let mut out = [TemporalEpochNanoseconds::default(); 300];
+        let result = unsafe { temporal_zoned_date_time_range_next_batch(range, out.as_mut_ptr(), 300) };
+        assert_eq!(result.count, 300);
+        let first = parse_zoned_date_time(start.as_ptr(), "start").ok().unwrap();
+        let step = Duration::from_str("P1DT30M").unwrap();
+        for (i, occurrence) in out.iter().enumerate() {
+            let expected = first.add(&scale_duration(&step, i as i64).ok().unwrap(), Some(Overflow::Constrain)).unwrap();
+            assert_eq!(*occurrence, TemporalEpochNanoseconds::from_i128(expected.epoch_nanoseconds().0), "{}", i);
+        }
+        unsafe { temporal_handle_release(range) };
+
+        let zero = CString::new("PT0S").unwrap();
+        let mut result = temporal_zoned_date_time_range_new(start.as_ptr(), zero.as_ptr(), ptr::null());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_handle_result(&mut result) };
+    }
+
+    #[test]
+    fn test_time_zone_transitions() {
+        let tz = CString::new("America/New_York").unwrap();
+        let instant = CString::new("2024-01-01T00:00:00Z").unwrap();
+        assert_eq!(
+            extract_result(temporal_time_zone_get_next_transition(tz.as_ptr(), instant.as_ptr())),
+            "2024-03-10T07:00:00Z"
+        );
+        assert_eq!(
+            extract_result(temporal_time_zone_get_previous_transition(tz.as_ptr(), instant.as_ptr())),
+            "2023-11-05T06:00:00Z"
+        );
+        let summer = CString::new("2024-07-01T00:00:00Z").unwrap();
+        assert_eq!(
+            extract_result(temporal_time_zone_get_offset_nanoseconds_for(tz.as_ptr(), summer.as_ptr())),
+            "-14400000000000"
+        );
+
+        // Paging with a small cap visits every transition of the year once
+        let epoch = |s: &str| TemporalEpochNanoseconds::from_instant(&Instant::from_str(s).unwrap());
+        let end = epoch("2025-01-01T00:00:00Z");
+        let mut start = epoch("2024-03-10T07:00:00Z");
+        let mut out = [TemporalEpochNanoseconds::default(); 1];
+        let mut found = Vec::new();
+        loop {
+            let result = temporal_time_zone_get_transitions(tz.as_ptr(), start, end, out.as_mut_ptr(), 1);
+            assert_eq!(result.error_type, TemporalErrorType::None as i32);
+            if result.count == 0 {
+                break;
+            }
+            found.push(out[0].seconds);
+            start = TemporalEpochNanoseconds::from_i128(out[0].seconds as i128 * 1_000_000_000 + 1);
+        }
+        assert_eq!(found, vec![epoch("2024-03-10T07:00:00Z").seconds, epoch("2024-11-03T06:00:00Z").seconds]);
+
+        let utc = CString::new("UTC").unwrap();
+        assert_eq!(extract_result(temporal_time_zone_get_next_transition(utc.as_ptr(), instant.as_ptr())), "");
+    }
+
+    #[test]
+    fn test_stats() {
+        assert_eq!(temporal_stats_snapshot(ptr::null_mut()), TemporalErrorType::TypeError as i32);
+
+        let mut before = TemporalStats::default();
+        assert_eq!(temporal_stats_snapshot(&mut before), 0);
+        if !cfg!(feature = "stats") {
+            assert_eq!(before, TemporalStats::default());
+            let json = extract_result(temporal_stats_to_json());
+            assert!(json.starts_with("{\"enabled\":false,"), "{}", json);
+            return;
+        }
+
+        let valid = CString::new("PT1H").unwrap();
+        let invalid = CString::new("not a duration").unwrap();
+        extract_result(temporal_duration_from_string(valid.as_ptr()));
+        let mut error = temporal_duration_from_string(invalid.as_ptr());
+        assert_eq!(error.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_result(&mut error) };
+
+        // Other tests run concurrently, so only lower bounds hold.
+        let mut after = TemporalStats::default();
+        temporal_stats_snapshot(&mut after);
+        assert_eq!(after.enabled, 1);
+        assert!(after.calls >= before.calls + 2);
+        assert!(after.parse_count >= before.parse_count + 2);
+        assert!(after.format_count > before.format_count);
+        assert!(after.error_count > before.error_count);
+        assert!(after.allocation_bytes > before.allocation_bytes);
+
+        let json = extract_result(temporal_stats_to_json());
+        assert!(json.starts_with("{\"enabled\":true,"), "{}", json);
+        assert!(json.contains("\"temporal_duration_from_string\":{\"calls\":"), "{}", json);
+    }
+    #[test]
+    fn test_validate() {
+        let last_message = || unsafe { std::ffi::CStr::from_ptr(temporal_last_error_message()) }
+            .to_string_lossy()
+            .into_owned();
+
+        let valid = CString::new("2024-02-29").unwrap();
+        let invalid = CString::new("2023-02-29").unwrap();
+        let kind = TemporalValueKind::PlainDate as i32;
+        assert_eq!(temporal_validate(kind, valid.as_ptr()), TemporalErrorType::None as i32);
+        assert_eq!(temporal_validate(kind, invalid.as_ptr()), TemporalErrorType::RangeError as i32);
+        assert!(last_message().starts_with("Invalid plain date '2023-02-29'"), "{}", last_message());
+        assert_eq!(temporal_validate(kind, ptr::null()), TemporalErrorType::TypeError as i32);
+        assert_eq!(last_message(), "plain date string cannot be null");
+
+        let zdt = CString::new("2024-03-10T02:30:00-05:00[America/New_York]").unwrap();
+        let kind = TemporalValueKind::ZonedDateTime as i32;
+        assert_eq!(temporal_validate(kind, zdt.as_ptr()), TemporalErrorType::RangeError as i32);
+        let instant = CString::new("2024-03-10T07:30:00Z").unwrap();
+        assert_eq!(temporal_validate(TemporalValueKind::Instant as i32, instant.as_ptr()), 0);
+
+        assert_eq!(temporal_validate(99, valid.as_ptr()), TemporalErrorType::RangeError as i32);
+        assert_eq!(last_message(), "Unknown value kind 99");
+    }
+    #[test]
+    fn test_binary_round_trip() {
+        let mut bytes = [0u8; TEMPORAL_BINARY_SIZE];
+        let zdt = CString::new("2024-03-10T03:30:00-04:00[America/New_York][u-ca=japanese]").unwrap();
+        assert_eq!(temporal_zoned_date_time_to_bytes(zdt.as_ptr(), bytes.as_mut_ptr()), 0);
+        assert_eq!(bytes[0], TEMPORAL_BINARY_VERSION);
+        assert_eq!(bytes[1], BINARY_KIND_ZONED_DATE_TIME);
+        assert_eq!(CALENDAR_TAGS[bytes[2] as usize], "japanese");
+        assert_eq!(bytes[3], BINARY_ZONE_IANA);
+        let decoded = extract_result(temporal_zoned_date_time_from_bytes(bytes.as_ptr()));
+        assert_eq!(decoded, "2024-03-10T03:30:00-04:00[America/New_York][u-ca=japanese]");
+
+        let offset = CString::new("1969-12-31T23:00:00.5-05:30[-05:30]").unwrap();
+        assert_eq!(temporal_zoned_date_time_to_bytes(offset.as_ptr(), bytes.as_mut_ptr()), 0);
+        assert_eq!(bytes[3], BINARY_ZONE_OFFSET);
+        let decoded = extract_result(temporal_zoned_date_time_from_bytes(bytes.as_ptr()));
+        assert_eq!(decoded, "1969-12-31T23:00:00.5-05:30[-05:30]");
+
+        let instant = CString::new("1969-07-20T20:17:40.123456789Z").unwrap();
+        assert_eq!(temporal_instant_to_bytes(instant.as_ptr(), bytes.as_mut_ptr()), 0);
+        assert_eq!(&bytes[..4], &[TEMPORAL_BINARY_VERSION, BINARY_KIND_INSTANT, 0, BINARY_ZONE_NONE]);
+        assert_eq!(extract_result(temporal_instant_from_bytes(bytes.as_ptr())), "1969-07-20T20:17:40.123456789Z");
+
+        let mut result = temporal_zoned_date_time_from_bytes(bytes.as_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::TypeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+        bytes[20] = 1;
+        let mut result = temporal_instant_from_bytes(bytes.as_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+
+        let inputs = [
+            CString::new("2024-01-01T00:00:00+00:00[UTC]").unwrap(),
+            CString::new("2024-06-01T12:00:00+09:00[Asia/Tokyo]").unwrap(),
+        ];
+        let ptrs: Vec<*const c_char> = inputs.iter().map(|s| s.as_ptr()).collect();
+        let mut out = vec![0u8; inputs.len() * TEMPORAL_BINARY_SIZE];
+        let result = temporal_zoned_date_time_to_bytes_many(ptrs.as_ptr(), ptrs.len() as i32, out.as_mut_ptr());
+        assert_eq!((result.count, result.error_type), (2, 0));
+        assert_eq!(&out[4..8], &0u32.to_le_bytes());
+        let second = extract_result(temporal_zoned_date_time_from_bytes(out[TEMPORAL_BINARY_SIZE..].as_ptr()));
+        assert_eq!(second, "2024-06-01T12:00:00+09:00[Asia/Tokyo]");
+    }
+    #[test]
+    fn test_instant_parse_stream() {
+        let parse = |input: &str, format: TemporalStreamFormat, last_chunk: i32, cap: usize| {
+            let mut out = vec![TemporalEpochNanoseconds::default(); cap];
+            let mut errors = vec![-1i8; cap];
+            let mut consumed = 0usize;
+            let mut result = temporal_instant_parse_stream(
+                input.as_ptr(),
+                input.len(),
+                format as i32,
+                last_chunk,
+                out.as_mut_ptr(),
+                errors.as_mut_ptr(),
+                cap as i32,
+                &mut consumed,
+            );
+            assert_eq!(result.error_type, 0);
+            unsafe { temporal_free_batch_result(&mut result) };
+            let n = result.count as usize;
+            (out[..n].iter().map(|e| e.seconds).collect::<Vec<_>>(), errors[..n].to_vec(), consumed)
+        };
+
+        let lines = "1970-01-01T00:00:01Z\r\n\n 2024-13-01T00:00:00Z \n1970-01-01T00:00:03Z\n1970-01-01T00:";
+        let (seconds, errors, consumed) = parse(lines, TemporalStreamFormat::Lines, 0, 8);
+        assert_eq!((seconds, errors), (vec![1, 0, 3], vec![0, 1, 0]));
+        assert_eq!(&lines[consumed..], "1970-01-01T00:");
+
+        let json = r#"["1969-12-31T23:59:59.5Z", null, "1970-01-01T00:00:02Z"]"#;
+        let (seconds, errors, consumed) = parse(json, TemporalStreamFormat::JsonArray, 1, 8);
+        assert_eq!((seconds, errors), (vec![-1, 0, 2], vec![0, 2, 0]));
+        assert_eq!(consumed, json.len() - 1);
+        let (seconds, _, consumed) = parse(json, TemporalStreamFormat::JsonArray, 1, 1);
+        assert_eq!((seconds, &json[consumed..consumed + 1]), (vec![-1], ","));
+
+        let counted = temporal_instant_parse_stream(
+            json.as_ptr(),
+            json.len(),
+            TemporalStreamFormat::JsonArray as i32,
+            1,
+            ptr::null_mut(),
+            ptr::null_mut(),
+            0,
+            ptr::null_mut(),
+        );
+        assert_eq!(counted.count, 3);
+
+        let mut out = [TemporalEpochNanoseconds::default(); 3];
+        let mut result = temporal_instant_parse_stream(
+            json.as_ptr(),
+            json.len(),
+            TemporalStreamFormat::JsonArray as i32,
+            1,
+            out.as_mut_ptr(),
+            ptr::null_mut(),
+            3,
+            ptr::null_mut(),
+        );
+        assert_eq!((result.error_index, result.error_type), (1, TemporalErrorType::TypeError as i32));
+        unsafe { temporal_free_batch_result(&mut result) };
+    }
+    #[test]
+    fn test_interned_identifiers() {
+        let intern_zone = |s: &str| {
+            let s = CString::new(s).unwrap();
+            let mut id = u32::MAX;
+            assert_eq!(temporal_intern_time_zone(s.as_ptr(), &mut id), 0);
+            id
+        };
+        let new_york = intern_zone("America/New_York");
+        assert_eq!(intern_zone("America/New_York"), new_york);
+        assert_ne!(intern_zone("Europe/Paris"), new_york);
+        assert_eq!(extract_result(temporal_interned_time_zone_identifier(new_york)), "America/New_York");
+
+        let japanese = CString::new("japanese").unwrap();
+        let mut calendar = u32::MAX;
+        assert_eq!(temporal_intern_calendar(japanese.as_ptr(), &mut calendar), 0);
+        assert_eq!(extract_result(temporal_interned_calendar_identifier(calendar)), "japanese");
+
+        let instant = CString::new("2024-07-01T12:00:00Z").unwrap();
+        let offset = extract_result(temporal_time_zone_get_offset_nanoseconds_for_interned(new_york, instant.as_ptr()));
+        assert_eq!(offset, "-14400000000000");
+        let epoch = TemporalEpochNanoseconds { seconds: 1_719_835_200, nanoseconds: 0 };
+        let zdt = extract_result(temporal_instant_to_zoned_date_time_interned(epoch, calendar, new_york));
+        assert_eq!(zdt, "2024-07-01T08:00:00-04:00[America/New_York][u-ca=japanese]");
+
+        let mut result = temporal_time_zone_get_offset_string_for_interned(u32::MAX, instant.as_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+        let invalid = CString::new("Mars/Olympus_Mons").unwrap();
+        let mut id = 0;
+        assert_eq!(temporal_intern_time_zone(invalid.as_ptr(), &mut id), TemporalErrorType::RangeError as i32);
+    }
+    #[test]
+    fn test_to_string_with_options() {
+        let instant = CString::new("2024-07-01T12:34:56.789123456Z").unwrap();
+        let minute = CString::new("minute").unwrap();
+        let floor = CString::new("floor").unwrap();
+        let ceil = CString::new("ceil").unwrap();
+        let never = CString::new("never").unwrap();
+        let none = ptr::null();
+        assert_eq!(
+            extract_result(temporal_instant_to_string_with_options(instant.as_ptr(), 3, none, floor.as_ptr())),
+            "2024-07-01T12:34:56.789Z"
+        );
+        assert_eq!(
+            extract_result(temporal_instant_to_string_with_options(instant.as_ptr(), -1, minute.as_ptr(), ceil.as_ptr())),
+            "2024-07-01T12:35Z"
+        );
+        assert_eq!(
+            extract_result(temporal_instant_to_string_with_options(instant.as_ptr(), 0, none, none)),
+            "2024-07-01T12:34:56Z"
+        );
+
+        let time = CString::new("08:30:15.5").unwrap();
+        assert_eq!(extract_result(temporal_plain_time_to_string_with_options(time.as_ptr(), 2, none, none)), "08:30:15.50");
+
+        let dt = CString::new("2024-07-01T08:30:15[u-ca=japanese]").unwrap();
+        assert_eq!(
+            extract_result(temporal_plain_date_time_to_string_with_options(dt.as_ptr(), -1, minute.as_ptr(), none, never.as_ptr())),
+            "2024-07-01T08:30"
+        );
+
+        let zdt = CString::new("2024-07-01T08:30:15-04:00[America/New_York]").unwrap();
+        assert_eq!(
+            extract_result(temporal_zoned_date_time_to_string_with_options(
+                zdt.as_ptr(),
+                -1,
+                none,
+                none,
+                none,
+                never.as_ptr(),
+                never.as_ptr(),
+            )),
+            "2024-07-01T08:30:15"
+        );
+
+        let mut result = temporal_plain_time_to_string_with_options(time.as_ptr(), 10, none, none);
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+        let mut result = temporal_zoned_date_time_to_string_with_options(zdt.as_ptr(), -1, none, none, none, none, ceil.as_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+    }
+    #[test]
+    fn test_to_string_with_packed_options() {
+        let minute = CString::new("minute").unwrap();
+        let ceil = CString::new("ceil").unwrap();
+        let never = CString::new("never").unwrap();
+        let critical = CString::new("critical").unwrap();
+        let none = ptr::null();
+        let mut defaults = u64::MAX;
+        assert_eq!(temporal_to_string_options_new(-1, none, none, none, none, none, &mut defaults), 0);
+        assert_eq!(defaults, 0);
+        let mut millis = 0;
+        assert_eq!(temporal_to_string_options_new(3, none, ceil.as_ptr(), none, none, none, &mut millis), 0);
+        let mut minutes = 0;
+        assert_eq!(
+            temporal_to_string_options_new(-1, minute.as_ptr(), none, never.as_ptr(), never.as_ptr(), never.as_ptr(), &mut minutes),
+            0
+        );
+
+        let instant = CString::new("2024-07-01T12:34:56.789123456Z").unwrap();
+        assert_eq!(
+            extract_result(temporal_instant_to_string_with_packed_options(instant.as_ptr(), millis)),
+            "2024-07-01T12:34:56.790Z"
+        );
+        assert_eq!(
+            extract_result(temporal_instant_to_string_with_packed_options(instant.as_ptr(), defaults)),
+            "2024-07-01T12:34:56.789123456Z"
+        );
+        let time = CString::new("08:30:15.5").unwrap();
+        assert_eq!(extract_result(temporal_plain_time_to_string_with_packed_options(time.as_ptr(), minutes)), "08:30");
+        let dt = CString::new("2024-07-01T08:30:15[u-ca=japanese]").unwrap();
+        assert_eq!(
+            extract_result(temporal_plain_date_time_to_string_with_packed_options(dt.as_ptr(), minutes)),
+            "2024-07-01T08:30"
+        );
+        let zdt = CString::new("2024-07-01T08:30:15-04:00[America/New_York]").unwrap();
+        assert_eq!(
+            extract_result(temporal_zoned_date_time_to_string_with_packed_options(zdt.as_ptr(), minutes)),
+            "2024-07-01T08:30"
+        );
+        assert_eq!(
+            extract_result(temporal_zoned_date_time_to_string_with_packed_options(zdt.as_ptr(), defaults)),
+            extract_result(temporal_zoned_date_time_to_string_with_options(zdt.as_ptr(), -1, none, none, none, none, none))
+        );
+        let mut annotated = 0;
+        assert_eq!(
+            temporal_to_string_options_new(-1, none, none, critical.as_ptr(), critical.as_ptr(), none, &mut annotated),
+            0
+        );
+        assert_eq!(
+            extract_result(temporal_zoned_date_time_to_string_with_packed_options(zdt.as_ptr(), annotated)),
+            extract_result(temporal_zoned_date_time_to_string_with_options(
+                zdt.as_ptr(),
+                -1,
+                none,
+                none,
+                critical.as_ptr(),
+                critical.as_ptr(),
+                none,
+            ))
+        );
+
+        let mut out = 0;
+        assert_eq!(
+            temporal_to_string_options_new(10, none, none, none, none, none, &mut out),
+            TemporalErrorType::RangeError as i32
+        );
+        assert_eq!(
+            temporal_to_string_options_new(-1, none, none, none, none, ceil.as_ptr(), &mut out),
+            TemporalErrorType::RangeError as i32
+        );
+        assert_eq!(
+            temporal_to_string_options_new(-1, none, none, none, none, none, ptr::null_mut()),
+            TemporalErrorType::TypeError as i32
+        );
+        for invalid in [11, 0xf << 4, 0xf << 8, 5 << 12, 4 << 16, 3 << 20, 1 << 24] {
+            let mut result = temporal_instant_to_string_with_packed_options(instant.as_ptr(), invalid);
+            assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+            unsafe { temporal_free_result(&mut result) };
+        }
+    }
+    #[test]
+    fn test_rounding_options() {
+        let new_options = |largest: Option<&str>, smallest: Option<&str>, increment: i64, mode: Option<&str>| {
+            let (largest, smallest, mode) = (
+                largest.map(|s| CString::new(s).unwrap()),
+                smallest.map(|s| CString::new(s).unwrap()),
+                mode.map(|s| CString::new(s).unwrap()),
+            );
+            let as_ptr = |s: &Option<CString>| s.as_ref().map_or(ptr::null(), |s| s.as_ptr());
+            let mut out = 0;
+            let status =
+                temporal_rounding_options_new(as_ptr(&largest), as_ptr(&smallest), increment, as_ptr(&mode), &mut out);
+            (status, out)
+        };
+
+        let (status, hours) = new_options(Some("hour"), Some("minute"), 15, Some("floor"));
+        assert_eq!(status, 0);
+        assert_eq!(
+            PackedRoundingOptions::unpack(hours).unwrap(),
+            PackedRoundingOptions {
+                largest_unit: Some(Unit::Hour),
+                smallest_unit: Some(Unit::Minute),
+                rounding_mode: Some(RoundingMode::Floor),
+                increment: 15,
+            }
+        );
+        let one = TemporalEpochNanoseconds { seconds: 0, nanoseconds: 0 };
+        let two = TemporalEpochNanoseconds { seconds: 90_061, nanoseconds: 0 };
+        assert_eq!(extract_result(temporal_instant_until_epoch_nanoseconds_with_options(one, two, hours)), "PT25H");
+        let one_str = CString::new("08:00").unwrap();
+        let two_str = CString::new("10:31:59").unwrap();
+        assert_eq!(
+            extract_result(temporal_plain_time_until_with_options(one_str.as_ptr(), two_str.as_ptr(), hours)),
+            "PT2H30M"
+        );
+        assert_eq!(
+            extract_result(temporal_plain_time_round_with_options(two_str.as_ptr(), hours)),
+            "10:30:00"
+        );
+
+        let (_, defaults) = new_options(None, None, 0, None);
+        let mut out = TemporalEpochNanoseconds::default();
+        assert_eq!(temporal_instant_round_epoch_nanoseconds_with_options(two, defaults, &mut out), TemporalErrorType::TypeError as i32);
+        let (_, seconds) = new_options(None, Some("second"), 1, None);
+        assert_eq!(extract_result(temporal_instant_until_epoch_nanoseconds_with_options(one, two, seconds)), "PT90061S");
+
+        assert_eq!(new_options(None, Some("fortnight"), 1, None).0, TemporalErrorType::RangeError as i32);
+        assert_eq!(new_options(None, Some("second"), 2_000_000_000, None).0, TemporalErrorType::RangeError as i32);
+        let mut result = temporal_instant_until_epoch_nanoseconds_with_options(one, two, 0xfff);
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_result(&mut result) };
+    }
+
+    #[test]
+    fn test_concurrent_use() {
+        let zones = ["Asia/Kathmandu", "Pacific/Chatham", "Africa/Casablanca", "Europe/Warsaw"];
+        let instant = CString::new("2024-07-01T12:00:00Z").unwrap();
+        let expected: Vec<String> = zones
+            .iter()
+            .map(|zone| {
+                let zone = CString::new(*zone).unwrap();
+                extract_result(temporal_time_zone_get_offset_nanoseconds_for(zone.as_ptr(), instant.as_ptr()))
+            })
+            .collect();
+        let inputs: Vec<CString> = ["2024-03-01T00:00:00Z", "2020-01-01T00:00:00Z", "2022-06-15T12:00:00Z"]
+            .iter()
+            .map(|s| CString::new(*s).unwrap())
+            .collect();
+
+        // Each thread stands in for a JS runtime: the same zones resolved,
+        // interned and queried at once must give the single-threaded answers.
+        std::thread::scope(|scope| {
+            for t in 0..8 {
+                let (expected, instant, inputs) = (&expected, &instant, &inputs);
+                scope.spawn(move || {
+                    let pointers: Vec<*const c_char> = inputs.iter().map(|s| s.as_ptr()).collect();
+                    for round in 0..50 {
+                        let i = (t + round) % zones.len();
+                        let zone = CString::new(zones[i]).unwrap();
+                        let mut id = u32::MAX;
+                        assert_eq!(temporal_intern_time_zone(zone.as_ptr(), &mut id), 0);
+                        let by_id = temporal_time_zone_get_offset_nanoseconds_for_interned(id, instant.as_ptr());
+                        assert_eq!(extract_result(by_id), expected[i]);
+                        let by_name = temporal_time_zone_get_offset_nanoseconds_for(zone.as_ptr(), instant.as_ptr());
+                        assert_eq!(extract_result(by_name), expected[i]);
+
+                        let mut order = [0i32; 3];
+                        let result = temporal_instant_sort(pointers.as_ptr(), 3, order.as_mut_ptr());
+                        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+                        assert_eq!(order, [1, 2, 0]);
+                    }
+                });
+            }
+        });
+
+        // A thread-local copy from an older generation is dropped, not served.
+        let key = "Test/Stale".to_string();
+        let utc = resolve_time_zone("UTC").unwrap();
+        with_local_time_zone_cache(u64::MAX - 1, |local| local.zones.insert(key.clone(), utc));
+        assert!(with_local_time_zone_cache(u64::MAX, |local| local.zones.get(&key).is_none()));
+
+        // Scratch buffers are not aliased by nested use.
+        with_scratch(&EPOCH_SCRATCH, |outer| {
+            outer.push(1);
+            with_scratch(&EPOCH_SCRATCH, |inner| {
+                assert!(inner.is_empty());
+                inner.push(2);
+            });
+            assert_eq!(outer, &[1]);
+        });
+    }
+
+    #[test]
+    fn test_parallel_batches() {
+        let mut inputs: Vec<CString> = (0..10_000)
+            .map(|i| CString::new(format!("1970-01-01T{:02}:{:02}:{:02}Z", i / 3_600, i / 60 % 60, i % 60)).unwrap())
+            .collect();
+        let parse = |inputs: &[CString]| {
+            let ptrs: Vec<*const c_char> = inputs.iter().map(|s| s.as_ptr()).collect();
+            let mut out = vec![TemporalEpochNanoseconds::default(); ptrs.len()];
+            let mut result = temporal_instant_parse_many(ptrs.as_ptr(), ptrs.len() as i32, out.as_mut_ptr());
+            let outcome = (result.count, result.error_index);
+            unsafe { temporal_free_batch_result(&mut result) };
+            (outcome, out)
+        };
+        let start = CString::new("2024-01-31T09:00:00").unwrap();
+        let duration = CString::new("PT1H").unwrap();
+        let tz = CString::new("Europe/Berlin").unwrap();
+        let expand = || {
+            let mut out = vec![TemporalEpochNanoseconds::default(); 6_000];
+            let result = temporal_zoned_date_time_expand_recurrence(
+                start.as_ptr(),
+                duration.as_ptr(),
+                6_000,
+                tz.as_ptr(),
+                out.as_mut_ptr(),
+            );
+            assert_eq!(result.error_type, TemporalErrorType::None as i32);
+            out
+        };
+
+        // Other tests may run batches meanwhile; every setting gives the same results.
+        assert_eq!(temporal_set_batch_threads(1), 0);
+        let (serial_outcome, serial) = parse(&inputs);
+        let serial_occurrences = expand();
+        assert_eq!(temporal_set_batch_threads(4), 0);
+        assert_eq!(temporal_get_batch_threads(), 4);
+        let (outcome, parallel) = parse(&inputs);
+        assert_eq!((outcome, &parallel), (serial_outcome, &serial));
+        assert!(parallel.iter().enumerate().all(|(i, e)| e.seconds == i as i64));
+        assert_eq!(expand(), serial_occurrences);
+
+        // The reported failure is the first one, wherever the workers hit it.
+        inputs[9_000] = CString::new("not an instant").unwrap();
+        inputs[7_000] = CString::new("not an instant").unwrap();
+        assert_eq!(parse(&inputs).0, (0, 7_000));
+
+        assert_eq!(temporal_set_batch_threads(MAX_BATCH_THREADS + 1), TemporalErrorType::RangeError as i32);
+        assert_eq!(temporal_set_batch_threads(0), 0);
+        assert!(temporal_get_batch_threads() >= 1);
+    }
+
+    #[test]
+    fn test_columns() {
+        let epoch = |s: &str| TemporalEpochNanoseconds::from_instant(&Instant::from_str(s).unwrap());
+        let strings: Vec<CString> = [
+            "2024-03-31T12:00:00Z",
+            "2024-03-30T22:30:00Z",
+            "2024-03-30T23:30:00Z",
+            "2024-04-02T08:00:00Z",
+            "2024-03-30T10:00:00Z",
+        ]
+        .iter()
+        .map(|s| CString::new(*s).unwrap())
+        .collect();
+        let ptrs: Vec<*const c_char> = strings.iter().map(|s| s.as_ptr()).collect();
+        let column = extract_handle(temporal_instant_column_from_strings(ptrs.as_ptr(), 5));
+        assert_eq!(temporal_handle_kind(column), TemporalHandleKind::InstantColumn as i32);
+
+        let mut value = -1;
+        assert_eq!(temporal_column_length(column, &mut value), 0);
+        assert_eq!(value, 5);
+        assert_eq!(temporal_instant_column_lower_bound(column, epoch("2024-03-30T23:00:00Z"), &mut value), 0);
+        assert_eq!(value, 2);
+        let (start, end) = (epoch("2024-03-30T00:00:00Z"), epoch("2024-03-31T00:00:00Z"));
+        assert_eq!(temporal_instant_column_range_count(column, start, end, &mut value), 0);
+        assert_eq!(value, 3);
+
+        // Slices share the values and clamp their bounds
+        let slice = extract_handle(temporal_column_slice(column, 1, 100));
+        let mut out = [TemporalEpochNanoseconds::default(); 4];
+        let result = temporal_instant_column_read(slice, 0, 4, out.as_mut_ptr());
+        assert_eq!(result.count, 4);
+        assert_eq!(out[0], epoch("2024-03-30T22:30:00Z"));
+        assert_eq!(out[3], epoch("2024-04-02T08:00:00Z"));
+
+        // Paris moves to UTC+2 early on 2024-03-31: 22:30Z and 23:30Z fall on
+        // different local days, and April days start at 22:00Z.
+        let unit = CString::new("day").unwrap();
+        let tz = CString::new("Europe/Paris").unwrap();
+        let mut starts = [TemporalEpochNanoseconds::default(); 5];
+        let mut counts = [0i32; 5];
+        let result =
+            temporal_instant_column_bucket_by(column, unit.as_ptr(), tz.as_ptr(), starts.as_mut_ptr(), counts.as_mut_ptr(), 5);
+        assert_eq!(result.error_type, TemporalErrorType::None as i32);
+        assert_eq!(result.count, 3);
+        assert_eq!(&counts[..3], &[2, 2, 1]);
+        assert_eq!(starts[0], epoch("2024-03-29T23:00:00Z"));
+        assert_eq!(starts[1], epoch("2024-03-30T23:00:00Z"));
+        assert_eq!(starts[2], epoch("2024-04-01T22:00:00Z"));
+
+        // Sao Paulo skipped midnight on 2018-11-04 and repeated the hour
+        // before it on 2019-02-16.
+        let index = transition_index(&resolve_time_zone("America/Sao_Paulo").unwrap()).unwrap();
+        let day = |y, m, d| days_from_civil(y, m, d);
+        let ns = |s: &str| Instant::from_str(s).unwrap().epoch_nanoseconds().0;
+        assert_eq!(index.start_of_day(day(2018, 11, 3)).unwrap(), ns("2018-11-03T03:00:00Z"));
+        assert_eq!(index.start_of_day(day(2018, 11, 4)).unwrap(), ns("2018-11-04T03:00:00Z"));
+        assert_eq!(index.start_of_day(day(2018, 11, 5)).unwrap(), ns("2018-11-05T02:00:00Z"));
+        assert_eq!(index.start_of_day(day(2019, 2, 16)).unwrap(), ns("2019-02-16T02:00:00Z"));
+        assert_eq!(index.start_of_day(day(2019, 2, 17)).unwrap(), ns("2019-02-17T03:00:00Z"));
+
+        let dates: Vec<CString> = ["2024-02-29", "2024-01-31", "2024-03-04", "2024-03-03", "2024-02-01[u-ca=japanese]"]
+            .iter()
+            .map(|s| CString::new(*s).unwrap())
+            .collect();
+        let ptrs: Vec<*const c_char> = dates.iter().map(|s| s.as_ptr()).collect();
+        let dates = extract_handle(temporal_plain_date_column_from_strings(ptrs.as_ptr(), 5));
+        let march = CString::new("2024-03-01").unwrap();
+        assert_eq!(temporal_plain_date_column_lower_bound(dates, march.as_ptr(), &mut value), 0);
+        assert_eq!(value, 3);
+        let mut days = [0i32; 5];
+        assert_eq!(temporal_plain_date_column_read(dates, 0, 5, days.as_mut_ptr()).count, 5);
+        assert_eq!(days[0], days_from_civil(2024, 1, 31) as i32);
+        assert_eq!(days[1], days_from_civil(2024, 2, 1) as i32);
+
+        let month = CString::new("month").unwrap();
+        let result = temporal_plain_date_column_bucket_by(dates, month.as_ptr(), days.as_mut_ptr(), counts.as_mut_ptr(), 5);
+        assert_eq!(result.count, 3);
+        assert_eq!(&counts[..3], &[1, 2, 2]);
+        assert_eq!(days[2], days_from_civil(2024, 3, 1) as i32);
+        // Weeks start on Monday: 2024-03-03 is a Sunday, 2024-03-04 a Monday
+        let week = CString::new("week").unwrap();
+        let result = temporal_plain_date_column_bucket_by(dates, week.as_ptr(), days.as_mut_ptr(), counts.as_mut_ptr(), 5);
+        assert_eq!(result.count, 3);
+        assert_eq!(&counts[..3], &[2, 2, 1]);
+        assert_eq!(days[0], days_from_civil(2024, 1, 29) as i32);
+        let result = temporal_plain_date_column_bucket_by(dates, week.as_ptr(), days.as_mut_ptr(), counts.as_mut_ptr(), 1);
+        assert_eq!(result.count, 1);
+
+        let fortnight = CString::new("fortnight").unwrap();
+        let mut result =
+            temporal_plain_date_column_bucket_by(dates, fortnight.as_ptr(), days.as_mut_ptr(), counts.as_mut_ptr(), 5);
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_batch_result(&mut result) };
+        assert_ne!(temporal_column_length(column, ptr::null_mut()), 0);
+
+        unsafe {
+            temporal_handle_release(column);
+            temporal_handle_release(slice);
+            temporal_handle_release(dates);
+        }
+    }
+
+    #[test]
+    fn test_zoned_clock() {
+        let ns = |s: &str| Instant::from_str(s).unwrap().epoch_nanoseconds().0;
+        let mut clock = ZonedClock::new(resolve_time_zone("Europe/Paris").unwrap());
+
+        let before = clock.reading_at(ns("2024-03-31T00:59:59.123456789Z")).unwrap();
+        assert_eq!(
+            (before.year, before.month, before.day, before.hour, before.minute, before.second),
+            (2024, 3, 31, 1, 59, 59)
+        );
+        assert_eq!((before.millisecond, before.microsecond, before.nanosecond), (123, 456, 789));
+        assert_eq!(before.offset_nanoseconds, 3_600_000_000_000);
+        assert_eq!((before.day_of_week, before.day_of_year), (7, 91));
+        assert_eq!(clock.valid_until, ns("2024-03-31T01:00:00Z"));
+
+        // Crossing the cached period's end picks up the summer offset
+        let after = clock.reading_at(ns("2024-03-31T01:00:00Z")).unwrap();
+        assert_eq!((after.hour, after.minute, after.offset_nanoseconds), (3, 0, 7_200_000_000_000));
+        assert_eq!(clock.valid_until, ns("2024-10-27T01:00:00Z"));
+
+        // Readings track the system clock
+        let tz = CString::new("Asia/Kolkata").unwrap();
+        let handle = extract_handle(temporal_zoned_clock_new(tz.as_ptr()));
+        assert_eq!(temporal_handle_kind(handle), TemporalHandleKind::ZonedClock as i32);
+        let mut now = TemporalEpochNanoseconds::default();
+        assert_eq!(temporal_instant_now_epoch_nanoseconds(&mut now), 0);
+        let mut reading = ZonedClockReading::default();
+        for _ in 0..3 {
+            assert_eq!(temporal_zoned_clock_read(handle, &mut reading), 0);
+            let delta = (reading.epoch_ns.seconds - now.seconds).abs();
+            assert!(delta <= 5, "clock is {}s away from now", delta);
+            assert_eq!(reading.offset_nanoseconds, 19_800_000_000_000);
+        }
+        assert_ne!(temporal_zoned_clock_read(handle, ptr::null_mut()), 0);
+        unsafe { temporal_handle_release(handle) };
+
+        let bad = CString::new("Mars/Olympus_Mons").unwrap();
+        let mut result = temporal_zoned_clock_new(bad.as_ptr());
+        assert_eq!(result.error_type, TemporalErrorType::RangeError as i32);
+        unsafe { temporal_free_handle_result(&mut result) };
+    }
 }
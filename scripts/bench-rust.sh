@@ -0,0 +1,73 @@
+#!/bin/bash
+set -e
+
+# Runs the temporal-rn C ABI benchmarks on the host.
+#
+#   ./scripts/bench-rust.sh                 # run and print
+#   ./scripts/bench-rust.sh save [name]     # record benches/baselines/<name>.tsv
+#   ./scripts/bench-rust.sh compare [name]  # compare against a saved baseline
+#   ./scripts/bench-rust.sh flavors         # size and speed of each flavor
+#
+# The baseline name defaults to "main". Record it on main, then compare from
+# a PR branch on the same machine; numbers across machines aren't comparable.
+#
+# TEMPORAL_RN_FLAVOR=fast|small benches that build flavor instead of release.
+# `flavors` builds every flavor, prints the library sizes and saves one
+# baseline per flavor (flavor-release, flavor-fast, flavor-small) with the
+# ops/s and first-call time of each case. The host build gets no target-cpu
+# tuning, so run the example app's bench harness on a device to see that.
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+RUST_DIR="$SCRIPT_DIR/../rust/temporal-rn"
+
+MODE="${1:-run}"
+BASELINE="${2:-main}"
+
+profile_for() {
+    case "$1" in
+        release) echo release ;;
+        fast) echo release-fast ;;
+        small) echo release-small ;;
+        *)
+            echo "Unknown flavor '$1' (release, fast or small)" >&2
+            exit 1
+            ;;
+    esac
+}
+
+PROFILE="$(profile_for "${TEMPORAL_RN_FLAVOR:-release}")"
+
+cd "$RUST_DIR"
+
+case "$MODE" in
+    run)
+        cargo bench --profile "$PROFILE" --bench ffi
+        ;;
+    save)
+        cargo bench --profile "$PROFILE" --bench ffi -- --save-baseline "$BASELINE"
+        ;;
+    compare)
+        cargo bench --profile "$PROFILE" --bench ffi -- --baseline "$BASELINE"
+        ;;
+    flavors)
+        SIZES=""
+        for flavor in release fast small; do
+            profile="$(profile_for "$flavor")"
+            echo ">>> $flavor (profile $profile)"
+            cargo build --lib --profile "$profile"
+            for lib in target/"$profile"/libtemporal_rn.{a,so,dylib}; do
+                if [ -f "$lib" ]; then
+                    SIZES+="$(printf '%-8s %10s  %s' "$flavor" "$(wc -c < "$lib")" "${lib##*/}")"$'\n'
+                fi
+            done
+            cargo bench --profile "$profile" --bench ffi -- --save-baseline "flavor-$flavor"
+            echo ""
+        done
+        echo "Library sizes (bytes):"
+        printf '%s' "$SIZES"
+        ;;
+    *)
+        echo "Usage: $0 [run|save|compare|flavors] [baseline]" >&2
+        exit 1
+        ;;
+esac
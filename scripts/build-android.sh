@@ -32,6 +32,33 @@ echo "Using NDK: ${ANDROID_NDK_HOME:-$NDK_HOME}"
 
 cd "$RUST_DIR"
 
+# Extra cargo features, e.g. TEMPORAL_RN_FEATURES=stats for call counters
+CARGO_FEATURES=()
+if [ -n "$TEMPORAL_RN_FEATURES" ]; then
+    CARGO_FEATURES=(--features "$TEMPORAL_RN_FEATURES")
+fi
+
+# Build flavor (see the profiles in Cargo.toml):
+#   release  balanced, the default
+#   fast     fat LTO and one codegen unit; arm64-v8a is tuned for
+#            Cortex-A55 (ARMv8.2) and won't run on ARMv8.0 cores such as
+#            the Cortex-A53, so only ship it to apps that exclude them
+#   small    optimized for size, symbols stripped from the .so files
+# TEMPORAL_RN_TARGET_CPU overrides the arm64 CPU of the fast flavor.
+case "${TEMPORAL_RN_FLAVOR:-release}" in
+    release) PROFILE=release ;;
+    fast)
+        PROFILE=release-fast
+        export CARGO_TARGET_AARCH64_LINUX_ANDROID_RUSTFLAGS="-C target-cpu=${TEMPORAL_RN_TARGET_CPU:-cortex-a55}"
+        ;;
+    small) PROFILE=release-small ;;
+    *)
+        echo "Error: unknown TEMPORAL_RN_FLAVOR '$TEMPORAL_RN_FLAVOR' (release, fast or small)"
+        exit 1
+        ;;
+esac
+echo "Flavor: ${TEMPORAL_RN_FLAVOR:-release} (profile $PROFILE)"
+
 # Install cargo-ndk if not present
 if ! command -v cargo-ndk &> /dev/null; then
     echo "Installing cargo-ndk..."
@@ -59,7 +86,7 @@ cargo ndk \
     -t x86 \
     -t x86_64 \
     -o "$JNILIBS_DIR" \
-    build --release
+    build --profile "$PROFILE" "${CARGO_FEATURES[@]}"
 
 echo ""
 echo "Android build complete!"
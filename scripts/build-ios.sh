@@ -12,6 +12,32 @@ echo "Project root: $PROJECT_ROOT"
 
 cd "$RUST_DIR"
 
+# Extra cargo features, e.g. TEMPORAL_RN_FEATURES=stats for call counters
+CARGO_FEATURES=()
+if [ -n "$TEMPORAL_RN_FEATURES" ]; then
+    CARGO_FEATURES=(--features "$TEMPORAL_RN_FEATURES")
+fi
+
+# Build flavor (see the profiles in Cargo.toml):
+#   release  balanced, the default
+#   fast     fat LTO and one codegen unit; the device slice is tuned for
+#            A11 and later (ARMv8.2), so it needs an iOS 16 minimum
+#   small    optimized for size, debug info stripped from the archives
+# TEMPORAL_RN_TARGET_CPU overrides the device CPU of the fast flavor.
+case "${TEMPORAL_RN_FLAVOR:-release}" in
+    release) PROFILE=release ;;
+    fast)
+        PROFILE=release-fast
+        export CARGO_TARGET_AARCH64_APPLE_IOS_RUSTFLAGS="-C target-cpu=${TEMPORAL_RN_TARGET_CPU:-apple-a11}"
+        ;;
+    small) PROFILE=release-small ;;
+    *)
+        echo "Error: unknown TEMPORAL_RN_FLAVOR '$TEMPORAL_RN_FLAVOR' (release, fast or small)"
+        exit 1
+        ;;
+esac
+echo "Flavor: ${TEMPORAL_RN_FLAVOR:-release} (profile $PROFILE)"
+
 # Install Rust targets if not present
 echo "Installing iOS Rust targets..."
 rustup target add aarch64-apple-ios 2>/dev/null || true
@@ -20,15 +46,15 @@ rustup target add x86_64-apple-ios 2>/dev/null || true
 
 # Build for device (arm64)
 echo "Building for iOS device (aarch64-apple-ios)..."
-cargo build --release --target aarch64-apple-ios
+cargo build --profile "$PROFILE" --target aarch64-apple-ios "${CARGO_FEATURES[@]}"
 
 # Build for simulator (arm64 - Apple Silicon)
 echo "Building for iOS simulator arm64 (aarch64-apple-ios-sim)..."
-cargo build --release --target aarch64-apple-ios-sim
+cargo build --profile "$PROFILE" --target aarch64-apple-ios-sim "${CARGO_FEATURES[@]}"
 
 # Build for simulator (x86_64 - Intel Macs)
 echo "Building for iOS simulator x86_64 (x86_64-apple-ios)..."
-cargo build --release --target x86_64-apple-ios
+cargo build --profile "$PROFILE" --target x86_64-apple-ios "${CARGO_FEATURES[@]}"
 
 # Create output directory
 mkdir -p "$IOS_DIR/libs"
@@ -36,13 +62,20 @@ mkdir -p "$IOS_DIR/libs"
 # Create universal simulator library (combining arm64 and x86_64)
 echo "Creating universal simulator library..."
 lipo -create \
-    "$TARGET_DIR/aarch64-apple-ios-sim/release/libtemporal_rn.a" \
-    "$TARGET_DIR/x86_64-apple-ios/release/libtemporal_rn.a" \
+    "$TARGET_DIR/aarch64-apple-ios-sim/$PROFILE/libtemporal_rn.a" \
+    "$TARGET_DIR/x86_64-apple-ios/$PROFILE/libtemporal_rn.a" \
     -output "$IOS_DIR/libs/libtemporal_rn_sim.a"
 
 # Copy device library
 echo "Copying device library..."
-cp "$TARGET_DIR/aarch64-apple-ios/release/libtemporal_rn.a" "$IOS_DIR/libs/libtemporal_rn_device.a"
+cp "$TARGET_DIR/aarch64-apple-ios/$PROFILE/libtemporal_rn.a" "$IOS_DIR/libs/libtemporal_rn_device.a"
+
+# Cargo's strip setting only applies to linked artifacts, so strip the
+# archives here. Exported symbols stay; the app link drops unused code.
+if [ "$PROFILE" = "release-small" ]; then
+    echo "Stripping debug info..."
+    strip -S "$IOS_DIR/libs/libtemporal_rn_sim.a" "$IOS_DIR/libs/libtemporal_rn_device.a"
+fi
 
 # Generate C header using cbindgen
 echo "Generating C header..."
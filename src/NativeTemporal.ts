@@ -2,6 +2,12 @@ import { TurboModuleRegistry, type TurboModule } from 'react-native';
 
 export interface Spec extends TurboModule {
   multiply(a: number, b: number): number;
+
+  /**
+   * Installs the C++ JSI bindings as `global.__TemporalJSI`.
+   * Returns false when the platform can't expose its jsi::Runtime.
+   */
+  install(): boolean;
   instantNow(): string;
   instantFromString(s: string): string;
   instantFromEpochMilliseconds(ms: number): string;
@@ -39,6 +45,40 @@ export interface Spec extends TurboModule {
     timeZoneId: string
   ): string;
 
+  // Epoch nanosecond instants
+  // Instants cross as [seconds, nanoseconds] with the nanosecond part in
+  // [0, 1e9), so JS can keep them numeric.
+  instantParseEpochNanoseconds(s: string): number[];
+  instantNowEpochNanoseconds(): number[];
+  instantFormatEpochNanoseconds(seconds: number, nanoseconds: number): string;
+  instantRoundEpochNanoseconds(
+    seconds: number,
+    nanoseconds: number,
+    smallestUnit: string,
+    roundingIncrement: number,
+    roundingMode: string | null
+  ): number[];
+  instantUntilEpochNanoseconds(
+    oneSeconds: number,
+    oneNanoseconds: number,
+    twoSeconds: number,
+    twoNanoseconds: number,
+    largestUnit: string | null,
+    smallestUnit: string | null,
+    roundingIncrement: number,
+    roundingMode: string | null
+  ): string;
+  instantSinceEpochNanoseconds(
+    oneSeconds: number,
+    oneNanoseconds: number,
+    twoSeconds: number,
+    twoNanoseconds: number,
+    largestUnit: string | null,
+    smallestUnit: string | null,
+    roundingIncrement: number,
+    roundingMode: string | null
+  ): string;
+
   // Now methods
   nowTimeZoneId(): string;
   nowPlainDateTimeISO(tz?: string): string;
@@ -200,6 +240,119 @@ export interface Spec extends TurboModule {
     tzId: string,
     instantStr: string
   ): string | null;
+  /**
+   * Returns the process-wide TimeZone cache counters as [hits, misses, size].
+   */
+  timeZoneCacheStats(): number[];
+  timeZoneCacheClear(): void;
+  /**
+   * Sets how many threads large batches may use: 0 for the device's
+   * performance cores, 1 to stay on the calling thread.
+   */
+  setBatchThreads(threads: number): void;
+  getBatchThreads(): number;
+  /**
+   * Returns 0 if `s` parses as the given TemporalValueKind, otherwise its
+   * TemporalErrorType. Never throws; see lastErrorMessage() for the reason.
+   */
+  validate(kind: number, s: string): number;
+  /**
+   * Message of the last failed validate() on this thread, built on demand.
+   */
+  lastErrorMessage(): string | null;
+  /**
+   * Returns the native call counters as a JSON object; all zero unless the
+   * library was built with the `stats` feature.
+   */
+  getStats(): string;
+  resetStats(): void;
+  /**
+   * Encodes a ZonedDateTime as its 24-byte binary record, one number per byte.
+   */
+  zonedDateTimeToBytes(s: string): number[];
+  zonedDateTimeFromBytes(bytes: number[]): string;
+  /**
+   * toString(options). fractionalSecondDigits is 0-9, or -1 for 'auto';
+   * null options take the Temporal defaults.
+   */
+  instantToStringWithOptions(
+    s: string,
+    fractionalSecondDigits: number,
+    smallestUnit: string | null,
+    roundingMode: string | null
+  ): string;
+  plainTimeToStringWithOptions(
+    s: string,
+    fractionalSecondDigits: number,
+    smallestUnit: string | null,
+    roundingMode: string | null
+  ): string;
+  plainDateTimeToStringWithOptions(
+    s: string,
+    fractionalSecondDigits: number,
+    smallestUnit: string | null,
+    roundingMode: string | null,
+    calendarName: string | null
+  ): string;
+  zonedDateTimeToStringWithOptions(
+    s: string,
+    fractionalSecondDigits: number,
+    smallestUnit: string | null,
+    roundingMode: string | null,
+    calendarName: string | null,
+    timeZoneName: string | null,
+    offset: string | null
+  ): string;
+  /**
+   * Packs toString options into one number for the WithPackedOptions
+   * variants, which then parse no option strings.
+   */
+  toStringOptionsNew(
+    fractionalSecondDigits: number,
+    smallestUnit: string | null,
+    roundingMode: string | null,
+    calendarName: string | null,
+    timeZoneName: string | null,
+    offset: string | null
+  ): number;
+  instantToStringWithPackedOptions(s: string, options: number): string;
+  plainTimeToStringWithPackedOptions(s: string, options: number): string;
+  plainDateTimeToStringWithPackedOptions(s: string, options: number): string;
+  zonedDateTimeToStringWithPackedOptions(s: string, options: number): string;
+  /**
+   * Packs until/since/round options into one number for the WithOptions
+   * variants, which then parse no strings.
+   */
+  roundingOptionsNew(
+    largestUnit: string | null,
+    smallestUnit: string | null,
+    roundingIncrement: number,
+    roundingMode: string | null
+  ): number;
+  instantUntilEpochNanosecondsWithOptions(
+    oneSeconds: number,
+    oneNanoseconds: number,
+    twoSeconds: number,
+    twoNanoseconds: number,
+    options: number
+  ): string;
+  instantSinceEpochNanosecondsWithOptions(
+    oneSeconds: number,
+    oneNanoseconds: number,
+    twoSeconds: number,
+    twoNanoseconds: number,
+    options: number
+  ): string;
+  instantRoundEpochNanosecondsWithOptions(
+    seconds: number,
+    nanoseconds: number,
+    options: number
+  ): number[];
+  plainTimeUntilWithOptions(one: string, two: string, options: number): string;
+  plainTimeSinceWithOptions(one: string, two: string, options: number): string;
+  plainTimeRoundWithOptions(time: string, options: number): string;
+  zonedDateTimeRoundWithOptions(s: string, options: number): string;
+  zonedDateTimeHandleRoundWithOptions(handle: number, options: number): number;
 
   // ZonedDateTime methods
   zonedDateTimeFromString(s: string): string;
@@ -335,6 +488,200 @@ export interface Spec extends TurboModule {
     microseconds: number,
     nanoseconds: number
   ): string;
+  // Handle API
+  //
+  // Handles are opaque numbers referring to parsed values kept on the native
+  // side. Each handle must be released exactly once with handleRelease.
+  // Released or made-up handles throw a TypeError.
+
+  /**
+   * Releases a handle.
+   */
+  handleRelease(handle: number): void;
+
+  /**
+   * Formats the value held by a handle as an ISO string.
+   */
+  handleToString(handle: number): string;
+
+  /**
+   * Compares two handles of the same kind. Returns -1, 0, or 1.
+   * Throws TypeError for mismatched kinds, RangeError for durations.
+   */
+  handleCompare(a: number, b: number): number;
+
+  instantHandleFromString(s: string): number;
+  plainDateTimeHandleFromString(s: string): number;
+  zonedDateTimeHandleFromString(s: string): number;
+  durationHandleFromString(s: string): number;
+
+  instantHandleAdd(handle: number, duration: number): number;
+  instantHandleSubtract(handle: number, duration: number): number;
+  instantHandleRound(
+    handle: number,
+    smallestUnit: string,
+    roundingIncrement: number,
+    roundingMode: string | null
+  ): number;
+
+  plainDateTimeHandleAdd(handle: number, duration: number): number;
+  plainDateTimeHandleSubtract(handle: number, duration: number): number;
+  /**
+   * Pass Number.MIN_SAFE_INTEGER for fields that should not be changed.
+   */
+  plainDateTimeHandleWith(
+    handle: number,
+    year: number,
+    month: number,
+    day: number,
+    hour: number,
+    minute: number,
+    second: number,
+    millisecond: number,
+    microsecond: number,
+    nanosecond: number,
+    calendarId: string | null
+  ): number;
+  plainDateTimeHandleGetAllComponents(handle: number): number[];
+
+  zonedDateTimeHandleAdd(handle: number, duration: number): number;
+  zonedDateTimeHandleSubtract(handle: number, duration: number): number;
+  zonedDateTimeHandleRound(
+    handle: number,
+    smallestUnit: string,
+    roundingIncrement: number,
+    roundingMode: string | null
+  ): number;
+  /**
+   * Pass Number.MIN_SAFE_INTEGER for fields that should not be changed.
+   */
+  zonedDateTimeHandleWith(
+    handle: number,
+    year: number,
+    month: number,
+    day: number,
+    hour: number,
+    minute: number,
+    second: number,
+    millisecond: number,
+    microsecond: number,
+    nanosecond: number,
+    calendarId: string | null,
+    timeZoneId: string | null
+  ): number;
+  zonedDateTimeHandleGetAllComponents(handle: number): number[];
+
+  // Ranges are handles over `start + step * i`, released with handleRelease.
+  zonedDateTimeRangeNew(
+    start: string,
+    step: string,
+    end: string | null
+  ): number;
+  /**
+   * Returns up to `n` further occurrences as flat [seconds, nanoseconds]
+   * pairs of epoch nanoseconds. An empty array means the range is exhausted.
+   */
+  zonedDateTimeRangeNextBatch(range: number, n: number): number[];
+
+  // Columns are handles over sorted instants or plain dates, released with
+  // handleRelease. Plain dates cross as days since 1970-01-01.
+  instantColumnFromEpochNanoseconds(epochPairs: number[]): number;
+  instantColumnFromStrings(strings: string[]): number;
+  plainDateColumnFromStrings(strings: string[]): number;
+  columnLength(column: number): number;
+  /** A view of [start, end) sharing the column's memory, bounds clamped. */
+  columnSlice(column: number, start: number, end: number): number;
+  instantColumnLowerBound(
+    column: number,
+    seconds: number,
+    nanoseconds: number
+  ): number;
+  instantColumnRangeCount(
+    column: number,
+    startSeconds: number,
+    startNanoseconds: number,
+    endSeconds: number,
+    endNanoseconds: number
+  ): number;
+  /** Up to `count` instants from `start`, as flat [seconds, nanoseconds]. */
+  instantColumnRead(column: number, start: number, count: number): number[];
+  /**
+   * Non-empty 'day', 'week', 'month' or 'year' buckets in the time zone, as
+   * flat [start seconds, start nanoseconds, count] triples.
+   */
+  instantColumnBucketBy(
+    column: number,
+    unit: string,
+    timeZoneId: string
+  ): number[];
+  plainDateColumnLowerBound(column: number, date: string): number;
+  plainDateColumnRangeCount(column: number, start: string, end: string): number;
+  plainDateColumnRead(column: number, start: number, count: number): number[];
+  /** Non-empty buckets as flat [start day, count] pairs. */
+  plainDateColumnBucketBy(column: number, unit: string): number[];
+
+  // Zoned clocks are handles bound to a time zone, released with
+  // handleRelease. Reads skip the zone lookup, parsing and formatting.
+  zonedClockNew(timeZoneId: string): number;
+  /**
+   * The current time in the clock's zone: [epoch seconds, nanoseconds,
+   * offset nanoseconds, year, month, day, hour, minute, second, millisecond,
+   * microsecond, nanosecond, day of week, day of year].
+   */
+  zonedClockRead(clock: number): number[];
+
+  // Batch API
+  // One native call per array. Sort methods return the stable ascending
+  // permutation of input indices; compareMany returns -1, 0, or 1 per pair.
+  /**
+   * Returns flat [seconds, nanoseconds] pairs of epoch nanoseconds, with the
+   * nanosecond part in [0, 1e9).
+   */
+  instantParseMany(strings: string[]): number[];
+  instantSort(strings: string[]): number[];
+  instantCompareMany(a: string[], b: string[]): number[];
+  plainDateSort(strings: string[]): number[];
+  plainDateCompareMany(a: string[], b: string[]): number[];
+  zonedDateTimeParseMany(strings: string[]): number[];
+  zonedDateTimeSort(strings: string[]): number[];
+  zonedDateTimeCompareMany(a: string[], b: string[]): number[];
+  /**
+   * Converts flat [seconds, nanoseconds] epoch pairs to wall-clock fields.
+   * The result is column-major: year, month, day, hour, minute, second,
+   * millisecond, microsecond, nanosecond.
+   */
+  timeZoneGetPlainDateTimesForMany(
+    tzId: string,
+    epochPairs: number[]
+  ): number[];
+  /**
+   * Returns at most `cap` transitions t with start <= t < end as flat
+   * [seconds, nanoseconds] pairs, ascending.
+   */
+  timeZoneGetTransitions(
+    tzId: string,
+    startSeconds: number,
+    startNanoseconds: number,
+    endSeconds: number,
+    endNanoseconds: number,
+    cap: number
+  ): number[];
+
+  // Async API
+  // These run on a native worker pool so long batches never block the JS
+  // thread. Rejections carry the Temporal error name as their code.
+
+  /**
+   * Expands `start + duration * i` for i in [0, count), with `start` a plain
+   * date-time placed in the time zone. Resolves with flat [seconds,
+   * nanoseconds] pairs of epoch nanoseconds.
+   */
+  expandRecurrence(
+    start: string,
+    duration: string,
+    count: number,
+    timeZoneId: string
+  ): Promise<number[]>;
 }
 
 export default TurboModuleRegistry.getEnforcing<Spec>('Temporal');
@@ -0,0 +1,163 @@
+import NativeTemporal, { NativeTemporalJSI } from './native';
+
+/**
+ * Fixed-size binary records shared by Instant and ZonedDateTime.
+ *
+ * A record is BINARY_RECORD_SIZE little-endian bytes: format version, kind,
+ * calendar tag, zone kind, zone, floored epoch seconds (int64), nanosecond
+ * remainder (uint32) and four reserved zero bytes. The layout is the one the
+ * Rust library defines, so records decode the same on every platform.
+ *
+ * Instants have neither zone nor calendar and are encoded here from their
+ * epoch nanoseconds. Zoned records need the native zone and calendar tables:
+ * with the JSI bindings a batch is a single call reading or writing the
+ * ArrayBuffer directly, otherwise each record crosses as a number[].
+ */
+
+export const BINARY_RECORD_SIZE = 24;
+
+const BINARY_VERSION = 1;
+const KIND_INSTANT = 1;
+const TWO_POW_32 = 2 ** 32;
+
+/**
+ * Bytes accepted by the fromBytes methods.
+ */
+export type BinaryInput = ArrayBuffer | ArrayBufferView;
+
+/**
+ * Views `input` as bytes without copying.
+ */
+export const binaryBytes = (input: BinaryInput): Uint8Array =>
+  input instanceof ArrayBuffer
+    ? new Uint8Array(input)
+    : new Uint8Array(input.buffer, input.byteOffset, input.byteLength);
+
+/**
+ * The number of records in `bytes`, which must hold whole records.
+ */
+export const binaryRecordCount = (bytes: Uint8Array): number => {
+  if (bytes.byteLength % BINARY_RECORD_SIZE !== 0) {
+    throw new RangeError(
+      `Binary records must be a multiple of ${BINARY_RECORD_SIZE} bytes`
+    );
+  }
+  return bytes.byteLength / BINARY_RECORD_SIZE;
+};
+
+/**
+ * Checks that `bytes` holds exactly one record.
+ */
+export const singleBinaryRecord = (input: BinaryInput): Uint8Array => {
+  const bytes = binaryBytes(input);
+  if (bytes.byteLength !== BINARY_RECORD_SIZE) {
+    throw new RangeError(`Binary record must be ${BINARY_RECORD_SIZE} bytes`);
+  }
+  return bytes;
+};
+
+const dataView = (bytes: Uint8Array): DataView =>
+  new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+
+/**
+ * Writes Instant records for [seconds, nanoseconds] pairs into zeroed memory.
+ */
+export const writeInstantRecords = (
+  pairs: readonly (readonly [number, number])[]
+): ArrayBuffer => {
+  const out = new ArrayBuffer(pairs.length * BINARY_RECORD_SIZE);
+  const view = new DataView(out);
+  pairs.forEach(([seconds, nanoseconds], i) => {
+    const offset = i * BINARY_RECORD_SIZE;
+    const high = Math.floor(seconds / TWO_POW_32);
+    view.setUint8(offset, BINARY_VERSION);
+    view.setUint8(offset + 1, KIND_INSTANT);
+    view.setUint32(offset + 8, seconds - high * TWO_POW_32, true);
+    view.setInt32(offset + 12, high, true);
+    view.setUint32(offset + 16, nanoseconds, true);
+  });
+  return out;
+};
+
+/**
+ * Reads the [seconds, nanoseconds] pair of every Instant record in `bytes`,
+ * rejecting them as the native decoder would.
+ */
+export const readInstantRecords = (bytes: Uint8Array): [number, number][] => {
+  const count = binaryRecordCount(bytes);
+  const view = dataView(bytes);
+  const result = new Array<[number, number]>(count);
+  for (let i = 0; i < count; i++) {
+    const offset = i * BINARY_RECORD_SIZE;
+    const version = view.getUint8(offset);
+    const kind = view.getUint8(offset + 1);
+    if (version !== BINARY_VERSION) {
+      throw new RangeError(`Unsupported binary format version ${version}`);
+    }
+    if (kind !== KIND_INSTANT) {
+      throw new TypeError(
+        `Binary record has kind ${kind}, expected ${KIND_INSTANT}`
+      );
+    }
+    if (view.getUint32(offset + 20, true) !== 0) {
+      throw new RangeError('Reserved bytes of binary record must be zero');
+    }
+    if (view.getUint16(offset + 2) !== 0 || view.getUint32(offset + 4) !== 0) {
+      throw new RangeError(
+        'Instant record cannot carry a time zone or calendar'
+      );
+    }
+    const nanoseconds = view.getUint32(offset + 16, true);
+    if (nanoseconds >= 1_000_000_000) {
+      throw new RangeError('Epoch nanoseconds remainder must be in [0, 1e9)');
+    }
+    const seconds =
+      view.getInt32(offset + 12, true) * TWO_POW_32 +
+      view.getUint32(offset + 8, true);
+    result[i] = [seconds, nanoseconds];
+  }
+  return result;
+};
+
+/**
+ * Encodes ZonedDateTime strings into consecutive records.
+ */
+export const zonedDateTimeToBytes = (isos: string[]): ArrayBuffer => {
+  const out = new ArrayBuffer(isos.length * BINARY_RECORD_SIZE);
+  const { zonedDateTimeToBytesMany } = NativeTemporalJSI;
+  if (zonedDateTimeToBytesMany) {
+    zonedDateTimeToBytesMany(isos, out, 0);
+    return out;
+  }
+  const bytes = new Uint8Array(out);
+  isos.forEach((iso, i) => {
+    bytes.set(
+      NativeTemporal.zonedDateTimeToBytes(iso),
+      i * BINARY_RECORD_SIZE
+    );
+  });
+  return out;
+};
+
+/**
+ * Decodes consecutive ZonedDateTime records into ISO strings.
+ */
+export const zonedDateTimeFromBytes = (bytes: Uint8Array): string[] => {
+  const count = binaryRecordCount(bytes);
+  const { zonedDateTimeFromBytesMany } = NativeTemporalJSI;
+  if (zonedDateTimeFromBytesMany) {
+    return zonedDateTimeFromBytesMany(
+      bytes.buffer as ArrayBuffer,
+      bytes.byteOffset,
+      count
+    );
+  }
+  const result = new Array<string>(count);
+  for (let i = 0; i < count; i++) {
+    const offset = i * BINARY_RECORD_SIZE;
+    result[i] = NativeTemporal.zonedDateTimeFromBytes(
+      Array.from(bytes.subarray(offset, offset + BINARY_RECORD_SIZE))
+    );
+  }
+  return result;
+};
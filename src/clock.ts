@@ -0,0 +1,185 @@
+import NativeTemporal, { NativeTemporalJSI } from './native';
+import { handlesSupported, releaseHandle, trackHandle } from './handles';
+import { epochNanosecondsFromPair, wrapNativeCall } from './utils';
+import { Instant } from './types/Instant';
+import { TimeZone } from './types/TimeZone';
+
+// Slots of a clock reading, as written by zonedClockRead(Into).
+const enum ClockIndex {
+  EpochSeconds = 0,
+  EpochNanoseconds = 1,
+  OffsetNanoseconds = 2,
+  Year = 3,
+  Month = 4,
+  Day = 5,
+  Hour = 6,
+  Minute = 7,
+  Second = 8,
+  Millisecond = 9,
+  Microsecond = 10,
+  Nanosecond = 11,
+  DayOfWeek = 12,
+  DayOfYear = 13,
+}
+
+const CLOCK_SLOT_COUNT = 14;
+
+/**
+ * A clock bound to one time zone, for timers and animations that need the
+ * local time every frame.
+ *
+ * `Now.zonedDateTimeISO()` resolves the zone, converts and formats a string
+ * on every call. A clock resolves the zone once and keeps its UTC offset
+ * until the next transition, so `read()` costs a monotonic clock read and
+ * integer arithmetic. With the JSI bindings the reading is written into a
+ * buffer the clock owns, and reading allocates nothing.
+ *
+ * The fields describe the last `read()`, in the ISO calendar. The system
+ * clock is re-read at least once a second, so changes to the device time
+ * show up within a second.
+ *
+ * @example
+ * const clock = ZonedClock.from('Europe/Paris');
+ * const tick = () => {
+ *   clock.read();
+ *   label.text = `${clock.hour}:${clock.minute}:${clock.second}`;
+ *   requestAnimationFrame(tick);
+ * };
+ */
+export class ZonedClock {
+  readonly timeZoneId: string;
+  #handle: number | undefined;
+  #fields: Float64Array | number[] = new Float64Array(CLOCK_SLOT_COUNT);
+
+  private constructor(timeZoneId: string, handle: number) {
+    this.timeZoneId = timeZoneId;
+    this.#handle = handlesSupported ? trackHandle(this, handle) : handle;
+  }
+
+  /**
+   * Creates a clock for `timeZone`, the system time zone by default, and
+   * takes a first reading.
+   */
+  static from(timeZone?: TimeZone | string): ZonedClock {
+    const timeZoneId =
+      timeZone === undefined
+        ? wrapNativeCall(
+            () => NativeTemporal.nowTimeZoneId(),
+            'Failed to get time zone ID'
+          )
+        : TimeZone.from(timeZone).id;
+    return new ZonedClock(
+      timeZoneId,
+      wrapNativeCall(
+        () => NativeTemporal.zonedClockNew(timeZoneId),
+        'Invalid time zone'
+      )
+    ).read();
+  }
+
+  /**
+   * Reads the current time; the field getters then describe it.
+   */
+  read(): this {
+    const handle = this.#handle;
+    if (handle === undefined) {
+      throw new TypeError('Clock has been released');
+    }
+    const { zonedClockReadInto } = NativeTemporalJSI;
+    if (zonedClockReadInto && this.#fields instanceof Float64Array) {
+      const fields = this.#fields;
+      wrapNativeCall(
+        () => zonedClockReadInto(handle, fields.buffer as ArrayBuffer),
+        'Failed to read clock'
+      );
+    } else {
+      this.#fields = wrapNativeCall(
+        () => NativeTemporal.zonedClockRead(handle),
+        'Failed to read clock'
+      );
+    }
+    return this;
+  }
+
+  get epochNanoseconds(): bigint {
+    return epochNanosecondsFromPair([
+      this.#fields[ClockIndex.EpochSeconds]!,
+      this.#fields[ClockIndex.EpochNanoseconds]!,
+    ]);
+  }
+
+  get epochMilliseconds(): number {
+    return (
+      this.#fields[ClockIndex.EpochSeconds]! * 1000 +
+      Math.floor(this.#fields[ClockIndex.EpochNanoseconds]! / 1e6)
+    );
+  }
+
+  /** The zone's UTC offset at the last reading */
+  get offsetNanoseconds(): number {
+    return this.#fields[ClockIndex.OffsetNanoseconds]!;
+  }
+
+  get year(): number {
+    return this.#fields[ClockIndex.Year]!;
+  }
+
+  get month(): number {
+    return this.#fields[ClockIndex.Month]!;
+  }
+
+  get day(): number {
+    return this.#fields[ClockIndex.Day]!;
+  }
+
+  get hour(): number {
+    return this.#fields[ClockIndex.Hour]!;
+  }
+
+  get minute(): number {
+    return this.#fields[ClockIndex.Minute]!;
+  }
+
+  get second(): number {
+    return this.#fields[ClockIndex.Second]!;
+  }
+
+  get millisecond(): number {
+    return this.#fields[ClockIndex.Millisecond]!;
+  }
+
+  get microsecond(): number {
+    return this.#fields[ClockIndex.Microsecond]!;
+  }
+
+  get nanosecond(): number {
+    return this.#fields[ClockIndex.Nanosecond]!;
+  }
+
+  /** 1 (Monday) to 7 (Sunday) */
+  get dayOfWeek(): number {
+    return this.#fields[ClockIndex.DayOfWeek]!;
+  }
+
+  get dayOfYear(): number {
+    return this.#fields[ClockIndex.DayOfYear]!;
+  }
+
+  /**
+   * The last reading as an Instant.
+   */
+  toInstant(): Instant {
+    return Instant.fromEpochNanoseconds(this.epochNanoseconds);
+  }
+
+  /**
+   * Frees the native clock now instead of at garbage collection. Required
+   * on engines without FinalizationRegistry.
+   */
+  release(): void {
+    if (this.#handle !== undefined) {
+      releaseHandle(this, this.#handle);
+      this.#handle = undefined;
+    }
+  }
+}
@@ -0,0 +1,361 @@
+import NativeTemporal from './native';
+import { handlesSupported, releaseHandle, trackHandle } from './handles';
+import {
+  epochNanosecondsFromPair,
+  epochNanosecondsFromPairs,
+  epochNanosecondsToPair,
+  wrapNativeCall,
+} from './utils';
+import { Instant } from './types/Instant';
+import { formatIsoDate, isoFromEpochDays } from './types/isoArithmetic';
+import { PlainDate, type PlainDateLike } from './types/PlainDate';
+import { TimeZone } from './types/TimeZone';
+
+/**
+ * Sorted instants or plain dates held in native memory.
+ *
+ * Timeline and calendar views ask the same questions of thousands of values:
+ * where does this day start, how many fall in this range, how many per week.
+ * A column answers each with one native call running a binary search,
+ * instead of one comparison crossing the bridge per probe. Values are sorted
+ * once on creation and never change; `slice` shares them without copying.
+ *
+ * The native memory is freed when the column is garbage collected, or
+ * earlier by `release()`. Engines without FinalizationRegistry must call
+ * `release()`.
+ */
+
+/** Calendar periods accepted by bucketBy. Weeks start on Monday. */
+export type BucketUnit = 'day' | 'week' | 'month' | 'year';
+
+export interface InstantBucket {
+  /** The first instant of the period */
+  start: Instant;
+  count: number;
+}
+
+export interface PlainDateBucket {
+  /** The first day of the period */
+  start: PlainDate;
+  count: number;
+}
+
+// Array.prototype.slice semantics for the bounds of `slice`.
+const relativeIndex = (index: number, length: number): number => {
+  const i = Math.trunc(index) || 0;
+  return i < 0 ? Math.max(length + i, 0) : Math.min(i, length);
+};
+
+/**
+ * Owns a column handle. Subclasses read `handle`, which throws once released.
+ */
+abstract class Column {
+  #handle: number | undefined;
+  /** The number of values in the column */
+  readonly length: number;
+
+  protected constructor(handle: number) {
+    this.#handle = handlesSupported ? trackHandle(this, handle) : handle;
+    this.length = wrapNativeCall(
+      () => NativeTemporal.columnLength(handle),
+      'Invalid column'
+    );
+  }
+
+  protected get handle(): number {
+    if (this.#handle === undefined) {
+      throw new TypeError('Column has been released');
+    }
+    return this.#handle;
+  }
+
+  protected sliceHandle(start: number, end: number): number {
+    const handle = this.handle;
+    const from = relativeIndex(start, this.length);
+    const to = relativeIndex(end, this.length);
+    return wrapNativeCall(
+      () => NativeTemporal.columnSlice(handle, from, Math.max(from, to)),
+      'Failed to slice column'
+    );
+  }
+
+  protected indexOf(index: number): number | undefined {
+    const i = Math.trunc(index) || 0;
+    const resolved = i < 0 ? this.length + i : i;
+    return resolved >= 0 && resolved < this.length ? resolved : undefined;
+  }
+
+  /**
+   * Frees the native memory now. Other slices of the same values are not
+   * affected.
+   */
+  release(): void {
+    if (this.#handle !== undefined) {
+      releaseHandle(this, this.#handle);
+      this.#handle = undefined;
+    }
+  }
+}
+
+/**
+ * A sorted column of instants.
+ *
+ * @example
+ * const column = InstantColumn.from(eventStarts);
+ * const perDay = column.bucketBy('day', 'Europe/Paris');
+ * const today = column.rangeCount(startOfDay, startOfTomorrow);
+ */
+export class InstantColumn extends Column implements Iterable<Instant> {
+  private constructor(handle: number) {
+    super(handle);
+  }
+
+  /**
+   * Sorts `items` into a new column. String items are parsed natively.
+   */
+  static from(items: Iterable<Instant | string>): InstantColumn {
+    if (Array.isArray(items) && items.every((i) => typeof i === 'string')) {
+      const strings = items as string[];
+      return new InstantColumn(
+        wrapNativeCall(
+          () => NativeTemporal.instantColumnFromStrings(strings),
+          'Invalid instant'
+        )
+      );
+    }
+    return InstantColumn.fromEpochNanoseconds(
+      Instant.epochNanosecondsMany(Array.from(items))
+    );
+  }
+
+  /**
+   * Sorts epoch nanoseconds into a new column.
+   */
+  static fromEpochNanoseconds(values: Iterable<bigint>): InstantColumn {
+    const pairs: number[] = [];
+    for (const value of values) {
+      pairs.push(...epochNanosecondsToPair(value));
+    }
+    return new InstantColumn(
+      wrapNativeCall(
+        () => NativeTemporal.instantColumnFromEpochNanoseconds(pairs),
+        'Invalid epoch nanoseconds'
+      )
+    );
+  }
+
+  /**
+   * The instant at `index`, counting back from the end when negative.
+   */
+  at(index: number): Instant | undefined {
+    const i = this.indexOf(index);
+    return i === undefined ? undefined : this.#read(i, 1)[0];
+  }
+
+  /**
+   * The index of the first instant not before `instant`, or `length`.
+   */
+  lowerBound(instant: Instant | string): number {
+    const handle = this.handle;
+    const [seconds, nanoseconds] = epochNanosecondsToPair(
+      Instant.from(instant).epochNanoseconds
+    );
+    return wrapNativeCall(
+      () =>
+        NativeTemporal.instantColumnLowerBound(handle, seconds, nanoseconds),
+      'Failed to search column'
+    );
+  }
+
+  /**
+   * How many instants lie in `[start, end)`.
+   */
+  rangeCount(start: Instant | string, end: Instant | string): number {
+    const handle = this.handle;
+    const [startSeconds, startNanoseconds] = epochNanosecondsToPair(
+      Instant.from(start).epochNanoseconds
+    );
+    const [endSeconds, endNanoseconds] = epochNanosecondsToPair(
+      Instant.from(end).epochNanoseconds
+    );
+    return wrapNativeCall(
+      () =>
+        NativeTemporal.instantColumnRangeCount(
+          handle,
+          startSeconds,
+          startNanoseconds,
+          endSeconds,
+          endNanoseconds
+        ),
+      'Failed to count column range'
+    );
+  }
+
+  /**
+   * Groups the instants by the local day, week, month or year they fall in.
+   * Only non-empty periods are returned, in order; each starts at the first
+   * instant of its period in `timeZone`, so DST days keep their true length.
+   */
+  bucketBy(unit: BucketUnit, timeZone: TimeZone | string): InstantBucket[] {
+    const handle = this.handle;
+    const timeZoneId = TimeZone.from(timeZone).id;
+    const triples = wrapNativeCall(
+      () => NativeTemporal.instantColumnBucketBy(handle, unit, timeZoneId),
+      'Failed to bucket column'
+    );
+    const buckets = new Array<InstantBucket>(triples.length / 3);
+    for (let i = 0; i < buckets.length; i++) {
+      const triple = triples.slice(i * 3, i * 3 + 3);
+      buckets[i] = {
+        start: Instant.fromEpochNanoseconds(epochNanosecondsFromPair(triple)),
+        count: triple[2]!,
+      };
+    }
+    return buckets;
+  }
+
+  /**
+   * The instants at `[start, end)` as a column sharing this one's memory.
+   * Negative bounds count back from the end, as with Array.prototype.slice.
+   */
+  slice(start = 0, end = this.length): InstantColumn {
+    return new InstantColumn(this.sliceHandle(start, end));
+  }
+
+  toArray(): Instant[] {
+    return this.#read(0, this.length);
+  }
+
+  [Symbol.iterator](): Iterator<Instant> {
+    return this.toArray()[Symbol.iterator]();
+  }
+
+  #read(start: number, count: number): Instant[] {
+    const handle = this.handle;
+    const pairs = wrapNativeCall(
+      () => NativeTemporal.instantColumnRead(handle, start, count),
+      'Failed to read column'
+    );
+    return epochNanosecondsFromPairs(pairs).map((ns) =>
+      Instant.fromEpochNanoseconds(ns)
+    );
+  }
+}
+
+const plainDateFromEpochDays = (days: number): PlainDate =>
+  PlainDate.from(formatIsoDate(isoFromEpochDays(days)));
+
+const plainDateString = (date: PlainDate | PlainDateLike | string): string =>
+  typeof date === 'string' ? date : PlainDate.from(date).toString();
+
+/**
+ * A sorted column of plain dates.
+ *
+ * Dates are kept as ISO days, so dates in other calendars sort with the
+ * ISO dates they fall on and are read back in the ISO calendar.
+ *
+ * @example
+ * const column = PlainDateColumn.from(dueDates);
+ * const overdue = column.lowerBound('2024-06-01');
+ */
+export class PlainDateColumn extends Column implements Iterable<PlainDate> {
+  private constructor(handle: number) {
+    super(handle);
+  }
+
+  /**
+   * Sorts `items` into a new column.
+   */
+  static from(
+    items: Iterable<PlainDate | PlainDateLike | string>
+  ): PlainDateColumn {
+    const strings = Array.from(items, plainDateString);
+    return new PlainDateColumn(
+      wrapNativeCall(
+        () => NativeTemporal.plainDateColumnFromStrings(strings),
+        'Invalid plain date'
+      )
+    );
+  }
+
+  /**
+   * The date at `index`, counting back from the end when negative.
+   */
+  at(index: number): PlainDate | undefined {
+    const i = this.indexOf(index);
+    return i === undefined ? undefined : this.#read(i, 1)[0];
+  }
+
+  /**
+   * The index of the first date not before `date`, or `length`.
+   */
+  lowerBound(date: PlainDate | PlainDateLike | string): number {
+    const handle = this.handle;
+    const iso = plainDateString(date);
+    return wrapNativeCall(
+      () => NativeTemporal.plainDateColumnLowerBound(handle, iso),
+      'Failed to search column'
+    );
+  }
+
+  /**
+   * How many dates lie in `[start, end)`.
+   */
+  rangeCount(
+    start: PlainDate | PlainDateLike | string,
+    end: PlainDate | PlainDateLike | string
+  ): number {
+    const handle = this.handle;
+    const startIso = plainDateString(start);
+    const endIso = plainDateString(end);
+    return wrapNativeCall(
+      () => NativeTemporal.plainDateColumnRangeCount(handle, startIso, endIso),
+      'Failed to count column range'
+    );
+  }
+
+  /**
+   * Groups the dates by the ISO day, week, month or year they fall in. Only
+   * non-empty periods are returned, in order.
+   */
+  bucketBy(unit: BucketUnit): PlainDateBucket[] {
+    const handle = this.handle;
+    const pairs = wrapNativeCall(
+      () => NativeTemporal.plainDateColumnBucketBy(handle, unit),
+      'Failed to bucket column'
+    );
+    const buckets = new Array<PlainDateBucket>(pairs.length / 2);
+    for (let i = 0; i < buckets.length; i++) {
+      buckets[i] = {
+        start: plainDateFromEpochDays(pairs[i * 2]!),
+        count: pairs[i * 2 + 1]!,
+      };
+    }
+    return buckets;
+  }
+
+  /**
+   * The dates at `[start, end)` as a column sharing this one's memory.
+   * Negative bounds count back from the end, as with Array.prototype.slice.
+   */
+  slice(start = 0, end = this.length): PlainDateColumn {
+    return new PlainDateColumn(this.sliceHandle(start, end));
+  }
+
+  toArray(): PlainDate[] {
+    return this.#read(0, this.length);
+  }
+
+  [Symbol.iterator](): Iterator<PlainDate> {
+    return this.toArray()[Symbol.iterator]();
+  }
+
+  #read(start: number, count: number): PlainDate[] {
+    const handle = this.handle;
+    const days = wrapNativeCall(
+      () => NativeTemporal.plainDateColumnRead(handle, start, count),
+      'Failed to read column'
+    );
+    return days.map(plainDateFromEpochDays);
+  }
+}
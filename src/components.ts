@@ -0,0 +1,141 @@
+import NativeTemporal, { NativeTemporalJSI } from './native';
+
+/**
+ * Component arrays shared by the Temporal types.
+ *
+ * With the JSI bindings installed, native code writes the component struct
+ * straight into an Int32Array owned by the Temporal object, so reading fields
+ * never boxes a number per component. Otherwise the TurboModule's number[]
+ * is used as-is.
+ */
+
+export const PLAIN_TIME_COMPONENT_COUNT = 6;
+export const PLAIN_DATE_COMPONENT_COUNT = 12;
+export const PLAIN_DATE_TIME_COMPONENT_COUNT = 18;
+
+/**
+ * Zoned components follow the plain date time ones with the UTC offset split
+ * into whole seconds and a nanosecond remainder, which fit an Int32Array.
+ */
+export const ZONED_DATE_TIME_COMPONENT_COUNT = 20;
+
+const OFFSET_SECONDS_INDEX = 18;
+const OFFSET_NANOSECONDS_INDEX = 19;
+
+type ParseResult = [iso: string, components: ArrayLike<number> | undefined];
+
+/**
+ * Parses `s` and, when the JSI bindings are installed, fills its components
+ * in the same native call. Without them only the string is parsed and the
+ * components are left for the caller to fetch lazily.
+ */
+const parseWithComponents = (
+  s: string,
+  count: number,
+  combined: ((s: string, out: ArrayBuffer) => string) | undefined,
+  parse: (s: string) => string
+): ParseResult => {
+  if (combined) {
+    const out = new Int32Array(count);
+    return [combined(s, out.buffer), out];
+  }
+  return [parse(s), undefined];
+};
+
+export const parsePlainTime = (s: string): ParseResult =>
+  parseWithComponents(
+    s,
+    PLAIN_TIME_COMPONENT_COUNT,
+    NativeTemporalJSI.plainTimeFromStringWithComponents,
+    (item) => NativeTemporal.plainTimeFromString(item)
+  );
+
+export const parsePlainDate = (s: string): ParseResult =>
+  parseWithComponents(
+    s,
+    PLAIN_DATE_COMPONENT_COUNT,
+    NativeTemporalJSI.plainDateFromStringWithComponents,
+    (item) => NativeTemporal.plainDateFromString(item)
+  );
+
+export const parsePlainDateTime = (s: string): ParseResult =>
+  parseWithComponents(
+    s,
+    PLAIN_DATE_TIME_COMPONENT_COUNT,
+    NativeTemporalJSI.plainDateTimeFromStringWithComponents,
+    (item) => NativeTemporal.plainDateTimeFromString(item)
+  );
+
+export const parseZonedDateTime = (s: string): ParseResult =>
+  parseWithComponents(
+    s,
+    ZONED_DATE_TIME_COMPONENT_COUNT,
+    NativeTemporalJSI.zonedDateTimeFromStringWithComponents,
+    (item) => NativeTemporal.zonedDateTimeFromString(item)
+  );
+
+/**
+ * Fetches PlainDateTime components from a native handle, or from the ISO
+ * string when there is no handle.
+ */
+export const plainDateTimeComponents = (
+  iso: string | undefined,
+  handle: number | undefined
+): ArrayLike<number> => {
+  const {
+    plainDateTimeGetAllComponentsInto,
+    plainDateTimeHandleGetAllComponentsInto,
+  } = NativeTemporalJSI;
+  if (handle !== undefined) {
+    if (plainDateTimeHandleGetAllComponentsInto) {
+      const out = new Int32Array(PLAIN_DATE_TIME_COMPONENT_COUNT);
+      plainDateTimeHandleGetAllComponentsInto(handle, out.buffer);
+      return out;
+    }
+    return NativeTemporal.plainDateTimeHandleGetAllComponents(handle);
+  }
+  if (plainDateTimeGetAllComponentsInto) {
+    const out = new Int32Array(PLAIN_DATE_TIME_COMPONENT_COUNT);
+    plainDateTimeGetAllComponentsInto(iso!, out.buffer);
+    return out;
+  }
+  return NativeTemporal.plainDateTimeGetAllComponents(iso!);
+};
+
+/**
+ * Fetches ZonedDateTime components from a native handle, or from the ISO
+ * string when there is no handle.
+ */
+export const zonedDateTimeComponents = (
+  iso: string | undefined,
+  handle: number | undefined
+): ArrayLike<number> => {
+  const {
+    zonedDateTimeGetAllComponentsInto,
+    zonedDateTimeHandleGetAllComponentsInto,
+  } = NativeTemporalJSI;
+  if (handle !== undefined && zonedDateTimeHandleGetAllComponentsInto) {
+    const out = new Int32Array(ZONED_DATE_TIME_COMPONENT_COUNT);
+    zonedDateTimeHandleGetAllComponentsInto(handle, out.buffer);
+    return out;
+  }
+  if (handle === undefined && zonedDateTimeGetAllComponentsInto) {
+    const out = new Int32Array(ZONED_DATE_TIME_COMPONENT_COUNT);
+    zonedDateTimeGetAllComponentsInto(iso!, out.buffer);
+    return out;
+  }
+
+  // The TurboModule returns the offset as a single nanosecond value
+  const components =
+    handle !== undefined
+      ? NativeTemporal.zonedDateTimeHandleGetAllComponents(handle)
+      : NativeTemporal.zonedDateTimeGetAllComponents(iso!);
+  const offset = components[OFFSET_SECONDS_INDEX]!;
+  components[OFFSET_SECONDS_INDEX] = Math.trunc(offset / 1e9);
+  components[OFFSET_NANOSECONDS_INDEX] = offset % 1e9;
+  return components;
+};
+
+export const zonedOffsetNanoseconds = (components: ArrayLike<number>) =>
+  components[OFFSET_SECONDS_INDEX]! * 1e9 +
+  components[OFFSET_NANOSECONDS_INDEX]!;
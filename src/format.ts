@@ -0,0 +1,186 @@
+import NativeTemporal from './native';
+import { wrapNativeCall } from './utils';
+
+/**
+ * Options accepted by `toString` on the types with a time of day.
+ * Instant and PlainTime ignore the annotation options.
+ */
+export interface ToStringOptions {
+  /** 0-9, or 'auto' (the default) for as many digits as needed */
+  fractionalSecondDigits?: 'auto' | number;
+  /** 'minute', 'second', 'millisecond', 'microsecond' or 'nanosecond' */
+  smallestUnit?: string;
+  /** Defaults to 'trunc' */
+  roundingMode?: string;
+  calendarName?: 'auto' | 'always' | 'never' | 'critical';
+  timeZoneName?: 'auto' | 'never' | 'critical';
+  offset?: 'auto' | 'never';
+}
+
+const isAuto = (value: string | null): boolean =>
+  value === null || value === 'auto';
+
+/** Distinct option sets remembered by CompiledToStringOptions.from. */
+const COMPILED_CACHE_CAPACITY = 256;
+
+const compiled = new Map<string, CompiledToStringOptions>();
+
+// Stands in for omitted options in cache keys, apart from any real value.
+const UNSET = '\0';
+
+/**
+ * ToStringOptions validated and packed natively once.
+ *
+ * The packed value is what the `*WithPackedOptions` native methods take, so
+ * calls with the same options don't send or parse the option strings each
+ * time, and it identifies cached output. `from` accepts either form, so
+ * APIs can take both, and returns the same instance for equal plain
+ * objects.
+ */
+export class CompiledToStringOptions {
+  /** -1 for 'auto' */
+  readonly fractionalSecondDigits: number;
+  readonly smallestUnit: string | null;
+  readonly roundingMode: string | null;
+  readonly calendarName: string | null;
+  readonly timeZoneName: string | null;
+  readonly offset: string | null;
+  /** The packed options from `toStringOptionsNew` */
+  readonly packed: number;
+  /** Identifies these options in the format cache */
+  readonly key: string;
+  /** True when the output is the plain `toString()` one */
+  readonly isDefault: boolean;
+
+  private constructor(options: ToStringOptions) {
+    const digits = options.fractionalSecondDigits ?? 'auto';
+    if (
+      digits !== 'auto' &&
+      !(Number.isInteger(digits) && digits >= 0 && digits <= 9)
+    ) {
+      throw new RangeError(`Invalid fractionalSecondDigits: ${digits}`);
+    }
+    this.fractionalSecondDigits = digits === 'auto' ? -1 : digits;
+    this.smallestUnit = options.smallestUnit ?? null;
+    this.roundingMode = options.roundingMode ?? null;
+    this.calendarName = options.calendarName ?? null;
+    this.timeZoneName = options.timeZoneName ?? null;
+    this.offset = options.offset ?? null;
+    this.isDefault =
+      this.fractionalSecondDigits === -1 &&
+      this.smallestUnit === null &&
+      this.roundingMode === null &&
+      isAuto(this.calendarName) &&
+      isAuto(this.timeZoneName) &&
+      isAuto(this.offset);
+    // Default options never reach a native formatter.
+    this.packed = this.isDefault
+      ? 0
+      : wrapNativeCall(
+          () =>
+            NativeTemporal.toStringOptionsNew(
+              this.fractionalSecondDigits,
+              this.smallestUnit,
+              this.roundingMode,
+              this.calendarName,
+              this.timeZoneName,
+              this.offset
+            ),
+          'Invalid toString options'
+        );
+    this.key = String(this.packed);
+    Object.freeze(this);
+  }
+
+  static from(
+    options: ToStringOptions | CompiledToStringOptions
+  ): CompiledToStringOptions {
+    if (options instanceof CompiledToStringOptions) {
+      return options;
+    }
+    const key = [
+      options.fractionalSecondDigits ?? UNSET,
+      options.smallestUnit ?? UNSET,
+      options.roundingMode ?? UNSET,
+      options.calendarName ?? UNSET,
+      options.timeZoneName ?? UNSET,
+      options.offset ?? UNSET,
+    ].join('|');
+    let result = compiled.get(key);
+    if (result === undefined) {
+      result = new CompiledToStringOptions(options);
+      if (compiled.size >= COMPILED_CACHE_CAPACITY) {
+        compiled.clear();
+      }
+      compiled.set(key, result);
+    }
+    return result;
+  }
+}
+
+/** Formatted strings kept by the format cache. */
+const FORMAT_CACHE_CAPACITY = 1024;
+
+export interface FormatCacheStats {
+  hits: number;
+  misses: number;
+  size: number;
+}
+
+// Least recently used first: Map iteration follows insertion order, so a
+// hit re-inserts its entry and eviction takes the first key.
+const formatCache = new Map<string, string>();
+let formatCacheHits = 0;
+let formatCacheMisses = 0;
+
+/**
+ * Formats `iso` with `options` through `format`, memoizing the result.
+ * `kind` keeps equal strings of different types apart. Default options
+ * return `iso` without a native call or a cache entry.
+ */
+export const formatWithOptions = (
+  kind: string,
+  iso: string,
+  options: CompiledToStringOptions,
+  format: (iso: string, options: CompiledToStringOptions) => string
+): string => {
+  if (options.isDefault) {
+    return iso;
+  }
+  const key = `${kind}\0${iso}\0${options.key}`;
+  const cached = formatCache.get(key);
+  if (cached !== undefined) {
+    formatCacheHits++;
+    formatCache.delete(key);
+    formatCache.set(key, cached);
+    return cached;
+  }
+  formatCacheMisses++;
+  const formatted = wrapNativeCall(
+    () => format(iso, options),
+    'Failed to format'
+  );
+  if (formatCache.size >= FORMAT_CACHE_CAPACITY) {
+    formatCache.delete(formatCache.keys().next().value!);
+  }
+  formatCache.set(key, formatted);
+  return formatted;
+};
+
+/**
+ * Returns the counters of the `toString(options)` cache.
+ */
+export const getFormatCacheStats = (): FormatCacheStats => ({
+  hits: formatCacheHits,
+  misses: formatCacheMisses,
+  size: formatCache.size,
+});
+
+/**
+ * Empties the `toString(options)` cache and resets its counters.
+ */
+export const clearFormatCache = (): void => {
+  formatCache.clear();
+  formatCacheHits = 0;
+  formatCacheMisses = 0;
+};
@@ -0,0 +1,32 @@
+import type { Duration } from './types/Duration';
+import type { Instant } from './types/Instant';
+import type { Now } from './types/Now';
+import type { PlainTime } from './types/PlainTime';
+import type { PlainDate } from './types/PlainDate';
+import type { PlainDateTime } from './types/PlainDateTime';
+import type { PlainMonthDay } from './types/PlainMonthDay';
+import type { PlainYearMonth } from './types/PlainYearMonth';
+import type { Calendar } from './types/Calendar';
+import type { TimeZone } from './types/TimeZone';
+import type { ZonedDateTime } from './types/ZonedDateTime';
+
+/**
+ * The `Temporal` namespace installed by the polyfills.
+ */
+export interface TemporalNamespace {
+  Duration: typeof Duration;
+  Instant: typeof Instant;
+  Now: typeof Now;
+  PlainTime: typeof PlainTime;
+  PlainDate: typeof PlainDate;
+  PlainDateTime: typeof PlainDateTime;
+  PlainMonthDay: typeof PlainMonthDay;
+  PlainYearMonth: typeof PlainYearMonth;
+  Calendar: typeof Calendar;
+  TimeZone: typeof TimeZone;
+  ZonedDateTime: typeof ZonedDateTime;
+}
+
+declare global {
+  var Temporal: TemporalNamespace;
+}
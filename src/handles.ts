@@ -0,0 +1,64 @@
+import NativeTemporal from './native';
+import { wrapNativeCall } from './utils';
+
+/**
+ * Native handles keep parsed Temporal values on the native side so chained
+ * operations (e.g. `dt.add(a).with(b).subtract(c)`) don't re-parse and
+ * re-format an ISO string on every step.
+ *
+ * Handles are released by a FinalizationRegistry once their owner is
+ * garbage collected. Engines without FinalizationRegistry fall back to the
+ * string-based API, which never leaks.
+ */
+const registry: FinalizationRegistry<number> | null =
+  typeof FinalizationRegistry === 'undefined'
+    ? null
+    : new FinalizationRegistry<number>((handle) =>
+        NativeTemporal.handleRelease(handle)
+      );
+
+export const handlesSupported = registry !== null;
+
+const cachedHandles = new WeakMap<object, number>();
+
+/**
+ * Ties the lifetime of a native handle to `owner` and returns the handle.
+ */
+export const trackHandle = (owner: object, handle: number): number => {
+  registry!.register(owner, handle, owner);
+  return handle;
+};
+
+/**
+ * Releases a handle before `owner` is collected, for owners that free large
+ * native allocations eagerly. Works whether or not the handle was tracked.
+ */
+export const releaseHandle = (owner: object, handle: number): void => {
+  registry?.unregister(owner);
+  NativeTemporal.handleRelease(handle);
+};
+
+/**
+ * Returns the handle cached for `owner`, creating it on first use.
+ * Used for operands (such as durations) that don't own a handle themselves.
+ */
+export const cachedHandle = (owner: object, create: () => number): number => {
+  let handle = cachedHandles.get(owner);
+  if (handle === undefined) {
+    handle = trackHandle(owner, create());
+    cachedHandles.set(owner, handle);
+  }
+  return handle;
+};
+
+/**
+ * Returns a Duration-kind handle for any object whose toString() is an ISO
+ * 8601 duration.
+ */
+export const durationHandle = (duration: object): number =>
+  cachedHandle(duration, () =>
+    wrapNativeCall(
+      () => NativeTemporal.durationHandleFromString(duration.toString()),
+      'Invalid duration'
+    )
+  );
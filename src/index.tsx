@@ -1,9 +1,114 @@
-import Temporal from './NativeTemporal';
+import Temporal from './native';
+import { wrapNativeCall } from './utils';
 
 export function multiply(a: number, b: number): number {
   return Temporal.multiply(a, b);
 }
 
+export interface TimeZoneCacheStats {
+  hits: number;
+  misses: number;
+  size: number;
+}
+
+/**
+ * Returns the counters of the native process-wide TimeZone cache.
+ */
+export function getTimeZoneCacheStats(): TimeZoneCacheStats {
+  const [hits, misses, size] = Temporal.timeZoneCacheStats();
+  return { hits: hits!, misses: misses!, size: size! };
+}
+
+/**
+ * Empties the native TimeZone cache and resets its counters.
+ */
+export function clearTimeZoneCache(): void {
+  Temporal.timeZoneCacheClear();
+}
+
+export interface NativeCallStats {
+  calls: number;
+  totalNanoseconds: number;
+  parseCount: number;
+  formatCount: number;
+  errorCount: number;
+}
+
+export interface TemporalStats {
+  /** False unless the native library was built with the `stats` feature. */
+  enabled: boolean;
+  /** Outermost calls only, plus heap traffic from the native library. */
+  totals: NativeCallStats & {
+    allocationCount: number;
+    allocationBytes: number;
+  };
+  /** Counters per native entry point that has been called at least once. */
+  functions: Record<string, NativeCallStats>;
+}
+
+/**
+ * Sets how many threads the native batch operations (parsing, sorting and
+ * comparing many values, binary encoding, zone conversion of many instants
+ * and recurrence expansion) may split large batches across. 0 (the default)
+ * uses the device's performance cores; 1 keeps every batch on the calling
+ * thread. Results are the same for every setting.
+ */
+export function setBatchThreads(threads: number): void {
+  wrapNativeCall(
+    () => Temporal.setBatchThreads(threads),
+    'Failed to set batch threads'
+  );
+}
+
+/**
+ * Returns the number of threads large native batches run on.
+ */
+export function getBatchThreads(): number {
+  return Temporal.getBatchThreads();
+}
+
+/**
+ * Returns the native call counters, for attributing time to specific
+ * operations. Counting has to be enabled at build time with the `stats`
+ * cargo feature; otherwise every counter is zero.
+ */
+export function getStats(): TemporalStats {
+  return JSON.parse(Temporal.getStats()) as TemporalStats;
+}
+
+/**
+ * Zeroes the native call counters.
+ */
+export function resetStats(): void {
+  Temporal.resetStats();
+}
+
+export { lastValidationError } from './validation';
+export { BINARY_RECORD_SIZE, type BinaryInput } from './binary';
+export type { InstantStream, InstantStreamFormat } from './stream';
+export {
+  CompiledToStringOptions,
+  clearFormatCache,
+  getFormatCacheStats,
+  type FormatCacheStats,
+  type ToStringOptions,
+} from './format';
+export {
+  CompiledRoundingOptions,
+  type RoundOptions,
+  type RoundingOptionsLike,
+} from './rounding';
+export { setForceNativeArithmetic } from './types/isoArithmetic';
+export { expandRecurrence, ZonedDateTimeRange } from './recurrence';
+export { ZonedClock } from './clock';
+export {
+  InstantColumn,
+  PlainDateColumn,
+  type BucketUnit,
+  type InstantBucket,
+  type PlainDateBucket,
+} from './column';
+
 // Export Temporal types
 export { Instant } from './types/Instant';
 export { Duration } from './types/Duration';
@@ -22,3 +127,4 @@ export type { PlainDateLike } from './types/PlainDate';
 export type { PlainDateTimeLike } from './types/PlainDateTime';
 export type { PlainYearMonthLike } from './types/PlainYearMonth';
 export type { PlainMonthDayLike } from './types/PlainMonthDay';
+export type { PlainDateTimeColumns } from './types/TimeZone';
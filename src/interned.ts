@@ -0,0 +1,50 @@
+import { NativeTemporalJSI } from './native';
+import { wrapNativeCall } from './utils';
+
+/**
+ * Numeric IDs for time zones and calendars.
+ *
+ * With the JSI bindings an identifier is interned once and the `*Interned`
+ * methods take the ID instead, so a hot loop of conversions in one zone no
+ * longer re-parses the zone name on every call. The IDs are process-wide and
+ * stable. The bindings that install `timeZoneIntern` install every
+ * `*Interned` method too. Without them, or once the native table is full,
+ * these return undefined and callers keep passing strings.
+ */
+
+const timeZoneIds = new Map<string, number | undefined>();
+const calendarIds = new Map<string, number | undefined>();
+
+const internedId = (
+  cache: Map<string, number | undefined>,
+  identifier: string,
+  intern: ((identifier: string) => number) | undefined
+): number | undefined => {
+  if (intern === undefined) {
+    return undefined;
+  }
+  if (cache.has(identifier)) {
+    return cache.get(identifier);
+  }
+  let id: number | undefined;
+  try {
+    id = wrapNativeCall(() => intern(identifier), 'Failed to intern');
+  } catch {
+    // Table full or an identifier the string path reports better.
+    id = undefined;
+  }
+  cache.set(identifier, id);
+  return id;
+};
+
+/**
+ * The interned ID of a time zone identifier, if the bindings support it.
+ */
+export const internedTimeZoneId = (identifier: string): number | undefined =>
+  internedId(timeZoneIds, identifier, NativeTemporalJSI.timeZoneIntern);
+
+/**
+ * The interned ID of a calendar identifier, if the bindings support it.
+ */
+export const internedCalendarId = (identifier: string): number | undefined =>
+  internedId(calendarIds, identifier, NativeTemporalJSI.calendarIntern);
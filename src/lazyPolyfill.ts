@@ -0,0 +1,47 @@
+import type { TemporalNamespace } from './global';
+
+export type { TemporalNamespace } from './global';
+
+type Loaders = {
+  [K in keyof TemporalNamespace]: () => TemporalNamespace[K];
+};
+
+// Each class module (and, through it, the native module and its time zone
+// data) is only evaluated the first time its property is read.
+const loaders: Loaders = {
+  Duration: () => require('./types/Duration').Duration,
+  Instant: () => require('./types/Instant').Instant,
+  Now: () => require('./types/Now').Now,
+  PlainTime: () => require('./types/PlainTime').PlainTime,
+  PlainDate: () => require('./types/PlainDate').PlainDate,
+  PlainDateTime: () => require('./types/PlainDateTime').PlainDateTime,
+  PlainMonthDay: () => require('./types/PlainMonthDay').PlainMonthDay,
+  PlainYearMonth: () => require('./types/PlainYearMonth').PlainYearMonth,
+  Calendar: () => require('./types/Calendar').Calendar,
+  TimeZone: () => require('./types/TimeZone').TimeZone,
+  ZonedDateTime: () => require('./types/ZonedDateTime').ZonedDateTime,
+};
+
+function createLazyNamespace(): TemporalNamespace {
+  const namespace = {} as TemporalNamespace;
+  for (const key of Object.keys(loaders) as (keyof TemporalNamespace)[]) {
+    Object.defineProperty(namespace, key, {
+      configurable: true,
+      enumerable: true,
+      get() {
+        const value = loaders[key]();
+        // Replace the getter so later reads are plain property loads.
+        Object.defineProperty(namespace, key, {
+          configurable: true,
+          enumerable: true,
+          writable: true,
+          value,
+        });
+        return value;
+      },
+    });
+  }
+  return namespace;
+}
+
+globalThis.Temporal = globalThis.Temporal || createLazyNamespace();
@@ -0,0 +1,120 @@
+import TurboTemporal, { type Spec } from './NativeTemporal';
+
+/**
+ * Methods only the JSI bindings provide, since they take arguments the
+ * TurboModule codegen can't express (such as an ArrayBuffer to fill).
+ */
+export interface JSIExtensions {
+  plainTimeFromStringWithComponents(s: string, out: ArrayBuffer): string;
+  plainDateFromStringWithComponents(s: string, out: ArrayBuffer): string;
+  plainDateTimeFromStringWithComponents(s: string, out: ArrayBuffer): string;
+  zonedDateTimeFromStringWithComponents(s: string, out: ArrayBuffer): string;
+  plainDateTimeGetAllComponentsInto(s: string, out: ArrayBuffer): void;
+  plainDateTimeHandleGetAllComponentsInto(
+    handle: number,
+    out: ArrayBuffer
+  ): void;
+  zonedDateTimeGetAllComponentsInto(s: string, out: ArrayBuffer): void;
+  zonedDateTimeHandleGetAllComponentsInto(
+    handle: number,
+    out: ArrayBuffer
+  ): void;
+  zonedDateTimeToBytesMany(
+    strings: string[],
+    out: ArrayBuffer,
+    byteOffset: number
+  ): void;
+  zonedDateTimeFromBytesMany(
+    bytes: ArrayBuffer,
+    byteOffset: number,
+    count: number
+  ): string[];
+  instantParseStream(
+    bytes: ArrayBuffer,
+    byteOffset: number,
+    byteLength: number,
+    format: number
+  ): { seconds: Float64Array; nanoseconds: Int32Array; errors: Int8Array };
+  timeZoneIntern(id: string): number;
+  calendarIntern(id: string): number;
+  timeZoneGetOffsetNanosecondsForInterned(tz: number, instant: string): number;
+  timeZoneGetOffsetStringForInterned(tz: number, instant: string): string;
+  timeZoneGetPlainDateTimeForInterned(
+    tz: number,
+    instant: string,
+    calendar: number
+  ): string;
+  timeZoneGetInstantForInterned(
+    tz: number,
+    dateTime: string,
+    disambiguation: string | null
+  ): string;
+  timeZoneGetNextTransitionInterned(tz: number, instant: string): string | null;
+  timeZoneGetPreviousTransitionInterned(
+    tz: number,
+    instant: string
+  ): string | null;
+  timeZoneGetTransitionsInterned(
+    tz: number,
+    startSeconds: number,
+    startNanoseconds: number,
+    endSeconds: number,
+    endNanoseconds: number,
+    cap: number
+  ): number[];
+  timeZoneGetPlainDateTimesForManyInterned(
+    tz: number,
+    epochNanoseconds: number[]
+  ): number[];
+  instantToZonedDateTimeInterned(
+    seconds: number,
+    nanoseconds: number,
+    calendar: number,
+    tz: number
+  ): string;
+  zonedClockReadInto(clock: number, out: ArrayBuffer): void;
+}
+
+declare global {
+  // Installed by cpp/TemporalJSI.cpp
+  var __TemporalJSI: Partial<Spec & JSIExtensions> | undefined;
+}
+
+/**
+ * Resolves the native module used by all Temporal types.
+ *
+ * When the C++ JSI bindings are available their methods shadow the
+ * TurboModule ones, skipping the Objective-C / Kotlin string bridge.
+ * Anything the JSI layer doesn't implement (e.g. device time zone lookups)
+ * falls through to the TurboModule via the prototype chain.
+ */
+const resolveNativeModule = (): Spec => {
+  if (globalThis.__TemporalJSI === undefined) {
+    try {
+      TurboTemporal.install();
+    } catch {
+      // Older platform code without install(); keep the TurboModule.
+    }
+  }
+
+  const jsi = globalThis.__TemporalJSI;
+  if (jsi === undefined) {
+    return TurboTemporal;
+  }
+
+  const module: Record<string, unknown> = Object.create(TurboTemporal);
+  for (const name of Object.keys(jsi)) {
+    module[name] = jsi[name as keyof Spec];
+  }
+  return module as unknown as Spec;
+};
+
+const NativeTemporal: Spec = resolveNativeModule();
+
+/**
+ * The JSI-only methods, or an empty object when the bindings aren't installed.
+ */
+export const NativeTemporalJSI: Partial<JSIExtensions> =
+  globalThis.__TemporalJSI ?? {};
+
+export default NativeTemporal;
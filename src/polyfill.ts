@@ -10,21 +10,7 @@ import { Calendar } from './types/Calendar';
 import { TimeZone } from './types/TimeZone';
 import { ZonedDateTime } from './types/ZonedDateTime';
 
-declare global {
-  var Temporal: {
-    Duration: typeof Duration;
-    Instant: typeof Instant;
-    Now: typeof Now;
-    PlainTime: typeof PlainTime;
-    PlainDate: typeof PlainDate;
-    PlainDateTime: typeof PlainDateTime;
-    PlainMonthDay: typeof PlainMonthDay;
-    PlainYearMonth: typeof PlainYearMonth;
-    Calendar: typeof Calendar;
-    TimeZone: typeof TimeZone;
-    ZonedDateTime: typeof ZonedDateTime;
-  };
-}
+export type { TemporalNamespace } from './global';
 
 globalThis.Temporal = globalThis.Temporal || {
   Duration,
@@ -0,0 +1,122 @@
+import NativeTemporal from './native';
+import { handlesSupported, trackHandle } from './handles';
+import {
+  epochNanosecondsFromPairs,
+  wrapNativeCall,
+  wrapNativePromise,
+} from './utils';
+import { Duration, type DurationLike } from './types/Duration';
+import { Instant } from './types/Instant';
+import { PlainDateTime, type PlainDateTimeLike } from './types/PlainDateTime';
+import { TimeZone } from './types/TimeZone';
+import { ZonedDateTime } from './types/ZonedDateTime';
+
+/** Occurrences pulled per native call while iterating a range. */
+const ITERATOR_BATCH_SIZE = 256;
+
+/**
+ * Expands a recurrence on a native worker thread, so long expansions (years
+ * of occurrences, non-ISO calendars) never block the JS thread.
+ *
+ * Occurrence `i` is `start + duration * i` with `start` placed in
+ * `timeZone`, computed from `start` rather than from the previous
+ * occurrence so month-end dates don't drift. Calendar units follow the
+ * calendar of `start`.
+ *
+ * @example
+ * await expandRecurrence('2024-01-31T09:00', { months: 1 }, 12, 'Europe/Paris')
+ */
+export async function expandRecurrence(
+  start: PlainDateTime | PlainDateTimeLike | string,
+  duration: Duration | DurationLike | string,
+  count: number,
+  timeZone: TimeZone | string
+): Promise<Instant[]> {
+  const startIso = PlainDateTime.from(start).toString();
+  const durationIso = Duration.from(duration).toString();
+  const timeZoneId = TimeZone.from(timeZone).id;
+  const pairs = await wrapNativePromise(
+    () =>
+      NativeTemporal.expandRecurrence(startIso, durationIso, count, timeZoneId),
+    'Failed to expand recurrence'
+  );
+  return epochNanosecondsFromPairs(pairs).map((ns) =>
+    Instant.fromEpochNanoseconds(ns)
+  );
+}
+
+/**
+ * A series of `start + step * i` kept in native memory between calls, so
+ * calendar grids and reminder schedulers pull a whole batch of occurrences
+ * with one native call instead of one `add()` per step.
+ *
+ * Occurrences follow the time zone and calendar of `start` and stop before
+ * `end`, if given, in the direction of `step`. Steps without calendar units
+ * (hours and smaller) are exact time and never consult the time zone.
+ *
+ * @example
+ * const range = ZonedDateTimeRange.from(
+ *   '2024-03-01T09:00:00+01:00[Europe/Paris]',
+ *   { days: 1 },
+ *   '2024-04-01T00:00:00+02:00[Europe/Paris]'
+ * );
+ * for (const instant of range) schedule(instant);
+ */
+export class ZonedDateTimeRange implements Iterable<Instant> {
+  #handle: number | undefined;
+
+  private constructor(handle: number) {
+    // Without FinalizationRegistry the handle is released once the range is
+    // exhausted instead.
+    this.#handle = handlesSupported ? trackHandle(this, handle) : handle;
+  }
+
+  static from(
+    start: ZonedDateTime | string,
+    step: Duration | DurationLike | string,
+    end?: ZonedDateTime | string
+  ): ZonedDateTimeRange {
+    const startIso = ZonedDateTime.from(start).toString();
+    const stepIso = Duration.from(step).toString();
+    const endIso =
+      end === undefined ? null : ZonedDateTime.from(end).toString();
+    return new ZonedDateTimeRange(
+      wrapNativeCall(
+        () => NativeTemporal.zonedDateTimeRangeNew(startIso, stepIso, endIso),
+        'Invalid range'
+      )
+    );
+  }
+
+  /**
+   * Returns up to `n` further occurrences; an empty array once the range is
+   * exhausted.
+   */
+  nextBatch(n: number): Instant[] {
+    const handle = this.#handle;
+    if (handle === undefined || n <= 0) {
+      return [];
+    }
+    const pairs = wrapNativeCall(
+      () => NativeTemporal.zonedDateTimeRangeNextBatch(handle, n),
+      'Failed to advance range'
+    );
+    if (pairs.length === 0 && !handlesSupported) {
+      NativeTemporal.handleRelease(handle);
+      this.#handle = undefined;
+    }
+    return epochNanosecondsFromPairs(pairs).map((ns) =>
+      Instant.fromEpochNanoseconds(ns)
+    );
+  }
+
+  *[Symbol.iterator](): Iterator<Instant> {
+    for (;;) {
+      const batch = this.nextBatch(ITERATOR_BATCH_SIZE);
+      if (batch.length === 0) {
+        return;
+      }
+      yield* batch;
+    }
+  }
+}
@@ -0,0 +1,87 @@
+import NativeTemporal from './native';
+import { wrapNativeCall } from './utils';
+
+/**
+ * Options accepted by until, since and round.
+ */
+export interface RoundingOptionsLike {
+  largestUnit?: string;
+  smallestUnit?: string;
+  roundingIncrement?: number;
+  roundingMode?: string;
+}
+
+/**
+ * Options accepted by round, which requires a smallest unit.
+ */
+export interface RoundOptions {
+  smallestUnit: string;
+  roundingIncrement?: number;
+  roundingMode?: string;
+}
+
+/** Distinct option sets remembered by CompiledRoundingOptions.from. */
+const COMPILED_CACHE_CAPACITY = 256;
+
+const compiled = new Map<string, CompiledRoundingOptions>();
+
+// Stands in for omitted options in cache keys, apart from any real value.
+const UNSET = '\0';
+
+/**
+ * Until/since/round options validated and packed natively once.
+ *
+ * The packed value is what the `*WithOptions` native methods take, so calls
+ * with the same options don't send or parse unit and mode strings each
+ * time. `from` returns the same instance for equal plain objects; holding
+ * on to one skips even that lookup.
+ */
+export class CompiledRoundingOptions {
+  readonly largestUnit: string | undefined;
+  readonly smallestUnit: string | undefined;
+  readonly roundingIncrement: number | undefined;
+  readonly roundingMode: string | undefined;
+  /** The packed options from `roundingOptionsNew` */
+  readonly packed: number;
+
+  private constructor(options: RoundingOptionsLike) {
+    this.largestUnit = options.largestUnit;
+    this.smallestUnit = options.smallestUnit;
+    this.roundingIncrement = options.roundingIncrement;
+    this.roundingMode = options.roundingMode;
+    this.packed = wrapNativeCall(
+      () =>
+        NativeTemporal.roundingOptionsNew(
+          options.largestUnit ?? null,
+          options.smallestUnit ?? null,
+          options.roundingIncrement ?? 1,
+          options.roundingMode ?? null
+        ),
+      'Invalid rounding options'
+    );
+    Object.freeze(this);
+  }
+
+  static from(
+    options: RoundingOptionsLike | CompiledRoundingOptions = {}
+  ): CompiledRoundingOptions {
+    if (options instanceof CompiledRoundingOptions) {
+      return options;
+    }
+    const key = [
+      options.largestUnit ?? UNSET,
+      options.smallestUnit ?? UNSET,
+      options.roundingIncrement ?? UNSET,
+      options.roundingMode ?? UNSET,
+    ].join('|');
+    let result = compiled.get(key);
+    if (result === undefined) {
+      result = new CompiledRoundingOptions(options);
+      if (compiled.size >= COMPILED_CACHE_CAPACITY) {
+        compiled.clear();
+      }
+      compiled.set(key, result);
+    }
+    return result;
+  }
+}
@@ -0,0 +1,121 @@
+import NativeTemporal, { NativeTemporalJSI } from './native';
+import { binaryBytes, type BinaryInput } from './binary';
+import { wrapNativeCall } from './utils';
+
+/**
+ * Instants parsed from a response body, as parallel columns: a stream of
+ * 100k timestamps costs three typed arrays rather than 100k strings and
+ * objects.
+ */
+export interface InstantStream {
+  /** The number of items in the stream */
+  readonly length: number;
+  /** Floored epoch seconds of each item, 0 for items that failed */
+  readonly seconds: Float64Array;
+  /** Nanosecond remainder in [0, 1e9) of each item */
+  readonly nanoseconds: Int32Array;
+  /** 0 for parsed items, otherwise 1 (RangeError) or 2 (TypeError) */
+  readonly errors: Int8Array;
+}
+
+/**
+ * `'lines'` reads one item per line; `'json'` the string elements of a JSON
+ * array.
+ */
+export type InstantStreamFormat = 'lines' | 'json';
+
+const STREAM_FORMATS: Record<InstantStreamFormat, number> = {
+  lines: 0,
+  json: 1,
+};
+
+const RANGE_ERROR = 1;
+const TYPE_ERROR = 2;
+
+/**
+ * Decodes the stream for the TurboModule fallback. Instant strings are
+ * ASCII, so anything else fails to parse either way.
+ */
+const decodeAscii = (bytes: Uint8Array): string => {
+  let text = '';
+  for (let i = 0; i < bytes.length; i += 8192) {
+    text += String.fromCharCode(...bytes.subarray(i, i + 8192));
+  }
+  return text;
+};
+
+const streamItems = (
+  bytes: Uint8Array,
+  format: InstantStreamFormat
+): unknown[] => {
+  const text = decodeAscii(bytes);
+  if (format === 'lines') {
+    return text
+      .split('\n')
+      .map((line) => line.trim())
+      .filter((line) => line.length > 0);
+  }
+  const items: unknown = JSON.parse(text);
+  if (!Array.isArray(items)) {
+    throw new TypeError('Instant stream must be a JSON array');
+  }
+  return items;
+};
+
+/**
+ * Parses the items one native call at a time when the JSI bindings aren't
+ * installed.
+ */
+const parseItems = (items: unknown[]): Omit<InstantStream, 'length'> => {
+  const seconds = new Float64Array(items.length);
+  const nanoseconds = new Int32Array(items.length);
+  const errors = new Int8Array(items.length);
+  items.forEach((item, i) => {
+    if (typeof item !== 'string') {
+      errors[i] = TYPE_ERROR;
+      return;
+    }
+    try {
+      const pair = wrapNativeCall(
+        () => NativeTemporal.instantParseEpochNanoseconds(item),
+        'Invalid instant string'
+      );
+      seconds[i] = pair[0]!;
+      nanoseconds[i] = pair[1]!;
+    } catch (error) {
+      errors[i] = error instanceof TypeError ? TYPE_ERROR : RANGE_ERROR;
+    }
+  });
+  return { seconds, nanoseconds, errors };
+};
+
+/**
+ * Parses every instant string in a UTF-8 buffer, such as
+ * `await response.arrayBuffer()`, with a single native call when the JSI
+ * bindings are installed. Invalid items don't throw; their error type is
+ * reported in `errors`.
+ */
+export const parseInstantStream = (
+  input: BinaryInput,
+  format: InstantStreamFormat = 'json'
+): InstantStream => {
+  const code = STREAM_FORMATS[format];
+  if (code === undefined) {
+    throw new RangeError(`Unknown instant stream format: ${format}`);
+  }
+  const bytes = binaryBytes(input);
+  const { instantParseStream } = NativeTemporalJSI;
+  const parsed = instantParseStream
+    ? wrapNativeCall(
+        () =>
+          instantParseStream(
+            bytes.buffer as ArrayBuffer,
+            bytes.byteOffset,
+            bytes.byteLength,
+            code
+          ),
+        'Failed to parse instant stream'
+      )
+    : parseItems(streamItems(bytes, format));
+  return { length: parsed.errors.length, ...parsed };
+};
@@ -1,4 +1,4 @@
-import NativeTemporal from '../NativeTemporal';
+import NativeTemporal from '../native';
 import { wrapNativeCall } from '../utils';
 
 /**
@@ -1,5 +1,14 @@
-import NativeTemporal from '../NativeTemporal';
+import NativeTemporal from '../native';
+import { ValueKind, isValidString } from '../validation';
 import { wrapNativeCall } from '../utils';
+import {
+  addDurations,
+  durationComponents,
+  formatDuration,
+  isValidDuration,
+  jsArithmeticEnabled,
+  type DurationFields,
+} from './isoArithmetic';
 
 /**
  * Sentinel value for "unchanged" in durationWith.
@@ -50,12 +59,30 @@ export class Duration {
   /** Internal ISO 8601 string representation */
   readonly #isoString: string;
 
-  /** Cached components array from native */
-  readonly #components: number[];
+  /** Components array from native, fetched on first use */
+  #componentsCache: ArrayLike<number> | undefined;
 
-  private constructor(isoString: string, components: number[]) {
+  private constructor(isoString: string, components?: ArrayLike<number>) {
     this.#isoString = isoString;
-    this.#components = components;
+    this.#componentsCache = components;
+  }
+
+  static #fromFields(fields: DurationFields): Duration {
+    return new Duration(formatDuration(fields), durationComponents(fields));
+  }
+
+  /**
+   * Components fetched from native on first field access.
+   */
+  get #components(): ArrayLike<number> {
+    if (this.#componentsCache === undefined) {
+      const isoString = this.#isoString;
+      this.#componentsCache = wrapNativeCall(
+        () => NativeTemporal.durationGetAllComponents(isoString),
+        'Failed to get duration components'
+      );
+    }
+    return this.#componentsCache;
   }
 
   /**
@@ -78,11 +105,7 @@ export class Duration {
         () => NativeTemporal.durationFromString(item),
         `Invalid duration string: ${item}`
       );
-      const components = wrapNativeCall(
-        () => NativeTemporal.durationGetAllComponents(isoString),
-        'Failed to get duration components'
-      );
-      return new Duration(isoString, components);
+      return new Duration(isoString);
     }
 
     if (typeof item !== 'object' || item === null) {
@@ -91,7 +114,26 @@ export class Duration {
       );
     }
 
-    // Create duration from components - all validation happens in native
+    if (jsArithmeticEnabled()) {
+      // -0 is normalized so it formats and compares like 0
+      const fields: DurationFields = [
+        (item.years ?? 0) + 0,
+        (item.months ?? 0) + 0,
+        (item.weeks ?? 0) + 0,
+        (item.days ?? 0) + 0,
+        (item.hours ?? 0) + 0,
+        (item.minutes ?? 0) + 0,
+        (item.seconds ?? 0) + 0,
+        (item.milliseconds ?? 0) + 0,
+        (item.microseconds ?? 0) + 0,
+        (item.nanoseconds ?? 0) + 0,
+      ];
+      if (isValidDuration(fields)) {
+        return Duration.#fromFields(fields);
+      }
+    }
+
+    // Anything the JS check rejects is validated (and reported) by native
     const isoString = wrapNativeCall(
       () =>
         NativeTemporal.durationFromComponents(
@@ -108,11 +150,23 @@ export class Duration {
         ),
       'Invalid duration values'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.durationGetAllComponents(isoString),
-      'Failed to get duration components'
-    );
-    return new Duration(isoString, components);
+    return new Duration(isoString);
+  }
+
+  /**
+   * Whether `Duration.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.Duration, item);
+  }
+
+  /**
+   * `Duration.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): Duration | null {
+    return Duration.isValid(item) ? Duration.from(item) : null;
   }
 
   /**
@@ -240,16 +294,16 @@ export class Duration {
   add(other: Duration | DurationLike | string): Duration {
     const otherDuration =
       other instanceof Duration ? other : Duration.from(other);
+    const fields = this.#addFields(otherDuration, 1);
+    if (fields) {
+      return Duration.#fromFields(fields);
+    }
     const isoString = wrapNativeCall(
       () =>
         NativeTemporal.durationAdd(this.#isoString, otherDuration.#isoString),
       'Failed to add durations'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.durationGetAllComponents(isoString),
-      'Failed to get duration components'
-    );
-    return new Duration(isoString, components);
+    return new Duration(isoString);
   }
 
   /**
@@ -261,6 +315,10 @@ export class Duration {
   subtract(other: Duration | DurationLike | string): Duration {
     const otherDuration =
       other instanceof Duration ? other : Duration.from(other);
+    const fields = this.#addFields(otherDuration, -1);
+    if (fields) {
+      return Duration.#fromFields(fields);
+    }
     const isoString = wrapNativeCall(
       () =>
         NativeTemporal.durationSubtract(
@@ -269,11 +327,22 @@ export class Duration {
         ),
       'Failed to subtract durations'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.durationGetAllComponents(isoString),
-      'Failed to get duration components'
-    );
-    return new Duration(isoString, components);
+    return new Duration(isoString);
+  }
+
+  /**
+   * Adds time-only durations in JS when both already have their components,
+   * so the fast path never costs an extra native fetch.
+   */
+  #addFields(other: Duration, sign: 1 | -1): DurationFields | undefined {
+    if (
+      !jsArithmeticEnabled() ||
+      this.#componentsCache === undefined ||
+      other.#componentsCache === undefined
+    ) {
+      return undefined;
+    }
+    return addDurations(durationFields(this), durationFields(other), sign);
   }
 
   /**
@@ -287,11 +356,7 @@ export class Duration {
       () => NativeTemporal.durationNegated(this.#isoString),
       'Failed to negate duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.durationGetAllComponents(isoString),
-      'Failed to get duration components'
-    );
-    return new Duration(isoString, components);
+    return new Duration(isoString);
   }
 
   /**
@@ -305,11 +370,7 @@ export class Duration {
       () => NativeTemporal.durationAbs(this.#isoString),
       'Failed to get absolute duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.durationGetAllComponents(isoString),
-      'Failed to get duration components'
-    );
-    return new Duration(isoString, components);
+    return new Duration(isoString);
   }
 
   /**
@@ -338,11 +399,7 @@ export class Duration {
         ),
       'Failed to modify duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.durationGetAllComponents(isoString),
-      'Failed to get duration components'
-    );
-    return new Duration(isoString, components);
+    return new Duration(isoString);
   }
 
   /**
@@ -389,3 +446,36 @@ export class Duration {
     return parts.length > 0 ? parts.join(', ') : '0 seconds';
   }
 }
+
+/**
+ * The fields of `duration` in the order the ISO arithmetic helpers use.
+ */
+export const durationFields = (duration: Duration): DurationFields => [
+  duration.years,
+  duration.months,
+  duration.weeks,
+  duration.days,
+  duration.hours,
+  duration.minutes,
+  duration.seconds,
+  duration.milliseconds,
+  duration.microseconds,
+  duration.nanoseconds,
+];
+
+/**
+ * Builds a Duration from fields computed by the ISO arithmetic helpers.
+ */
+export const durationFromFields = (fields: DurationFields): Duration =>
+  Duration.from({
+    years: fields[0],
+    months: fields[1],
+    weeks: fields[2],
+    days: fields[3],
+    hours: fields[4],
+    minutes: fields[5],
+    seconds: fields[6],
+    milliseconds: fields[7],
+    microseconds: fields[8],
+    nanoseconds: fields[9],
+  });
@@ -1,22 +1,91 @@
-import NativeTemporal from '../NativeTemporal';
-import { wrapNativeCall } from '../utils';
+import NativeTemporal, { NativeTemporalJSI } from '../native';
+import { internedCalendarId, internedTimeZoneId } from '../interned';
+import { ValueKind, isValidString } from '../validation';
+import {
+  CompiledRoundingOptions,
+  type RoundOptions,
+  type RoundingOptionsLike,
+} from '../rounding';
+import {
+  CompiledToStringOptions,
+  formatWithOptions,
+  type ToStringOptions,
+} from '../format';
+import {
+  binaryBytes,
+  readInstantRecords,
+  singleBinaryRecord,
+  writeInstantRecords,
+  type BinaryInput,
+} from '../binary';
+import {
+  parseInstantStream,
+  type InstantStream,
+  type InstantStreamFormat,
+} from '../stream';
+import {
+  epochNanosecondsFromPair,
+  epochNanosecondsFromPairs,
+  epochNanosecondsToPair,
+  wrapNativeCall,
+} from '../utils';
 import { Duration, type DurationLike } from './Duration';
 import { ZonedDateTime } from './ZonedDateTime';
 import { Calendar } from './Calendar';
 import { TimeZone } from './TimeZone';
 
+// Instants are limited to ±10^8 days around the Unix epoch.
+const NS_MAX_INSTANT = 8_640_000_000_000_000_000_000n;
+const NS_PER_MS = 1_000_000n;
+
+const compareBigInt = (a: bigint, b: bigint): -1 | 0 | 1 =>
+  a < b ? -1 : a > b ? 1 : 0;
+
+const checkEpochNanoseconds = (epochNanoseconds: bigint): bigint => {
+  if (epochNanoseconds < -NS_MAX_INSTANT || epochNanoseconds > NS_MAX_INSTANT) {
+    throw new RangeError('Instant is outside the supported range');
+  }
+  return epochNanoseconds;
+};
+
+const formatInstant = (iso: string, options: CompiledToStringOptions) =>
+  NativeTemporal.instantToStringWithPackedOptions(iso, options.packed);
+
 /**
  * A Temporal.Instant represents a fixed point in time, without regard to calendar or time zone,
  * e.g. July 20, 1969, at 20:17 UTC.
  *
+ * The instant is stored as epoch nanoseconds, so comparison and time
+ * arithmetic stay in JS; the ISO string is only formatted when asked for.
+ *
  * This implementation follows the TC39 Temporal proposal.
  * @see https://tc39.es/proposal-temporal/#sec-temporal-instant-objects
  */
 export class Instant {
-  readonly #isoString: string;
+  readonly #epochNanoseconds: bigint;
+  #isoString: string | undefined;
+
+  private constructor(epochNanoseconds: bigint) {
+    this.#epochNanoseconds = epochNanoseconds;
+  }
+
+  /**
+   * The ISO string, formatted natively on first use.
+   */
+  get #iso(): string {
+    if (this.#isoString === undefined) {
+      const [seconds, nanoseconds] = this.#pair;
+      this.#isoString = wrapNativeCall(
+        () =>
+          NativeTemporal.instantFormatEpochNanoseconds(seconds, nanoseconds),
+        'Failed to format instant'
+      );
+    }
+    return this.#isoString;
+  }
 
-  private constructor(isoString: string) {
-    this.#isoString = isoString;
+  get #pair(): [number, number] {
+    return epochNanosecondsToPair(this.#epochNanoseconds);
   }
 
   /**
@@ -30,47 +99,62 @@ export class Instant {
       return item;
     }
     if (typeof item === 'string') {
-      const iso = wrapNativeCall(
-        () => NativeTemporal.instantFromString(item),
+      const pair = wrapNativeCall(
+        () => NativeTemporal.instantParseEpochNanoseconds(item),
         `Invalid instant string: ${item}`
       );
-      return new Instant(iso);
+      return new Instant(epochNanosecondsFromPair(pair));
     }
     throw new TypeError('Instant.from requires a string or Instant');
   }
 
+  /**
+   * Whether `Instant.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.Instant, item);
+  }
+
+  /**
+   * `Instant.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): Instant | null {
+    return Instant.isValid(item) ? Instant.from(item) : null;
+  }
+
   /**
    * Creates an Instant from the number of milliseconds since the Unix epoch.
    */
   static fromEpochMilliseconds(epochMilliseconds: number): Instant {
-    const iso = wrapNativeCall(
-      () => NativeTemporal.instantFromEpochMilliseconds(epochMilliseconds),
-      'Invalid epoch milliseconds'
+    if (!Number.isInteger(epochMilliseconds)) {
+      throw new RangeError('Invalid epoch milliseconds');
+    }
+    return new Instant(
+      checkEpochNanoseconds(BigInt(epochMilliseconds) * NS_PER_MS)
     );
-    return new Instant(iso);
   }
 
   /**
    * Creates an Instant from the number of nanoseconds since the Unix epoch.
    */
   static fromEpochNanoseconds(epochNanoseconds: bigint): Instant {
-    const iso = wrapNativeCall(
-      () =>
-        NativeTemporal.instantFromEpochNanoseconds(epochNanoseconds.toString()),
-      'Invalid epoch nanoseconds'
-    );
-    return new Instant(iso);
+    if (typeof epochNanoseconds !== 'bigint') {
+      throw new TypeError('Epoch nanoseconds must be a bigint');
+    }
+    return new Instant(checkEpochNanoseconds(epochNanoseconds));
   }
 
   /**
    * Returns the current instant.
    */
   static now(): Instant {
-    const iso = wrapNativeCall(
-      () => NativeTemporal.instantNow(),
+    const pair = wrapNativeCall(
+      () => NativeTemporal.instantNowEpochNanoseconds(),
       'Failed to get current instant'
     );
-    return new Instant(iso);
+    return new Instant(epochNanosecondsFromPair(pair));
   }
 
   /**
@@ -79,61 +163,139 @@ export class Instant {
   static compare(one: Instant | string, two: Instant | string): -1 | 0 | 1 {
     const instOne = one instanceof Instant ? one : Instant.from(one);
     const instTwo = two instanceof Instant ? two : Instant.from(two);
+    return compareBigInt(instOne.#epochNanoseconds, instTwo.#epochNanoseconds);
+  }
 
-    const result = wrapNativeCall(
-      () =>
-        NativeTemporal.instantCompare(instOne.#isoString, instTwo.#isoString),
-      'Failed to compare instants'
+  /**
+   * Sorts instants in ascending order. The sort is stable and returns a new
+   * array of the same Instant objects.
+   */
+  static sort(items: readonly Instant[]): Instant[] {
+    return [...items].sort((a, b) =>
+      compareBigInt(a.#epochNanoseconds, b.#epochNanoseconds)
     );
-    return result as -1 | 0 | 1;
+  }
+
+  /**
+   * Compares `one[i]` with `two[i]` for every index. String items are parsed
+   * with a single native call per array.
+   */
+  static compareMany(
+    one: readonly (Instant | string)[],
+    two: readonly (Instant | string)[]
+  ): (-1 | 0 | 1)[] {
+    if (one.length !== two.length) {
+      throw new RangeError(
+        'Instant.compareMany requires arrays of equal length'
+      );
+    }
+    const first = Instant.epochNanosecondsMany(one);
+    const second = Instant.epochNanosecondsMany(two);
+    return first.map((ns, i) => compareBigInt(ns, second[i]!));
+  }
+
+  /**
+   * Returns the epoch nanoseconds of every item, for sorting, deduplicating
+   * or binary-searching on numeric keys. String items are parsed with a
+   * single native call.
+   */
+  static epochNanosecondsMany(items: readonly (Instant | string)[]): bigint[] {
+    const result = new Array<bigint>(items.length);
+    const strings: string[] = [];
+    const stringIndices: number[] = [];
+    items.forEach((item, i) => {
+      if (item instanceof Instant) {
+        result[i] = item.#epochNanoseconds;
+      } else {
+        strings.push(item);
+        stringIndices.push(i);
+      }
+    });
+    if (strings.length > 0) {
+      const parsed = epochNanosecondsFromPairs(
+        wrapNativeCall(
+          () => NativeTemporal.instantParseMany(strings),
+          'Failed to get epoch nanoseconds'
+        )
+      );
+      stringIndices.forEach((index, i) => {
+        result[index] = parsed[i]!;
+      });
+    }
+    return result;
   }
 
   /**
    * Returns the number of milliseconds since the Unix epoch.
    */
   get epochMilliseconds(): number {
-    return wrapNativeCall(
-      () => NativeTemporal.instantEpochMilliseconds(this.#isoString),
-      'Failed to get epoch milliseconds'
-    );
+    const ns = this.#epochNanoseconds;
+    const ms = ns / NS_PER_MS;
+    return Number(ns % NS_PER_MS < 0n ? ms - 1n : ms);
   }
 
   /**
    * Returns the number of nanoseconds since the Unix epoch.
    */
   get epochNanoseconds(): bigint {
-    const nsStr = wrapNativeCall(
-      () => NativeTemporal.instantEpochNanoseconds(this.#isoString),
-      'Failed to get epoch nanoseconds'
-    );
-    return BigInt(nsStr);
+    return this.#epochNanoseconds;
   }
 
   /**
    * Adds a duration to this instant.
    */
   add(duration: Duration | DurationLike | string): Instant {
-    const durationObj =
-      duration instanceof Duration ? duration : Duration.from(duration);
-    const iso = wrapNativeCall(
-      () => NativeTemporal.instantAdd(this.#isoString, durationObj.toString()),
-      'Failed to add duration'
-    );
-    return new Instant(iso);
+    return this.#addDuration(duration, 1n, 'Failed to add duration');
   }
 
   /**
    * Subtracts a duration from this instant.
    */
   subtract(duration: Duration | DurationLike | string): Instant {
-    const durationObj =
-      duration instanceof Duration ? duration : Duration.from(duration);
-    const iso = wrapNativeCall(
-      () =>
-        NativeTemporal.instantSubtract(this.#isoString, durationObj.toString()),
-      'Failed to subtract duration'
+    return this.#addDuration(duration, -1n, 'Failed to subtract duration');
+  }
+
+  #addDuration(
+    duration: Duration | DurationLike | string,
+    sign: 1n | -1n,
+    context: string
+  ): Instant {
+    const d = duration instanceof Duration ? duration : Duration.from(duration);
+    if (d.years !== 0 || d.months !== 0 || d.weeks !== 0 || d.days !== 0) {
+      throw new RangeError(
+        `${context}: years, months, weeks and days are not allowed`
+      );
+    }
+    const fields = [
+      d.hours,
+      d.minutes,
+      d.seconds,
+      d.milliseconds,
+      d.microseconds,
+      d.nanoseconds,
+    ];
+    if (!fields.every(Number.isSafeInteger)) {
+      // Sub-second fields past 2^53 lose precision as numbers; let the
+      // native side do the exact arithmetic on the string form.
+      const iso = wrapNativeCall(
+        () =>
+          sign === 1n
+            ? NativeTemporal.instantAdd(this.#iso, d.toString())
+            : NativeTemporal.instantSubtract(this.#iso, d.toString()),
+        context
+      );
+      return Instant.from(iso);
+    }
+    const delta =
+      BigInt(d.hours) * 3_600_000_000_000n +
+      BigInt(d.minutes) * 60_000_000_000n +
+      BigInt(d.seconds) * 1_000_000_000n +
+      BigInt(d.milliseconds) * NS_PER_MS +
+      BigInt(d.microseconds) * 1_000n +
+      BigInt(d.nanoseconds);
+    return new Instant(
+      checkEpochNanoseconds(this.#epochNanoseconds + sign * delta)
     );
-    return new Instant(iso);
   }
 
   /**
@@ -141,7 +303,7 @@ export class Instant {
    */
   equals(other: Instant | string): boolean {
     const otherInst = other instanceof Instant ? other : Instant.from(other);
-    return Instant.compare(this, otherInst) === 0;
+    return this.#epochNanoseconds === otherInst.#epochNanoseconds;
   }
 
   /**
@@ -149,23 +311,20 @@ export class Instant {
    */
   until(
     other: Instant | string,
-    options?: {
-      largestUnit?: string;
-      smallestUnit?: string;
-      roundingIncrement?: number;
-      roundingMode?: string;
-    }
+    options?: RoundingOptionsLike | CompiledRoundingOptions
   ): Duration {
     const otherInst = other instanceof Instant ? other : Instant.from(other);
+    const [oneSeconds, oneNanoseconds] = this.#pair;
+    const [twoSeconds, twoNanoseconds] = otherInst.#pair;
+    const { packed } = CompiledRoundingOptions.from(options);
     const durStr = wrapNativeCall(
       () =>
-        NativeTemporal.instantUntil(
-          this.#isoString,
-          otherInst.#isoString,
-          options?.largestUnit ?? null,
-          options?.smallestUnit ?? null,
-          options?.roundingIncrement ?? 1,
-          options?.roundingMode ?? null
+        NativeTemporal.instantUntilEpochNanosecondsWithOptions(
+          oneSeconds,
+          oneNanoseconds,
+          twoSeconds,
+          twoNanoseconds,
+          packed
         ),
       'Until failed'
     );
@@ -177,23 +336,20 @@ export class Instant {
    */
   since(
     other: Instant | string,
-    options?: {
-      largestUnit?: string;
-      smallestUnit?: string;
-      roundingIncrement?: number;
-      roundingMode?: string;
-    }
+    options?: RoundingOptionsLike | CompiledRoundingOptions
   ): Duration {
     const otherInst = other instanceof Instant ? other : Instant.from(other);
+    const [oneSeconds, oneNanoseconds] = this.#pair;
+    const [twoSeconds, twoNanoseconds] = otherInst.#pair;
+    const { packed } = CompiledRoundingOptions.from(options);
     const durStr = wrapNativeCall(
       () =>
-        NativeTemporal.instantSince(
-          this.#isoString,
-          otherInst.#isoString,
-          options?.largestUnit ?? null,
-          options?.smallestUnit ?? null,
-          options?.roundingIncrement ?? 1,
-          options?.roundingMode ?? null
+        NativeTemporal.instantSinceEpochNanosecondsWithOptions(
+          oneSeconds,
+          oneNanoseconds,
+          twoSeconds,
+          twoNanoseconds,
+          packed
         ),
       'Since failed'
     );
@@ -203,22 +359,19 @@ export class Instant {
   /**
    * Rounds the Instant to the given smallest unit.
    */
-  round(options: {
-    smallestUnit: string;
-    roundingIncrement?: number;
-    roundingMode?: string;
-  }): Instant {
-    const iso = wrapNativeCall(
+  round(options: RoundOptions | CompiledRoundingOptions): Instant {
+    const [seconds, nanoseconds] = this.#pair;
+    const { packed } = CompiledRoundingOptions.from(options);
+    const pair = wrapNativeCall(
       () =>
-        NativeTemporal.instantRound(
-          this.#isoString,
-          options.smallestUnit,
-          options.roundingIncrement ?? 1,
-          options.roundingMode ?? null
+        NativeTemporal.instantRoundEpochNanosecondsWithOptions(
+          seconds,
+          nanoseconds,
+          packed
         ),
       'Round failed'
     );
-    return new Instant(iso);
+    return new Instant(epochNanosecondsFromPair(pair));
   }
 
   /**
@@ -228,8 +381,9 @@ export class Instant {
     const tz = TimeZone.from(timeZone);
     const iso = wrapNativeCall(
       () =>
+        this.#toZonedDateTimeInterned('iso8601', tz.id) ??
         NativeTemporal.instantToZonedDateTime(
-          this.#isoString,
+          this.#iso,
           null, // Default to ISO8601 implied by null calendar logic in native or we can pass 'iso8601'
           tz.id
         ),
@@ -249,26 +403,111 @@ export class Instant {
     const cal = Calendar.from(options.calendar);
     const iso = wrapNativeCall(
       () =>
-        NativeTemporal.instantToZonedDateTime(this.#isoString, cal.id, tz.id),
+        this.#toZonedDateTimeInterned(cal.id, tz.id) ??
+        NativeTemporal.instantToZonedDateTime(this.#iso, cal.id, tz.id),
       'To ZonedDateTime failed'
     );
     return ZonedDateTime.from(iso);
   }
 
   /**
-   * Returns the ISO 8601 string representation.
+   * The zoned string via interned IDs and the epoch pair, skipping the
+   * instant and zone parse; undefined when the IDs aren't available.
    */
-  toString(options?: { timeZone?: string | TimeZone }): string {
-    if (options?.timeZone) {
-      return this.toZonedDateTimeISO(options.timeZone).toString();
+  #toZonedDateTimeInterned(
+    calendar: string,
+    timeZone: string
+  ): string | undefined {
+    const cal = internedCalendarId(calendar);
+    const tz = internedTimeZoneId(timeZone);
+    if (cal === undefined || tz === undefined) {
+      return undefined;
     }
-    return this.#isoString;
+    const [seconds, nanoseconds] = this.#pair;
+    return NativeTemporalJSI.instantToZonedDateTimeInterned!(
+      seconds,
+      nanoseconds,
+      cal,
+      tz
+    );
+  }
+
+  /**
+   * Returns the ISO 8601 string representation, as the ZonedDateTime string
+   * in `options.timeZone` when one is given. Repeated calls with the same
+   * value and options are cached.
+   */
+  toString(
+    options?:
+      | (ToStringOptions & { timeZone?: string | TimeZone })
+      | CompiledToStringOptions
+  ): string {
+    if (options === undefined) {
+      return this.#iso;
+    }
+    if (!(options instanceof CompiledToStringOptions) && options.timeZone) {
+      const { timeZone, ...rest } = options;
+      return this.toZonedDateTimeISO(timeZone).toString(rest);
+    }
+    return formatWithOptions(
+      'Instant',
+      this.#iso,
+      CompiledToStringOptions.from(options),
+      formatInstant
+    );
   }
 
   toJSON(): string {
     return this.toString();
   }
 
+  /**
+   * Encodes the instant as a fixed 24-byte record, for storage or transfer.
+   * Encoding and decoding stay in JS.
+   */
+  toBytes(): Uint8Array {
+    return new Uint8Array(writeInstantRecords([this.#pair]));
+  }
+
+  /**
+   * Decodes a record written by `toBytes`.
+   */
+  static fromBytes(bytes: BinaryInput): Instant {
+    return Instant.fromBytesMany(singleBinaryRecord(bytes))[0]!;
+  }
+
+  /**
+   * Parses every instant string in a UTF-8 buffer, such as the body of a
+   * sync response, into epoch columns without a string or Instant per item.
+   * Invalid items are reported in `errors` instead of throwing.
+   *
+   * @example
+   * const stream = Instant.parseStream(await response.arrayBuffer());
+   */
+  static parseStream(
+    bytes: BinaryInput,
+    format?: InstantStreamFormat
+  ): InstantStream {
+    return parseInstantStream(bytes, format);
+  }
+
+  /**
+   * Encodes every item into one buffer of consecutive `toBytes` records.
+   */
+  static toBytesMany(items: readonly Instant[]): ArrayBuffer {
+    return writeInstantRecords(items.map((item) => item.#pair));
+  }
+
+  /**
+   * Decodes a buffer of consecutive records written by `toBytesMany`.
+   */
+  static fromBytesMany(bytes: BinaryInput): Instant[] {
+    return readInstantRecords(binaryBytes(bytes)).map(
+      (pair) =>
+        new Instant(checkEpochNanoseconds(epochNanosecondsFromPair(pair)))
+    );
+  }
+
   valueOf(): never {
     throw new TypeError('Cannot convert a Temporal.Instant to a primitive');
   }
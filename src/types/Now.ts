@@ -1,6 +1,7 @@
 import { Instant } from './Instant';
 import { ZonedDateTime } from './ZonedDateTime';
-import NativeTemporal from '../NativeTemporal';
+import { ZonedClock } from '../clock';
+import NativeTemporal from '../native';
 import { wrapNativeCall } from '../utils';
 
 export const Now = {
@@ -63,4 +64,12 @@ export const Now = {
     );
     return ZonedDateTime.from(iso);
   },
+
+  /**
+   * Returns a clock bound to a time zone, the system one by default, for
+   * code that reads the local time many times a second.
+   */
+  clock: (temporalTimeZoneLike?: string): ZonedClock => {
+    return ZonedClock.from(temporalTimeZoneLike);
+  },
 };
@@ -1,6 +1,26 @@
-import NativeTemporal from '../NativeTemporal';
-import { wrapNativeCall } from '../utils';
-import { Duration, type DurationLike } from './Duration';
+import { parsePlainDate } from '../components';
+import NativeTemporal from '../native';
+import { ValueKind, isValidString } from '../validation';
+import { applyPermutation, wrapNativeCall } from '../utils';
+import {
+  Duration,
+  durationFields,
+  durationFromFields,
+  type DurationLike,
+} from './Duration';
+import {
+  addIsoDate,
+  compareCanonicalStrings,
+  compareFields,
+  formatIsoDate,
+  isIsoCalendarString,
+  isoDateComponents,
+  isoDateFromString,
+  isoDateUntil,
+  jsArithmeticEnabled,
+  negateDuration,
+  type IsoDate,
+} from './isoArithmetic';
 
 export type PlainDateLike = {
   year?: number;
@@ -25,32 +45,73 @@ const enum ComponentIndex {
   InLeapYear = 11,
 }
 
+const DATE_FIELDS = [
+  ComponentIndex.Year,
+  ComponentIndex.Month,
+  ComponentIndex.Day,
+] as const;
+
 export class PlainDate {
   readonly #isoString: string;
-  readonly #components: number[];
+  #componentsCache: ArrayLike<number> | undefined;
   #monthCode: string | undefined;
   #calendarId: string | undefined;
 
-  private constructor(isoString: string, components: number[]) {
+  private constructor(isoString: string, components?: ArrayLike<number>) {
     this.#isoString = isoString;
-    this.#components = components;
+    this.#componentsCache = components;
+  }
+
+  /**
+   * Components fetched from native on first field access.
+   */
+  get #components(): ArrayLike<number> {
+    if (this.#componentsCache === undefined) {
+      const isoString = this.#isoString;
+      this.#componentsCache = wrapNativeCall(
+        () => NativeTemporal.plainDateGetAllComponents(isoString),
+        'Failed to get plain date components'
+      );
+    }
+    return this.#componentsCache;
+  }
+
+  /**
+   * Whether arithmetic on this date can run in JS: ISO calendar only.
+   */
+  get #jsEligible(): boolean {
+    return jsArithmeticEnabled() && isIsoCalendarString(this.#isoString);
+  }
+
+  /**
+   * The ISO date, read from cached components or the canonical string.
+   */
+  get #isoDate(): IsoDate {
+    const c = this.#componentsCache;
+    return c === undefined
+      ? isoDateFromString(this.#isoString)
+      : [
+          c[ComponentIndex.Year]!,
+          c[ComponentIndex.Month]!,
+          c[ComponentIndex.Day]!,
+        ];
+  }
+
+  static #fromIsoDate(date: IsoDate): PlainDate {
+    return new PlainDate(formatIsoDate(date), isoDateComponents(date));
   }
 
   static from(item: string | PlainDateLike | PlainDate): PlainDate {
     if (item instanceof PlainDate) return item;
 
     if (typeof item === 'string') {
-      const isoString = wrapNativeCall(
-        () => NativeTemporal.plainDateFromString(item),
+      const [isoString, components] = wrapNativeCall(
+        () => parsePlainDate(item),
         `Invalid plain date string: ${item}`
       );
       if (!isoString) {
         throw new RangeError(`Invalid plain date string: ${item}`);
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainDateGetAllComponents(isoString),
-        'Failed to get plain date components'
-      );
       return new PlainDate(isoString, components);
     }
 
@@ -68,11 +129,7 @@ export class PlainDate {
       if (!isoString) {
         throw new RangeError('Invalid plain date components');
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainDateGetAllComponents(isoString),
-        'Failed to get plain date components'
-      );
-      return new PlainDate(isoString, components);
+      return new PlainDate(isoString);
     }
 
     throw new TypeError(
@@ -80,18 +137,81 @@ export class PlainDate {
     );
   }
 
+  /**
+   * Whether `PlainDate.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.PlainDate, item);
+  }
+
+  /**
+   * `PlainDate.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): PlainDate | null {
+    return PlainDate.isValid(item) ? PlainDate.from(item) : null;
+  }
+
   static compare(
     one: PlainDate | string | PlainDateLike,
     two: PlainDate | string | PlainDateLike
   ): number {
     const d1 = one instanceof PlainDate ? one : PlainDate.from(one);
     const d2 = two instanceof PlainDate ? two : PlainDate.from(two);
+    if (d1.#jsEligible && d2.#jsEligible) {
+      if (d1.#componentsCache && d2.#componentsCache) {
+        return compareFields(
+          d1.#componentsCache,
+          d2.#componentsCache,
+          DATE_FIELDS
+        );
+      }
+      const result = compareCanonicalStrings(d1.#isoString, d2.#isoString);
+      if (result !== undefined) {
+        return result;
+      }
+    }
     return wrapNativeCall(
       () => NativeTemporal.plainDateCompare(d1.#isoString, d2.#isoString),
       'Failed to compare plain dates'
     );
   }
 
+  /**
+   * Sorts dates in ascending order with a single native call. The sort is
+   * stable and returns a new array of the same PlainDate objects.
+   */
+  static sort(items: readonly PlainDate[]): PlainDate[] {
+    const permutation = wrapNativeCall(
+      () => NativeTemporal.plainDateSort(items.map((item) => item.#isoString)),
+      'Failed to sort plain dates'
+    );
+    return applyPermutation(items, permutation);
+  }
+
+  /**
+   * Compares `one[i]` with `two[i]` for every index with a single native call.
+   */
+  static compareMany(
+    one: readonly PlainDate[],
+    two: readonly PlainDate[]
+  ): (-1 | 0 | 1)[] {
+    if (one.length !== two.length) {
+      throw new RangeError(
+        'PlainDate.compareMany requires arrays of equal length'
+      );
+    }
+    return wrapNativeCall(
+      () =>
+        NativeTemporal.plainDateCompareMany(
+          one.map((item) => item.#isoString),
+          two.map((item) => item.#isoString)
+        ),
+      'Failed to compare plain dates'
+    ) as (-1 | 0 | 1)[];
+  }
+
   get year(): number {
     return this.#components[ComponentIndex.Year]!;
   }
@@ -146,28 +266,32 @@ export class PlainDate {
 
   add(duration: Duration | DurationLike | string): PlainDate {
     const d = duration instanceof Duration ? duration : Duration.from(duration);
+    if (this.#jsEligible) {
+      const date = addIsoDate(this.#isoDate, durationFields(d));
+      if (date) {
+        return PlainDate.#fromIsoDate(date);
+      }
+    }
     const isoString = wrapNativeCall(
       () => NativeTemporal.plainDateAdd(this.#isoString, d.toString()),
       'Failed to add duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainDateGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainDate(isoString, components);
+    return new PlainDate(isoString);
   }
 
   subtract(duration: Duration | DurationLike | string): PlainDate {
     const d = duration instanceof Duration ? duration : Duration.from(duration);
+    if (this.#jsEligible) {
+      const date = addIsoDate(this.#isoDate, negateDuration(durationFields(d)));
+      if (date) {
+        return PlainDate.#fromIsoDate(date);
+      }
+    }
     const isoString = wrapNativeCall(
       () => NativeTemporal.plainDateSubtract(this.#isoString, d.toString()),
       'Failed to subtract duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainDateGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainDate(isoString, components);
+    return new PlainDate(isoString);
   }
 
   with(dateLike: PlainDateLike): PlainDate {
@@ -182,15 +306,14 @@ export class PlainDate {
         ),
       'Failed to update plain date'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainDateGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainDate(isoString, components);
+    return new PlainDate(isoString);
   }
 
   until(other: PlainDate | string | PlainDateLike): Duration {
     const o = other instanceof PlainDate ? other : PlainDate.from(other);
+    if (this.#jsEligible && o.#jsEligible) {
+      return durationFromFields(isoDateUntil(this.#isoDate, o.#isoDate));
+    }
     const durationIso = wrapNativeCall(
       () => NativeTemporal.plainDateUntil(this.#isoString, o.#isoString),
       'Failed to compute until'
@@ -200,6 +323,11 @@ export class PlainDate {
 
   since(other: PlainDate | string | PlainDateLike): Duration {
     const o = other instanceof PlainDate ? other : PlainDate.from(other);
+    if (this.#jsEligible && o.#jsEligible) {
+      return durationFromFields(
+        negateDuration(isoDateUntil(this.#isoDate, o.#isoDate))
+      );
+    }
     const durationIso = wrapNativeCall(
       () => NativeTemporal.plainDateSince(this.#isoString, o.#isoString),
       'Failed to compute since'
@@ -1,6 +1,34 @@
-import NativeTemporal from '../NativeTemporal';
+import NativeTemporal from '../native';
+import { ValueKind, isValidString } from '../validation';
 import { wrapNativeCall } from '../utils';
-import { Duration, type DurationLike } from './Duration';
+import {
+  CompiledToStringOptions,
+  formatWithOptions,
+  type ToStringOptions,
+} from '../format';
+import { durationHandle, handlesSupported, trackHandle } from '../handles';
+import { parsePlainDateTime, plainDateTimeComponents } from '../components';
+import {
+  Duration,
+  durationFields,
+  durationFromFields,
+  type DurationLike,
+} from './Duration';
+import {
+  addIsoDateTime,
+  compareCanonicalStrings,
+  compareFields,
+  formatIsoDateTime,
+  isIsoCalendarString,
+  isoDateComponents,
+  isoDateTimeFromString,
+  isoDateTimeUntil,
+  jsArithmeticEnabled,
+  negateDuration,
+  type DurationFields,
+  type IsoDate,
+  type IsoTime,
+} from './isoArithmetic';
 import { PlainDate, type PlainDateLike } from './PlainDate';
 import { PlainTime, type PlainTimeLike } from './PlainTime';
 
@@ -39,32 +67,158 @@ const enum ComponentIndex {
   Nanosecond = 17,
 }
 
+const DATE_TIME_FIELDS = [
+  ComponentIndex.Year,
+  ComponentIndex.Month,
+  ComponentIndex.Day,
+  ComponentIndex.Hour,
+  ComponentIndex.Minute,
+  ComponentIndex.Second,
+  ComponentIndex.Millisecond,
+  ComponentIndex.Microsecond,
+  ComponentIndex.Nanosecond,
+] as const;
+
+const formatPlainDateTime = (iso: string, options: CompiledToStringOptions) =>
+  NativeTemporal.plainDateTimeToStringWithPackedOptions(iso, options.packed);
+
 export class PlainDateTime {
-  readonly #isoString: string;
-  readonly #components: number[];
+  #isoString: string | undefined;
+  #handle: number | undefined;
+  #componentsCache: ArrayLike<number> | undefined;
   #monthCode: string | undefined;
   #calendarId: string | undefined;
 
-  private constructor(isoString: string, components: number[]) {
+  private constructor(
+    isoString: string | undefined,
+    components: ArrayLike<number> | undefined
+  ) {
     this.#isoString = isoString;
-    this.#components = components;
+    this.#componentsCache = components;
+  }
+
+  static #fromHandle(handle: number): PlainDateTime {
+    const dt = new PlainDateTime(undefined, undefined);
+    dt.#handle = trackHandle(dt, handle);
+    return dt;
+  }
+
+  /**
+   * The ISO string, formatted on first use for handle-backed values.
+   */
+  get #iso(): string {
+    if (this.#isoString === undefined) {
+      this.#isoString = wrapNativeCall(
+        () => NativeTemporal.handleToString(this.#handle!),
+        'Failed to format plain date time'
+      );
+    }
+    return this.#isoString;
+  }
+
+  /**
+   * The native handle, parsed on first use for string-backed values.
+   */
+  #nativeHandle(): number {
+    if (this.#handle === undefined) {
+      const iso = this.#isoString!;
+      this.#handle = trackHandle(
+        this,
+        wrapNativeCall(
+          () => NativeTemporal.plainDateTimeHandleFromString(iso),
+          'Failed to create plain date time handle'
+        )
+      );
+    }
+    return this.#handle;
+  }
+
+  get #components(): ArrayLike<number> {
+    if (this.#componentsCache === undefined) {
+      this.#componentsCache = wrapNativeCall(
+        () => plainDateTimeComponents(this.#isoString, this.#handle),
+        'Failed to get plain date time components'
+      );
+    }
+    return this.#componentsCache;
+  }
+
+  /**
+   * Whether arithmetic can run in JS: string-backed ISO-calendar values
+   * only, so handle-backed values never pay for a native format.
+   */
+  get #jsEligible(): boolean {
+    return (
+      jsArithmeticEnabled() &&
+      this.#isoString !== undefined &&
+      isIsoCalendarString(this.#isoString)
+    );
+  }
+
+  /**
+   * The ISO fields, read from cached components or the canonical string.
+   */
+  get #isoDateTime(): [IsoDate, IsoTime] {
+    const c = this.#componentsCache;
+    if (c === undefined) {
+      return isoDateTimeFromString(this.#isoString!);
+    }
+    return [
+      [
+        c[ComponentIndex.Year]!,
+        c[ComponentIndex.Month]!,
+        c[ComponentIndex.Day]!,
+      ],
+      [
+        c[ComponentIndex.Hour]!,
+        c[ComponentIndex.Minute]!,
+        c[ComponentIndex.Second]!,
+        c[ComponentIndex.Millisecond]!,
+        c[ComponentIndex.Microsecond]!,
+        c[ComponentIndex.Nanosecond]!,
+      ],
+    ];
+  }
+
+  static #fromIsoDateTime(date: IsoDate, time: IsoTime): PlainDateTime {
+    return new PlainDateTime(formatIsoDateTime(date, time), [
+      ...isoDateComponents(date),
+      ...time,
+    ]);
+  }
+
+  /**
+   * Adds `fields` in JS, or returns undefined when native has to do it.
+   */
+  #addFields(fields: DurationFields): PlainDateTime | undefined {
+    if (!this.#jsEligible) {
+      return undefined;
+    }
+    const [date, time] = this.#isoDateTime;
+    const result = addIsoDateTime(date, time, fields);
+    return result && PlainDateTime.#fromIsoDateTime(result[0], result[1]);
+  }
+
+  #untilFields(other: PlainDateTime): DurationFields | undefined {
+    if (!this.#jsEligible || !other.#jsEligible) {
+      return undefined;
+    }
+    const [oneDate, oneTime] = this.#isoDateTime;
+    const [twoDate, twoTime] = other.#isoDateTime;
+    return isoDateTimeUntil(oneDate, oneTime, twoDate, twoTime);
   }
 
   static from(item: string | PlainDateTimeLike | PlainDateTime): PlainDateTime {
     if (item instanceof PlainDateTime) return item;
 
     if (typeof item === 'string') {
-      const isoString = wrapNativeCall(
-        () => NativeTemporal.plainDateTimeFromString(item),
+      const [isoString, components] = wrapNativeCall(
+        () => parsePlainDateTime(item),
         `Invalid plain date time string: ${item}`
       );
       if (!isoString) {
         throw new RangeError(`Invalid plain date time string: ${item}`);
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainDateTimeGetAllComponents(isoString),
-        'Failed to get plain date time components'
-      );
       return new PlainDateTime(isoString, components);
     }
 
@@ -88,11 +242,7 @@ export class PlainDateTime {
       if (!isoString) {
         throw new RangeError('Invalid plain date time components');
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainDateTimeGetAllComponents(isoString),
-        'Failed to get plain date time components'
-      );
-      return new PlainDateTime(isoString, components);
+      return new PlainDateTime(isoString, undefined);
     }
 
     throw new TypeError(
@@ -100,14 +250,43 @@ export class PlainDateTime {
     );
   }
 
+  /**
+   * Whether `PlainDateTime.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.PlainDateTime, item);
+  }
+
+  /**
+   * `PlainDateTime.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): PlainDateTime | null {
+    return PlainDateTime.isValid(item) ? PlainDateTime.from(item) : null;
+  }
+
   static compare(
     one: PlainDateTime | string | PlainDateTimeLike,
     two: PlainDateTime | string | PlainDateTimeLike
   ): number {
     const dt1 = one instanceof PlainDateTime ? one : PlainDateTime.from(one);
     const dt2 = two instanceof PlainDateTime ? two : PlainDateTime.from(two);
+    if (dt1.#jsEligible && dt2.#jsEligible) {
+      if (dt1.#componentsCache && dt2.#componentsCache) {
+        return compareFields(
+          dt1.#componentsCache,
+          dt2.#componentsCache,
+          DATE_TIME_FIELDS
+        );
+      }
+      const result = compareCanonicalStrings(dt1.#iso, dt2.#iso);
+      if (result !== undefined) {
+        return result;
+      }
+    }
     return wrapNativeCall(
-      () => NativeTemporal.plainDateTimeCompare(dt1.#isoString, dt2.#isoString),
+      () => NativeTemporal.plainDateTimeCompare(dt1.#iso, dt2.#iso),
       'Failed to compare plain date times'
     );
   }
@@ -143,7 +322,7 @@ export class PlainDateTime {
   get monthCode(): string {
     if (this.#monthCode === undefined) {
       this.#monthCode = NativeTemporal.plainDateTimeGetMonthCode(
-        this.#isoString
+        this.#iso
       );
     }
     return this.#monthCode!;
@@ -152,7 +331,7 @@ export class PlainDateTime {
   get calendarId(): string {
     if (this.#calendarId === undefined) {
       this.#calendarId = NativeTemporal.plainDateTimeGetCalendar(
-        this.#isoString
+        this.#iso
       );
     }
     return this.#calendarId!;
@@ -188,35 +367,77 @@ export class PlainDateTime {
 
   add(duration: Duration | DurationLike | string): PlainDateTime {
     const d = duration instanceof Duration ? duration : Duration.from(duration);
+    const js = this.#addFields(durationFields(d));
+    if (js) {
+      return js;
+    }
+    if (handlesSupported) {
+      const handle = wrapNativeCall(
+        () =>
+          NativeTemporal.plainDateTimeHandleAdd(
+            this.#nativeHandle(),
+            durationHandle(d)
+          ),
+        'Failed to add duration'
+      );
+      return PlainDateTime.#fromHandle(handle);
+    }
     const isoString = wrapNativeCall(
-      () => NativeTemporal.plainDateTimeAdd(this.#isoString, d.toString()),
+      () => NativeTemporal.plainDateTimeAdd(this.#iso, d.toString()),
       'Failed to add duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainDateTimeGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainDateTime(isoString, components);
+    return new PlainDateTime(isoString, undefined);
   }
 
   subtract(duration: Duration | DurationLike | string): PlainDateTime {
     const d = duration instanceof Duration ? duration : Duration.from(duration);
+    const js = this.#addFields(negateDuration(durationFields(d)));
+    if (js) {
+      return js;
+    }
+    if (handlesSupported) {
+      const handle = wrapNativeCall(
+        () =>
+          NativeTemporal.plainDateTimeHandleSubtract(
+            this.#nativeHandle(),
+            durationHandle(d)
+          ),
+        'Failed to subtract duration'
+      );
+      return PlainDateTime.#fromHandle(handle);
+    }
     const isoString = wrapNativeCall(
-      () => NativeTemporal.plainDateTimeSubtract(this.#isoString, d.toString()),
+      () => NativeTemporal.plainDateTimeSubtract(this.#iso, d.toString()),
       'Failed to subtract duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainDateTimeGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainDateTime(isoString, components);
+    return new PlainDateTime(isoString, undefined);
   }
 
   with(like: PlainDateTimeLike): PlainDateTime {
+    if (handlesSupported) {
+      const handle = wrapNativeCall(
+        () =>
+          NativeTemporal.plainDateTimeHandleWith(
+            this.#nativeHandle(),
+            like.year ?? Number.MIN_SAFE_INTEGER,
+            like.month ?? Number.MIN_SAFE_INTEGER,
+            like.day ?? Number.MIN_SAFE_INTEGER,
+            like.hour ?? Number.MIN_SAFE_INTEGER,
+            like.minute ?? Number.MIN_SAFE_INTEGER,
+            like.second ?? Number.MIN_SAFE_INTEGER,
+            like.millisecond ?? Number.MIN_SAFE_INTEGER,
+            like.microsecond ?? Number.MIN_SAFE_INTEGER,
+            like.nanosecond ?? Number.MIN_SAFE_INTEGER,
+            like.calendar ?? null
+          ),
+        'Failed to update plain date time'
+      );
+      return PlainDateTime.#fromHandle(handle);
+    }
     const isoString = wrapNativeCall(
       () =>
         NativeTemporal.plainDateTimeWith(
-          this.#isoString,
+          this.#iso,
           like.year ?? Number.MIN_SAFE_INTEGER,
           like.month ?? Number.MIN_SAFE_INTEGER,
           like.day ?? Number.MIN_SAFE_INTEGER,
@@ -230,11 +451,7 @@ export class PlainDateTime {
         ),
       'Failed to update plain date time'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainDateTimeGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainDateTime(isoString, components);
+    return new PlainDateTime(isoString, undefined);
   }
 
   withPlainDate(date: PlainDate | PlainDateLike | string): PlainDateTime {
@@ -262,8 +479,12 @@ export class PlainDateTime {
   until(other: PlainDateTime | string | PlainDateTimeLike): Duration {
     const o =
       other instanceof PlainDateTime ? other : PlainDateTime.from(other);
+    const fields = this.#untilFields(o);
+    if (fields) {
+      return durationFromFields(fields);
+    }
     const durationIso = wrapNativeCall(
-      () => NativeTemporal.plainDateTimeUntil(this.#isoString, o.#isoString),
+      () => NativeTemporal.plainDateTimeUntil(this.#iso, o.#iso),
       'Failed to compute until'
     );
     return Duration.from(durationIso);
@@ -272,8 +493,12 @@ export class PlainDateTime {
   since(other: PlainDateTime | string | PlainDateTimeLike): Duration {
     const o =
       other instanceof PlainDateTime ? other : PlainDateTime.from(other);
+    const fields = this.#untilFields(o);
+    if (fields) {
+      return durationFromFields(negateDuration(fields));
+    }
     const durationIso = wrapNativeCall(
-      () => NativeTemporal.plainDateTimeSince(this.#isoString, o.#isoString),
+      () => NativeTemporal.plainDateTimeSince(this.#iso, o.#iso),
       'Failed to compute since'
     );
     return Duration.from(durationIso);
@@ -303,8 +528,20 @@ export class PlainDateTime {
     });
   }
 
-  toString(_options?: object): string {
-    return this.#isoString;
+  /**
+   * Returns the ISO 8601 string, rounded and annotated as requested by
+   * `options`. Repeated calls with the same value and options are cached.
+   */
+  toString(options?: ToStringOptions | CompiledToStringOptions): string {
+    if (options === undefined) {
+      return this.#iso;
+    }
+    return formatWithOptions(
+      'PlainDateTime',
+      this.#iso,
+      CompiledToStringOptions.from(options),
+      formatPlainDateTime
+    );
   }
 
   toJSON(): string {
@@ -1,4 +1,5 @@
-import NativeTemporal from '../NativeTemporal';
+import NativeTemporal from '../native';
+import { ValueKind, isValidString } from '../validation';
 import { wrapNativeCall } from '../utils';
 import { PlainDate } from './PlainDate';
 
@@ -16,13 +17,26 @@ const enum ComponentIndex {
 
 export class PlainMonthDay {
   readonly #isoString: string;
-  readonly #components: number[];
+  #componentsCache: ArrayLike<number> | undefined;
   #monthCode: string | undefined;
   #calendarId: string | undefined;
 
-  private constructor(isoString: string, components: number[]) {
+  private constructor(isoString: string) {
     this.#isoString = isoString;
-    this.#components = components;
+  }
+
+  /**
+   * Components fetched from native on first field access.
+   */
+  get #components(): ArrayLike<number> {
+    if (this.#componentsCache === undefined) {
+      const isoString = this.#isoString;
+      this.#componentsCache = wrapNativeCall(
+        () => NativeTemporal.plainMonthDayGetAllComponents(isoString),
+        'Failed to get plain month day components'
+      );
+    }
+    return this.#componentsCache;
   }
 
   static from(item: string | PlainMonthDayLike | PlainMonthDay): PlainMonthDay {
@@ -36,11 +50,7 @@ export class PlainMonthDay {
       if (!isoString) {
         throw new RangeError(`Invalid plain month day string: ${item}`);
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainMonthDayGetAllComponents(isoString),
-        'Failed to get plain month day components'
-      );
-      return new PlainMonthDay(isoString, components);
+      return new PlainMonthDay(isoString);
     }
 
     if (typeof item === 'object' && item !== null) {
@@ -57,11 +67,7 @@ export class PlainMonthDay {
       if (!isoString) {
         throw new RangeError('Invalid plain month day components');
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainMonthDayGetAllComponents(isoString),
-        'Failed to get plain month day components'
-      );
-      return new PlainMonthDay(isoString, components);
+      return new PlainMonthDay(isoString);
     }
 
     throw new TypeError(
@@ -69,6 +75,22 @@ export class PlainMonthDay {
     );
   }
 
+  /**
+   * Whether `PlainMonthDay.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.PlainMonthDay, item);
+  }
+
+  /**
+   * `PlainMonthDay.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): PlainMonthDay | null {
+    return PlainMonthDay.isValid(item) ? PlainMonthDay.from(item) : null;
+  }
+
   get monthCode(): string {
     if (this.#monthCode === undefined) {
       this.#monthCode = NativeTemporal.plainMonthDayGetMonthCode(
@@ -1,6 +1,35 @@
-import NativeTemporal from '../NativeTemporal';
+import { parsePlainTime } from '../components';
+import NativeTemporal from '../native';
+import { ValueKind, isValidString } from '../validation';
 import { wrapNativeCall } from '../utils';
-import { Duration, type DurationLike } from './Duration';
+import {
+  CompiledRoundingOptions,
+  type RoundOptions,
+  type RoundingOptionsLike,
+} from '../rounding';
+import {
+  CompiledToStringOptions,
+  formatWithOptions,
+  type ToStringOptions,
+} from '../format';
+import {
+  Duration,
+  durationFields,
+  durationFromFields,
+  type DurationLike,
+} from './Duration';
+import {
+  addIsoTime,
+  compareCanonicalStrings,
+  compareFields,
+  formatIsoTime,
+  isDefaultDifference,
+  isoTimeFromString,
+  isoTimeUntil,
+  jsArithmeticEnabled,
+  negateDuration,
+  type IsoTime,
+} from './isoArithmetic';
 
 /**
  * Component indices in the array returned by plainTimeGetAllComponents.
@@ -14,6 +43,15 @@ const enum ComponentIndex {
   Nanosecond = 5,
 }
 
+const TIME_FIELDS = [
+  ComponentIndex.Hour,
+  ComponentIndex.Minute,
+  ComponentIndex.Second,
+  ComponentIndex.Millisecond,
+  ComponentIndex.Microsecond,
+  ComponentIndex.Nanosecond,
+] as const;
+
 export type PlainTimeLike = {
   hour?: number;
   minute?: number;
@@ -23,6 +61,9 @@ export type PlainTimeLike = {
   nanosecond?: number;
 };
 
+const formatPlainTime = (iso: string, options: CompiledToStringOptions) =>
+  NativeTemporal.plainTimeToStringWithPackedOptions(iso, options.packed);
+
 /**
  * A Temporal.PlainTime represents a wall-clock time, with a precision in nanoseconds,
  * and without any time zone. "Wall-clock time" means that it is not a specific instant
@@ -33,11 +74,39 @@ export type PlainTimeLike = {
  */
 export class PlainTime {
   readonly #isoString: string;
-  readonly #components: number[];
+  #componentsCache: ArrayLike<number> | undefined;
 
-  private constructor(isoString: string, components: number[]) {
+  private constructor(isoString: string, components?: ArrayLike<number>) {
     this.#isoString = isoString;
-    this.#components = components;
+    this.#componentsCache = components;
+  }
+
+  /**
+   * Components fetched from native on first field access.
+   */
+  get #components(): ArrayLike<number> {
+    if (this.#componentsCache === undefined) {
+      const isoString = this.#isoString;
+      this.#componentsCache = wrapNativeCall(
+        () => NativeTemporal.plainTimeGetAllComponents(isoString),
+        'Failed to get plain time components'
+      );
+    }
+    return this.#componentsCache;
+  }
+
+  /**
+   * The time fields, read from cached components or the canonical string.
+   */
+  get #isoTime(): IsoTime {
+    const c = this.#componentsCache;
+    return c === undefined
+      ? isoTimeFromString(this.#isoString)
+      : [c[0]!, c[1]!, c[2]!, c[3]!, c[4]!, c[5]!];
+  }
+
+  static #fromIsoTime(time: IsoTime): PlainTime {
+    return new PlainTime(formatIsoTime(time), time);
   }
 
   /**
@@ -53,14 +122,10 @@ export class PlainTime {
     }
 
     if (typeof item === 'string') {
-      const isoString = wrapNativeCall(
-        () => NativeTemporal.plainTimeFromString(item),
+      const [isoString, components] = wrapNativeCall(
+        () => parsePlainTime(item),
         `Invalid plain time string: ${item}`
       );
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainTimeGetAllComponents(isoString),
-        'Failed to get plain time components'
-      );
       return new PlainTime(isoString, components);
     }
 
@@ -77,11 +142,7 @@ export class PlainTime {
           ),
         'Invalid plain time components'
       );
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainTimeGetAllComponents(isoString),
-        'Failed to get plain time components'
-      );
-      return new PlainTime(isoString, components);
+      return new PlainTime(isoString);
     }
 
     throw new TypeError(
@@ -89,6 +150,22 @@ export class PlainTime {
     );
   }
 
+  /**
+   * Whether `PlainTime.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.PlainTime, item);
+  }
+
+  /**
+   * `PlainTime.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): PlainTime | null {
+    return PlainTime.isValid(item) ? PlainTime.from(item) : null;
+  }
+
   /**
    * Compares two PlainTime objects.
    */
@@ -99,6 +176,17 @@ export class PlainTime {
     const t1 = one instanceof PlainTime ? one : PlainTime.from(one);
     const t2 = two instanceof PlainTime ? two : PlainTime.from(two);
 
+    if (jsArithmeticEnabled()) {
+      if (t1.#componentsCache && t2.#componentsCache) {
+        return compareFields(
+          t1.#componentsCache,
+          t2.#componentsCache,
+          TIME_FIELDS
+        );
+      }
+      return compareCanonicalStrings(t1.#isoString, t2.#isoString)!;
+    }
+
     const result = wrapNativeCall(
       () => NativeTemporal.plainTimeCompare(t1.#isoString, t2.#isoString),
       'Failed to compare plain times'
@@ -135,15 +223,17 @@ export class PlainTime {
    */
   add(duration: Duration | DurationLike | string): PlainTime {
     const d = duration instanceof Duration ? duration : Duration.from(duration);
+    if (jsArithmeticEnabled()) {
+      const time = addIsoTime(this.#isoTime, durationFields(d));
+      if (time) {
+        return PlainTime.#fromIsoTime(time);
+      }
+    }
     const isoString = wrapNativeCall(
       () => NativeTemporal.plainTimeAdd(this.#isoString, d.toString()),
       'Failed to add duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainTimeGetAllComponents(isoString),
-      'Failed to get plain time components'
-    );
-    return new PlainTime(isoString, components);
+    return new PlainTime(isoString);
   }
 
   /**
@@ -151,15 +241,17 @@ export class PlainTime {
    */
   subtract(duration: Duration | DurationLike | string): PlainTime {
     const d = duration instanceof Duration ? duration : Duration.from(duration);
+    if (jsArithmeticEnabled()) {
+      const time = addIsoTime(this.#isoTime, negateDuration(durationFields(d)));
+      if (time) {
+        return PlainTime.#fromIsoTime(time);
+      }
+    }
     const isoString = wrapNativeCall(
       () => NativeTemporal.plainTimeSubtract(this.#isoString, d.toString()),
       'Failed to subtract duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainTimeGetAllComponents(isoString),
-      'Failed to get plain time components'
-    );
-    return new PlainTime(isoString, components);
+    return new PlainTime(isoString);
   }
 
   /**
@@ -180,8 +272,20 @@ export class PlainTime {
     return PlainTime.compare(this, other) === 0;
   }
 
-  toString(_options?: object): string {
-    return this.#isoString;
+  /**
+   * Returns the ISO 8601 string, rounded and with the precision requested by
+   * `options`. Repeated calls with the same value and options are cached.
+   */
+  toString(options?: ToStringOptions | CompiledToStringOptions): string {
+    if (options === undefined) {
+      return this.#isoString;
+    }
+    return formatWithOptions(
+      'PlainTime',
+      this.#isoString,
+      CompiledToStringOptions.from(options),
+      formatPlainTime
+    );
   }
 
   toJSON(): string {
@@ -207,23 +311,19 @@ export class PlainTime {
    */
   until(
     other: PlainTime | string | PlainTimeLike,
-    options?: {
-      largestUnit?: string;
-      smallestUnit?: string;
-      roundingIncrement?: number;
-      roundingMode?: string;
-    }
+    options?: RoundingOptionsLike | CompiledRoundingOptions
   ): Duration {
     const t2 = other instanceof PlainTime ? other : PlainTime.from(other);
+    if (jsArithmeticEnabled() && isDefaultDifference(options)) {
+      return durationFromFields(isoTimeUntil(this.#isoTime, t2.#isoTime));
+    }
+    const { packed } = CompiledRoundingOptions.from(options);
     const durStr = wrapNativeCall(
       () =>
-        NativeTemporal.plainTimeUntil(
+        NativeTemporal.plainTimeUntilWithOptions(
           this.#isoString,
           t2.#isoString,
-          options?.largestUnit ?? null,
-          options?.smallestUnit ?? null,
-          options?.roundingIncrement ?? 1,
-          options?.roundingMode ?? null
+          packed
         ),
       'Until failed'
     );
@@ -235,23 +335,21 @@ export class PlainTime {
    */
   since(
     other: PlainTime | string | PlainTimeLike,
-    options?: {
-      largestUnit?: string;
-      smallestUnit?: string;
-      roundingIncrement?: number;
-      roundingMode?: string;
-    }
+    options?: RoundingOptionsLike | CompiledRoundingOptions
   ): Duration {
     const t2 = other instanceof PlainTime ? other : PlainTime.from(other);
+    if (jsArithmeticEnabled() && isDefaultDifference(options)) {
+      return durationFromFields(
+        negateDuration(isoTimeUntil(this.#isoTime, t2.#isoTime))
+      );
+    }
+    const { packed } = CompiledRoundingOptions.from(options);
     const durStr = wrapNativeCall(
       () =>
-        NativeTemporal.plainTimeSince(
+        NativeTemporal.plainTimeSinceWithOptions(
           this.#isoString,
           t2.#isoString,
-          options?.largestUnit ?? null,
-          options?.smallestUnit ?? null,
-          options?.roundingIncrement ?? 1,
-          options?.roundingMode ?? null
+          packed
         ),
       'Since failed'
     );
@@ -261,19 +359,10 @@ export class PlainTime {
   /**
    * Rounds the time to the given smallest unit.
    */
-  round(options: {
-    smallestUnit: string;
-    roundingIncrement?: number;
-    roundingMode?: string;
-  }): PlainTime {
+  round(options: RoundOptions | CompiledRoundingOptions): PlainTime {
+    const { packed } = CompiledRoundingOptions.from(options);
     const iso = wrapNativeCall(
-      () =>
-        NativeTemporal.plainTimeRound(
-          this.#isoString,
-          options.smallestUnit,
-          options.roundingIncrement ?? 1,
-          options.roundingMode ?? null
-        ),
+      () => NativeTemporal.plainTimeRoundWithOptions(this.#isoString, packed),
       'Round failed'
     );
     return PlainTime.from(iso);
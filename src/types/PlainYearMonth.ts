@@ -1,4 +1,5 @@
-import NativeTemporal from '../NativeTemporal';
+import NativeTemporal from '../native';
+import { ValueKind, isValidString } from '../validation';
 import { wrapNativeCall } from '../utils';
 import { Duration, type DurationLike } from './Duration';
 import { PlainDate } from './PlainDate';
@@ -23,13 +24,26 @@ const enum ComponentIndex {
 
 export class PlainYearMonth {
   readonly #isoString: string;
-  readonly #components: number[];
+  #componentsCache: ArrayLike<number> | undefined;
   #monthCode: string | undefined;
   #calendarId: string | undefined;
 
-  private constructor(isoString: string, components: number[]) {
+  private constructor(isoString: string) {
     this.#isoString = isoString;
-    this.#components = components;
+  }
+
+  /**
+   * Components fetched from native on first field access.
+   */
+  get #components(): ArrayLike<number> {
+    if (this.#componentsCache === undefined) {
+      const isoString = this.#isoString;
+      this.#componentsCache = wrapNativeCall(
+        () => NativeTemporal.plainYearMonthGetAllComponents(isoString),
+        'Failed to get plain year month components'
+      );
+    }
+    return this.#componentsCache;
   }
 
   static from(
@@ -45,11 +59,7 @@ export class PlainYearMonth {
       if (!isoString) {
         throw new RangeError(`Invalid plain year month string: ${item}`);
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainYearMonthGetAllComponents(isoString),
-        'Failed to get plain year month components'
-      );
-      return new PlainYearMonth(isoString, components);
+      return new PlainYearMonth(isoString);
     }
 
     if (typeof item === 'object' && item !== null) {
@@ -66,11 +76,7 @@ export class PlainYearMonth {
       if (!isoString) {
         throw new RangeError('Invalid plain year month components');
       }
-      const components = wrapNativeCall(
-        () => NativeTemporal.plainYearMonthGetAllComponents(isoString),
-        'Failed to get plain year month components'
-      );
-      return new PlainYearMonth(isoString, components);
+      return new PlainYearMonth(isoString);
     }
 
     throw new TypeError(
@@ -78,6 +84,22 @@ export class PlainYearMonth {
     );
   }
 
+  /**
+   * Whether `PlainYearMonth.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.PlainYearMonth, item);
+  }
+
+  /**
+   * `PlainYearMonth.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): PlainYearMonth | null {
+    return PlainYearMonth.isValid(item) ? PlainYearMonth.from(item) : null;
+  }
+
   static compare(
     one: PlainYearMonth | string | PlainYearMonthLike,
     two: PlainYearMonth | string | PlainYearMonthLike
@@ -140,11 +162,7 @@ export class PlainYearMonth {
       () => NativeTemporal.plainYearMonthAdd(this.#isoString, d.toString()),
       'Failed to add duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainYearMonthGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainYearMonth(isoString, components);
+    return new PlainYearMonth(isoString);
   }
 
   subtract(duration: Duration | DurationLike | string): PlainYearMonth {
@@ -154,11 +172,7 @@ export class PlainYearMonth {
         NativeTemporal.plainYearMonthSubtract(this.#isoString, d.toString()),
       'Failed to subtract duration'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainYearMonthGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainYearMonth(isoString, components);
+    return new PlainYearMonth(isoString);
   }
 
   with(like: PlainYearMonthLike): PlainYearMonth {
@@ -172,11 +186,7 @@ export class PlainYearMonth {
         ),
       'Failed to update plain year month'
     );
-    const components = wrapNativeCall(
-      () => NativeTemporal.plainYearMonthGetAllComponents(isoString),
-      'Failed to get components'
-    );
-    return new PlainYearMonth(isoString, components);
+    return new PlainYearMonth(isoString);
   }
 
   until(other: PlainYearMonth | string | PlainYearMonthLike): Duration {
@@ -1,9 +1,34 @@
-import NativeTemporal from '../NativeTemporal';
-import { wrapNativeCall } from '../utils';
+import NativeTemporal, { NativeTemporalJSI } from '../native';
+import { internedCalendarId, internedTimeZoneId } from '../interned';
+import {
+  epochNanosecondsFromPairs,
+  epochNanosecondsToPair,
+  wrapNativeCall,
+} from '../utils';
 import { Instant } from './Instant';
 import { PlainDateTime } from './PlainDateTime';
 import { Calendar } from './Calendar';
 
+/** Transitions fetched per native call by getTransitions. */
+const TRANSITIONS_PAGE_SIZE = 1024;
+
+/**
+ * ISO wall-clock fields for many instants, one typed-array column per field.
+ * Entry `i` of every column belongs to the `i`-th input instant.
+ */
+export interface PlainDateTimeColumns {
+  readonly length: number;
+  readonly year: Int32Array;
+  readonly month: Int32Array;
+  readonly day: Int32Array;
+  readonly hour: Int32Array;
+  readonly minute: Int32Array;
+  readonly second: Int32Array;
+  readonly millisecond: Int32Array;
+  readonly microsecond: Int32Array;
+  readonly nanosecond: Int32Array;
+}
+
 export class TimeZone {
   readonly #id: string;
 
@@ -30,37 +55,108 @@ export class TimeZone {
     return this.#id;
   }
 
+  /** The interned ID for the JSI `*Interned` methods, if there is one. */
+  get #interned(): number | undefined {
+    return internedTimeZoneId(this.#id);
+  }
+
   getOffsetNanosecondsFor(instant: Instant): number {
+    const tz = this.#interned;
     return wrapNativeCall(
       () =>
-        NativeTemporal.timeZoneGetOffsetNanosecondsFor(
-          this.#id,
-          instant.toString()
-        ),
+        tz !== undefined
+          ? NativeTemporalJSI.timeZoneGetOffsetNanosecondsForInterned!(
+              tz,
+              instant.toString()
+            )
+          : NativeTemporal.timeZoneGetOffsetNanosecondsFor(
+              this.#id,
+              instant.toString()
+            ),
       'Failed to get offset nanoseconds'
     );
   }
 
   getOffsetStringFor(instant: Instant): string {
+    const tz = this.#interned;
     return wrapNativeCall(
       () =>
-        NativeTemporal.timeZoneGetOffsetStringFor(this.#id, instant.toString()),
+        tz !== undefined
+          ? NativeTemporalJSI.timeZoneGetOffsetStringForInterned!(
+              tz,
+              instant.toString()
+            )
+          : NativeTemporal.timeZoneGetOffsetStringFor(
+              this.#id,
+              instant.toString()
+            ),
       'Failed to get offset string'
     );
   }
 
+  /**
+   * Converts many instants to ISO wall-clock fields in this time zone without
+   * a native call per instant.
+   */
+  getPlainDateTimesFor(instants: readonly Instant[]): PlainDateTimeColumns {
+    const pairs = new Array<number>(instants.length * 2);
+    for (let i = 0; i < instants.length; i++) {
+      const [seconds, nanoseconds] = epochNanosecondsToPair(
+        instants[i]!.epochNanoseconds
+      );
+      pairs[i * 2] = seconds;
+      pairs[i * 2 + 1] = nanoseconds;
+    }
+    const tz = this.#interned;
+    const flat = wrapNativeCall(
+      () =>
+        tz !== undefined
+          ? NativeTemporalJSI.timeZoneGetPlainDateTimesForManyInterned!(
+              tz,
+              pairs
+            )
+          : NativeTemporal.timeZoneGetPlainDateTimesForMany(this.#id, pairs),
+      'Failed to get plain date times'
+    );
+
+    const n = instants.length;
+    const buffer = Int32Array.from(flat);
+    const column = (index: number) =>
+      buffer.subarray(index * n, (index + 1) * n);
+    return {
+      length: n,
+      year: column(0),
+      month: column(1),
+      day: column(2),
+      hour: column(3),
+      minute: column(4),
+      second: column(5),
+      millisecond: column(6),
+      microsecond: column(7),
+      nanosecond: column(8),
+    };
+  }
+
   getPlainDateTimeFor(
     instant: Instant,
     calendarLike: string | Calendar = 'iso8601'
   ): PlainDateTime {
     const calendar = Calendar.from(calendarLike);
+    const tz = this.#interned;
+    const cal = internedCalendarId(calendar.id);
     const dtStr = wrapNativeCall(
       () =>
-        NativeTemporal.timeZoneGetPlainDateTimeFor(
-          this.#id,
-          instant.toString(),
-          calendar.id
-        ),
+        tz !== undefined && cal !== undefined
+          ? NativeTemporalJSI.timeZoneGetPlainDateTimeForInterned!(
+              tz,
+              instant.toString(),
+              cal
+            )
+          : NativeTemporal.timeZoneGetPlainDateTimeFor(
+              this.#id,
+              instant.toString(),
+              calendar.id
+            ),
       'Failed to get plain date time'
     );
     return PlainDateTime.from(dtStr);
@@ -71,39 +167,107 @@ export class TimeZone {
     options?: { disambiguation?: 'compatible' | 'earlier' | 'later' | 'reject' }
   ): Instant {
     const disambiguation = options?.disambiguation ?? 'compatible';
+    const tz = this.#interned;
     const instantStr = wrapNativeCall(
       () =>
-        NativeTemporal.timeZoneGetInstantFor(
-          this.#id,
-          dateTime.toString(),
-          disambiguation
-        ),
+        tz !== undefined
+          ? NativeTemporalJSI.timeZoneGetInstantForInterned!(
+              tz,
+              dateTime.toString(),
+              disambiguation
+            )
+          : NativeTemporal.timeZoneGetInstantFor(
+              this.#id,
+              dateTime.toString(),
+              disambiguation
+            ),
       'Failed to get instant'
     );
     return Instant.from(instantStr);
   }
 
   getNextTransition(instant: Instant): Instant | null {
+    const tz = this.#interned;
     const nextStr = wrapNativeCall(
       () =>
-        NativeTemporal.timeZoneGetNextTransition(this.#id, instant.toString()),
+        tz !== undefined
+          ? NativeTemporalJSI.timeZoneGetNextTransitionInterned!(
+              tz,
+              instant.toString()
+            )
+          : NativeTemporal.timeZoneGetNextTransition(
+              this.#id,
+              instant.toString()
+            ),
       'Failed to get next transition'
     );
     return nextStr ? Instant.from(nextStr) : null;
   }
 
   getPreviousTransition(instant: Instant): Instant | null {
+    const tz = this.#interned;
     const prevStr = wrapNativeCall(
       () =>
-        NativeTemporal.timeZoneGetPreviousTransition(
-          this.#id,
-          instant.toString()
-        ),
+        tz !== undefined
+          ? NativeTemporalJSI.timeZoneGetPreviousTransitionInterned!(
+              tz,
+              instant.toString()
+            )
+          : NativeTemporal.timeZoneGetPreviousTransition(
+              this.#id,
+              instant.toString()
+            ),
       'Failed to get previous transition'
     );
     return prevStr ? Instant.from(prevStr) : null;
   }
 
+  /**
+   * Returns every offset transition at or after `start` and before `end`,
+   * ascending. Zones without transitions (UTC, fixed offsets) return an
+   * empty array.
+   */
+  getTransitions(start: Instant, end: Instant): Instant[] {
+    const [endSeconds, endNanoseconds] = epochNanosecondsToPair(
+      end.epochNanoseconds
+    );
+    const tz = this.#interned;
+    const transitions: Instant[] = [];
+    let from = start.epochNanoseconds;
+    for (;;) {
+      const [seconds, nanoseconds] = epochNanosecondsToPair(from);
+      const pairs = wrapNativeCall(
+        () =>
+          tz !== undefined
+            ? NativeTemporalJSI.timeZoneGetTransitionsInterned!(
+                tz,
+                seconds,
+                nanoseconds,
+                endSeconds,
+                endNanoseconds,
+                TRANSITIONS_PAGE_SIZE
+              )
+            : NativeTemporal.timeZoneGetTransitions(
+                this.#id,
+                seconds,
+                nanoseconds,
+                endSeconds,
+                endNanoseconds,
+                TRANSITIONS_PAGE_SIZE
+              ),
+        'Failed to get transitions'
+      );
+      const page = epochNanosecondsFromPairs(pairs);
+      for (const ns of page) {
+        transitions.push(Instant.fromEpochNanoseconds(ns));
+      }
+      if (page.length < TRANSITIONS_PAGE_SIZE) {
+        return transitions;
+      }
+      from = page[page.length - 1]! + 1n;
+    }
+  }
+
   toString(): string {
     return this.#id;
   }
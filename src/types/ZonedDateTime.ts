@@ -1,5 +1,29 @@
-import NativeTemporal from '../NativeTemporal';
-import { wrapNativeCall } from '../utils';
+import NativeTemporal from '../native';
+import { ValueKind, isValidString } from '../validation';
+import { CompiledRoundingOptions, type RoundOptions } from '../rounding';
+import {
+  CompiledToStringOptions,
+  formatWithOptions,
+  type ToStringOptions,
+} from '../format';
+import {
+  binaryBytes,
+  singleBinaryRecord,
+  zonedDateTimeFromBytes,
+  zonedDateTimeToBytes,
+  type BinaryInput,
+} from '../binary';
+import {
+  applyPermutation,
+  epochNanosecondsFromPairs,
+  wrapNativeCall,
+} from '../utils';
+import { durationHandle, handlesSupported, trackHandle } from '../handles';
+import {
+  parseZonedDateTime,
+  zonedDateTimeComponents,
+  zonedOffsetNanoseconds,
+} from '../components';
 import { Calendar } from './Calendar';
 import { TimeZone } from './TimeZone';
 import { Duration } from './Duration';
@@ -8,15 +32,67 @@ import { PlainDate } from './PlainDate';
 import { PlainTime } from './PlainTime';
 import { PlainDateTime } from './PlainDateTime';
 
+const formatZonedDateTime = (iso: string, options: CompiledToStringOptions) =>
+  NativeTemporal.zonedDateTimeToStringWithPackedOptions(iso, options.packed);
+
 export class ZonedDateTime {
-  readonly #iso: string;
-  readonly #calendar: Calendar;
-  readonly #timeZone: TimeZone;
+  #isoString: string | undefined;
+  #handle: number | undefined;
+  // Resolved on first use for values parsed from strings
+  #calendar: Calendar | undefined;
+  #timeZone: TimeZone | undefined;
+  #components: ArrayLike<number> | undefined;
 
-  private constructor(iso: string, calendar: Calendar, timeZone: TimeZone) {
-    this.#iso = iso;
+  private constructor(
+    iso: string | undefined,
+    calendar?: Calendar,
+    timeZone?: TimeZone,
+    components?: ArrayLike<number>
+  ) {
+    this.#isoString = iso;
     this.#calendar = calendar;
     this.#timeZone = timeZone;
+    this.#components = components;
+  }
+
+  static #fromHandle(
+    handle: number,
+    calendar: Calendar | undefined,
+    timeZone: TimeZone | undefined
+  ): ZonedDateTime {
+    const zdt = new ZonedDateTime(undefined, calendar, timeZone);
+    zdt.#handle = trackHandle(zdt, handle);
+    return zdt;
+  }
+
+  /**
+   * The ISO string, formatted on first use for handle-backed values.
+   */
+  get #iso(): string {
+    if (this.#isoString === undefined) {
+      this.#isoString = wrapNativeCall(
+        () => NativeTemporal.handleToString(this.#handle!),
+        'Failed to format ZonedDateTime'
+      );
+    }
+    return this.#isoString;
+  }
+
+  /**
+   * The native handle, parsed on first use for string-backed values.
+   */
+  #nativeHandle(): number {
+    if (this.#handle === undefined) {
+      const iso = this.#isoString!;
+      this.#handle = trackHandle(
+        this,
+        wrapNativeCall(
+          () => NativeTemporal.zonedDateTimeHandleFromString(iso),
+          'Failed to create ZonedDateTime handle'
+        )
+      );
+    }
+    return this.#handle;
   }
 
   static from(item: string | ZonedDateTime): ZonedDateTime {
@@ -25,17 +101,11 @@ export class ZonedDateTime {
     }
 
     if (typeof item === 'string') {
-      const iso = wrapNativeCall(
-        () => NativeTemporal.zonedDateTimeFromString(item),
+      const [iso, components] = wrapNativeCall(
+        () => parseZonedDateTime(item),
         'Invalid ZonedDateTime string'
       );
-      const calendarId = NativeTemporal.zonedDateTimeGetCalendar(iso);
-      const timeZoneId = NativeTemporal.zonedDateTimeGetTimeZone(iso);
-      return new ZonedDateTime(
-        iso,
-        Calendar.from(calendarId),
-        TimeZone.from(timeZoneId)
-      );
+      return new ZonedDateTime(iso, undefined, undefined, components);
     }
 
     throw new TypeError(
@@ -43,6 +113,22 @@ export class ZonedDateTime {
     );
   }
 
+  /**
+   * Whether `ZonedDateTime.from` would accept `item`. Never throws; rejecting
+   * input costs one native call and allocates no error.
+   */
+  static isValid(item: string): boolean {
+    return isValidString(ValueKind.ZonedDateTime, item);
+  }
+
+  /**
+   * `ZonedDateTime.from` for strings, returning null instead of throwing;
+   * `lastValidationError()` explains a rejection.
+   */
+  static tryFrom(item: string): ZonedDateTime | null {
+    return ZonedDateTime.isValid(item) ? ZonedDateTime.from(item) : null;
+  }
+
   get year(): number {
     return this.#getComponent(0);
   }
@@ -113,7 +199,7 @@ export class ZonedDateTime {
     return this.#getComponent(17);
   }
   get offsetNanoseconds(): number {
-    return this.#getComponent(18);
+    return zonedOffsetNanoseconds(this.#allComponents());
   }
 
   get offset(): string {
@@ -131,30 +217,63 @@ export class ZonedDateTime {
   }
 
   get calendar(): Calendar {
+    if (this.#calendar === undefined) {
+      const iso = this.#iso;
+      this.#calendar = Calendar.from(
+        wrapNativeCall(
+          () => NativeTemporal.zonedDateTimeGetCalendar(iso),
+          'Failed to get ZonedDateTime calendar'
+        )
+      );
+    }
     return this.#calendar;
   }
   get timeZone(): TimeZone {
+    if (this.#timeZone === undefined) {
+      const iso = this.#iso;
+      // The native side returns an already-normalized identifier
+      this.#timeZone = new TimeZone(
+        wrapNativeCall(
+          () => NativeTemporal.zonedDateTimeGetTimeZone(iso),
+          'Failed to get ZonedDateTime time zone'
+        )
+      );
+    }
     return this.#timeZone;
   }
   get calendarId(): string {
-    return this.#calendar.id;
+    return this.calendar.id;
   }
   get timeZoneId(): string {
-    return this.#timeZone.id;
+    return this.timeZone.id;
   }
 
-  #components: number[] | null = null;
-  #getComponent(index: number): number {
-    if (!this.#components) {
-      this.#components = NativeTemporal.zonedDateTimeGetAllComponents(
-        this.#iso
+  #allComponents(): ArrayLike<number> {
+    if (this.#components === undefined) {
+      this.#components = wrapNativeCall(
+        () => zonedDateTimeComponents(this.#isoString, this.#handle),
+        'Failed to get ZonedDateTime components'
       );
     }
-    return this.#components[index]!;
+    return this.#components;
+  }
+  #getComponent(index: number): number {
+    return this.#allComponents()[index]!;
   }
 
   add(duration: Duration | string | object): ZonedDateTime {
     const d = Duration.from(duration);
+    if (handlesSupported) {
+      const handle = wrapNativeCall(
+        () =>
+          NativeTemporal.zonedDateTimeHandleAdd(
+            this.#nativeHandle(),
+            durationHandle(d)
+          ),
+        'Add failed'
+      );
+      return ZonedDateTime.#fromHandle(handle, this.#calendar, this.#timeZone);
+    }
     const newIso = wrapNativeCall(
       () => NativeTemporal.zonedDateTimeAdd(this.#iso, d.toString()),
       'Add failed'
@@ -164,6 +283,17 @@ export class ZonedDateTime {
 
   subtract(duration: Duration | string | object): ZonedDateTime {
     const d = Duration.from(duration);
+    if (handlesSupported) {
+      const handle = wrapNativeCall(
+        () =>
+          NativeTemporal.zonedDateTimeHandleSubtract(
+            this.#nativeHandle(),
+            durationHandle(d)
+          ),
+        'Subtract failed'
+      );
+      return ZonedDateTime.#fromHandle(handle, this.#calendar, this.#timeZone);
+    }
     const newIso = wrapNativeCall(
       () => NativeTemporal.zonedDateTimeSubtract(this.#iso, d.toString()),
       'Subtract failed'
@@ -187,19 +317,21 @@ export class ZonedDateTime {
     return Duration.from(durStr);
   }
 
-  round(options: {
-    smallestUnit: string;
-    roundingIncrement?: number;
-    roundingMode?: string;
-  }): ZonedDateTime {
+  round(options: RoundOptions | CompiledRoundingOptions): ZonedDateTime {
+    const { packed } = CompiledRoundingOptions.from(options);
+    if (handlesSupported) {
+      const handle = wrapNativeCall(
+        () =>
+          NativeTemporal.zonedDateTimeHandleRoundWithOptions(
+            this.#nativeHandle(),
+            packed
+          ),
+        'Round failed'
+      );
+      return ZonedDateTime.#fromHandle(handle, this.#calendar, this.#timeZone);
+    }
     const newIso = wrapNativeCall(
-      () =>
-        NativeTemporal.zonedDateTimeRound(
-          this.#iso,
-          options.smallestUnit,
-          options.roundingIncrement ?? 1,
-          options.roundingMode ?? null
-        ),
+      () => NativeTemporal.zonedDateTimeRoundWithOptions(this.#iso, packed),
       'Round failed'
     );
     return this.#clone(newIso);
@@ -224,6 +356,32 @@ export class ZonedDateTime {
   ): ZonedDateTime {
     const MIN = Number.MIN_SAFE_INTEGER;
 
+    if (handlesSupported) {
+      const handle = wrapNativeCall(
+        () =>
+          NativeTemporal.zonedDateTimeHandleWith(
+            this.#nativeHandle(),
+            fields.year ?? MIN,
+            fields.month ?? MIN,
+            fields.day ?? MIN,
+            fields.hour ?? MIN,
+            fields.minute ?? MIN,
+            fields.second ?? MIN,
+            fields.millisecond ?? MIN,
+            fields.microsecond ?? MIN,
+            fields.nanosecond ?? MIN,
+            fields.calendar ? fields.calendar.toString() : null,
+            fields.timeZone ? fields.timeZone.toString() : null
+          ),
+        'With failed'
+      );
+      return ZonedDateTime.#fromHandle(
+        handle,
+        fields.calendar ? Calendar.from(fields.calendar) : this.#calendar,
+        fields.timeZone ? TimeZone.from(fields.timeZone) : this.#timeZone
+      );
+    }
+
     const newIso = wrapNativeCall(
       () =>
         NativeTemporal.zonedDateTimeWith(
@@ -282,8 +440,20 @@ export class ZonedDateTime {
     return PlainDateTime.from(s);
   }
 
-  toString(_options?: any): string {
-    return this.#iso;
+  /**
+   * Returns the ISO 8601 string, rounded and annotated as requested by
+   * `options`. Repeated calls with the same value and options are cached.
+   */
+  toString(options?: ToStringOptions | CompiledToStringOptions): string {
+    if (options === undefined) {
+      return this.#iso;
+    }
+    return formatWithOptions(
+      'ZonedDateTime',
+      this.#iso,
+      CompiledToStringOptions.from(options),
+      formatZonedDateTime
+    );
   }
 
   equals(other: ZonedDateTime | string): boolean {
@@ -295,20 +465,109 @@ export class ZonedDateTime {
     return this.toString();
   }
 
+  /**
+   * Encodes the exact time, time zone and calendar as a fixed 24-byte
+   * record, for storage or transfer. Zones outside the built-in IANA table
+   * and unknown calendars throw a RangeError.
+   */
+  toBytes(): Uint8Array {
+    return new Uint8Array(
+      wrapNativeCall(
+        () => zonedDateTimeToBytes([this.#iso]),
+        'Failed to encode ZonedDateTime'
+      )
+    );
+  }
+
+  /**
+   * Decodes a record written by `toBytes`.
+   */
+  static fromBytes(bytes: BinaryInput): ZonedDateTime {
+    return ZonedDateTime.fromBytesMany(singleBinaryRecord(bytes))[0]!;
+  }
+
   static compare(one: ZonedDateTime, two: ZonedDateTime): -1 | 0 | 1 {
+    if (one.#handle !== undefined && two.#handle !== undefined) {
+      return NativeTemporal.handleCompare(one.#handle, two.#handle) as
+        | -1
+        | 0
+        | 1;
+    }
     return NativeTemporal.zonedDateTimeCompare(
       one.toString(),
       two.toString()
     ) as -1 | 0 | 1;
   }
 
-  #clone(iso: string): ZonedDateTime {
-    const calendarId = NativeTemporal.zonedDateTimeGetCalendar(iso);
-    const timeZoneId = NativeTemporal.zonedDateTimeGetTimeZone(iso);
-    return new ZonedDateTime(
-      iso,
-      Calendar.from(calendarId),
-      TimeZone.from(timeZoneId)
+  /**
+   * Sorts by exact time in ascending order with a single native call. The
+   * sort is stable and returns a new array of the same ZonedDateTime objects.
+   */
+  static sort(items: readonly ZonedDateTime[]): ZonedDateTime[] {
+    const permutation = wrapNativeCall(
+      () => NativeTemporal.zonedDateTimeSort(items.map((item) => item.#iso)),
+      'Failed to sort zoned date times'
+    );
+    return applyPermutation(items, permutation);
+  }
+
+  /**
+   * Compares `one[i]` with `two[i]` for every index with a single native call.
+   */
+  static compareMany(
+    one: readonly ZonedDateTime[],
+    two: readonly ZonedDateTime[]
+  ): (-1 | 0 | 1)[] {
+    if (one.length !== two.length) {
+      throw new RangeError(
+        'ZonedDateTime.compareMany requires arrays of equal length'
+      );
+    }
+    return wrapNativeCall(
+      () =>
+        NativeTemporal.zonedDateTimeCompareMany(
+          one.map((item) => item.#iso),
+          two.map((item) => item.#iso)
+        ),
+      'Failed to compare zoned date times'
+    ) as (-1 | 0 | 1)[];
+  }
+
+  /**
+   * Returns the epoch nanoseconds of every item with a single native call.
+   */
+  static epochNanosecondsMany(items: readonly ZonedDateTime[]): bigint[] {
+    const pairs = wrapNativeCall(
+      () =>
+        NativeTemporal.zonedDateTimeParseMany(items.map((item) => item.#iso)),
+      'Failed to get epoch nanoseconds'
+    );
+    return epochNanosecondsFromPairs(pairs);
+  }
+
+  /**
+   * Encodes every item into one buffer of consecutive `toBytes` records,
+   * with a single native call when the JSI bindings are installed.
+   */
+  static toBytesMany(items: readonly ZonedDateTime[]): ArrayBuffer {
+    return wrapNativeCall(
+      () => zonedDateTimeToBytes(items.map((item) => item.#iso)),
+      'Failed to encode zoned date times'
+    );
+  }
+
+  /**
+   * Decodes a buffer of consecutive records written by `toBytesMany`.
+   */
+  static fromBytesMany(bytes: BinaryInput): ZonedDateTime[] {
+    const isos = wrapNativeCall(
+      () => zonedDateTimeFromBytes(binaryBytes(bytes)),
+      'Failed to decode zoned date times'
     );
+    return isos.map((iso) => new ZonedDateTime(iso));
+  }
+
+  #clone(iso: string): ZonedDateTime {
+    return new ZonedDateTime(iso);
   }
 }
@@ -0,0 +1,598 @@
+/**
+ * Pure-JS arithmetic for ISO-calendar dates, times and time-only durations.
+ *
+ * The types call into these helpers before crossing into native. Every
+ * helper returns `undefined` when the operation is outside what it covers
+ * (non-ISO data, results at or past the representable limits, unsafe
+ * integers), in which case the caller falls back to NativeTemporal so
+ * errors and edge cases keep the native behaviour.
+ */
+
+export type IsoDate = [year: number, month: number, day: number];
+
+export type IsoTime = [
+  hour: number,
+  minute: number,
+  second: number,
+  millisecond: number,
+  microsecond: number,
+  nanosecond: number,
+];
+
+/**
+ * Duration fields from years down to nanoseconds.
+ */
+export type DurationFields = [
+  years: number,
+  months: number,
+  weeks: number,
+  days: number,
+  hours: number,
+  minutes: number,
+  seconds: number,
+  milliseconds: number,
+  microseconds: number,
+  nanoseconds: number,
+];
+
+let forceNative = false;
+
+/**
+ * Routes every operation through NativeTemporal, e.g. to check the JS fast
+ * paths against the native implementation.
+ */
+export const setForceNativeArithmetic = (force: boolean): void => {
+  forceNative = force;
+};
+
+export const jsArithmeticEnabled = (): boolean => !forceNative;
+
+/**
+ * Canonical ISO strings carry a bracketed annotation for any calendar other
+ * than iso8601.
+ */
+export const isIsoCalendarString = (iso: string): boolean =>
+  !iso.includes('[');
+
+// ============================================================================
+// Calendar maths
+// ============================================================================
+
+// Dates strictly inside -271821-04-19 .. +275760-09-13; the limit days
+// themselves are left to native so range errors match exactly.
+const MIN_EPOCH_DAYS = -100_000_001;
+const MAX_EPOCH_DAYS = 100_000_000;
+
+const NS_PER_DAY = 86_400_000_000_000n;
+
+// Nanoseconds per duration field from days down
+const UNIT_NANOSECONDS = [
+  NS_PER_DAY,
+  3_600_000_000_000n,
+  60_000_000_000n,
+  1_000_000_000n,
+  1_000_000n,
+  1_000n,
+  1n,
+];
+const DAYS_INDEX = 3;
+
+const floorMod = (a: number, b: number): number => ((a % b) + b) % b;
+
+const isLeapYear = (year: number): boolean =>
+  year % 4 === 0 && (year % 100 !== 0 || year % 400 === 0);
+
+const daysInMonth = (year: number, month: number): number =>
+  month === 2
+    ? isLeapYear(year)
+      ? 29
+      : 28
+    : month === 4 || month === 6 || month === 9 || month === 11
+      ? 30
+      : 31;
+
+/**
+ * Days since 1970-01-01 for a proleptic Gregorian date.
+ */
+const epochDaysFromIso = (
+  year: number,
+  month: number,
+  day: number
+): number => {
+  const y = month <= 2 ? year - 1 : year;
+  const era = Math.floor(y / 400);
+  const yoe = y - era * 400;
+  const mp = (month + 9) % 12;
+  const doy = Math.floor((153 * mp + 2) / 5) + day - 1;
+  const doe = yoe * 365 + Math.floor(yoe / 4) - Math.floor(yoe / 100) + doy;
+  return era * 146_097 + doe - 719_468;
+};
+
+/**
+ * The proleptic Gregorian date `epochDays` days after 1970-01-01.
+ */
+export const isoFromEpochDays = (epochDays: number): IsoDate => {
+  const z = epochDays + 719_468;
+  const era = Math.floor(z / 146_097);
+  const doe = z - era * 146_097;
+  const yoe = Math.floor(
+    (doe -
+      Math.floor(doe / 1460) +
+      Math.floor(doe / 36_524) -
+      Math.floor(doe / 146_096)) /
+      365
+  );
+  const doy = doe - (365 * yoe + Math.floor(yoe / 4) - Math.floor(yoe / 100));
+  const mp = Math.floor((5 * doy + 2) / 153);
+  const day = doy - Math.floor((153 * mp + 2) / 5) + 1;
+  const month = mp < 10 ? mp + 3 : mp - 9;
+  const year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+  return [year, month, day];
+};
+
+const inRange = (epochDays: number): boolean =>
+  epochDays > MIN_EPOCH_DAYS && epochDays < MAX_EPOCH_DAYS;
+
+const weeksInYear = (year: number): number => {
+  const p = (y: number) =>
+    floorMod(
+      y + Math.floor(y / 4) - Math.floor(y / 100) + Math.floor(y / 400),
+      7
+    );
+  return p(year) === 4 || p(year - 1) === 3 ? 53 : 52;
+};
+
+/**
+ * The PlainDate component array (see PlainDate's ComponentIndex) for an ISO
+ * date, so JS-computed results never need a native component fetch.
+ */
+export const isoDateComponents = ([year, month, day]: IsoDate): number[] => {
+  const epochDays = epochDaysFromIso(year, month, day);
+  const dayOfWeek = floorMod(epochDays + 3, 7) + 1;
+  const dayOfYear = epochDays - epochDaysFromIso(year, 1, 1) + 1;
+  let weekOfYear = Math.floor((dayOfYear - dayOfWeek + 10) / 7);
+  let yearOfWeek = year;
+  if (weekOfYear < 1) {
+    yearOfWeek = year - 1;
+    weekOfYear = weeksInYear(yearOfWeek);
+  } else if (weekOfYear > weeksInYear(year)) {
+    yearOfWeek = year + 1;
+    weekOfYear = 1;
+  }
+  const leap = isLeapYear(year);
+  return [
+    year,
+    month,
+    day,
+    dayOfWeek,
+    dayOfYear,
+    weekOfYear,
+    yearOfWeek,
+    7,
+    daysInMonth(year, month),
+    leap ? 366 : 365,
+    12,
+    leap ? 1 : 0,
+  ];
+};
+
+// ============================================================================
+// Formatting and reading canonical strings
+// ============================================================================
+
+const pad = (value: number, width: number): string =>
+  String(value).padStart(width, '0');
+
+export const formatIsoDate = ([year, month, day]: IsoDate): string => {
+  const y =
+    year >= 0 && year <= 9999
+      ? pad(year, 4)
+      : (year < 0 ? '-' : '+') + pad(Math.abs(year), 6);
+  return `${y}-${pad(month, 2)}-${pad(day, 2)}`;
+};
+
+const formatFraction = (nanoseconds: number): string =>
+  nanoseconds === 0 ? '' : '.' + pad(nanoseconds, 9).replace(/0+$/, '');
+
+export const formatIsoTime = (time: IsoTime): string => {
+  const [hour, minute, second, ms, us, ns] = time;
+  return (
+    `${pad(hour, 2)}:${pad(minute, 2)}:${pad(second, 2)}` +
+    formatFraction(ms * 1_000_000 + us * 1_000 + ns)
+  );
+};
+
+export const formatIsoDateTime = (date: IsoDate, time: IsoTime): string =>
+  `${formatIsoDate(date)}T${formatIsoTime(time)}`;
+
+/**
+ * Reads the date from the start of a canonical ISO string.
+ */
+export const isoDateFromString = (iso: string): IsoDate => {
+  const extended = iso[0] === '+' || iso[0] === '-';
+  const yearEnd = extended ? 7 : 4;
+  return [
+    Number(iso.slice(0, yearEnd)),
+    Number(iso.slice(yearEnd + 1, yearEnd + 3)),
+    Number(iso.slice(yearEnd + 4, yearEnd + 6)),
+  ];
+};
+
+/**
+ * Reads the time from a canonical `HH:MM:SS[.fraction]` string starting at
+ * `start`.
+ */
+export const isoTimeFromString = (iso: string, start = 0): IsoTime => {
+  let end = start + 8;
+  let fraction = 0;
+  if (iso[end] === '.') {
+    let digits = '';
+    end++;
+    while (end < iso.length && iso[end]! >= '0' && iso[end]! <= '9') {
+      digits += iso[end];
+      end++;
+    }
+    fraction = Number(digits.padEnd(9, '0'));
+  }
+  return [
+    Number(iso.slice(start, start + 2)),
+    Number(iso.slice(start + 3, start + 5)),
+    Number(iso.slice(start + 6, start + 8)),
+    Math.floor(fraction / 1_000_000),
+    Math.floor(fraction / 1_000) % 1_000,
+    fraction % 1_000,
+  ];
+};
+
+/**
+ * Reads the date and time from a canonical PlainDateTime string.
+ */
+export const isoDateTimeFromString = (iso: string): [IsoDate, IsoTime] => {
+  const separator = iso.indexOf('T');
+  return [isoDateFromString(iso), isoTimeFromString(iso, separator + 1)];
+};
+
+/**
+ * Lexicographic order matches chronological order for canonical strings
+ * with four-digit years, because every field is zero-padded and fractions
+ * have their trailing zeros trimmed.
+ */
+export const compareCanonicalStrings = (
+  a: string,
+  b: string
+): -1 | 0 | 1 | undefined => {
+  if (a[0] === '+' || a[0] === '-' || b[0] === '+' || b[0] === '-') {
+    return undefined;
+  }
+  return a < b ? -1 : a > b ? 1 : 0;
+};
+
+// ============================================================================
+// Durations
+// ============================================================================
+
+const MAX_CALENDAR_UNIT = 2 ** 32;
+const MAX_TIME_SECONDS = BigInt(Number.MAX_SAFE_INTEGER) + 1n;
+
+const fieldNanoseconds = (fields: DurationFields): bigint => {
+  let total = 0n;
+  for (let i = DAYS_INDEX; i < 10; i++) {
+    total += BigInt(fields[i]!) * UNIT_NANOSECONDS[i - DAYS_INDEX]!;
+  }
+  return total;
+};
+
+export const durationSign = (fields: DurationFields): -1 | 0 | 1 => {
+  for (const value of fields) {
+    if (value !== 0) {
+      return value < 0 ? -1 : 1;
+    }
+  }
+  return 0;
+};
+
+/**
+ * Checks the Temporal duration limits: integral fields of one sign, calendar
+ * units below 2^32 and a time part below 2^53 seconds.
+ */
+export const isValidDuration = (fields: DurationFields): boolean => {
+  if (!fields.every(Number.isSafeInteger)) {
+    return false;
+  }
+  const sign = durationSign(fields);
+  if (fields.some((value) => value !== 0 && Math.sign(value) !== sign)) {
+    return false;
+  }
+  if (
+    Math.abs(fields[0]) >= MAX_CALENDAR_UNIT ||
+    Math.abs(fields[1]) >= MAX_CALENDAR_UNIT ||
+    Math.abs(fields[2]) >= MAX_CALENDAR_UNIT
+  ) {
+    return false;
+  }
+  const total = fieldNanoseconds(fields);
+  const seconds = (total < 0n ? -total : total) / 1_000_000_000n;
+  return seconds < MAX_TIME_SECONDS;
+};
+
+/**
+ * The Duration component array (see Duration's ComponentIndex).
+ */
+export const durationComponents = (fields: DurationFields): number[] => {
+  const sign = durationSign(fields);
+  return [...fields, sign, sign === 0 ? 1 : 0];
+};
+
+export const formatDuration = (fields: DurationFields): string => {
+  const sign = durationSign(fields);
+  const [years, months, weeks, days, hours, minutes] = fields.map(Math.abs);
+  let date = '';
+  if (years) date += `${years}Y`;
+  if (months) date += `${months}M`;
+  if (weeks) date += `${weeks}W`;
+  if (days) date += `${days}D`;
+
+  let time = '';
+  if (hours) time += `${hours}H`;
+  if (minutes) time += `${minutes}M`;
+  let subsecond =
+    BigInt(fields[6]) * 1_000_000_000n +
+    BigInt(fields[7]) * 1_000_000n +
+    BigInt(fields[8]) * 1_000n +
+    BigInt(fields[9]);
+  if (subsecond < 0n) {
+    subsecond = -subsecond;
+  }
+  if (subsecond !== 0n || (!date && !time)) {
+    time +=
+      String(subsecond / 1_000_000_000n) +
+      formatFraction(Number(subsecond % 1_000_000_000n)) +
+      'S';
+  }
+  return `${sign < 0 ? '-' : ''}P${date}${time ? `T${time}` : ''}`;
+};
+
+/**
+ * Splits a nanosecond total into duration fields, with `largestIndex` the
+ * index of the largest unit to fill (days through nanoseconds).
+ */
+const balanceNanoseconds = (
+  total: bigint,
+  largestIndex: number
+): DurationFields | undefined => {
+  const fields: DurationFields = [0, 0, 0, 0, 0, 0, 0, 0, 0, 0];
+  let remainder = total;
+  for (let i = largestIndex; i < 10; i++) {
+    const size = UNIT_NANOSECONDS[i - DAYS_INDEX]!;
+    const value = Number(remainder / size);
+    if (!Number.isSafeInteger(value)) {
+      return undefined;
+    }
+    fields[i] = value + 0;
+    remainder %= size;
+  }
+  return fields;
+};
+
+/**
+ * Duration.add/subtract without relativeTo for durations that have no
+ * years, months or weeks. Days count as 24 hours, as in the spec.
+ */
+export const addDurations = (
+  one: DurationFields,
+  two: DurationFields,
+  sign: 1 | -1
+): DurationFields | undefined => {
+  if (
+    !one.every(Number.isSafeInteger) ||
+    !two.every(Number.isSafeInteger) ||
+    one[0] ||
+    one[1] ||
+    one[2] ||
+    two[0] ||
+    two[1] ||
+    two[2]
+  ) {
+    return undefined;
+  }
+  const largestOf = (fields: DurationFields) => {
+    const index = fields.findIndex((value) => value !== 0);
+    return index === -1 ? 9 : index;
+  };
+  const total = fieldNanoseconds(one) + BigInt(sign) * fieldNanoseconds(two);
+  const result = balanceNanoseconds(
+    total,
+    Math.min(largestOf(one), largestOf(two))
+  );
+  return result && isValidDuration(result) ? result : undefined;
+};
+
+// ============================================================================
+// Date and time arithmetic
+// ============================================================================
+
+const hasTimeFields = (d: DurationFields): boolean =>
+  d[4] !== 0 ||
+  d[5] !== 0 ||
+  d[6] !== 0 ||
+  d[7] !== 0 ||
+  d[8] !== 0 ||
+  d[9] !== 0;
+
+/**
+ * Adds years and months with day constraining, then weeks and days, in the
+ * order the ISO calendar prescribes.
+ */
+const addDateFields = (
+  [year, month, day]: IsoDate,
+  d: DurationFields,
+  extraDays: number
+): IsoDate | undefined => {
+  const monthIndex = month - 1 + d[1];
+  const y = year + d[0] + Math.floor(monthIndex / 12);
+  const m = floorMod(monthIndex, 12) + 1;
+  const epochDays =
+    epochDaysFromIso(y, m, Math.min(day, daysInMonth(y, m))) +
+    d[2] * 7 +
+    d[3] +
+    extraDays;
+  return inRange(epochDays) ? isoFromEpochDays(epochDays) : undefined;
+};
+
+/**
+ * PlainDate.add with the default `constrain` overflow. Durations with time
+ * fields are left to native, which balances them into days.
+ */
+export const addIsoDate = (
+  date: IsoDate,
+  d: DurationFields
+): IsoDate | undefined => {
+  if (!d.every(Number.isSafeInteger) || hasTimeFields(d)) {
+    return undefined;
+  }
+  return addDateFields(date, d, 0);
+};
+
+const timeNanoseconds = (time: IsoTime): bigint =>
+  BigInt(
+    ((time[0] * 60 + time[1]) * 60 + time[2]) * 1e9 +
+      time[3] * 1e6 +
+      time[4] * 1e3 +
+      time[5]
+  );
+
+const timeFromNanoseconds = (nanoseconds: number): IsoTime => [
+  Math.floor(nanoseconds / 3_600_000_000_000),
+  Math.floor(nanoseconds / 60_000_000_000) % 60,
+  Math.floor(nanoseconds / 1_000_000_000) % 60,
+  Math.floor(nanoseconds / 1_000_000) % 1_000,
+  Math.floor(nanoseconds / 1_000) % 1_000,
+  nanoseconds % 1_000,
+];
+
+const durationTimeNanoseconds = (d: DurationFields): bigint =>
+  BigInt(d[4]) * 3_600_000_000_000n +
+  BigInt(d[5]) * 60_000_000_000n +
+  BigInt(d[6]) * 1_000_000_000n +
+  BigInt(d[7]) * 1_000_000n +
+  BigInt(d[8]) * 1_000n +
+  BigInt(d[9]);
+
+/**
+ * PlainTime.add: the time part of the duration wraps around midnight and
+ * the date part is ignored.
+ */
+export const addIsoTime = (
+  time: IsoTime,
+  d: DurationFields
+): IsoTime | undefined => {
+  if (!d.every(Number.isSafeInteger)) {
+    return undefined;
+  }
+  let total =
+    (timeNanoseconds(time) + durationTimeNanoseconds(d)) % NS_PER_DAY;
+  if (total < 0n) {
+    total += NS_PER_DAY;
+  }
+  return timeFromNanoseconds(Number(total));
+};
+
+/**
+ * PlainDateTime.add with the default `constrain` overflow: the time part
+ * carries whole days into the date part.
+ */
+export const addIsoDateTime = (
+  date: IsoDate,
+  time: IsoTime,
+  d: DurationFields
+): [IsoDate, IsoTime] | undefined => {
+  if (!d.every(Number.isSafeInteger)) {
+    return undefined;
+  }
+  const total = timeNanoseconds(time) + durationTimeNanoseconds(d);
+  let carry = total / NS_PER_DAY;
+  let remainder = total % NS_PER_DAY;
+  if (remainder < 0n) {
+    carry -= 1n;
+    remainder += NS_PER_DAY;
+  }
+  const carryDays = Number(carry);
+  if (!Number.isSafeInteger(carryDays)) {
+    return undefined;
+  }
+  const resultDate = addDateFields(date, d, carryDays);
+  return resultDate
+    ? [resultDate, timeFromNanoseconds(Number(remainder))]
+    : undefined;
+};
+
+/**
+ * Compares component arrays field by field at `indices`.
+ */
+export const compareFields = (
+  a: ArrayLike<number>,
+  b: ArrayLike<number>,
+  indices: readonly number[]
+): -1 | 0 | 1 => {
+  for (const i of indices) {
+    if (a[i]! !== b[i]!) {
+      return a[i]! < b[i]! ? -1 : 1;
+    }
+  }
+  return 0;
+};
+
+/**
+ * PlainDate.until with the default `day` largest unit.
+ */
+export const isoDateUntil = (one: IsoDate, two: IsoDate): DurationFields => {
+  const days =
+    epochDaysFromIso(two[0], two[1], two[2]) -
+    epochDaysFromIso(one[0], one[1], one[2]);
+  return [0, 0, 0, days + 0, 0, 0, 0, 0, 0, 0];
+};
+
+/**
+ * PlainTime.until with the default `hour` largest unit and no rounding.
+ */
+export const isoTimeUntil = (one: IsoTime, two: IsoTime): DurationFields =>
+  balanceNanoseconds(timeNanoseconds(two) - timeNanoseconds(one), 4)!;
+
+/**
+ * PlainDateTime.until with the default `day` largest unit and no rounding.
+ */
+export const isoDateTimeUntil = (
+  oneDate: IsoDate,
+  oneTime: IsoTime,
+  twoDate: IsoDate,
+  twoTime: IsoTime
+): DurationFields => {
+  const days =
+    epochDaysFromIso(twoDate[0], twoDate[1], twoDate[2]) -
+    epochDaysFromIso(oneDate[0], oneDate[1], oneDate[2]);
+  const total =
+    BigInt(days) * NS_PER_DAY +
+    timeNanoseconds(twoTime) -
+    timeNanoseconds(oneTime);
+  return balanceNanoseconds(total, DAYS_INDEX)!;
+};
+
+export const negateDuration = (fields: DurationFields): DurationFields =>
+  fields.map((value) => 0 - value) as DurationFields;
+
+/**
+ * True when until/since options ask for nothing beyond the defaults the JS
+ * paths implement.
+ */
+export const isDefaultDifference = (options?: {
+  largestUnit?: string;
+  smallestUnit?: string;
+  roundingIncrement?: number;
+  roundingMode?: string;
+}): boolean =>
+  options === undefined ||
+  (options.largestUnit === undefined &&
+    options.smallestUnit === undefined &&
+    (options.roundingIncrement === undefined ||
+      options.roundingIncrement === 1) &&
+    options.roundingMode === undefined);
@@ -1,3 +1,32 @@
+/**
+ * Maps an error from native code to the TC39 Temporal error type.
+ */
+const toTemporalError = (error: unknown, context: string): Error => {
+  if (error instanceof Error) {
+    let message = error.message || '';
+
+    // Strip React Native's "Exception in HostFunction: " prefix
+    message = message.replace(/^Exception in HostFunction:\s*/i, '');
+
+    // Check for error type markers
+    const isTypeError =
+      error.name === 'TypeError' ||
+      (error as { code?: unknown }).code === 'TypeError' ||
+      message.startsWith('[TypeError]') ||
+      message.toLowerCase().includes('cannot be null') ||
+      message.toLowerCase().includes('type error');
+
+    // Clean up any [ErrorType] prefix from the message
+    message = message.replace(/^\[(RangeError|TypeError)\]\s*/i, '');
+
+    if (isTypeError) {
+      return new TypeError(message || context);
+    }
+    return new RangeError(message || context);
+  }
+  return new RangeError(context);
+};
+
 /**
  * Wraps a native call and ensures proper TC39 Temporal error types are thrown.
  * Native exceptions come through as generic Errors, so we re-throw
@@ -7,27 +36,64 @@ export const wrapNativeCall = <T>(fn: () => T, context: string): T => {
   try {
     return fn();
   } catch (error) {
-    if (error instanceof Error) {
-      let message = error.message || '';
-
-      // Strip React Native's "Exception in HostFunction: " prefix
-      message = message.replace(/^Exception in HostFunction:\s*/i, '');
-
-      // Check for error type markers
-      const isTypeError =
-        error.name === 'TypeError' ||
-        message.startsWith('[TypeError]') ||
-        message.toLowerCase().includes('cannot be null') ||
-        message.toLowerCase().includes('type error');
-
-      // Clean up any [ErrorType] prefix from the message
-      message = message.replace(/^\[(RangeError|TypeError)\]\s*/i, '');
-
-      if (isTypeError) {
-        throw new TypeError(message || context);
-      }
-      throw new RangeError(message || context);
-    }
-    throw new RangeError(context);
+    throw toTemporalError(error, context);
+  }
+};
+
+/**
+ * The async counterpart of wrapNativeCall for Promise-returning native
+ * methods, whose rejections carry the error name in `code`.
+ */
+export const wrapNativePromise = async <T>(
+  fn: () => Promise<T>,
+  context: string
+): Promise<T> => {
+  try {
+    return await fn();
+  } catch (error) {
+    throw toTemporalError(error, context);
+  }
+};
+
+/**
+ * Returns `items` reordered by a sort permutation from a native batch call.
+ */
+export const applyPermutation = <T>(
+  items: readonly T[],
+  permutation: number[]
+): T[] => permutation.map((index) => items[index]!);
+
+/**
+ * Converts flat [seconds, nanoseconds] pairs from a native batch call into
+ * epoch nanoseconds.
+ */
+export const epochNanosecondsFromPairs = (pairs: number[]): bigint[] => {
+  const result = new Array<bigint>(pairs.length / 2);
+  for (let i = 0; i < result.length; i++) {
+    result[i] =
+      BigInt(pairs[i * 2]!) * 1_000_000_000n + BigInt(pairs[i * 2 + 1]!);
+  }
+  return result;
+};
+
+/**
+ * Combines a native [seconds, nanoseconds] pair into epoch nanoseconds.
+ */
+export const epochNanosecondsFromPair = (pair: readonly number[]): bigint =>
+  BigInt(pair[0]!) * 1_000_000_000n + BigInt(pair[1]!);
+
+/**
+ * Splits epoch nanoseconds into the [seconds, nanoseconds] pair native calls
+ * expect. Seconds are floored so the nanosecond part is always in [0, 1e9).
+ */
+export const epochNanosecondsToPair = (
+  epochNanoseconds: bigint
+): [number, number] => {
+  let seconds = epochNanoseconds / 1_000_000_000n;
+  let nanoseconds = epochNanoseconds % 1_000_000_000n;
+  if (nanoseconds < 0n) {
+    seconds -= 1n;
+    nanoseconds += 1_000_000_000n;
   }
+  return [Number(seconds), Number(nanoseconds)];
 };
@@ -0,0 +1,32 @@
+import NativeTemporal from './native';
+
+/**
+ * Mirrors `TemporalValueKind` in temporal_rn.h.
+ */
+export const ValueKind = {
+  Instant: 0,
+  Duration: 1,
+  PlainTime: 2,
+  PlainDate: 3,
+  PlainDateTime: 4,
+  PlainYearMonth: 5,
+  PlainMonthDay: 6,
+  ZonedDateTime: 7,
+} as const;
+
+export type ValueKind = (typeof ValueKind)[keyof typeof ValueKind];
+
+/**
+ * Whether `from` would accept `s`. One native call that returns a status
+ * code, so rejecting input raises no exception and formats no message.
+ */
+export const isValidString = (kind: ValueKind, s: unknown): boolean =>
+  typeof s === 'string' && NativeTemporal.validate(kind, s) === 0;
+
+/**
+ * Explains why the last failed `isValid` / `tryFrom` call rejected its
+ * input, or returns null. The message is only formatted when asked for.
+ */
+export function lastValidationError(): string | null {
+  return NativeTemporal.lastErrorMessage();
+}